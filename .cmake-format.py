@@ -388,12 +388,14 @@ with section("parse"):
                                   'THREADS_PER_LOCALITY': 1,
                                   'NO_PARCELPORT_TCP': 1,
                                   'NO_PARCELPORT_MPI': 1,
-                                  'NO_PARCELPORT_LCI': 1},
+                                  'NO_PARCELPORT_LCI': 1,
+                                  'NO_PARCELPORT_SHMEM': 1},
                       'pargs': {'flags': ['FAILURE_EXPECTED',
                                           'RUN_SERIAL',
                                           'NO_PARCELPORT_TCP',
                                           'NO_PARCELPORT_LCI',
-                                          'NO_PARCELPORT_MPI'],
+                                          'NO_PARCELPORT_MPI',
+                                          'NO_PARCELPORT_SHMEM'],
                                 'nargs': '2+'}},
     'add_hpx_test_target_dependencies': { 'kwargs': {'PSEUDO_DEPS_NAME': 1},
                                           'pargs': {'flags': [], 'nargs': '2+'}},
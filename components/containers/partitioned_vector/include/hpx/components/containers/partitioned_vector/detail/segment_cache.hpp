@@ -0,0 +1,96 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/detail/segment_cache.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \cond NOINTERNAL
+namespace hpx { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Read-through cache holding copies of the remote segments of a
+    // partitioned_vector. A segment is fetched as a whole the first time one
+    // of its elements is read, concurrent readers share the same request.
+    // The cached copies are not kept coherent with the remote segments, they
+    // have to be invalidated explicitly.
+    template <typename Data>
+    class segment_cache
+    {
+        using mutex_type = hpx::spinlock;
+
+    public:
+        explicit segment_cache(std::size_t num_segments)
+          : segments_(num_segments)
+        {
+        }
+
+        segment_cache(segment_cache const&) = delete;
+        segment_cache& operator=(segment_cache const&) = delete;
+
+        // Return the cached copy of the given segment, invoke 'fetch' to
+        // retrieve the segment if it is not cached yet.
+        template <typename F>
+        hpx::shared_future<Data> get(std::size_t segment, F&& fetch)
+        {
+            HPX_ASSERT(segment < segments_.size());
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (segments_[segment].valid())
+                {
+                    return segments_[segment];
+                }
+            }
+
+            // do not hold the lock while sending the request
+            hpx::shared_future<Data> f = fetch();
+
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!segments_[segment].valid())
+            {
+                segments_[segment] = HPX_MOVE(f);
+            }
+            return segments_[segment];
+        }
+
+        void invalidate(std::size_t segment)
+        {
+            HPX_ASSERT(segment < segments_.size());
+
+            hpx::shared_future<Data> f;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                std::swap(f, segments_[segment]);
+            }
+        }
+
+        void invalidate()
+        {
+            std::vector<hpx::shared_future<Data>> segments(segments_.size());
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                std::swap(segments, segments_);
+            }
+        }
+
+    private:
+        mutex_type mtx_;
+        std::vector<hpx::shared_future<Data>> segments_;
+    };
+}}    // namespace hpx::detail
+
+/// \endcond
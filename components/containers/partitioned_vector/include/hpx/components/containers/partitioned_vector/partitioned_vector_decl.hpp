@@ -24,6 +24,7 @@
 #include <hpx/runtime_components/new.hpp>
 #include <hpx/runtime_distributed/copy_component.hpp>
 
+#include <hpx/components/containers/partitioned_vector/detail/segment_cache.hpp>
 #include <hpx/components/containers/partitioned_vector/export_definitions.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
@@ -220,6 +221,10 @@ namespace hpx {
         // global ID's of the underlying partitioned_vector_partitions.
         partitions_vector_type partitions_;
 
+        // Copies of remote partitions, only allocated if caching is enabled.
+        typedef hpx::detail::segment_cache<Data> segment_cache_type;
+        std::unique_ptr<segment_cache_type> cache_;
+
     public:
         typedef segmented::vector_iterator<T, Data> iterator;
         typedef segmented::const_vector_iterator<T, Data> const_iterator;
@@ -429,6 +434,7 @@ namespace hpx {
           , size_(rhs.size_)
           , partition_size_(rhs.partition_size_)
           , partitions_(HPX_MOVE(rhs.partitions_))
+          , cache_(HPX_MOVE(rhs.cache_))
         {
             rhs.size_ = 0;
             rhs.partition_size_ = std::size_t(-1);
@@ -474,7 +480,10 @@ namespace hpx {
         partitioned_vector& operator=(partitioned_vector const& rhs)
         {
             if (this != &rhs && rhs.size_ != 0)
+            {
                 copy_from(rhs);
+                reset_cache();
+            }
             return *this;
         }
 
@@ -487,6 +496,7 @@ namespace hpx {
                 size_ = rhs.size_;
                 partition_size_ = rhs.partition_size_;
                 partitions_ = HPX_MOVE(rhs.partitions_);
+                reset_cache();
 
                 rhs.size_ = 0;
                 rhs.partition_size_ = std::size_t(-1);
@@ -506,6 +516,113 @@ namespace hpx {
             return size_;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Caching of remote partitions
+
+        /// Enable caching of remote partitions. Once enabled, the first read
+        /// of an element of a remote partition through this object fetches a
+        /// copy of the whole partition, all subsequent reads of elements of
+        /// this partition are served from the local copy.
+        ///
+        /// \note The cached copies are not kept coherent with the remote
+        ///       partitions. Writing an element through this object
+        ///       invalidates the cached copy of its partition, all other
+        ///       modifications require calling \a invalidate_cache. Caching
+        ///       is meant to be used for read-mostly phases of an application.
+        ///       This function must not be called concurrently with accesses
+        ///       to the elements of the vector.
+        ///
+        void enable_cache()
+        {
+            if (!cache_)
+            {
+                cache_.reset(new segment_cache_type(partitions_.size()));
+            }
+        }
+
+        /// Disable caching of remote partitions and discard all cached
+        /// copies. This function must not be called concurrently with
+        /// accesses to the elements of the vector.
+        void disable_cache()
+        {
+            cache_.reset();
+        }
+
+        /// Return whether caching of remote partitions is enabled.
+        bool is_cache_enabled() const noexcept
+        {
+            return !!cache_;
+        }
+
+        /// Discard the cached copies of all remote partitions.
+        void invalidate_cache()
+        {
+            if (cache_)
+                cache_->invalidate();
+        }
+
+        /// Discard the cached copy of the given partition.
+        ///
+        /// \param part  Sequence number of the partition
+        ///
+        void invalidate_cache(size_type part)
+        {
+            if (cache_)
+                cache_->invalidate(part);
+        }
+
+    private:
+        // discard all cached partitions after the partitions have changed
+        void reset_cache()
+        {
+            if (cache_)
+            {
+                cache_.reset(new segment_cache_type(partitions_.size()));
+            }
+        }
+
+        hpx::shared_future<Data> get_cached_partition(size_type part) const
+        {
+            HPX_ASSERT(cache_);
+            return cache_->get(part, [&]() {
+                return partitioned_vector_partition_client(
+                    partitions_[part].partition_)
+                    .get_copied_data()
+                    .share();
+            });
+        }
+
+        // Sort the given global positions by partition, returns the local
+        // positions and the index of each position in the given sequence.
+        void group_by_partition(std::vector<size_type> const& pos,
+            std::vector<std::vector<size_type>>& part_pos,
+            std::vector<std::vector<std::size_t>>& part_indices) const
+        {
+            part_pos.resize(partitions_.size());
+            part_indices.resize(partitions_.size());
+            for (std::size_t i = 0; i != pos.size(); ++i)
+            {
+                size_type part = get_partition(pos[i]);
+                HPX_ASSERT(part < partitions_.size());
+
+                part_pos[part].push_back(get_local_index(pos[i]));
+                part_indices[part].push_back(i);
+            }
+        }
+
+        static std::vector<T> get_cached_values(
+            Data const& data, std::vector<size_type> const& pos)
+        {
+            std::vector<T> result;
+            result.reserve(pos.size());
+            for (size_type p : pos)
+            {
+                result.push_back(data[p]);
+            }
+            return result;
+        }
+
+    public:
         //
         //  Element access API's in vector class
         //
@@ -537,6 +654,9 @@ namespace hpx {
             if (part_data.local_data_)
                 return part_data.local_data_->get_value(pos);
 
+            if (cache_)
+                return get_cached_partition(part).get()[pos];
+
             return partitioned_vector_partition_client(part_data.partition_)
                 .get_value(launch::sync, pos);
         }
@@ -571,6 +691,14 @@ namespace hpx {
                     partitions_[part].local_data_->get_value(pos));
             }
 
+            if (cache_)
+            {
+                return get_cached_partition(part).then(hpx::launch::sync,
+                    [pos](hpx::shared_future<Data>&& f) -> T {
+                        return f.get()[pos];
+                    });
+            }
+
             return partitioned_vector_partition_client(
                 partitions_[part].partition_)
                 .get_value(pos);
@@ -592,6 +720,9 @@ namespace hpx {
             if (part_data.local_data_)
                 return part_data.local_data_->get_values(pos);
 
+            if (cache_)
+                return get_cached_values(get_cached_partition(part).get(), pos);
+
             return partitioned_vector_partition_client(part_data.partition_)
                 .get_values(launch::sync, pos);
         }
@@ -613,6 +744,14 @@ namespace hpx {
                 return make_ready_future(
                     part_data.local_data_->get_values(pos));
 
+            if (cache_)
+            {
+                return get_cached_partition(part).then(hpx::launch::sync,
+                    [pos](hpx::shared_future<Data>&& f) {
+                        return get_cached_values(f.get(), pos);
+                    });
+            }
+
             return partitioned_vector_partition_client(part_data.partition_)
                 .get_values(pos);
         }
@@ -633,63 +772,39 @@ namespace hpx {
             if (pos_vec.empty())
                 return make_ready_future(std::vector<T>());
 
-            // current partition index of the block
-            size_type part_cur = get_partition(pos_vec[0]);
+            // coalesce the positions referring to the same partition, this
+            // issues at most one request per partition
+            std::vector<std::vector<size_type>> part_pos;
+            std::vector<std::vector<std::size_t>> part_indices;
+            group_by_partition(pos_vec, part_pos, part_indices);
 
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator part_begin =
-                pos_vec.begin();
-
-            // vector holding futures of the values for all blocks
+            // vector holding futures of the values for all partitions
             std::vector<future<std::vector<T>>> part_values_future;
-            for (typename std::vector<size_type>::const_iterator it =
-                     pos_vec.begin();
-                 it != pos_vec.end(); ++it)
+            std::vector<std::vector<std::size_t>> indices;
+            for (size_type part = 0; part != part_pos.size(); ++part)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
+                if (part_pos[part].empty())
                     continue;
 
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // get async values for this block
-                    part_values_future.push_back(get_values(part_cur,
-                        get_local_indices(
-                            std::vector<size_type>(part_begin, it))));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    part_begin = it;
-                }
+                part_values_future.push_back(get_values(part, part_pos[part]));
+                indices.push_back(HPX_MOVE(part_indices[part]));
             }
 
-            // the end of the vector is also an end of a block
-            // get async values for this block
-            part_values_future.push_back(get_values(part_cur,
-                get_local_indices(
-                    std::vector<size_type>(part_begin, pos_vec.end()))));
-
             // This helper function unwraps the vectors from each partition
-            // and merge them to one vector
+            // and places the values at their original positions
             auto merge_func =
-                [&pos_vec](std::vector<future<std::vector<T>>>&& part_values_f)
+                [size = pos_vec.size(), indices = HPX_MOVE(indices)](
+                    std::vector<future<std::vector<T>>>&& part_values_f)
                 -> std::vector<T> {
-                std::vector<T> values;
-                values.reserve(pos_vec.size());
-
-                for (future<std::vector<T>>& part_f : part_values_f)
+                std::vector<T> values(size);
+                for (std::size_t i = 0; i != part_values_f.size(); ++i)
                 {
-                    std::vector<T> part_values = part_f.get();
-                    std::move(part_values.begin(), part_values.end(),
-                        std::back_inserter(values));
+                    std::vector<T> part_values = part_values_f[i].get();
+                    std::vector<std::size_t> const& idx = indices[i];
+
+                    HPX_ASSERT(part_values.size() == idx.size());
+                    for (std::size_t j = 0; j != idx.size(); ++j)
+                        values[idx[j]] = HPX_MOVE(part_values[j]);
                 }
                 return values;
             };
@@ -697,7 +812,7 @@ namespace hpx {
             // when all values are here merge them to one vector
             // and return a future to this vector
             return dataflow(
-                launch::async, merge_func, HPX_MOVE(part_values_future));
+                launch::sync, merge_func, HPX_MOVE(part_values_future));
         }
 
         /// Returns the elements at the positions \a pos
@@ -881,6 +996,7 @@ namespace hpx {
             }
             else
             {
+                invalidate_cache(part);
                 partitioned_vector_partition_client(part_data.partition_)
                     .set_value(launch::sync, pos, HPX_FORWARD(T_, val));
             }
@@ -922,6 +1038,7 @@ namespace hpx {
                 return make_ready_future();
             }
 
+            invalidate_cache(part);
             return partitioned_vector_partition_client(part_data.partition_)
                 .set_value(pos, HPX_FORWARD(T_, val));
         }
@@ -933,10 +1050,10 @@ namespace hpx {
         /// \param pos   Position of the element in the vector
         /// \param val   The value to be copied
         ///
-        void set_values(launch::sync_policy, size_type /* part */,
+        void set_values(launch::sync_policy, size_type part,
             std::vector<size_type> const& pos, std::vector<T> const& val)
         {
-            set_values(pos, val).get();
+            set_values(part, pos, val).get();
         }
 
         /// Asynchronously set the element at position \a pos in
@@ -960,6 +1077,7 @@ namespace hpx {
                 return make_ready_future();
             }
 
+            invalidate_cache(part);
             return partitioned_vector_partition_client(
                 partitions_[part].partition_)
                 .set_values(pos, val);
@@ -984,57 +1102,28 @@ namespace hpx {
             if (pos.empty())
                 return make_ready_future();
 
-            // partition index of the current block
-            size_type part_cur = get_partition(pos[0]);
-
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator pos_block_begin =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_block_begin =
-                val.begin();
+            // coalesce the positions referring to the same partition, this
+            // issues at most one request per partition
+            std::vector<std::vector<size_type>> part_pos;
+            std::vector<std::vector<std::size_t>> part_indices;
+            group_by_partition(pos, part_pos, part_indices);
 
-            // vector holding futures of the state for all blocks
+            // vector holding futures of the state for all partitions
             std::vector<future<void>> part_futures;
-
-            // going through the position vector
-            typename std::vector<size_type>::const_iterator pos_it =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_it = val.begin();
-            for (/**/; pos_it != pos.end(); ++pos_it, ++val_it)
+            for (size_type part = 0; part != part_pos.size(); ++part)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*pos_it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
+                std::vector<std::size_t> const& idx = part_indices[part];
+                if (idx.empty())
                     continue;
 
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-                else
-                {
-                    // this is the end of a block containing indexes ('pos')
-                    // of the same partition ('part').
-                    // set asynchronous values for this block
-                    part_futures.push_back(set_values(part_cur,
-                        get_local_indices(
-                            std::vector<size_type>(pos_block_begin, pos_it)),
-                        std::vector<T>(val_block_begin, val_it)));
-
-                    // reset block variables to start a new one from here
-                    part_cur = part;
-                    pos_block_begin = pos_it;
-                    val_block_begin = val_it;
-                }
-            }
+                std::vector<T> part_val;
+                part_val.reserve(idx.size());
+                for (std::size_t i : idx)
+                    part_val.push_back(val[i]);
 
-            // the end of the vector is also an end of a block
-            // get asynchronous values for this block
-            part_futures.push_back(set_values(part_cur,
-                get_local_indices(
-                    std::vector<size_type>(pos_block_begin, pos.end())),
-                std::vector<T>(val_block_begin, val.end())));
+                part_futures.push_back(
+                    set_values(part, part_pos[part], part_val));
+            }
 
             return hpx::when_all(part_futures);
         }
@@ -0,0 +1,260 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/detail/sharded_unordered_map.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace hpx::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hash table which can be accessed concurrently. The elements are
+    // distributed over a fixed number of shards, each of which is protected by
+    // its own lock. Operations on keys hashing to different shards proceed in
+    // parallel.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class sharded_unordered_map
+    {
+    public:
+        using map_type = std::unordered_map<Key, T, Hash, KeyEqual>;
+        using size_type = typename map_type::size_type;
+
+        static constexpr std::size_t default_num_shards = 64;
+
+    private:
+        using mutex_type = hpx::spinlock;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            map_type map_;
+        };
+
+        using shard_type = hpx::util::cache_aligned_data_derived<shard>;
+
+        void init(size_type bucket_count, Hash const& hash,
+            KeyEqual const& equal)
+        {
+            size_type const shard_buckets =
+                (bucket_count + num_shards_ - 1) / num_shards_;
+
+            shards_.reset(new shard_type[num_shards_]);
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shards_[i].map_ = map_type(shard_buckets, hash, equal);
+            }
+        }
+
+        // The partition a key belongs to is selected from the lower bits of
+        // its hash value, scramble those before selecting the shard to avoid
+        // all keys of a partition being assigned to the same shard.
+        shard_type& get_shard(Key const& key) const noexcept
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+            h ^= h >> 29;
+            h *= 0x9e3779b97f4a7c15ull;
+            return shards_[static_cast<std::size_t>(h >> 32) % num_shards_];
+        }
+
+    public:
+        explicit sharded_unordered_map(size_type bucket_count = 0,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual(),
+            std::size_t num_shards = default_num_shards)
+          : num_shards_(num_shards != 0 ? num_shards : 1)
+          , hash_(hash)
+        {
+            init(bucket_count, hash, equal);
+        }
+
+        sharded_unordered_map(sharded_unordered_map const& rhs)
+          : num_shards_(rhs.num_shards_)
+          , hash_(rhs.hash_)
+        {
+            init(0, rhs.hash_, rhs.shards_[0].map_.key_eq());
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(rhs.shards_[i].mtx_);
+                shards_[i].map_ = rhs.shards_[i].map_;
+            }
+        }
+
+        sharded_unordered_map& operator=(sharded_unordered_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                assign(rhs.get_data());
+            }
+            return *this;
+        }
+
+        // the shards are not movable, move the elements instead
+        sharded_unordered_map(sharded_unordered_map&& rhs)
+          : sharded_unordered_map(rhs)
+        {
+            rhs.clear();
+        }
+
+        sharded_unordered_map& operator=(sharded_unordered_map&& rhs)
+        {
+            if (this != &rhs)
+            {
+                assign(rhs.get_data());
+                rhs.clear();
+            }
+            return *this;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += shards_[i].map_.size();
+            }
+            return result;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        size_type max_size() const noexcept
+        {
+            return shards_[0].map_.max_size();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Return a copy of the value stored for the given key, optionally
+        // erasing the element. Returns an empty optional if the key was not
+        // found.
+        std::optional<T> find(Key const& key, bool erase = false) const
+        {
+            shard_type& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+
+            auto it = s.map_.find(key);
+            if (it == s.map_.end())
+            {
+                return std::nullopt;
+            }
+
+            if (erase)
+            {
+                std::optional<T> value(HPX_MOVE(it->second));
+                s.map_.erase(it);
+                return value;
+            }
+            return it->second;
+        }
+
+        bool contains(Key const& key) const
+        {
+            shard_type& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.map_.find(key) != s.map_.end();
+        }
+
+        // Returns true if a new element was inserted
+        template <typename T_>
+        bool insert_or_assign(Key const& key, T_&& value)
+        {
+            shard_type& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.map_.insert_or_assign(key, HPX_FORWARD(T_, value)).second;
+        }
+
+        size_type erase(Key const& key)
+        {
+            shard_type& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.map_.erase(key);
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                shards_[i].map_.clear();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Return a copy of all elements, the result is not a snapshot if the
+        // table is modified concurrently.
+        map_type get_data() const
+        {
+            map_type result(0, hash_, shards_[0].map_.key_eq());
+            result.reserve(size());
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result.insert(shards_[i].map_.begin(), shards_[i].map_.end());
+            }
+            return result;
+        }
+
+        // Replace all elements with the given ones
+        void assign(map_type&& data)
+        {
+            clear();
+            for (auto& value : data)
+            {
+                insert_or_assign(value.first, HPX_MOVE(value.second));
+            }
+        }
+
+        void assign(map_type const& data)
+        {
+            clear();
+            for (auto const& value : data)
+            {
+                insert_or_assign(value.first, value.second);
+            }
+        }
+
+        // Invoke the given function for all elements, the function is called
+        // while the shard holding the element is locked.
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                for (auto const& value : shards_[i].map_)
+                {
+                    f(value.first, value.second);
+                }
+            }
+        }
+
+    private:
+        std::size_t num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        Hash hash_;
+    };
+}    // namespace hpx::detail
@@ -28,7 +28,6 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/cat.hpp>
@@ -37,8 +36,11 @@
 #include <hpx/runtime_components/component_factory.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/detail/sharded_unordered_map.hpp>
+
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -49,26 +51,29 @@ namespace hpx { namespace server {
     /// \brief This is the basic wrapper class for stl unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in a concurrent hash
+    /// table, which allows for the actions to be executed concurrently.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
-      : public components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
     {
     public:
+        // the type used to transfer all elements of a partition
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+        typedef hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        typedef hpx::detail::sharded_unordered_map<Key, T, Hash, KeyEqual>
+            storage_type;
+
+        storage_type partition_unordered_map_;
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -127,38 +132,11 @@ namespace hpx { namespace server {
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            return partition_unordered_map_.get_data();
         }
         void set_copied_data(data_type&& d)
         {
-            partition_unordered_map_ = HPX_MOVE(d);
-        }
-
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
-
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+            partition_unordered_map_.assign(HPX_MOVE(d));
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -177,13 +155,6 @@ namespace hpx { namespace server {
             return partition_unordered_map_.max_size();
         }
 
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
-        {
-            return partition_unordered_map_.capacity();
-        }
-
         /// Checks if the container has no elements, i.e. whether
         /// begin() == end().
         bool empty() const
@@ -203,39 +174,17 @@ namespace hpx { namespace server {
         /// \return Return the value of the element at position represented
         ///         by \a pos.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m)
-              , it_(it)
-            {
-            }
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it =
-                partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            std::optional<T> result = partition_unordered_map_.find(key, erase);
+            if (!result)
             {
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return HPX_MOVE(*result);
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -250,20 +199,17 @@ namespace hpx { namespace server {
         {
             std::vector<T> result;
             result.reserve(keys.size());
-
-            for (std::size_t i = 0; i != keys.size(); ++i)
+            for (Key const& key : keys)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                std::optional<T> value = partition_unordered_map_.find(key);
+                if (!value)
                 {
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                         "partition_unordered_map::get_values",
                         "unable to find requested key in this partition of the "
                         "unordered_map");
-                    break;
                 }
-                result.push_back(it->second);
+                result.push_back(HPX_MOVE(*value));
             }
             return result;
         }
@@ -281,7 +227,7 @@ namespace hpx { namespace server {
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -294,10 +240,86 @@ namespace hpx { namespace server {
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.insert_or_assign(keys[i], val[i]);
+        }
+
+        /// Insert the value \a val for the given key or assign it to the
+        /// existing element.
+        ///
+        /// \return Returns whether a new element was inserted.
+        ///
+        bool insert_or_assign(Key const& key, T const& val)
+        {
+            return partition_unordered_map_.insert_or_assign(key, val);
+        }
+
+        /// Insert the values \a vals for the given keys or assign them to the
+        /// existing elements.
+        ///
+        /// \return Returns the number of newly inserted elements.
+        ///
+        std::size_t insert_or_assign_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::size_t inserted = 0;
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                if (partition_unordered_map_.insert_or_assign(
+                        keys[i], vals[i]))
+                {
+                    ++inserted;
+                }
+            }
+            return inserted;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Bulk operations spanning several partitions located on the same
+        // locality as this one. Those allow to access all partitions of a
+        // locality using a single parcel.
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Return the values of the given keys from each of the given
+        /// partitions.
+        std::vector<std::vector<T>> get_values_bulk(
+            std::vector<hpx::id_type> const& partitions,
+            std::vector<std::vector<Key>> const& keys)
+        {
+            HPX_ASSERT(partitions.size() == keys.size());
+
+            std::vector<std::vector<T>> result;
+            result.reserve(partitions.size());
+            for (std::size_t i = 0; i != partitions.size(); ++i)
+            {
+                result.push_back(
+                    get_partition(partitions[i])->get_values(keys[i]));
+            }
+            return result;
+        }
+
+        /// Insert or assign the given values into each of the given
+        /// partitions.
+        ///
+        /// \return Returns the overall number of newly inserted elements.
+        std::size_t insert_or_assign_bulk(
+            std::vector<hpx::id_type> const& partitions,
+            std::vector<std::vector<Key>> const& keys,
+            std::vector<std::vector<T>> const& vals)
+        {
+            HPX_ASSERT(partitions.size() == keys.size());
+            HPX_ASSERT(partitions.size() == vals.size());
+
+            std::size_t inserted = 0;
+            for (std::size_t i = 0; i != partitions.size(); ++i)
+            {
+                inserted += get_partition(partitions[i])
+                                ->insert_or_assign_values(keys[i], vals[i]);
+            }
+            return inserted;
         }
 
         /// Remove all elements from the vector leaving the
@@ -323,12 +345,29 @@ namespace hpx { namespace server {
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values)
 
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, insert_or_assign)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, insert_or_assign_values)
+
+        HPX_DEFINE_COMPONENT_ACTION(partition_unordered_map, get_values_bulk)
+        HPX_DEFINE_COMPONENT_ACTION(
+            partition_unordered_map, insert_or_assign_bulk)
+
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
             partition_unordered_map, get_copied_data)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
             partition_unordered_map, set_copied_data)
+
+    private:
+        // the partitions passed to the bulk operations are local
+        std::shared_ptr<partition_unordered_map> get_partition(
+            hpx::id_type const& id) const
+        {
+            return hpx::get_ptr<partition_unordered_map>(hpx::launch::sync, id);
+        }
     };
 }}    // namespace hpx::server
 
@@ -370,6 +409,21 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,      \
         HPX_PP_CAT(__unordered_map_set_values_action_, name))                  \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::insert_or_assign_action,                                \
+        HPX_PP_CAT(__unordered_map_insert_or_assign_action_, name))            \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::insert_or_assign_values_action,                         \
+        HPX_PP_CAT(__unordered_map_insert_or_assign_values_action_, name))     \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_bulk_action, \
+        HPX_PP_CAT(__unordered_map_get_values_bulk_action_, name))             \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::insert_or_assign_bulk_action,                           \
+        HPX_PP_CAT(__unordered_map_insert_or_assign_bulk_action_, name))       \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,            \
         HPX_PP_CAT(__unordered_map_size_action_, name))                        \
@@ -427,6 +481,21 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_values_action,      \
         HPX_PP_CAT(__unordered_map_set_values_action_, name))                  \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::insert_or_assign_action,                                \
+        HPX_PP_CAT(__unordered_map_insert_or_assign_action_, name))            \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::insert_or_assign_values_action,                         \
+        HPX_PP_CAT(__unordered_map_insert_or_assign_values_action_, name))     \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_bulk_action, \
+        HPX_PP_CAT(__unordered_map_get_values_bulk_action_, name))             \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::insert_or_assign_bulk_action,                           \
+        HPX_PP_CAT(__unordered_map_insert_or_assign_bulk_action_, name))       \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::size_action,            \
         HPX_PP_CAT(__unordered_map_size_action_, name))                        \
@@ -649,6 +718,66 @@ namespace hpx {
                 this->get_id(), keys, vals);
         }
 
+        /// Insert the values \a vals for the given keys or assign them to the
+        /// existing elements of the partition_unordered_map component.
+        ///
+        /// \return Returns the number of newly inserted elements.
+        ///
+        std::size_t insert_or_assign_values(launch::sync_policy,
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            return insert_or_assign_values(keys, vals).get();
+        }
+
+        /// Insert the values \a vals for the given keys or assign them to the
+        /// existing elements of the partition_unordered_map component.
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         newly inserted elements
+        ///
+        future<std::size_t> insert_or_assign_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<
+                typename server_type::insert_or_assign_values_action>(
+                this->get_id(), keys, vals);
+        }
+
+        /// Return the values of the given keys from each of the given
+        /// partitions. All partitions have to be located on the same locality
+        /// as this one.
+        ///
+        /// \return This returns the hpx::future containing the values for
+        ///         each of the partitions
+        ///
+        future<std::vector<std::vector<T>>> get_values_bulk(
+            std::vector<hpx::id_type> const& partitions,
+            std::vector<std::vector<Key>> const& keys) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::get_values_bulk_action>(
+                this->get_id(), partitions, keys);
+        }
+
+        /// Insert or assign the given values into each of the given
+        /// partitions. All partitions have to be located on the same locality
+        /// as this one.
+        ///
+        /// \return This returns the hpx::future containing the overall number
+        ///         of newly inserted elements
+        ///
+        future<std::size_t> insert_or_assign_bulk(
+            std::vector<hpx::id_type> const& partitions,
+            std::vector<std::vector<Key>> const& keys,
+            std::vector<std::vector<T>> const& vals)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<
+                typename server_type::insert_or_assign_bulk_action>(
+                this->get_id(), partitions, keys, vals);
+        }
+
         /// Erase all values with the given key from the partition_unordered_map
         /// container.
         ///
@@ -12,6 +12,7 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -31,6 +32,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -377,6 +379,65 @@ namespace hpx {
             return ids;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Keys of a bulk operation which belong to the same partition, along
+        // with their positions in the sequence of keys passed by the caller.
+        struct partition_keys
+        {
+            std::vector<Key> keys_;
+            std::vector<std::size_t> positions_;
+        };
+
+        // Remote partitions involved in a bulk operation, grouped by the
+        // locality they live on.
+        typedef std::map<std::uint32_t, std::vector<std::size_t>>
+            remote_partitions_type;
+
+        std::vector<partition_keys> group_by_partition(
+            std::vector<Key> const& keys,
+            remote_partitions_type& remote_partitions) const
+        {
+            std::vector<partition_keys> result(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                partition_keys& pk = result[get_partition(keys[i])];
+                pk.keys_.push_back(keys[i]);
+                pk.positions_.push_back(i);
+            }
+
+            for (std::size_t part = 0; part != result.size(); ++part)
+            {
+                partition_data const& part_data = partitions_[part];
+                if (!result[part].keys_.empty() && !part_data.local_data_)
+                {
+                    remote_partitions[part_data.locality_id_].push_back(part);
+                }
+            }
+            return result;
+        }
+
+        static std::vector<T> gather_values(std::vector<T> const& vals,
+            std::vector<std::size_t> const& positions)
+        {
+            std::vector<T> result;
+            result.reserve(positions.size());
+            for (std::size_t pos : positions)
+            {
+                result.push_back(vals[pos]);
+            }
+            return result;
+        }
+
+        static void scatter_values(std::vector<T>& result,
+            std::vector<T>&& vals, std::vector<std::size_t> const& positions)
+        {
+            HPX_ASSERT(vals.size() == positions.size());
+            for (std::size_t i = 0; i != positions.size(); ++i)
+            {
+                result[positions[i]] = HPX_MOVE(vals[i]);
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         struct get_ptr_helper
         {
@@ -800,6 +861,210 @@ namespace hpx {
                 .set_value(pos, HPX_FORWARD(T_, val));
         }
 
+        /// Returns the values of the elements with the given \a keys.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the order of the
+        ///         given \a keys.
+        ///
+        std::vector<T> get_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously returns the values of the elements with the given
+        /// \a keys. The keys are grouped by the locality of the partition
+        /// they belong to, all values stored on a remote locality are
+        /// retrieved using a single action. Values stored in partitions on
+        /// the calling locality are accessed directly.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the order of the given \a keys.
+        ///
+        future<std::vector<T>> get_values(std::vector<Key> const& keys) const
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            remote_partitions_type remote_partitions;
+            std::vector<partition_keys> parts =
+                group_by_partition(keys, remote_partitions);
+
+            auto result = std::make_shared<std::vector<T>>(keys.size());
+
+            std::vector<future<void>> futures;
+            futures.reserve(remote_partitions.size());
+            for (auto const& remote : remote_partitions)
+            {
+                std::vector<hpx::id_type> ids;
+                std::vector<std::vector<Key>> part_keys;
+                std::vector<std::vector<std::size_t>> positions;
+                for (std::size_t part : remote.second)
+                {
+                    ids.push_back(partitions_[part].get_id());
+                    part_keys.push_back(HPX_MOVE(parts[part].keys_));
+                    positions.push_back(HPX_MOVE(parts[part].positions_));
+                }
+
+                futures.push_back(
+                    partition_unordered_map_client(ids[0])
+                        .get_values_bulk(ids, part_keys)
+                        .then(hpx::launch::sync,
+                            [result, positions = HPX_MOVE(positions)](
+                                future<std::vector<std::vector<T>>>&& f) {
+                                std::vector<std::vector<T>> vals = f.get();
+                                for (std::size_t i = 0; i != vals.size(); ++i)
+                                {
+                                    scatter_values(*result, HPX_MOVE(vals[i]),
+                                        positions[i]);
+                                }
+                            }));
+            }
+
+            // access local partitions while the remote requests are in flight
+            for (std::size_t part = 0; part != parts.size(); ++part)
+            {
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_ && !parts[part].keys_.empty())
+                {
+                    scatter_values(*result,
+                        part_data.local_data_->get_values(parts[part].keys_),
+                        parts[part].positions_);
+                }
+            }
+
+            return hpx::when_all(HPX_MOVE(futures))
+                .then(hpx::launch::sync,
+                    [result](future<std::vector<future<void>>>&& f) {
+                        for (future<void>& fut : f.get())
+                        {
+                            fut.get();    // propagate exceptions
+                        }
+                        return HPX_MOVE(*result);
+                    });
+#else
+            HPX_ASSERT(false);
+            HPX_UNUSED(keys);
+            return hpx::make_ready_future(std::vector<T>{});
+#endif
+        }
+
+        /// Copy the values \a vals to the elements with the given \a keys.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given \a keys, see \a insert_or_assign.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            return insert_or_assign(keys, vals).then(
+                hpx::launch::sync, [](future<std::size_t>&& f) { f.get(); });
+        }
+
+        /// Insert the values \a vals for the given \a keys or assign them to
+        /// the existing elements.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be inserted or assigned
+        ///
+        /// \return Returns the number of newly inserted elements.
+        ///
+        std::size_t insert_or_assign(launch::sync_policy,
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            return insert_or_assign(keys, vals).get();
+        }
+
+        /// Asynchronously insert the values \a vals for the given \a keys or
+        /// assign them to the existing elements. The elements are grouped by
+        /// the locality of the partition they belong to, all elements stored
+        /// on a remote locality are sent using a single action. Partitions on
+        /// the calling locality are modified directly.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be inserted or assigned
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         newly inserted elements.
+        ///
+        future<std::size_t> insert_or_assign(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            HPX_ASSERT(keys.size() == vals.size());
+
+            remote_partitions_type remote_partitions;
+            std::vector<partition_keys> parts =
+                group_by_partition(keys, remote_partitions);
+
+            std::vector<future<std::size_t>> futures;
+            futures.reserve(remote_partitions.size());
+            for (auto const& remote : remote_partitions)
+            {
+                std::vector<hpx::id_type> ids;
+                std::vector<std::vector<Key>> part_keys;
+                std::vector<std::vector<T>> part_vals;
+                for (std::size_t part : remote.second)
+                {
+                    ids.push_back(partitions_[part].get_id());
+                    part_vals.push_back(
+                        gather_values(vals, parts[part].positions_));
+                    part_keys.push_back(HPX_MOVE(parts[part].keys_));
+                }
+
+                futures.push_back(partition_unordered_map_client(ids[0])
+                                      .insert_or_assign_bulk(
+                                          ids, part_keys, part_vals));
+            }
+
+            std::size_t inserted = 0;
+            for (std::size_t part = 0; part != parts.size(); ++part)
+            {
+                partition_data const& part_data = partitions_[part];
+                if (part_data.local_data_ && !parts[part].keys_.empty())
+                {
+                    inserted += part_data.local_data_->insert_or_assign_values(
+                        parts[part].keys_,
+                        gather_values(vals, parts[part].positions_));
+                }
+            }
+
+            return hpx::when_all(HPX_MOVE(futures))
+                .then(hpx::launch::sync,
+                    [inserted](
+                        future<std::vector<future<std::size_t>>>&& f) {
+                        std::size_t result = inserted;
+                        for (future<std::size_t>& fut : f.get())
+                        {
+                            result += fut.get();
+                        }
+                        return result;
+                    });
+#else
+            HPX_ASSERT(false);
+            HPX_UNUSED(keys);
+            HPX_UNUSED(vals);
+            return hpx::make_ready_future(std::size_t{});
+#endif
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
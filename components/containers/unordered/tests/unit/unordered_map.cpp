@@ -79,6 +79,52 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_bulk_access(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+    std::size_t count)
+{
+    std::vector<Key> keys;
+    std::vector<Value> vals;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        vals.push_back(Value(i));
+    }
+
+    // only every other element is newly inserted
+    std::vector<Key> even_keys;
+    std::vector<Value> even_vals;
+    for (std::size_t i = 0; i < count; i += 2)
+    {
+        even_keys.push_back(keys[i]);
+        even_vals.push_back(Value(0));
+    }
+    HPX_TEST_EQ(
+        m.insert_or_assign(hpx::launch::sync, even_keys, even_vals),
+        even_keys.size());
+    HPX_TEST_EQ(m.insert_or_assign(keys, vals).get(), count - even_keys.size());
+    HPX_TEST_EQ(m.size(), count);
+
+    std::vector<Value> result = m.get_values(hpx::launch::sync, keys);
+    HPX_TEST(result == vals);
+
+    for (Value& val : vals)
+    {
+        val += Value(1);
+    }
+    m.set_values(keys, vals).get();
+
+    std::reverse(keys.begin(), keys.end());
+    std::reverse(vals.begin(), vals.end());
+    HPX_TEST(m.get_values(keys).get() == vals);
+    HPX_TEST_EQ(m.size(), count);
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(m.get_value(hpx::launch::sync, keys[i]), vals[i]);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -110,6 +156,12 @@ void trivial_tests(DistPolicy const& policy)
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
     }
+
+    // bulk operations
+    {
+        hpx::unordered_map<Key, Value> m(policy);
+        test_bulk_access(m, 107);
+    }
 }
 
 template <typename Key, typename Value>
@@ -124,6 +176,12 @@ void trivial_tests()
         test_global_iteration(m, Value(42));
     }
 
+    // bulk operations
+    {
+        hpx::unordered_map<Key, Value> m;
+        test_bulk_access(m, 107);
+    }
+
     // bucket_count
     {
         hpx::unordered_map<Key, Value> m(17);
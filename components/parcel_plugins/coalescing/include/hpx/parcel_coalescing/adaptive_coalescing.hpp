@@ -0,0 +1,197 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcel_coalescing/message_buffer.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/policies/message_handler.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::plugins::parcel {
+
+    struct coalescing_message_handler;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Derives the number of parcels to coalesce into one message from the
+        // observed arrival rate of parcels and the latency each parcel may be
+        // delayed by (the latency budget). All times are in nanoseconds.
+        class adaptive_flush_policy
+        {
+        public:
+            // weight of the most recent inter-arrival time
+            static constexpr double smoothing = 0.125;
+
+            // bounds of the correction applied to the estimated number of
+            // parcels arriving within the latency budget
+            static constexpr double min_scale = 1.0 / 16;
+            static constexpr double max_scale = 1.0;
+
+            adaptive_flush_policy(
+                std::size_t max_parcels, std::int64_t latency_budget) noexcept
+              : max_parcels_(max_parcels == 0 ? 1 : max_parcels)
+              , latency_budget_(latency_budget)
+              , last_arrival_(-1)
+              , mean_interarrival_time_(0.0)
+              , scale_(max_scale)
+            {
+            }
+
+            // record the arrival of a parcel at the given point in time
+            void arrived(std::int64_t now) noexcept
+            {
+                if (last_arrival_ >= 0 && now >= last_arrival_)
+                {
+                    double const t = double(now - last_arrival_);
+                    if (mean_interarrival_time_ == 0.0)
+                    {
+                        mean_interarrival_time_ = t;
+                    }
+                    else
+                    {
+                        mean_interarrival_time_ +=
+                            smoothing * (t - mean_interarrival_time_);
+                    }
+                }
+                last_arrival_ = now;
+            }
+
+            // the number of parcels a message should collect before being
+            // sent, a value of one disables coalescing
+            std::size_t threshold() const noexcept
+            {
+                if (mean_interarrival_time_ <= 0.0 || latency_budget_ <= 0)
+                {
+                    return 1;
+                }
+
+                double const n =
+                    scale_ * double(latency_budget_) / mean_interarrival_time_;
+                if (n < 2.0)
+                {
+                    return 1;
+                }
+                if (n >= double(max_parcels_))
+                {
+                    return max_parcels_;
+                }
+                return std::size_t(n);
+            }
+
+            // Adjust to the outcome of sending a message: if the latency
+            // budget expired before the threshold was reached the arrival rate
+            // was overestimated (e.g. at the end of a burst), while messages
+            // which were filled well within the budget allow for collecting
+            // more parcels again.
+            void sent(std::int64_t queueing_delay, bool timed_out) noexcept
+            {
+                if (timed_out)
+                {
+                    scale_ = (std::max)(scale_ * 0.5, min_scale);
+                }
+                else if (2 * queueing_delay < latency_budget_)
+                {
+                    scale_ = (std::min)(scale_ * 1.25, max_scale);
+                }
+            }
+
+            std::size_t max_parcels() const noexcept
+            {
+                return max_parcels_;
+            }
+
+            std::int64_t latency_budget() const noexcept
+            {
+                return latency_budget_;
+            }
+
+            double mean_interarrival_time() const noexcept
+            {
+                return mean_interarrival_time_;
+            }
+
+        private:
+            std::size_t max_parcels_;
+            std::int64_t latency_budget_;
+            std::int64_t last_arrival_;
+            double mean_interarrival_time_;
+            double scale_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Coalesces the parcels of all actions sent to one destination. The
+    // message handlers of the individual actions forward their parcels to the
+    // instance responsible for the destination if adaptive coalescing is
+    // enabled.
+    class HPX_LIBRARY_EXPORT destination_coalescer
+    {
+        using mutex_type = hpx::spinlock;
+
+    public:
+        HPX_NON_COPYABLE(destination_coalescer);
+
+        using write_handler_type =
+            parcelset::policies::message_handler::write_handler_type;
+
+        destination_coalescer(parcelset::parcelport* pp,
+            parcelset::locality const& dest, std::size_t max_parcels,
+            std::int64_t latency_budget);
+
+        // return the instance responsible for the given destination, all
+        // parameters except the destination are used only if a new instance
+        // is created
+        static std::shared_ptr<destination_coalescer> get(
+            parcelset::parcelport* pp, parcelset::locality const& dest,
+            std::size_t max_parcels, std::int64_t latency_budget);
+
+        void put_parcel(coalescing_message_handler* handler,
+            parcelset::parcel p, write_handler_type f);
+
+        bool flush();
+
+        // the given message handler is about to be destroyed
+        void remove_handler(coalescing_message_handler* handler);
+
+    private:
+        bool timer_flush();
+        void flush_terminate();
+        bool flush_locked(std::unique_lock<mutex_type>& l, bool timed_out,
+            bool cancel_timer);
+
+        mutex_type mtx_;
+        parcelset::parcelport* pp_;
+        parcelset::locality dest_;
+        detail::adaptive_flush_policy policy_;
+        detail::message_buffer buffer_;
+        util::pool_timer timer_;
+
+        // the message handlers which contributed to the current message
+        std::vector<coalescing_message_handler*> handlers_;
+        std::int64_t first_parcel_time_;
+    };
+}    // namespace hpx::plugins::parcel
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
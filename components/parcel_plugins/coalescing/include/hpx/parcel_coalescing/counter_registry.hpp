@@ -41,6 +41,15 @@ namespace hpx::plugins::parcel {
         using get_counter_values_creator_type = hpx::function<void(std::int64_t,
             std::int64_t, std::int64_t, get_counter_values_type&)>;
 
+        // parameters of a histogram requested before the corresponding
+        // action was used for the first time
+        struct histogram_parameters
+        {
+            std::int64_t min_boundary = 0;
+            std::int64_t max_boundary = 0;
+            std::int64_t num_buckets = 1;
+        };
+
         struct counter_functions
         {
             get_counter_type num_parcels;
@@ -50,6 +59,10 @@ namespace hpx::plugins::parcel {
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator;
             std::int64_t min_boundary, max_boundary, num_buckets;
+            get_counter_values_creator_type batch_size_histogram_creator;
+            get_counter_values_creator_type queueing_delay_histogram_creator;
+            histogram_parameters batch_size_histogram;
+            histogram_parameters queueing_delay_histogram;
         };
 
         using map_type = std::unordered_map<std::string, counter_functions,
@@ -64,7 +77,9 @@ namespace hpx::plugins::parcel {
             get_counter_type time_between_parcels,
             get_counter_type average_time_between_parcels,
             get_counter_values_creator_type
-                time_between_parcels_histogram_creator);
+                time_between_parcels_histogram_creator,
+            get_counter_values_creator_type batch_size_histogram_creator,
+            get_counter_values_creator_type queueing_delay_histogram_creator);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -75,6 +90,12 @@ namespace hpx::plugins::parcel {
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
+        get_counter_values_type get_batch_size_histogram_counter(
+            std::string const& name, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets);
+        get_counter_values_type get_queueing_delay_histogram_counter(
+            std::string const& name, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets);
 
         bool counter_discoverer(performance_counters::counter_info const& info,
             performance_counters::counter_path_elements& p,
@@ -88,6 +109,12 @@ namespace hpx::plugins::parcel {
         }
 
     private:
+        get_counter_values_type get_histogram_counter(std::string const& name,
+            get_counter_values_creator_type counter_functions::*creator,
+            histogram_parameters counter_functions::*parameters,
+            std::int64_t min_boundary, std::int64_t max_boundary,
+            std::int64_t num_buckets);
+
         struct tag
         {
         };
@@ -15,6 +15,7 @@
 #include <hpx/modules/statistics.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcel_coalescing/adaptive_coalescing.hpp>
 #include <hpx/parcel_coalescing/message_buffer.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
@@ -43,6 +44,8 @@ namespace hpx::plugins::parcel {
             parcelset::parcelport* pp, std::size_t num = std::size_t(-1),
             std::size_t interval = std::size_t(-1));
 
+        ~coalescing_message_handler();
+
         void put_parcel(parcelset::locality const& dest, parcelset::parcel p,
             write_handler_type f);
 
@@ -62,6 +65,17 @@ namespace hpx::plugins::parcel {
             std::int64_t min_boundary, std::int64_t max_boundary,
             std::int64_t num_buckets,
             hpx::function<std::vector<std::int64_t>(bool)>& result);
+        std::vector<std::int64_t> get_batch_size_histogram(bool reset);
+        void get_batch_size_histogram_creator(std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets,
+            hpx::function<std::vector<std::int64_t>(bool)>& result);
+        std::vector<std::int64_t> get_queueing_delay_histogram(bool reset);
+        void get_queueing_delay_histogram_creator(std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets,
+            hpx::function<std::vector<std::int64_t>(bool)>& result);
+
+        // a message holding parcels of this action was sent
+        void message_sent(std::size_t num_parcels, std::int64_t queueing_delay);
 
         // register the given action
         static void register_action(char const* action, error_code& ec);
@@ -76,6 +90,29 @@ namespace hpx::plugins::parcel {
         void update_interval();
 
     private:
+        // collects percentiles
+        using histogram_collector_type =
+            boost::accumulators::accumulator_set<double,
+                boost::accumulators::features<hpx::util::tag::histogram>>;
+
+        struct histogram_data
+        {
+            std::unique_ptr<histogram_collector_type> collector_;
+            std::int64_t min_boundary_ = -1;
+            std::int64_t max_boundary_ = -1;
+            std::int64_t num_buckets_ = -1;
+        };
+
+        std::vector<std::int64_t> get_histogram(
+            std::unique_lock<mutex_type>& l, histogram_data const& data,
+            char const* name) const;
+        static void create_histogram(histogram_data& data,
+            std::int64_t min_boundary, std::int64_t max_boundary,
+            std::int64_t num_buckets);
+        void record_message_locked(
+            std::size_t num_parcels, std::int64_t queueing_delay);
+
+
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
@@ -86,6 +123,12 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adaptive coalescing hands all parcels to the instance responsible
+        // for their destination
+        bool adaptive_;
+        std::int64_t latency_budget_;
+        std::shared_ptr<destination_coalescer> coalescer_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -96,16 +139,15 @@ namespace hpx::plugins::parcel {
         std::int64_t started_at_;
         std::int64_t reset_time_num_parcels_;
         std::int64_t last_parcel_time_;
-
-        // collects percentiles
-        using histogram_collector_type =
-            boost::accumulators::accumulator_set<double,
-                boost::accumulators::features<hpx::util::tag::histogram>>;
+        std::int64_t first_parcel_time_;
 
         std::unique_ptr<histogram_collector_type> time_between_parcels_;
         std::int64_t histogram_min_boundary_;
         std::int64_t histogram_max_boundary_;
         std::int64_t histogram_num_buckets_;
+
+        histogram_data batch_sizes_;
+        histogram_data queueing_delays_;
     };
 }    // namespace hpx::plugins::parcel
 
@@ -0,0 +1,201 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/thread_support.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcel_coalescing/adaptive_coalescing.hpp>
+#include <hpx/parcel_coalescing/message_handler.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::plugins::parcel {
+
+    namespace detail {
+
+        // all existing instances, keyed by parcelport and destination
+        struct destination_coalescers
+        {
+            using key_type =
+                std::pair<parcelset::parcelport*, parcelset::locality>;
+
+            hpx::spinlock mtx_;
+            std::map<key_type, std::weak_ptr<destination_coalescer>> map_;
+        };
+
+        destination_coalescers& get_destination_coalescers()
+        {
+            static destination_coalescers coalescers;
+            return coalescers;
+        }
+    }    // namespace detail
+
+    destination_coalescer::destination_coalescer(parcelset::parcelport* pp,
+        parcelset::locality const& dest, std::size_t max_parcels,
+        std::int64_t latency_budget)
+      : pp_(pp)
+      , dest_(dest)
+      , policy_(max_parcels, latency_budget)
+      , buffer_(policy_.max_parcels())
+      , timer_(hpx::bind_front(&destination_coalescer::timer_flush, this),
+            hpx::bind_front(&destination_coalescer::flush_terminate, this),
+            "destination_coalescer_timer")
+      , first_parcel_time_(0)
+    {
+    }
+
+    std::shared_ptr<destination_coalescer> destination_coalescer::get(
+        parcelset::parcelport* pp, parcelset::locality const& dest,
+        std::size_t max_parcels, std::int64_t latency_budget)
+    {
+        detail::destination_coalescers& coalescers =
+            detail::get_destination_coalescers();
+
+        std::lock_guard<hpx::spinlock> l(coalescers.mtx_);
+
+        std::weak_ptr<destination_coalescer>& entry =
+            coalescers.map_[std::make_pair(pp, dest)];
+
+        std::shared_ptr<destination_coalescer> result = entry.lock();
+        if (!result)
+        {
+            result = std::make_shared<destination_coalescer>(
+                pp, dest, max_parcels, latency_budget);
+            entry = result;
+        }
+        return result;
+    }
+
+    void destination_coalescer::put_parcel(coalescing_message_handler* handler,
+        parcelset::parcel p, write_handler_type f)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        std::int64_t const now = hpx::chrono::high_resolution_clock::now();
+        policy_.arrived(now);
+
+        // just send the parcel if parcels arrive too rarely for coalescing to
+        // pay off
+        std::size_t const threshold = policy_.threshold();
+        if (buffer_.empty() && threshold <= 1)
+        {
+            l.unlock();
+
+            handler->message_sent(1, 0);
+            pp_->put_parcel(dest_, HPX_MOVE(p), HPX_MOVE(f));
+            return;
+        }
+
+        if (std::find(handlers_.begin(), handlers_.end(), handler) ==
+            handlers_.end())
+        {
+            handlers_.push_back(handler);
+        }
+
+        if (buffer_.append(dest_, HPX_MOVE(p), HPX_MOVE(f)) ==
+            detail::message_buffer::first_message)
+        {
+            // no parcel may wait for longer than the latency budget
+            first_parcel_time_ = now;
+            l.unlock();
+
+            timer_.start(std::chrono::nanoseconds(policy_.latency_budget()));
+            return;
+        }
+
+        if (buffer_.size() >= threshold)
+        {
+            flush_locked(l, false, true);
+        }
+    }
+
+    bool destination_coalescer::timer_flush()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        if (!buffer_.empty())
+        {
+            flush_locked(l, true, false);
+        }
+
+        // do not restart timer, will be restarted on next parcel
+        return false;
+    }
+
+    bool destination_coalescer::flush()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return flush_locked(l, false, true);
+    }
+
+    void destination_coalescer::flush_terminate()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        flush_locked(l, false, true);
+    }
+
+    void destination_coalescer::remove_handler(
+        coalescing_message_handler* handler)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        handlers_.erase(
+            std::remove(handlers_.begin(), handlers_.end(), handler),
+            handlers_.end());
+    }
+
+    bool destination_coalescer::flush_locked(
+        std::unique_lock<mutex_type>& l, bool timed_out, bool cancel_timer)
+    {
+        HPX_ASSERT(l.owns_lock());
+
+        if (cancel_timer)
+        {
+            hpx::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+            timer_.stop();    // interrupt timer
+        }
+
+        if (buffer_.empty())
+            return false;
+
+        detail::message_buffer buff(policy_.max_parcels());
+        std::swap(buff, buffer_);
+
+        std::int64_t const queueing_delay =
+            hpx::chrono::high_resolution_clock::now() - first_parcel_time_;
+        policy_.sent(queueing_delay, timed_out);
+
+        // the message handlers of all actions which contributed parcels
+        // account for the message
+        for (coalescing_message_handler* handler : handlers_)
+        {
+            handler->message_sent(buff.size(), queueing_delay);
+        }
+        handlers_.clear();
+        l.unlock();
+
+        HPX_ASSERT(nullptr != pp_);
+        buff(pp_);    // 'invoke' the buffer
+
+        return true;
+    }
+}    // namespace hpx::plugins::parcel
+
+#endif
@@ -33,7 +33,9 @@ namespace hpx::plugins::parcel {
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
-        get_counter_values_creator_type time_between_parcels_histogram_creator)
+        get_counter_values_creator_type time_between_parcels_histogram_creator,
+        get_counter_values_creator_type batch_size_histogram_creator,
+        get_counter_values_creator_type queueing_delay_histogram_creator)
     {
         if (name.empty())
         {
@@ -49,7 +51,9 @@ namespace hpx::plugins::parcel {
         {
             counter_functions data = {num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
-                time_between_parcels_histogram_creator, 0, 0, 1};
+                time_between_parcels_histogram_creator, 0, 0, 1,
+                batch_size_histogram_creator, queueing_delay_histogram_creator,
+                histogram_parameters(), histogram_parameters()};
 
             map_.emplace(name, HPX_MOVE(data));
         }
@@ -63,6 +67,10 @@ namespace hpx::plugins::parcel {
                 average_time_between_parcels;
             (*it).second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
+            (*it).second.batch_size_histogram_creator =
+                batch_size_histogram_creator;
+            (*it).second.queueing_delay_histogram_creator =
+                queueing_delay_histogram_creator;
 
             if ((*it).second.min_boundary != (*it).second.max_boundary)
             {
@@ -73,6 +81,25 @@ namespace hpx::plugins::parcel {
                     (*it).second.num_buckets, result);
             }
 
+            histogram_parameters const& batch_size =
+                (*it).second.batch_size_histogram;
+            if (batch_size.min_boundary != batch_size.max_boundary)
+            {
+                coalescing_counter_registry::get_counter_values_type result;
+                batch_size_histogram_creator(batch_size.min_boundary,
+                    batch_size.max_boundary, batch_size.num_buckets, result);
+            }
+
+            histogram_parameters const& queueing_delay =
+                (*it).second.queueing_delay_histogram;
+            if (queueing_delay.min_boundary != queueing_delay.max_boundary)
+            {
+                coalescing_counter_registry::get_counter_values_type result;
+                queueing_delay_histogram_creator(queueing_delay.min_boundary,
+                    queueing_delay.max_boundary, queueing_delay.num_buckets,
+                    result);
+            }
+
             // silence warnings
             (void) (*it).second.num_parcels;
             (void) (*it).second.num_messages;
@@ -207,6 +234,63 @@ namespace hpx::plugins::parcel {
         return result;
     }
 
+    coalescing_counter_registry::get_counter_values_type
+    coalescing_counter_registry::get_histogram_counter(std::string const& name,
+        get_counter_values_creator_type counter_functions::*creator,
+        histogram_parameters counter_functions::*parameters,
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_counter_registry::get_histogram_counter",
+                "unknown action type");
+            return &coalescing_counter_registry::empty_histogram;
+        }
+
+        if (((*it).second.*creator).empty())
+        {
+            // no parcel of this type has been sent yet
+            histogram_parameters& params = (*it).second.*parameters;
+            params.min_boundary = min_boundary;
+            params.max_boundary = max_boundary;
+            params.num_buckets = num_buckets;
+            return coalescing_counter_registry::get_counter_values_type();
+        }
+
+        coalescing_counter_registry::get_counter_values_type result;
+        ((*it).second.*creator)(
+            min_boundary, max_boundary, num_buckets, result);
+        return result;
+    }
+
+    coalescing_counter_registry::get_counter_values_type
+    coalescing_counter_registry::get_batch_size_histogram_counter(
+        std::string const& name, std::int64_t min_boundary,
+        std::int64_t max_boundary, std::int64_t num_buckets)
+    {
+        return get_histogram_counter(name,
+            &counter_functions::batch_size_histogram_creator,
+            &counter_functions::batch_size_histogram, min_boundary,
+            max_boundary, num_buckets);
+    }
+
+    coalescing_counter_registry::get_counter_values_type
+    coalescing_counter_registry::get_queueing_delay_histogram_counter(
+        std::string const& name, std::int64_t min_boundary,
+        std::int64_t max_boundary, std::int64_t num_buckets)
+    {
+        return get_histogram_counter(name,
+            &counter_functions::queueing_delay_histogram_creator,
+            &counter_functions::queueing_delay_histogram, min_boundary,
+            max_boundary, num_buckets);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool coalescing_counter_registry::counter_discoverer(
         performance_counters::counter_info const& info,
@@ -41,6 +41,8 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      mode = fixed
+    //      latency_budget = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +51,16 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   // 'fixed': coalesce the parcels of each action separately
+                   // using num_messages and interval, 'adaptive': coalesce the
+                   // parcels of all actions sent to the same destination,
+                   // tuning the number of parcels per message to the
+                   // observed arrival rate
+                   "mode = fixed\n"
+                   // maximal time (in microseconds) a parcel may be delayed by
+                   // adaptive coalescing
+                   "latency_budget = 100";
         }
     };
 }    // namespace hpx::traits
@@ -84,6 +95,20 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            return hpx::get_config_entry(
+                       "hpx.plugins.coalescing_message_handler.mode",
+                       "fixed") == "adaptive";
+        }
+
+        std::size_t get_latency_budget(std::size_t latency_budget)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_budget",
+                latency_budget));
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
@@ -112,6 +137,9 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , latency_budget_(
+            std::int64_t(detail::get_latency_budget(interval_)) * 1000)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -121,6 +149,7 @@ namespace hpx::plugins::parcel {
       , started_at_(hpx::chrono::high_resolution_clock::now())
       , reset_time_num_parcels_(0)
       , last_parcel_time_(started_at_)
+      , first_parcel_time_(started_at_)
       , histogram_min_boundary_(-1)
       , histogram_max_boundary_(-1)
       , histogram_num_buckets_(-1)
@@ -139,6 +168,12 @@ namespace hpx::plugins::parcel {
                 this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
+                this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_batch_size_histogram_creator,
+                this),
+            hpx::bind_front(&coalescing_message_handler::
+                                get_queueing_delay_histogram_creator,
                 this));
 
         // register parameter update callbacks
@@ -150,6 +185,12 @@ namespace hpx::plugins::parcel {
             hpx::bind(&coalescing_message_handler::update_interval, this));
     }
 
+    coalescing_message_handler::~coalescing_message_handler()
+    {
+        if (coalescer_)
+            coalescer_->remove_handler(this);
+    }
+
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
         parcelset::parcel p, write_handler_type f)
     {
@@ -168,12 +209,14 @@ namespace hpx::plugins::parcel {
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (adaptive coalescing makes this decision based on the arrival rate
+        // of all parcels sent to the destination).
         if (stopped_ ||
-            (buffer_.empty() &&
+            (!adaptive_ && buffer_.empty() &&
                 std::chrono::nanoseconds(time_since_last_parcel) > interval))
         {
-            ++num_messages_;
+            record_message_locked(1, 0);
             l.unlock();
 
             // this instance should not buffer parcels anymore
@@ -181,12 +224,30 @@ namespace hpx::plugins::parcel {
             return;
         }
 
+        if (adaptive_)
+        {
+            // all message handlers for the same destination share the
+            // instance coalescing their parcels
+            if (!coalescer_)
+            {
+                coalescer_ = destination_coalescer::get(
+                    pp_, dest, num_coalesced_parcels_, latency_budget_);
+            }
+
+            std::shared_ptr<destination_coalescer> coalescer = coalescer_;
+            l.unlock();
+
+            coalescer->put_parcel(this, HPX_MOVE(p), HPX_MOVE(f));
+            return;
+        }
+
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, HPX_MOVE(p), HPX_MOVE(f));
 
         switch (s)
         {
         case detail::message_buffer::first_message:
+            first_parcel_time_ = parcel_time;
             [[fallthrough]];
         case detail::message_buffer::normal:
             // start deadline timer to flush buffer
@@ -269,13 +330,22 @@ namespace hpx::plugins::parcel {
             timer_.stop();    // interrupt timer
         }
 
+        if (adaptive_)
+        {
+            std::shared_ptr<destination_coalescer> coalescer = coalescer_;
+            l.unlock();
+
+            return coalescer && coalescer->flush();
+        }
+
         if (buffer_.empty())
             return false;
 
         detail::message_buffer buff(num_coalesced_parcels_);
         std::swap(buff, buffer_);
 
-        ++num_messages_;
+        record_message_locked(buff.size(),
+            hpx::chrono::high_resolution_clock::now() - first_parcel_time_);
         l.unlock();
 
         HPX_ASSERT(nullptr != pp_);
@@ -284,6 +354,24 @@ namespace hpx::plugins::parcel {
         return true;
     }
 
+    void coalescing_message_handler::message_sent(
+        std::size_t num_parcels, std::int64_t queueing_delay)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        record_message_locked(num_parcels, queueing_delay);
+    }
+
+    void coalescing_message_handler::record_message_locked(
+        std::size_t num_parcels, std::int64_t queueing_delay)
+    {
+        ++num_messages_;
+
+        if (batch_sizes_.collector_)
+            (*batch_sizes_.collector_)(double(num_parcels));
+        if (queueing_delays_.collector_)
+            (*queueing_delays_.collector_)(double(queueing_delay));
+    }
+
     // performance counter values
     std::int64_t coalescing_message_handler::get_average_time_between_parcels(
         bool reset)
@@ -429,6 +517,91 @@ namespace hpx::plugins::parcel {
             this);
     }
 
+    std::vector<std::int64_t> coalescing_message_handler::get_histogram(
+        std::unique_lock<mutex_type>& l, histogram_data const& data,
+        char const* name) const
+    {
+        std::vector<std::int64_t> result;
+        if (!data.collector_)
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_message_handler::get_histogram",
+                "{} counter was not initialized for action type: {}", name,
+                action_name_);
+            return result;
+        }
+
+        // first add histogram parameters
+        result.push_back(data.min_boundary_);
+        result.push_back(data.max_boundary_);
+        result.push_back(data.num_buckets_);
+
+        auto histogram = hpx::util::histogram(*data.collector_);
+        for (auto const& item : histogram)
+        {
+            result.push_back(std::int64_t(item.second * 1000));
+        }
+
+        return result;
+    }
+
+    void coalescing_message_handler::create_histogram(histogram_data& data,
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets)
+    {
+        if (data.collector_)
+            return;
+
+        data.min_boundary_ = min_boundary;
+        data.max_boundary_ = max_boundary;
+        data.num_buckets_ = num_buckets;
+
+        data.collector_.reset(new histogram_collector_type(
+            hpx::util::tag::histogram::num_bins = double(num_buckets),
+            hpx::util::tag::histogram::min_range = double(min_boundary),
+            hpx::util::tag::histogram::max_range = double(max_boundary)));
+    }
+
+    std::vector<std::int64_t>
+    coalescing_message_handler::get_batch_size_histogram(bool /* reset */)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return get_histogram(l, batch_sizes_, "batch-size-histogram");
+    }
+
+    void coalescing_message_handler::get_batch_size_histogram_creator(
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets,
+        hpx::function<std::vector<std::int64_t>(bool)>& result)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        create_histogram(batch_sizes_, min_boundary, max_boundary, num_buckets);
+
+        result = hpx::bind_front(
+            &coalescing_message_handler::get_batch_size_histogram, this);
+    }
+
+    std::vector<std::int64_t>
+    coalescing_message_handler::get_queueing_delay_histogram(bool /* reset */)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        return get_histogram(l, queueing_delays_, "queueing-delay-histogram");
+    }
+
+    void coalescing_message_handler::get_queueing_delay_histogram_creator(
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets,
+        hpx::function<std::vector<std::int64_t>(bool)>& result)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        create_histogram(
+            queueing_delays_, min_boundary, max_boundary, num_buckets);
+
+        result = hpx::bind_front(
+            &coalescing_message_handler::get_queueing_delay_histogram, this);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // register the given action (called during startup)
     void coalescing_message_handler::register_action(
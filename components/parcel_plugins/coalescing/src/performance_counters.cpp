@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <exception>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -543,6 +544,159 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The histograms of the sizes of the generated messages and of the time
+    // parcels were delayed by coalescing share their implementation
+    using get_histogram_counter_type =
+        coalescing_counter_registry::get_counter_values_type (
+            coalescing_counter_registry::*)(std::string const&, std::int64_t,
+            std::int64_t, std::int64_t);
+
+    struct histogram_counter_surrogate
+    {
+        histogram_counter_surrogate(get_histogram_counter_type get_counter,
+            std::string const& action_name, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets)
+          : get_counter_(get_counter)
+          , action_name_(action_name)
+          , min_boundary_(min_boundary)
+          , max_boundary_(max_boundary)
+          , num_buckets_(num_buckets)
+        {
+        }
+
+        histogram_counter_surrogate(histogram_counter_surrogate const& rhs)
+          : get_counter_(rhs.get_counter_)
+          , action_name_(rhs.action_name_)
+          , min_boundary_(rhs.min_boundary_)
+          , max_boundary_(rhs.max_boundary_)
+          , num_buckets_(rhs.num_buckets_)
+        {
+        }
+
+        std::vector<std::int64_t> operator()(bool reset)
+        {
+            {
+                std::lock_guard<hpx::spinlock> l(mtx_);
+                if (counter_.empty())
+                {
+                    counter_ = (coalescing_counter_registry::instance().*
+                        get_counter_)(action_name_, min_boundary_,
+                        max_boundary_, num_buckets_);
+
+                    // no counter available yet
+                    if (counter_.empty())
+                        return coalescing_counter_registry::empty_histogram(
+                            reset);
+                }
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::spinlock mtx_;
+        hpx::function<std::vector<std::int64_t>(bool)> counter_;
+        get_histogram_counter_type get_counter_;
+        std::string action_name_;
+        std::int64_t min_boundary_;
+        std::int64_t max_boundary_;
+        std::int64_t num_buckets_;
+    };
+
+    hpx::naming::gid_type histogram_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec, char const* creator_name,
+        get_histogram_counter_type get_counter, std::int64_t max_boundary)
+    {
+        switch (info.type_)
+        {
+        case performance_counters::counter_type::histogram:
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, creator_name,
+                    "invalid counter name for histogram (instance name must "
+                    "not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            // split parameters, extract separate values
+            std::vector<std::string> params;
+            hpx::string_util::split(params, paths.parameters_,
+                hpx::string_util::is_any_of(","),
+                hpx::string_util::token_compress_mode::off);
+
+            if (params.empty() || params[0].empty())
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, creator_name,
+                    "invalid counter parameter for histogram: must specify "
+                    "an action type");
+                return naming::invalid_gid;
+            }
+
+            std::int64_t min_boundary = 0;
+            std::int64_t num_buckets = 20;
+
+            if (params.size() > 1 && !params[1].empty())
+                min_boundary = util::from_string<std::int64_t>(params[1]);
+            if (params.size() > 2 && !params[2].empty())
+                max_boundary = util::from_string<std::int64_t>(params[2]);
+            if (params.size() > 3 && !params[3].empty())
+                num_buckets = util::from_string<std::int64_t>(params[3]);
+
+            // ask registry
+            hpx::function<std::vector<std::int64_t>(bool)> f =
+                (coalescing_counter_registry::instance().*get_counter)(
+                    params[0], min_boundary, max_boundary, num_buckets);
+
+            if (!f.empty())
+            {
+                return performance_counters::detail::create_raw_counter(
+                    info, HPX_MOVE(f), ec);
+            }
+
+            // the counter is not available yet, create surrogate function
+            return performance_counters::detail::create_raw_counter(info,
+                histogram_counter_surrogate(get_counter, params[0],
+                    min_boundary, max_boundary, num_buckets),
+                ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, creator_name,
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
+    hpx::naming::gid_type batch_size_histogram_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return histogram_counter_creator(info, ec,
+            "batch_size_histogram_counter_creator",
+            &coalescing_counter_registry::get_batch_size_histogram_counter,
+            100);
+    }
+
+    hpx::naming::gid_type queueing_delay_histogram_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return histogram_counter_creator(info, ec,
+            "queueing_delay_histogram_counter_creator",
+            &coalescing_counter_registry::get_queueing_delay_histogram_counter,
+            1000000);    // 1ms
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // This function will be registered as a startup function for HPX below.
     //
@@ -595,7 +749,25 @@ namespace hpx::plugins::parcel {
                 "the action which is given by the counter parameter",
                 HPX_PERFORMANCE_COUNTER_V1,
                 &time_between_parcels_histogram_counter_creator,
-                &counter_discoverer, "ns/0.1%"}};
+                &counter_discoverer, "ns/0.1%"},
+            // /coalescing(...)/count/batch-size-histogram@action-name,min,max,buckets
+            {"/coalescing/count/batch-size-histogram",
+                counter_type::histogram,
+                "returns the histogram for the number of parcels sent in the "
+                "messages carrying parcels of the action which is given by "
+                "the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &batch_size_histogram_counter_creator, &counter_discoverer,
+                "0.1%"},
+            // /coalescing(...)/time/queueing-delay-histogram@action-name,min,max,buckets
+            {"/coalescing/time/queueing-delay-histogram",
+                counter_type::histogram,
+                "returns the histogram for the times parcels of the action "
+                "which is given by the counter parameter were delayed by "
+                "coalescing (measured for the oldest parcel of each message)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &queueing_delay_histogram_counter_creator, &counter_discoverer,
+                "ns/0.1%"}};
 
         // Install the counter types, un-installation of the types is handled
         // automatically.
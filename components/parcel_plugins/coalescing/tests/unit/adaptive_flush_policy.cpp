@@ -0,0 +1,102 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using hpx::plugins::parcel::detail::adaptive_flush_policy;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_no_history()
+{
+    adaptive_flush_policy policy(50, 100000);
+
+    // nothing is known about the arrival rate, send parcels directly
+    HPX_TEST_EQ(policy.threshold(), std::size_t(1));
+
+    policy.arrived(0);
+    HPX_TEST_EQ(policy.threshold(), std::size_t(1));
+}
+
+void test_arrival_rate()
+{
+    // 100us latency budget
+    adaptive_flush_policy policy(50, 100000);
+
+    // a parcel every 10us: 10 parcels arrive within the budget
+    std::int64_t now = 0;
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.arrived(now);
+        now += 10000;
+    }
+    HPX_TEST_EQ(policy.threshold(), std::size_t(10));
+
+    // a parcel every 1us: capped by the maximal number of parcels
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.arrived(now);
+        now += 1000;
+    }
+    HPX_TEST_EQ(policy.threshold(), std::size_t(50));
+
+    // a parcel every 1ms: coalescing does not pay off anymore
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.arrived(now);
+        now += 1000000;
+    }
+    HPX_TEST_EQ(policy.threshold(), std::size_t(1));
+}
+
+void test_feedback()
+{
+    adaptive_flush_policy policy(1000, 100000);
+
+    std::int64_t now = 0;
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.arrived(now);
+        now += 1000;
+    }
+    HPX_TEST_EQ(policy.threshold(), std::size_t(100));
+
+    // the budget expired before the message was filled
+    policy.sent(100000, true);
+    HPX_TEST_EQ(policy.threshold(), std::size_t(50));
+
+    policy.sent(100000, true);
+    HPX_TEST_EQ(policy.threshold(), std::size_t(25));
+
+    // messages filled quickly recover the threshold
+    for (int i = 0; i != 10; ++i)
+    {
+        policy.sent(1000, false);
+    }
+    HPX_TEST_EQ(policy.threshold(), std::size_t(100));
+
+    // the correction is bounded
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.sent(100000, true);
+    }
+    HPX_TEST_EQ(policy.threshold(), std::size_t(6));
+}
+
+int main()
+{
+    test_no_history();
+    test_arrival_rate();
+    test_feedback();
+
+    return hpx::util::report_errors();
+}
+#endif
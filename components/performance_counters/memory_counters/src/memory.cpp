@@ -6,6 +6,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
 #include <hpx/components_base/component_startup_shutdown.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
@@ -39,6 +40,17 @@ namespace hpx { namespace performance_counters { namespace memory {
             "returns the total available memory on the node", "kB",
             pc::counter_type::raw);
 #endif
+        pc::install_counter_type("/runtime/memory/slab-hits",
+            &hpx::util::get_slab_allocator_hits,
+            "returns the number of small object allocations (thread "
+            "descriptions, shared states, function objects) served from the "
+            "slabs of the allocating thread on the referenced locality",
+            "", pc::counter_type::monotonically_increasing);
+        pc::install_counter_type("/runtime/memory/slab-misses",
+            &hpx::util::get_slab_allocator_misses,
+            "returns the number of small object allocations which required "
+            "allocating a new slab on the referenced locality",
+            "", pc::counter_type::monotonically_increasing);
     }
 
     ///////////////////////////////////////////////////////////////////////////
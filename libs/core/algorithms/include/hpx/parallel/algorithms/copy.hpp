@@ -311,12 +311,14 @@ namespace hpx {
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
 #include <hpx/execution/algorithms/detail/is_negative.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
@@ -558,8 +560,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 InIter1 first, InIter2 last, OutIter dest, Pred&& pred,
                 Proj&& proj /* = Proj()*/)
             {
-                return sequential_copy_if(first, last, dest,
-                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                if constexpr (hpx::traits::is_random_access_iterator_v<
+                                  InIter1> &&
+                    hpx::traits::is_sized_sentinel_for_v<InIter2, InIter1>)
+                {
+                    return sequential_copy_if_n<ExPolicy>(first,
+                        detail::distance(first, last), dest,
+                        HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                }
+                else
+                {
+                    return sequential_copy_if(first, last, dest,
+                        HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
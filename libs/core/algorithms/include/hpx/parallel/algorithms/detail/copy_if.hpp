@@ -0,0 +1,58 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // copy the count elements starting at first which satisfy the given
+    // predicate to dest
+    template <typename ExPolicy>
+    struct sequential_copy_if_n_t final
+      : hpx::functional::detail::tag_fallback<sequential_copy_if_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename Pred,
+            typename Proj>
+        friend constexpr util::in_out_result<InIter, OutIter>
+        tag_fallback_invoke(sequential_copy_if_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, Pred&& pred, Proj&& proj)
+        {
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+                    *dest++ = *first;
+            }
+            return util::in_out_result<InIter, OutIter>{
+                HPX_MOVE(first), HPX_MOVE(dest)};
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_copy_if_n_t<ExPolicy> sequential_copy_if_n =
+        sequential_copy_if_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename Pred, typename Proj>
+    constexpr util::in_out_result<InIter, OutIter> sequential_copy_if_n(
+        InIter first, std::size_t count, OutIter dest, Pred&& pred,
+        Proj&& proj)
+    {
+        return sequential_copy_if_n_t<ExPolicy>{}(first, count, dest,
+            HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
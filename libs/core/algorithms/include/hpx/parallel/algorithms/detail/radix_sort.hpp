@@ -0,0 +1,444 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps arithmetic keys onto unsigned integers of the same size such that
+    // the order of the integers is the order of the keys
+    template <typename T, typename Enable = void>
+    struct radix_key
+    {
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    {
+        using type = std::make_unsigned_t<T>;
+
+        static constexpr type encode(T value) noexcept
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                // move negative values below all positive ones
+                return type(
+                    type(value) ^ (type(1) << (sizeof(T) * CHAR_BIT - 1)));
+            }
+            else
+            {
+                return type(value);
+            }
+        }
+    };
+
+    template <typename T>
+    struct radix_key<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>>
+    {
+        using type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static type encode(T value) noexcept
+        {
+            // -0.0 and +0.0 compare equal, they have to be mapped to the same
+            // integer for the sort to be stable
+            if (value == T(0))
+            {
+                value = T(0);
+            }
+
+            type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+
+            // negative values are ordered in reverse, all of them are below
+            // all positive values
+            constexpr type sign = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (bits & sign) ? type(~bits) : type(bits | sign);
+        }
+    };
+
+    template <typename T, typename Enable = void>
+    inline constexpr bool is_radix_key_v = false;
+
+    template <typename T>
+    inline constexpr bool
+        is_radix_key_v<T, std::void_t<typename radix_key<T>::type>> = true;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Radix sorting is equivalent to sorting with the default comparators
+    // only: returns -1 for descending, 1 for ascending order, and 0 if the
+    // comparator is not known
+    template <typename Comp, typename T>
+    inline constexpr int radix_sort_order_v = 0;
+
+    template <typename T>
+    inline constexpr int radix_sort_order_v<less, T> = 1;
+
+    template <typename T>
+    inline constexpr int radix_sort_order_v<std::less<>, T> = 1;
+
+    template <typename T>
+    inline constexpr int radix_sort_order_v<std::less<T>, T> = 1;
+
+    template <typename T>
+    inline constexpr int radix_sort_order_v<greater, T> = -1;
+
+    template <typename T>
+    inline constexpr int radix_sort_order_v<std::greater<>, T> = -1;
+
+    template <typename T>
+    inline constexpr int radix_sort_order_v<std::greater<T>, T> = -1;
+
+    // The elements are accessed directly (no proxy references)
+    template <typename Iter>
+    inline constexpr bool is_radix_sort_iterator_v =
+        hpx::traits::is_random_access_iterator_v<Iter> &&
+        std::is_same_v<typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::value_type&>;
+
+    template <typename KeyIter, typename Comp>
+    inline constexpr bool is_radix_sortable_v =
+        is_radix_sort_iterator_v<KeyIter> &&
+        is_radix_key_v<typename std::iterator_traits<KeyIter>::value_type> &&
+        radix_sort_order_v<std::decay_t<Comp>,
+            typename std::iterator_traits<KeyIter>::value_type> != 0;
+
+    // Values sorted along with the keys are moved through a temporary buffer
+    template <typename ValueIter>
+    inline constexpr bool is_radix_sort_value_iterator_v =
+        is_radix_sort_iterator_v<ValueIter> &&
+        std::is_trivial_v<typename std::iterator_traits<ValueIter>::value_type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Describes whether (and how) a sequence can be radix sorted, the primary
+    // template handles sequences of arithmetic keys without projection
+    template <typename Iter, typename Comp, typename Proj,
+        typename Enable = void>
+    struct radix_sort_traits : std::false_type
+    {
+    };
+
+    // marks a radix sort without values
+    struct radix_sort_no_values
+    {
+    };
+
+    template <typename ValueIter>
+    struct radix_sort_value_type
+    {
+        using type = typename std::iterator_traits<ValueIter>::value_type;
+    };
+
+    template <>
+    struct radix_sort_value_type<radix_sort_no_values>
+    {
+        using type = radix_sort_no_values;
+    };
+
+    // sequences with less elements are sorted using comparisons
+    inline constexpr std::size_t radix_sort_limit = 65536;
+
+    // every task handles at least this many elements
+    inline constexpr std::size_t radix_sort_min_chunk = 16384;
+
+    inline constexpr std::size_t radix_sort_bits = 8;
+    inline constexpr std::size_t radix_sort_buckets = 1 << radix_sort_bits;
+
+    template <typename KeyIter, typename ValueIter>
+    class radix_sorter
+    {
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using encoded_type = typename radix_key<key_type>::type;
+
+        static constexpr bool has_values =
+            !std::is_same_v<ValueIter, radix_sort_no_values>;
+
+        static constexpr std::size_t num_digits = sizeof(key_type);
+
+        using histogram_type = std::size_t[num_digits][radix_sort_buckets];
+
+        using value_type = typename radix_sort_value_type<ValueIter>::type;
+
+    public:
+        radix_sorter(KeyIter keys, ValueIter values, std::size_t count,
+            int order, std::size_t num_chunks)
+          : keys_(keys)
+          , values_(values)
+          , count_(count)
+          , flip_(order < 0 ? ~encoded_type(0) : encoded_type(0))
+          , num_chunks_(num_chunks)
+          , chunk_size_((count + num_chunks - 1) / num_chunks)
+          , histograms_(new histogram_type[num_chunks])
+          , offsets_(num_chunks * radix_sort_buckets)
+        {
+        }
+
+        template <typename Executor>
+        void call(Executor&& exec)
+        {
+            std::unique_ptr<key_type[]> key_buffer(new key_type[count_]);
+            std::unique_ptr<value_type[]> value_buffer;
+            if constexpr (has_values)
+            {
+                value_buffer.reset(new value_type[count_]);
+            }
+
+            // count the occurrences of all digits in a single pass
+            execution::bulk_sync_execute(
+                exec,
+                [this](std::size_t chunk) {
+                    count_all_digits(chunk);
+                },
+                hpx::util::counting_shape(num_chunks_));
+
+            bool in_buffer = false;
+            bool first_pass = true;
+            for (std::size_t digit = 0; digit != num_digits; ++digit)
+            {
+                // the sequence is ordered by the digits seen so far if all
+                // keys share the current one
+                if (is_trivial_digit(digit))
+                {
+                    continue;
+                }
+
+                // the counts of the first pass are known already, the keys
+                // have moved between the chunks since then
+                if (!first_pass)
+                {
+                    execution::bulk_sync_execute(
+                        exec,
+                        [&, this](std::size_t chunk) {
+                            if (in_buffer)
+                                count_digit(key_buffer.get(), chunk, digit);
+                            else
+                                count_digit(keys_, chunk, digit);
+                        },
+                        hpx::util::counting_shape(num_chunks_));
+                }
+                first_pass = false;
+
+                compute_offsets(digit);
+
+                execution::bulk_sync_execute(
+                    exec,
+                    [&, this](std::size_t chunk) {
+                        if (in_buffer)
+                        {
+                            scatter(key_buffer.get(), value_buffer.get(),
+                                keys_, values_, chunk, digit);
+                        }
+                        else
+                        {
+                            scatter(keys_, values_, key_buffer.get(),
+                                value_buffer.get(), chunk, digit);
+                        }
+                    },
+                    hpx::util::counting_shape(num_chunks_));
+
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                // move the result back into the sequence
+                execution::bulk_sync_execute(
+                    exec,
+                    [&, this](std::size_t chunk) {
+                        auto const [begin, end] = chunk_range(chunk);
+                        std::copy(key_buffer.get() + begin,
+                            key_buffer.get() + end, keys_ + begin);
+                        if constexpr (has_values)
+                        {
+                            std::copy(value_buffer.get() + begin,
+                                value_buffer.get() + end, values_ + begin);
+                        }
+                    },
+                    hpx::util::counting_shape(num_chunks_));
+            }
+        }
+
+    private:
+        std::pair<std::size_t, std::size_t> chunk_range(
+            std::size_t chunk) const noexcept
+        {
+            std::size_t const begin = (std::min)(chunk * chunk_size_, count_);
+            return {begin, (std::min)(begin + chunk_size_, count_)};
+        }
+
+        encoded_type encode(key_type const& key) const noexcept
+        {
+            return encoded_type(radix_key<key_type>::encode(key) ^ flip_);
+        }
+
+        static constexpr std::size_t get_digit(
+            encoded_type value, std::size_t digit) noexcept
+        {
+            return std::size_t(value >> (digit * radix_sort_bits)) &
+                (radix_sort_buckets - 1);
+        }
+
+        void count_all_digits(std::size_t chunk)
+        {
+            histogram_type& histogram = histograms_[chunk];
+            std::fill(&histogram[0][0],
+                &histogram[0][0] + num_digits * radix_sort_buckets,
+                std::size_t(0));
+
+            auto const [begin, end] = chunk_range(chunk);
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                encoded_type const value = encode(keys_[i]);
+                for (std::size_t digit = 0; digit != num_digits; ++digit)
+                {
+                    ++histogram[digit][get_digit(value, digit)];
+                }
+            }
+        }
+
+        template <typename Iter>
+        void count_digit(Iter keys, std::size_t chunk, std::size_t digit)
+        {
+            std::size_t* histogram = histograms_[chunk][digit];
+            std::fill(
+                histogram, histogram + radix_sort_buckets, std::size_t(0));
+
+            auto const [begin, end] = chunk_range(chunk);
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                ++histogram[get_digit(encode(keys[i]), digit)];
+            }
+        }
+
+        // The total number of keys per digit value does not change between
+        // passes, the histograms of the first pass are sufficient to detect
+        // digits shared by all keys
+        bool is_trivial_digit(std::size_t digit) const noexcept
+        {
+            std::size_t const bucket = get_digit(encode(keys_[0]), digit);
+            std::size_t total = 0;
+            for (std::size_t chunk = 0; chunk != num_chunks_; ++chunk)
+            {
+                total += histograms_[chunk][digit][bucket];
+            }
+            return total == count_;
+        }
+
+        // the position each chunk writes the keys with a given digit value to
+        void compute_offsets(std::size_t digit)
+        {
+            std::size_t offset = 0;
+            for (std::size_t bucket = 0; bucket != radix_sort_buckets;
+                 ++bucket)
+            {
+                for (std::size_t chunk = 0; chunk != num_chunks_; ++chunk)
+                {
+                    offsets_[chunk * radix_sort_buckets + bucket] = offset;
+                    offset += histograms_[chunk][digit][bucket];
+                }
+            }
+            HPX_ASSERT(offset == count_);
+        }
+
+        template <typename SrcKeys, typename SrcValues, typename DestKeys,
+            typename DestValues>
+        void scatter(SrcKeys src_keys, SrcValues src_values,
+            DestKeys dest_keys, DestValues dest_values, std::size_t chunk,
+            std::size_t digit)
+        {
+            std::size_t* offsets = &offsets_[chunk * radix_sort_buckets];
+
+            auto const [begin, end] = chunk_range(chunk);
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                std::size_t const pos =
+                    offsets[get_digit(encode(src_keys[i]), digit)]++;
+                dest_keys[pos] = src_keys[i];
+                if constexpr (has_values)
+                {
+                    dest_values[pos] = src_values[i];
+                }
+            }
+        }
+
+        KeyIter keys_;
+        ValueIter values_;
+        std::size_t count_;
+        encoded_type flip_;
+        std::size_t num_chunks_;
+        std::size_t chunk_size_;
+        std::unique_ptr<histogram_type[]> histograms_;
+        std::vector<std::size_t> offsets_;
+    };
+
+    // Sort the keys (and the values along with them) using a least
+    // significant digit radix sort. All passes are split into one chunk per
+    // core, each of which maintains its own histogram.
+    template <typename ExPolicy, typename Comp, typename KeyIter,
+        typename ValueIter = radix_sort_no_values>
+    void parallel_radix_sort(ExPolicy&& policy, KeyIter keys,
+        std::size_t count, ValueIter values = ValueIter())
+    {
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+
+        if (count < 2)
+        {
+            return;
+        }
+
+        std::size_t const cores =
+            execution::processing_units_count(policy.parameters(),
+                policy.executor(), hpx::chrono::null_duration, count);
+
+        std::size_t const num_chunks = (std::max)(std::size_t(1),
+            (std::min)(cores, count / radix_sort_min_chunk));
+
+        radix_sorter<KeyIter, ValueIter> sorter(keys, values, count,
+            radix_sort_order_v<std::decay_t<Comp>, key_type>, num_chunks);
+        sorter.call(policy.executor());
+    }
+
+    template <typename Iter, typename Comp>
+    struct radix_sort_traits<Iter, Comp, util::projection_identity,
+        std::enable_if_t<is_radix_sortable_v<Iter, Comp>>> : std::true_type
+    {
+        template <typename ExPolicy>
+        static void call(ExPolicy&& policy, Iter first, std::size_t count)
+        {
+            parallel_radix_sort<ExPolicy, Comp>(
+                HPX_FORWARD(ExPolicy, policy), first, count);
+        }
+    };
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,65 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // remove the elements satisfying the given predicate from the count
+    // elements starting at first, returns the end of the remaining range
+    template <typename ExPolicy>
+    struct sequential_remove_if_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_remove_if_n_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Pred, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(
+            sequential_remove_if_n_t<ExPolicy>, FwdIter first,
+            std::size_t count, Pred&& pred, Proj&& proj)
+        {
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
+                    break;
+            }
+
+            FwdIter dest = first;
+            if (count != 0)
+            {
+                while (--count != 0)
+                {
+                    if (!HPX_INVOKE(pred, HPX_INVOKE(proj, *++first)))
+                        *dest++ = HPX_MOVE(*first);
+                }
+            }
+            return dest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_remove_if_n_t<ExPolicy>
+        sequential_remove_if_n = sequential_remove_if_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Pred,
+        typename Proj>
+    constexpr FwdIter sequential_remove_if_n(
+        FwdIter first, std::size_t count, Pred&& pred, Proj&& proj)
+    {
+        return sequential_remove_if_n_t<ExPolicy>{}(
+            first, count, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
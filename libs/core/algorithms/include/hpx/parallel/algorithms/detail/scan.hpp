@@ -0,0 +1,142 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+#include <hpx/parallel/util/loop.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // The counted versions of the scan algorithms are used for the
+    // sequential execution only if the length of the input range can be
+    // calculated without traversing it.
+    template <typename InIter, typename Sent, typename OutIter>
+    inline constexpr bool is_scan_n_compatible_v =
+        hpx::traits::is_random_access_iterator_v<InIter> &&
+        hpx::traits::is_random_access_iterator_v<OutIter> &&
+        (std::is_same_v<InIter, Sent> ||
+            hpx::traits::is_sized_sentinel_for_v<Sent, InIter>);
+
+    // Calculate the inclusive scan of the given range (starting with init),
+    // returns the scan result of the last element.
+    template <typename ExPolicy>
+    struct sequential_inclusive_scan_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_inclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_inclusive_scan_n_t<ExPolicy>
+        sequential_inclusive_scan_n = sequential_inclusive_scan_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op>
+    constexpr T sequential_inclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_inclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+    }
+#endif
+
+    // Calculate the exclusive scan of the given range (starting with init),
+    // returns the inclusive scan result of the last element.
+    template <typename ExPolicy>
+    struct sequential_exclusive_scan_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_exclusive_scan_n_t<ExPolicy>>
+    {
+    private:
+        template <typename InIter, typename OutIter, typename T, typename Op>
+        friend constexpr T tag_fallback_invoke(
+            sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+            std::size_t count, OutIter dest, T init, Op&& op)
+        {
+            T temp = init;
+            for (/* */; count-- != 0; (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = temp;
+                temp = init;
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_exclusive_scan_n_t<ExPolicy>
+        sequential_exclusive_scan_n = sequential_exclusive_scan_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op>
+    constexpr T sequential_exclusive_scan_n(
+        InIter first, std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        return sequential_exclusive_scan_n_t<ExPolicy>{}(
+            first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+    }
+#endif
+
+    // Combine the partial scan results of a partition with the value
+    // accumulated over all preceding partitions (dest[i] = op(val, dest[i])).
+    template <typename ExPolicy>
+    struct sequential_scan_update_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_scan_update_n_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename T, typename Op>
+        friend constexpr void tag_fallback_invoke(
+            sequential_scan_update_n_t<ExPolicy>, FwdIter dest,
+            std::size_t count, T const& val, Op&& op)
+        {
+            util::loop_n<std::decay_t<ExPolicy>>(
+                dest, count, [&val, &op](FwdIter it) -> void {
+                    *it = HPX_INVOKE(op, val, *it);
+                });
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_scan_update_n_t<ExPolicy>
+        sequential_scan_update_n = sequential_scan_update_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename T, typename Op>
+    constexpr void sequential_scan_update_n(
+        FwdIter dest, std::size_t count, T const& val, Op&& op)
+    {
+        sequential_scan_update_n_t<ExPolicy>{}(
+            dest, count, val, HPX_FORWARD(Op, op));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
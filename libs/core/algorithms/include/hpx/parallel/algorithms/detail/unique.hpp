@@ -0,0 +1,71 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // eliminate all but the first element from every consecutive group of
+    // equivalent elements of the count elements starting at first, returns
+    // the end of the remaining range
+    template <typename ExPolicy>
+    struct sequential_unique_n_t final
+      : hpx::functional::detail::tag_fallback<sequential_unique_n_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename Pred, typename Proj>
+        friend constexpr FwdIter tag_fallback_invoke(
+            sequential_unique_n_t<ExPolicy>, FwdIter first,
+            std::size_t count, Pred&& pred, Proj&& proj)
+        {
+            if (count == 0)
+                return first;
+
+            using element_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            FwdIter result = first;
+            element_type result_projected = HPX_INVOKE(proj, *result);
+            while (--count != 0)
+            {
+                if (!HPX_INVOKE(
+                        pred, result_projected, HPX_INVOKE(proj, *++first)))
+                {
+                    if (++result != first)
+                    {
+                        *result = HPX_MOVE(*first);
+                    }
+                    result_projected = HPX_INVOKE(proj, *result);
+                }
+            }
+            return ++result;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_unique_n_t<ExPolicy> sequential_unique_n =
+        sequential_unique_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename Pred,
+        typename Proj>
+    constexpr FwdIter sequential_unique_n(
+        FwdIter first, std::size_t count, Pred&& pred, Proj&& proj)
+    {
+        return sequential_unique_n_t<ExPolicy>{}(
+            first, count, HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
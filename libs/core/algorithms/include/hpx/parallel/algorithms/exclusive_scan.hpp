@@ -297,6 +297,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
@@ -341,20 +342,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return util::in_out_result<InIter, OutIter>{first, dest};
         }
 
-        template <typename InIter, typename OutIter, typename T, typename Op>
-        static constexpr T sequential_exclusive_scan_n(
-            InIter first, std::size_t count, OutIter dest, T init, Op&& op)
-        {
-            T temp = init;
-            for (/* */; count-- != 0; (void) ++first, ++dest)
-            {
-                init = HPX_INVOKE(op, init, *first);
-                *dest = temp;
-                temp = init;
-            }
-            return init;
-        }
-
         ///////////////////////////////////////////////////////////////////////
         template <typename IterPair>
         struct exclusive_scan
@@ -371,8 +358,20 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 ExPolicy, InIter first, Sent last, OutIter dest, T const& init,
                 Op&& op)
             {
-                return sequential_exclusive_scan(
-                    first, last, dest, init, HPX_FORWARD(Op, op));
+                if constexpr (is_scan_n_compatible_v<InIter, Sent, OutIter>)
+                {
+                    // the counted version of the scan can be vectorized
+                    auto const count = detail::distance(first, last);
+                    sequential_exclusive_scan_n<ExPolicy>(
+                        first, count, dest, init, HPX_FORWARD(Op, op));
+                    return util::in_out_result<InIter, OutIter>{
+                        std::next(first, count), std::next(dest, count)};
+                }
+                else
+                {
+                    return sequential_exclusive_scan(
+                        first, last, dest, init, HPX_FORWARD(Op, op));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter1, typename Sent,
@@ -411,12 +410,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               T val) mutable -> void {
                     FwdIter2 dst = get<1>(part_begin.get_iterator_tuple());
                     *dst++ = val;
-
-                    // MSVC 2015 fails if op is captured by reference
-                    util::loop_n<std::decay_t<ExPolicy>>(dst, part_size - 1,
-                        [=, &val](FwdIter2 it) mutable -> void {
-                            *it = HPX_INVOKE(op, val, *it);
-                        });
+                    sequential_scan_update_n<std::decay_t<ExPolicy>>(
+                        dst, part_size - 1, val, op);
                 };
 
                 return util::scan_partitioner<ExPolicy,
@@ -432,9 +427,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                             auto iters = part_begin.get_iterator_tuple();
                             if (get<0>(iters) != last)
                             {
-                                return sequential_exclusive_scan_n(
-                                    get<0>(iters), part_size - 1, get<1>(iters),
-                                    part_init, op);
+                                return sequential_exclusive_scan_n<
+                                    std::decay_t<ExPolicy>>(get<0>(iters),
+                                    part_size - 1, get<1>(iters), part_init,
+                                    op);
                             }
                             return part_init;
                         },
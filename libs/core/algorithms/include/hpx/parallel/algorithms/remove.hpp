@@ -215,6 +215,7 @@ namespace hpx {
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 #include <hpx/type_support/unused.hpp>
 
@@ -223,7 +224,9 @@ namespace hpx {
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/find.hpp>
+#include <hpx/parallel/algorithms/detail/remove.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
@@ -282,8 +285,18 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static Iter sequential(
                 ExPolicy, Iter first, Sent last, Pred&& pred, Proj&& proj)
             {
-                return sequential_remove_if(first, last,
-                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                if constexpr (hpx::traits::is_random_access_iterator_v<Iter> &&
+                    hpx::traits::is_sized_sentinel_for_v<Sent, Iter>)
+                {
+                    return sequential_remove_if_n<ExPolicy>(first,
+                        detail::distance(first, last), HPX_FORWARD(Pred, pred),
+                        HPX_FORWARD(Proj, proj));
+                }
+                else
+                {
+                    return sequential_remove_if(first, last,
+                        HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                }
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
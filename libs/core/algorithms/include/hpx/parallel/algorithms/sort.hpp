@@ -164,6 +164,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -334,6 +335,41 @@ namespace hpx { namespace parallel { inline namespace v1 {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        template <typename RadixSortTraits, typename ExPolicy,
+            typename RandomIt>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        parallel_radix_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last)
+        {
+            using algorithm_result =
+                util::detail::algorithm_result<ExPolicy, RandomIt>;
+
+            try
+            {
+                if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+                {
+                    return algorithm_result::get(
+                        execution::async_execute(policy.executor(),
+                            [policy, first, last]() mutable -> RandomIt {
+                                RadixSortTraits::call(
+                                    policy, first, last - first);
+                                return last;
+                            }));
+                }
+                else
+                {
+                    RadixSortTraits::call(policy, first, last - first);
+                    return algorithm_result::get(HPX_MOVE(last));
+                }
+            }
+            catch (...)
+            {
+                return algorithm_result::get(
+                    detail::handle_exception<ExPolicy, RandomIt>::call(
+                        std::current_exception()));
+            }
+        }
+
         // sort
         template <typename RandomIt>
         struct sort : public detail::algorithm<sort<RandomIt>, RandomIt>
@@ -365,6 +401,21 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 typedef util::detail::algorithm_result<ExPolicy, RandomIt>
                     algorithm_result;
 
+                // arithmetic keys compared using the default comparators are
+                // sorted without comparisons
+                using radix_sort_traits = detail::radix_sort_traits<RandomIt,
+                    std::decay_t<Comp>, std::decay_t<Proj>>;
+
+                if constexpr (radix_sort_traits::value)
+                {
+                    std::size_t const count = last - first;
+                    if (count >= radix_sort_limit)
+                    {
+                        return parallel_radix_sort_async<radix_sort_traits>(
+                            HPX_FORWARD(ExPolicy, policy), first, last);
+                    }
+                }
+
                 try
                 {
                     // call the sort routine and return the right type,
@@ -98,10 +98,12 @@ namespace hpx { namespace experimental {
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
 
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -124,6 +126,25 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return hpx::get<0>(HPX_FORWARD(Tuple, t));
             }
         };
+
+        // arithmetic keys are radix sorted, the values are moved along
+        template <typename KeyIter, typename ValueIter, typename Comp>
+        struct radix_sort_traits<hpx::util::zip_iterator<KeyIter, ValueIter>,
+            Comp, extract_key,
+            std::enable_if_t<is_radix_sortable_v<KeyIter, Comp> &&
+                is_radix_sort_value_iterator_v<ValueIter>>> : std::true_type
+        {
+            template <typename ExPolicy>
+            static void call(ExPolicy&& policy,
+                hpx::util::zip_iterator<KeyIter, ValueIter> first,
+                std::size_t count)
+            {
+                auto const& iterators = first.get_iterator_tuple();
+                parallel_radix_sort<ExPolicy, Comp>(
+                    HPX_FORWARD(ExPolicy, policy), hpx::get<0>(iterators),
+                    count, hpx::get<1>(iterators));
+            }
+        };
         /// \endcond
     }    // namespace detail
 }}}      // namespace hpx::parallel::v1
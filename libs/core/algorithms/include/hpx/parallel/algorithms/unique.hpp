@@ -297,6 +297,7 @@ namespace hpx {
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
@@ -307,6 +308,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/algorithms/detail/transfer.hpp>
+#include <hpx/parallel/algorithms/detail/unique.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
@@ -378,8 +380,19 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static InIter sequential(
                 ExPolicy, InIter first, Sent last, Pred&& pred, Proj&& proj)
             {
-                return sequential_unique(first, last, HPX_FORWARD(Pred, pred),
-                    HPX_FORWARD(Proj, proj));
+                if constexpr (hpx::traits::is_random_access_iterator_v<
+                                  InIter> &&
+                    hpx::traits::is_sized_sentinel_for_v<Sent, InIter>)
+                {
+                    return sequential_unique_n<ExPolicy>(first,
+                        detail::distance(first, last), HPX_FORWARD(Pred, pred),
+                        HPX_FORWARD(Proj, proj));
+                }
+                else
+                {
+                    return sequential_unique(first, last,
+                        HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                }
             }
 
             template <typename ExPolicy, typename FwdIter, typename Sent,
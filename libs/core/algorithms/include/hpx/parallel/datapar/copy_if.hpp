@@ -0,0 +1,120 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/copy_if.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The selected elements are compressed into consecutive lanes of the
+    // destination, which therefore has to be contiguous as well.
+    template <typename InIter, typename OutIter, typename Pred, typename Proj,
+        typename Enable = void>
+    struct copy_if_datapar_compatible : std::false_type
+    {
+    };
+
+    template <typename InIter, typename OutIter, typename Pred, typename Proj>
+    struct copy_if_datapar_compatible<InIter, OutIter, Pred, Proj,
+        std::enable_if_t<std::is_same_v<Proj, util::projection_identity> &&
+            util::detail::iterator_datapar_compatible<InIter>::value &&
+            util::detail::iterator_datapar_compatible<OutIter>::value &&
+            std::is_same_v<typename std::iterator_traits<InIter>::value_type,
+                typename std::iterator_traits<OutIter>::value_type>>>
+      : std::is_invocable<Pred&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<InIter>::value_type> const&>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename InIter>
+    struct datapar_copy_if
+    {
+        using value_type = typename std::iterator_traits<InIter>::value_type;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        static constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+        template <typename OutIter, typename Pred>
+        static util::in_out_result<InIter, OutIter> call(
+            InIter first, std::size_t count, OutIter dest, Pred& pred)
+        {
+            for (/**/; !util::detail::is_data_aligned(first) && count != 0;
+                 (void) --count, ++first)
+            {
+                if (HPX_INVOKE(pred, *first))
+                    *dest++ = *first;
+            }
+
+            for (/**/; count >= size; count -= size)
+            {
+                V values =
+                    traits::vector_pack_load<V, value_type>::aligned(first);
+                std::advance(dest,
+                    traits::compress_store(
+                        values, HPX_INVOKE(pred, values), dest));
+                std::advance(first, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                if (HPX_INVOKE(pred, *first))
+                    *dest++ = *first;
+            }
+
+            return util::in_out_result<InIter, OutIter>{
+                HPX_MOVE(first), HPX_MOVE(dest)};
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename InIter, typename OutIter,
+        typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::in_out_result<InIter, OutIter>
+    tag_invoke(sequential_copy_if_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, Pred&& pred, Proj&& proj)
+    {
+        if constexpr (copy_if_datapar_compatible<InIter, OutIter,
+                          std::decay_t<Pred>, std::decay_t<Proj>>::value)
+        {
+            return datapar_copy_if<InIter>::call(first, count, dest, pred);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_copy_if_n<base_policy_type>(first, count, dest,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -77,9 +77,18 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    // bool is an arithmetic type, but none of the supported vector pack
+    // backends can form vector packs from it
+    template <typename T>
+    struct is_vectorizable_value
+      : std::integral_constant<bool,
+            std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+    {
+    };
+
     template <typename Iter, typename Enable = void>
     struct iterator_datapar_compatible_impl
-      : std::is_arithmetic<typename std::iterator_traits<Iter>::value_type>
+      : is_vectorizable_value<typename std::iterator_traits<Iter>::value_type>
     {
     };
 
@@ -523,8 +523,19 @@ namespace hpx { namespace parallel { namespace util {
     tag_invoke(hpx::parallel::util::loop_n_t<ExPolicy>, Iter it,
         std::size_t count, F&& f)
     {
-        return hpx::parallel::util::detail::datapar_loop_n<Iter>::call(
-            it, count, HPX_FORWARD(F, f));
+        if constexpr (hpx::parallel::util::detail::iterator_datapar_compatible<
+                          Iter>::value)
+        {
+            return hpx::parallel::util::detail::datapar_loop_n<Iter>::call(
+                it, count, HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return loop_n<base_policy_type>(it, count, HPX_FORWARD(F, f));
+        }
     }
 
     template <typename ExPolicy, typename Iter, typename CancelToken,
@@ -534,8 +545,20 @@ namespace hpx { namespace parallel { namespace util {
     tag_invoke(hpx::parallel::util::loop_n_t<ExPolicy>, Iter it,
         std::size_t count, CancelToken& tok, F&& f)
     {
-        return hpx::parallel::util::detail::datapar_loop_n<Iter>::call(
-            it, count, tok, HPX_FORWARD(F, f));
+        if constexpr (hpx::parallel::util::detail::iterator_datapar_compatible<
+                          Iter>::value)
+        {
+            return hpx::parallel::util::detail::datapar_loop_n<Iter>::call(
+                it, count, tok, HPX_FORWARD(F, f));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return loop_n<base_policy_type>(
+                it, count, tok, HPX_FORWARD(F, f));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,377 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// make inspect happy: hpxinspect:nominmax
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized implementation compares whole vector packs, it is used
+    // only if the comparison operator can be applied to those and if no
+    // projection was specified.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct minmax_datapar_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F>
+    struct minmax_datapar_compatible<Iter, F, util::projection_identity,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value>>
+      : std::is_invocable<F const&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter>
+    struct datapar_minmax
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        static constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+        // Calculate the smallest and the largest value of the given range
+        // (count must not be zero). The vector packs keep the running
+        // minimum and maximum of each lane, those are combined at the end.
+        template <typename F>
+        static std::pair<value_type, value_type> min_max_values(
+            Iter it, std::size_t count, F const& f, bool calc_min,
+            bool calc_max)
+        {
+            value_type min_value = *it;
+            value_type max_value = min_value;
+
+            auto update = [&](value_type const& curr) {
+                if (HPX_INVOKE(f, curr, min_value))
+                    min_value = curr;
+                if (HPX_INVOKE(f, max_value, curr))
+                    max_value = curr;
+            };
+
+            for (/**/; !util::detail::is_data_aligned(it) && count != 0;
+                 --count, ++it)
+            {
+                update(*it);
+            }
+
+            if (count >= size)
+            {
+                V min_values(min_value);
+                V max_values(max_value);
+
+                for (/**/; count >= size; count -= size)
+                {
+                    V const curr =
+                        traits::vector_pack_load<V, value_type>::aligned(it);
+                    if (calc_min)
+                    {
+                        min_values = traits::choose(
+                            HPX_INVOKE(f, curr, min_values), curr, min_values);
+                    }
+                    if (calc_max)
+                    {
+                        max_values = traits::choose(
+                            HPX_INVOKE(f, max_values, curr), curr, max_values);
+                    }
+                    std::advance(it, size);
+                }
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    update(traits::get(min_values, i));
+                    update(traits::get(max_values, i));
+                }
+            }
+
+            for (/**/; count != 0; --count, ++it)
+            {
+                update(*it);
+            }
+
+            return {min_value, max_value};
+        }
+
+        // Find the first element in the given range for which the predicate
+        // returns true, returns the end of the range if there is none.
+        template <typename Pred>
+        static Iter find_first(Iter it, std::size_t count, Pred&& pred)
+        {
+            for (/**/; !util::detail::is_data_aligned(it) && count != 0;
+                 --count, ++it)
+            {
+                if (pred(*it))
+                    return it;
+            }
+
+            for (/**/; count >= size; count -= size)
+            {
+                int const offset = traits::find_first_of(
+                    pred(traits::vector_pack_load<V, value_type>::aligned(it)));
+                if (offset != -1)
+                    return std::next(it, offset);
+                std::advance(it, size);
+            }
+
+            for (/**/; count != 0; --count, ++it)
+            {
+                if (pred(*it))
+                    return it;
+            }
+            return it;
+        }
+
+        // Find the last element in the given range for which the predicate
+        // returns true, returns the end of the range if there is none.
+        template <typename Pred>
+        static Iter find_last(Iter it, std::size_t count, Pred&& pred)
+        {
+            Iter result = std::next(it, count);
+
+            for (/**/; !util::detail::is_data_aligned(it) && count != 0;
+                 --count, ++it)
+            {
+                if (pred(*it))
+                    result = it;
+            }
+
+            for (/**/; count >= size; count -= size)
+            {
+                int const offset = traits::find_last_of(
+                    pred(traits::vector_pack_load<V, value_type>::aligned(it)));
+                if (offset != -1)
+                    result = std::next(it, offset);
+                std::advance(it, size);
+            }
+
+            for (/**/; count != 0; --count, ++it)
+            {
+                if (pred(*it))
+                    result = it;
+            }
+            return result;
+        }
+
+        // The position of the smallest element is the first element which is
+        // not larger than the smallest value.
+        template <typename F>
+        static Iter min_element(Iter it, std::size_t count, F const& f)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            value_type const value =
+                min_max_values(it, count, f, true, false).first;
+            return find_first(it, count, [&](auto const& curr) {
+                using type = std::decay_t<decltype(curr)>;
+                return !HPX_INVOKE(f, type(value), curr);
+            });
+        }
+
+        // The position of the largest element is the last element which is
+        // not smaller than the largest value (this is consistent with the
+        // scalar implementation).
+        template <typename F>
+        static Iter max_element(Iter it, std::size_t count, F const& f)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            value_type const value =
+                min_max_values(it, count, f, false, true).second;
+            return find_last(it, count, [&](auto const& curr) {
+                using type = std::decay_t<decltype(curr)>;
+                return !HPX_INVOKE(f, curr, type(value));
+            });
+        }
+
+        template <typename F>
+        static util::min_max_result<Iter> minmax_element(
+            Iter it, std::size_t count, F const& f)
+        {
+            if (count == 0 || count == 1)
+                return {it, it};
+
+            auto const values = min_max_values(it, count, f, true, true);
+            Iter const min = find_first(it, count, [&](auto const& curr) {
+                using type = std::decay_t<decltype(curr)>;
+                return !HPX_INVOKE(f, type(values.first), curr);
+            });
+            Iter const max = find_last(it, count, [&](auto const& curr) {
+                using type = std::decay_t<decltype(curr)>;
+                return !HPX_INVOKE(f, curr, type(values.second));
+            });
+            return {min, max};
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_min_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax<FwdIter>::min_element(it, count, f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_min_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_min_element_t<ExPolicy>, FwdIter first, Sent last,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax<FwdIter>::min_element(
+                first, detail::distance(first, last), f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_min_element<base_policy_type>(
+                first, last, f, proj);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_max_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax<FwdIter>::max_element(it, count, f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_max_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE FwdIter tag_invoke(
+        sequential_max_element_t<ExPolicy>, FwdIter first, Sent last,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax<FwdIter>::max_element(
+                first, detail::distance(first, last), f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_max_element<base_policy_type>(
+                first, last, f, proj);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<FwdIter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, FwdIter it, std::size_t count,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax<FwdIter>::minmax_element(it, count, f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_minmax_element<base_policy_type>(
+                it, count, f, proj);
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename Sent, typename F,
+        typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<FwdIter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, FwdIter first, Sent last,
+        F const& f, Proj const& proj)
+    {
+        if constexpr (minmax_datapar_compatible<FwdIter, F, Proj>::value)
+        {
+            return datapar_minmax<FwdIter>::minmax_element(
+                first, detail::distance(first, last), f);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_minmax_element<base_policy_type>(
+                first, last, f, proj);
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,269 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_scan.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The scan algorithms use typed function objects (std::plus<T>) by
+    // default. Those can't be applied to vector packs, we use their
+    // transparent counterparts instead.
+    template <typename Op>
+    struct datapar_scan_op
+    {
+        using type = Op;
+
+        static constexpr Op const& get(Op const& op) noexcept
+        {
+            return op;
+        }
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::plus<T>>
+    {
+        using type = std::plus<>;
+
+        static constexpr type get(std::plus<T> const&) noexcept
+        {
+            return type{};
+        }
+    };
+
+    template <typename T>
+    struct datapar_scan_op<std::multiplies<T>>
+    {
+        using type = std::multiplies<>;
+
+        static constexpr type get(std::multiplies<T> const&) noexcept
+        {
+            return type{};
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The vectorized scan is used only if all elements (and the initial value)
+    // have the same arithmetic type and if the operation can be applied to
+    // vector packs.
+    template <typename InIter, typename OutIter, typename T, typename Op,
+        typename Enable = void>
+    struct scan_datapar_compatible : std::false_type
+    {
+    };
+
+    template <typename InIter, typename OutIter, typename T, typename Op>
+    struct scan_datapar_compatible<InIter, OutIter, T, Op,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<InIter>::value &&
+            util::detail::iterator_datapar_compatible<OutIter>::value &&
+            std::is_same_v<typename std::iterator_traits<InIter>::value_type,
+                T> &&
+            std::is_same_v<typename std::iterator_traits<OutIter>::value_type,
+                T>>>
+      : std::is_invocable_r<traits::vector_pack_type_t<T>, Op const&,
+            traits::vector_pack_type_t<T> const&,
+            traits::vector_pack_type_t<T> const&>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter>
+    struct datapar_scan
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        static constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+        // Each vector pack is scanned in registers, the result is combined
+        // with the value accumulated so far, whose new value is the last
+        // element of the pack.
+        template <typename OutIter, typename Op>
+        static value_type inclusive_scan_n(Iter first, std::size_t count,
+            OutIter dest, value_type init, Op const& op)
+        {
+            for (/**/;
+                 !(util::detail::is_data_aligned(first) &&
+                     util::detail::is_data_aligned(dest)) &&
+                 count != 0;
+                 --count, (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = init;
+            }
+
+            for (/**/; count >= size; count -= size)
+            {
+                V values = HPX_INVOKE(op, V(init),
+                    traits::inclusive_scan(
+                        traits::vector_pack_load<V, value_type>::aligned(first),
+                        op));
+                init = traits::get(values, size - 1);
+                traits::vector_pack_store<V, value_type>::aligned(values, dest);
+
+                std::advance(first, size);
+                std::advance(dest, size);
+            }
+
+            for (/**/; count != 0; --count, (void) ++first, ++dest)
+            {
+                init = HPX_INVOKE(op, init, *first);
+                *dest = init;
+            }
+            return init;
+        }
+
+        // The exclusive scan of a vector pack is its inclusive scan shifted
+        // by one lane.
+        template <typename OutIter, typename Op>
+        static value_type exclusive_scan_n(Iter first, std::size_t count,
+            OutIter dest, value_type init, Op const& op)
+        {
+            for (/**/;
+                 !(util::detail::is_data_aligned(first) &&
+                     util::detail::is_data_aligned(dest)) &&
+                 count != 0;
+                 --count, (void) ++first, ++dest)
+            {
+                value_type temp = init;
+                init = HPX_INVOKE(op, init, *first);
+                *dest = temp;
+            }
+
+            for (/**/; count >= size; count -= size)
+            {
+                V sums = HPX_INVOKE(op, V(init),
+                    traits::inclusive_scan(
+                        traits::vector_pack_load<V, value_type>::aligned(first),
+                        op));
+                V values = traits::slide_right(sums, init);
+                traits::vector_pack_store<V, value_type>::aligned(values, dest);
+                init = traits::get(sums, size - 1);
+
+                std::advance(first, size);
+                std::advance(dest, size);
+            }
+
+            for (/**/; count != 0; --count, (void) ++first, ++dest)
+            {
+                value_type temp = init;
+                init = HPX_INVOKE(op, init, *first);
+                *dest = temp;
+            }
+            return init;
+        }
+
+        template <typename ExPolicy, typename Op>
+        static void scan_update_n(
+            Iter dest, std::size_t count, value_type const& val, Op const& op)
+        {
+            util::loop_n_ind<ExPolicy>(dest, count, [&val, &op](auto& v) {
+                using type = std::decay_t<decltype(v)>;
+                v = HPX_INVOKE(op, type(val), v);
+            });
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_inclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        using op_type = datapar_scan_op<std::decay_t<Op>>;
+        if constexpr (scan_datapar_compatible<InIter, OutIter, T,
+                          typename op_type::type>::value)
+        {
+            return datapar_scan<InIter>::inclusive_scan_n(
+                first, count, dest, HPX_MOVE(init), op_type::get(op));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_inclusive_scan_n<base_policy_type>(
+                first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+        }
+    }
+
+    template <typename ExPolicy, typename InIter, typename OutIter, typename T,
+        typename Op,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_exclusive_scan_n_t<ExPolicy>, InIter first,
+        std::size_t count, OutIter dest, T init, Op&& op)
+    {
+        using op_type = datapar_scan_op<std::decay_t<Op>>;
+        if constexpr (scan_datapar_compatible<InIter, OutIter, T,
+                          typename op_type::type>::value)
+        {
+            return datapar_scan<InIter>::exclusive_scan_n(
+                first, count, dest, HPX_MOVE(init), op_type::get(op));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_exclusive_scan_n<base_policy_type>(
+                first, count, dest, HPX_MOVE(init), HPX_FORWARD(Op, op));
+        }
+    }
+
+    template <typename ExPolicy, typename FwdIter, typename T, typename Op,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void tag_invoke(
+        sequential_scan_update_n_t<ExPolicy>, FwdIter dest, std::size_t count,
+        T const& val, Op&& op)
+    {
+        using op_type = datapar_scan_op<std::decay_t<Op>>;
+        if constexpr (scan_datapar_compatible<FwdIter, FwdIter, T,
+                          typename op_type::type>::value)
+        {
+            datapar_scan<FwdIter>::template scan_update_n<ExPolicy>(
+                dest, count, val, op_type::get(op));
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            sequential_scan_update_n<base_policy_type>(
+                dest, count, val, HPX_FORWARD(Op, op));
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,130 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/vector_pack_get_set.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_scan.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/executors/datapar/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/unique.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter, typename Pred, typename Proj,
+        typename Enable = void>
+    struct unique_datapar_compatible : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct unique_datapar_compatible<Iter, Pred, Proj,
+        std::enable_if_t<std::is_same_v<Proj, util::projection_identity> &&
+            util::detail::iterator_datapar_compatible<Iter>::value>>
+      : std::is_invocable<Pred&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&,
+            traits::vector_pack_type_t<
+                typename std::iterator_traits<Iter>::value_type> const&>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter>
+    struct datapar_unique
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        static constexpr std::size_t size = traits::vector_pack_size_v<V>;
+
+        // Every element is compared with its original predecessor instead of
+        // with the last element kept so far. Both are equivalent as the
+        // predicate is required to be an equivalence relation.
+        template <typename Pred>
+        static Iter call(Iter first, std::size_t count, Pred& pred)
+        {
+            if (count == 0)
+                return first;
+
+            value_type prev = *first;
+            Iter dest = ++first;
+            --count;
+
+            for (/**/; !util::detail::is_data_aligned(first) && count != 0;
+                 (void) --count, ++first)
+            {
+                value_type curr = *first;
+                if (!HPX_INVOKE(pred, prev, curr))
+                    *dest++ = curr;
+                prev = curr;
+            }
+
+            for (/**/; count >= size; count -= size)
+            {
+                V values =
+                    traits::vector_pack_load<V, value_type>::aligned(first);
+                V const prevs = traits::slide_right(values, prev);
+                prev = traits::get(values, size - 1);
+                std::advance(dest,
+                    traits::compress_store(
+                        values, !HPX_INVOKE(pred, prevs, values), dest));
+                std::advance(first, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                value_type curr = *first;
+                if (!HPX_INVOKE(pred, prev, curr))
+                    *dest++ = curr;
+                prev = curr;
+            }
+            return dest;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(
+        sequential_unique_n_t<ExPolicy>, Iter first, std::size_t count,
+        Pred&& pred, Proj&& proj)
+    {
+        if constexpr (unique_datapar_compatible<Iter, std::decay_t<Pred>,
+                          std::decay_t<Proj>>::value)
+        {
+            return datapar_unique<Iter>::call(first, count, pred);
+        }
+        else
+        {
+            using base_policy_type =
+                decltype((hpx::execution::experimental::to_non_simd(
+                    std::declval<ExPolicy>())));
+            return sequential_unique_n<base_policy_type>(first, count,
+                HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+        }
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -52,7 +52,7 @@ namespace hpx { namespace parallel { namespace util { namespace detail {
     ///////////////////////////////////////////////////////////////////////////
     template <typename... Iter>
     struct iterator_datapar_compatible_impl<hpx::util::zip_iterator<Iter...>>
-      : hpx::util::all_of<std::is_arithmetic<
+      : hpx::util::all_of<is_vectorizable_value<
             typename std::iterator_traits<Iter>::value_type>...>
     {
     };
@@ -0,0 +1,174 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the scalar and the vectorized (datapar) versions of
+// min_element, minmax_element, inclusive_scan, exclusive_scan, copy_if,
+// remove_if, and unique.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+// restore the input data before each run as some of the algorithms modify it
+template <typename T, typename F>
+double run_benchmark(int test_count, std::vector<T> const& org,
+    std::vector<T>& data, F&& f)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        hpx::copy(hpx::execution::par, org.begin(), org.end(), data.begin());
+
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        f();
+        time += hpx::chrono::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+template <typename ExPolicy, typename T>
+void run_benchmarks(ExPolicy policy, char const* name, int test_count,
+    std::vector<T> const& org)
+{
+    std::vector<T> data(org.size());
+    std::vector<T> dest(org.size());
+
+    auto less_than = [](auto const& a, auto const& b) { return a < b; };
+    auto is_odd = [](auto const& v) { return (v & 1) != 0; };
+    auto equal_to = [](auto const& a, auto const& b) { return a == b; };
+
+    auto fmt = "{1} ({2}) : {3}(sec)";
+
+    double t = run_benchmark(test_count, org, data,
+        [&] { hpx::min_element(policy, data.begin(), data.end(), less_than); });
+    hpx::util::format_to(std::cout, fmt, "min_element", name, t) << std::endl;
+
+    t = run_benchmark(test_count, org, data, [&] {
+        hpx::minmax_element(policy, data.begin(), data.end(), less_than);
+    });
+    hpx::util::format_to(std::cout, fmt, "minmax_element", name, t)
+        << std::endl;
+
+    t = run_benchmark(test_count, org, data, [&] {
+        hpx::inclusive_scan(policy, data.begin(), data.end(), dest.begin());
+    });
+    hpx::util::format_to(std::cout, fmt, "inclusive_scan", name, t)
+        << std::endl;
+
+    t = run_benchmark(test_count, org, data, [&] {
+        hpx::exclusive_scan(
+            policy, data.begin(), data.end(), dest.begin(), T(0));
+    });
+    hpx::util::format_to(std::cout, fmt, "exclusive_scan", name, t)
+        << std::endl;
+
+    t = run_benchmark(test_count, org, data, [&] {
+        hpx::copy_if(policy, data.begin(), data.end(), dest.begin(), is_odd);
+    });
+    hpx::util::format_to(std::cout, fmt, "copy_if", name, t) << std::endl;
+
+    t = run_benchmark(test_count, org, data,
+        [&] { hpx::remove_if(policy, data.begin(), data.end(), is_odd); });
+    hpx::util::format_to(std::cout, fmt, "remove_if", name, t) << std::endl;
+
+    t = run_benchmark(test_count, org, data,
+        [&] { hpx::unique(policy, data.begin(), data.end(), equal_to); });
+    hpx::util::format_to(std::cout, fmt, "unique", name, t) << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t random_range = vm["random_range"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    if (random_range < 1)
+        random_range = 1;
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "random_range : " << random_range << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << hpx::get_os_thread_count()
+              << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(
+        0, static_cast<int>(random_range - 1));
+
+    std::vector<int> org(vector_size);
+    for (auto& v : org)
+        v = dist(gen);
+
+    using namespace hpx::execution;
+    run_benchmarks(seq, "seq", test_count, org);
+    run_benchmarks(simd, "simd", test_count, org);
+    run_benchmarks(par, "par", test_count, org);
+    run_benchmarks(par_simd, "par_simd", test_count, org);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(1000000),
+            "size of vector (default: 1000000)")
+        ("random_range",
+            hpx::program_options::value<std::size_t>()->default_value(6),
+            "range of random numbers [0, x) (default: 6)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", hpx::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run");
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> make_keys(std::size_t vector_size)
+{
+    std::mt19937_64 gen(seed);
+    std::vector<T> keys(vector_size);
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+        std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dist(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(keys.begin(), keys.end(), [&]() { return dist(gen); });
+    }
+    return keys;
+}
+
+template <typename F>
+double run_timed(int test_count, F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        time += f();
+    }
+    return static_cast<double>(time) / (1e9 * test_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Compare>
+void run_sort_benchmark(std::string const& name, std::size_t vector_size,
+    int test_count, Compare comp)
+{
+    std::vector<T> const org = make_keys<T>(vector_size);
+    std::vector<T> v;
+
+    double const time_std = run_timed(test_count, [&]() -> std::uint64_t {
+        v = org;
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        std::sort(v.begin(), v.end(), comp);
+        return hpx::chrono::high_resolution_clock::now() - elapsed;
+    });
+
+    double const time_seq = run_timed(test_count, [&]() -> std::uint64_t {
+        v = org;
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        hpx::sort(hpx::execution::seq, v.begin(), v.end(), comp);
+        return hpx::chrono::high_resolution_clock::now() - elapsed;
+    });
+
+    double const time_par = run_timed(test_count, [&]() -> std::uint64_t {
+        v = org;
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        hpx::sort(hpx::execution::par, v.begin(), v.end(), comp);
+        return hpx::chrono::high_resolution_clock::now() - elapsed;
+    });
+    HPX_TEST(std::is_sorted(v.begin(), v.end(), comp));
+
+    std::cout << "------- " << name << " -------\n"
+              << "std::sort           : " << time_std << "(sec)\n"
+              << "hpx::sort (seq)     : " << time_seq << "(sec)\n"
+              << "hpx::sort (par)     : " << time_par << "(sec)\n"
+              << "speedup (std / par) : " << time_std / time_par << "\n"
+              << std::endl;
+}
+
+template <typename T>
+void run_sort_by_key_benchmark(
+    std::string const& name, std::size_t vector_size, int test_count)
+{
+    std::vector<T> const org_keys = make_keys<T>(vector_size);
+    std::vector<std::int64_t> org_values(vector_size);
+    std::iota(org_values.begin(), org_values.end(), 0);
+
+    std::vector<T> keys;
+    std::vector<std::int64_t> values;
+
+    double const time_seq = run_timed(test_count, [&]() -> std::uint64_t {
+        keys = org_keys;
+        values = org_values;
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        hpx::experimental::sort_by_key(
+            hpx::execution::seq, keys.begin(), keys.end(), values.begin());
+        return hpx::chrono::high_resolution_clock::now() - elapsed;
+    });
+
+    double const time_par = run_timed(test_count, [&]() -> std::uint64_t {
+        keys = org_keys;
+        values = org_values;
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        hpx::experimental::sort_by_key(
+            hpx::execution::par, keys.begin(), keys.end(), values.begin());
+        return hpx::chrono::high_resolution_clock::now() - elapsed;
+    });
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+
+    std::cout << "------- " << name << " -------\n"
+              << "sort_by_key (seq)   : " << time_seq << "(sec)\n"
+              << "sort_by_key (par)   : " << time_par << "(sec)\n"
+              << "speedup (seq / par) : " << time_seq / time_par << "\n"
+              << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    run_sort_benchmark<std::int32_t>(
+        "int32_t", vector_size, test_count, std::less<>());
+    run_sort_benchmark<std::uint64_t>(
+        "uint64_t", vector_size, test_count, std::less<>());
+    run_sort_benchmark<float>("float", vector_size, test_count, std::less<>());
+    run_sort_benchmark<double>(
+        "double (greater)", vector_size, test_count, std::greater<>());
+
+    run_sort_by_key_benchmark<std::int32_t>(
+        "sort_by_key int32_t", vector_size, test_count);
+    run_sort_by_key_benchmark<double>(
+        "sort_by_key double", vector_size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("vector_size",
+        hpx::program_options::value<std::size_t>()->default_value(10000000),
+        "size of vector (default: 10000000)")("test_count",
+        hpx::program_options::value<int>()->default_value(10),
+        "number of tests to be averaged (default: 10)")("seed,s",
+        hpx::program_options::value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -7,8 +7,11 @@
 #include <hpx/local/init.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -145,6 +148,36 @@ void test_sort2()
     test_sort2_async(par(task), float(), std::greater<float>());
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// large sequences of arithmetic keys are radix sorted, make sure negative and
+// repeated keys are handled correctly
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort_radix(ExPolicy&& policy, T, Compare comp)
+{
+    std::vector<T> c(std::size_t(1) << 17);
+    for (auto& elem : c)
+    {
+        elem = static_cast<T>(std::rand() % 1000 - 500);
+    }
+
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(std::forward<ExPolicy>(policy), c.begin(), c.end(), comp);
+    HPX_TEST(c == expected);
+}
+
+void test_sort_radix()
+{
+    using namespace hpx::execution;
+
+    test_sort_radix(par, int(), std::less<>());
+    test_sort_radix(par, std::int64_t(), std::less<std::int64_t>());
+    test_sort_radix(par_unseq, short(), std::greater<>());
+    test_sort_radix(par, float(), std::less<float>());
+    test_sort_radix(par_unseq, double(), std::greater<double>());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -157,6 +190,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort_radix();
     sort_benchmark();
 
     return hpx::local::finalize();
@@ -11,7 +11,10 @@
 #include <hpx/parallel/algorithms/sort_by_key.hpp>
 #include <hpx/type_support/unused.hpp>
 //
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <numeric>
@@ -292,6 +295,58 @@ void test_sort_by_key1()
     } while (t2.elapsed() < seconds);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// large sequences of arithmetic keys are radix sorted, the values of equal keys
+// have to keep their relative order (-0.0 and +0.0 are equal keys)
+template <typename ExPolicy, typename Tkey>
+void test_sort_by_key_stable(ExPolicy&& policy, Tkey)
+{
+    std::size_t const size = std::size_t(1) << 17;
+
+    std::vector<Tkey> keys(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = static_cast<Tkey>(std::rand() % 100 - 50);
+        if (keys[i] == Tkey(0) && i % 2 == 0)
+        {
+            keys[i] = -keys[i];
+        }
+    }
+
+    std::vector<std::size_t> values(size);
+    std::iota(values.begin(), values.end(), std::size_t(0));
+
+    std::vector<std::pair<Tkey, std::size_t>> expected;
+    expected.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        expected.emplace_back(keys[i], values[i]);
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    hpx::experimental::sort_by_key(std::forward<ExPolicy>(policy),
+        keys.begin(), keys.end(), values.begin());
+
+    bool is_equal = true;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        is_equal = is_equal && keys[i] == expected[i].first &&
+            values[i] == expected[i].second;
+    }
+    HPX_TEST(is_equal);
+}
+
+void test_sort_by_key_stable()
+{
+    using namespace hpx::execution;
+
+    test_sort_by_key_stable(par, int());
+    test_sort_by_key_stable(par_unseq, std::int64_t());
+    test_sort_by_key_stable(par, float());
+    test_sort_by_key_stable(par_unseq, double());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -303,6 +358,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::srand(seed);
 
     test_sort_by_key1();
+    test_sort_by_key_stable();
     sort_by_key_benchmark();
 
     return hpx::local::finalize();
@@ -0,0 +1,107 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag, typename Pred>
+void test_copy_if(ExPolicy&& policy, IteratorTag, Pred pred)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = std::vector<int>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // use an odd offset to exercise the unaligned head of the sequence
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c), []() { return std::rand(); });
+
+    std::vector<int> d(c.size() + 2), expected(c.size() + 2);
+    auto result = hpx::copy_if(policy, iterator(std::begin(c) + 1),
+        iterator(std::end(c)), std::begin(d) + 3, pred);
+    auto solution = std::copy_if(
+        std::begin(c) + 1, std::end(c), std::begin(expected) + 3, pred);
+
+    HPX_TEST_EQ(std::distance(std::begin(d), result),
+        std::distance(std::begin(expected), solution));
+    HPX_TEST(d == expected);
+}
+
+template <typename IteratorTag>
+void test_copy_if()
+{
+    using namespace hpx::execution;
+
+    int const middle = RAND_MAX / 2;
+
+    // the predicate can be applied to vector packs
+    auto pred = [middle](auto const& v) { return v < middle; };
+
+    test_copy_if(simd, IteratorTag(), pred);
+    test_copy_if(par_simd, IteratorTag(), pred);
+
+    // the predicate can't be applied to vector packs
+    auto scalar_pred = [middle](int v) { return v < middle; };
+
+    test_copy_if(simd, IteratorTag(), scalar_pred);
+    test_copy_if(par_simd, IteratorTag(), scalar_pred);
+}
+
+void copy_if_test()
+{
+    test_copy_if<std::random_access_iterator_tag>();
+    test_copy_if<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    copy_if_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,112 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag, typename T, typename Op>
+void test_exclusive_scan(ExPolicy&& policy, IteratorTag, T, Op op)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = typename std::vector<T>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    std::vector<T> c(10007);
+    std::generate(
+        std::begin(c), std::end(c), []() { return T(std::rand() % 100); });
+
+    // use different offsets to exercise unaligned sequences
+    std::vector<T> d(c.size() + 2), expected(c.size() + 2);
+    hpx::exclusive_scan(policy, iterator(std::begin(c) + 1),
+        iterator(std::end(c)), std::begin(d) + 3, T(7), op);
+    std::exclusive_scan(
+        std::begin(c) + 1, std::end(c), std::begin(expected) + 3, T(7), op);
+    HPX_TEST(d == expected);
+
+    hpx::exclusive_scan(policy, iterator(std::begin(c)), iterator(std::end(c)),
+        std::begin(d), T(0));
+    std::exclusive_scan(std::begin(c), std::end(c), std::begin(expected), T(0));
+    HPX_TEST(d == expected);
+}
+
+template <typename IteratorTag, typename T>
+void test_exclusive_scan(T)
+{
+    using namespace hpx::execution;
+
+    test_exclusive_scan(simd, IteratorTag(), T(), std::plus<T>());
+    test_exclusive_scan(par_simd, IteratorTag(), T(), std::plus<T>());
+
+    // the operation can be applied to vector packs
+    auto op = [](auto const& a, auto const& b) { return a + b; };
+    test_exclusive_scan(simd, IteratorTag(), T(), op);
+    test_exclusive_scan(par_simd, IteratorTag(), T(), op);
+
+    // the operation can't be applied to vector packs
+    auto scalar_op = [](T a, T b) { return a + b; };
+    test_exclusive_scan(simd, IteratorTag(), T(), scalar_op);
+    test_exclusive_scan(par_simd, IteratorTag(), T(), scalar_op);
+}
+
+void exclusive_scan_test()
+{
+    test_exclusive_scan<std::random_access_iterator_tag>(int());
+    test_exclusive_scan<std::random_access_iterator_tag>(double());
+    test_exclusive_scan<std::forward_iterator_tag>(int());
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    exclusive_scan_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
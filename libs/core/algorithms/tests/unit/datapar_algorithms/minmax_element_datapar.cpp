@@ -0,0 +1,110 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../algorithms/test_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag, typename T, typename F>
+void test_minmax_element(ExPolicy&& policy, IteratorTag, T, F f)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    using base_iterator = typename std::vector<T>::iterator;
+    using iterator = test::test_iterator<base_iterator, IteratorTag>;
+
+    // use a small range of values to have many equivalent elements, start at
+    // an odd offset to exercise the unaligned head of the sequence
+    std::vector<T> c(10007);
+    std::generate(
+        std::begin(c), std::end(c), []() { return T(std::rand() % 1000); });
+
+    iterator first(std::begin(c) + 1);
+    iterator last(std::end(c));
+
+    // hpx::max_element returns the last of the largest elements
+    auto min = std::min_element(std::begin(c) + 1, std::end(c), f);
+    auto max = std::max_element(std::rbegin(c), std::rend(c) - 1, f).base() - 1;
+
+    HPX_TEST(hpx::min_element(policy, first, last, f).base() == min);
+    HPX_TEST(hpx::max_element(policy, first, last, f).base() == max);
+
+    auto r = hpx::minmax_element(policy, first, last, f);
+    HPX_TEST(r.min.base() == min);
+    HPX_TEST(r.max.base() == max);
+}
+
+template <typename IteratorTag, typename T>
+void test_minmax_element(T)
+{
+    using namespace hpx::execution;
+
+    // the comparison can be applied to vector packs
+    auto f = [](auto const& a, auto const& b) { return a < b; };
+    test_minmax_element(simd, IteratorTag(), T(), f);
+    test_minmax_element(par_simd, IteratorTag(), T(), f);
+
+    // the comparison can't be applied to vector packs
+    auto scalar_f = [](T a, T b) { return a < b; };
+    test_minmax_element(simd, IteratorTag(), T(), scalar_f);
+    test_minmax_element(par_simd, IteratorTag(), T(), scalar_f);
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<std::random_access_iterator_tag>(int());
+    test_minmax_element<std::random_access_iterator_tag>(double());
+    test_minmax_element<std::forward_iterator_tag>(int());
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    minmax_element_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,81 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../algorithms/remove_tests.hpp"
+
+////////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_remove_if()
+{
+    using namespace hpx::execution;
+
+    int rand_base = std::rand();
+
+    // the predicate can be applied to vector packs
+    auto pred = [rand_base](auto const& v) { return v < rand_base; };
+
+    test_remove_if(simd, IteratorTag(), int(), pred, rand_base);
+    test_remove_if(par_simd, IteratorTag(), int(), pred, rand_base);
+
+    test_remove_if_async(simd(task), IteratorTag(), int(), pred, rand_base);
+    test_remove_if_async(par_simd(task), IteratorTag(), int(), pred, rand_base);
+
+    // the predicate can't be applied to vector packs
+    auto scalar_pred = [rand_base](int v) { return v == rand_base; };
+
+    test_remove_if(simd, IteratorTag(), int(), scalar_pred, rand_base);
+    test_remove_if(par_simd, IteratorTag(), int(), scalar_pred, rand_base);
+}
+
+void remove_if_test()
+{
+    test_remove_if<std::random_access_iterator_tag>();
+    test_remove_if<std::forward_iterator_tag>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    remove_if_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,168 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/construct_at.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Small objects are carved out of slabs owned by the allocating (worker)
+    // thread, larger objects are allocated from the general heap.
+    inline constexpr std::size_t slab_allocator_max_size = 1024;
+    inline constexpr std::size_t slab_allocator_alignment = 16;
+
+    namespace detail {
+
+        // Allocate a block of the given size from the slabs of the calling
+        // thread. Blocks may be deallocated on any thread, they are returned
+        // to the owning thread in this case.
+        [[nodiscard]] HPX_CORE_EXPORT void* slab_allocate(std::size_t size);
+        HPX_CORE_EXPORT void slab_deallocate(void* p) noexcept;
+
+        constexpr bool use_slab_allocator(
+            std::size_t size, std::size_t alignment) noexcept
+        {
+            return size != 0 && size <= slab_allocator_max_size &&
+                alignment <= slab_allocator_alignment;
+        }
+
+        // allocate memory for an object of the given size and alignment from
+        // the slabs if possible, from the heap otherwise
+        [[nodiscard]] inline void* allocate_small(
+            std::size_t size, std::size_t alignment)
+        {
+            if (use_slab_allocator(size, alignment))
+            {
+                return slab_allocate(size);
+            }
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                return ::operator new(size, std::align_val_t(alignment));
+            }
+#endif
+            return ::operator new(size);
+        }
+
+        inline void deallocate_small(
+            void* p, std::size_t size, std::size_t alignment) noexcept
+        {
+            if (use_slab_allocator(size, alignment))
+            {
+                slab_deallocate(p);
+                return;
+            }
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ::operator delete(p, std::align_val_t(alignment));
+                return;
+            }
+#endif
+            ::operator delete(p);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Number of allocations served from the slabs of the allocating thread
+    // (hits) and of allocations which required a new slab or the general
+    // heap (misses), accumulated over all threads.
+    HPX_CORE_EXPORT std::uint64_t get_slab_allocator_hits(bool reset) noexcept;
+    HPX_CORE_EXPORT std::uint64_t get_slab_allocator_misses(
+        bool reset) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocator handing out memory from per-thread slabs, this is meant to be
+    // used for small objects allocated (and freed) at high rates, like thread
+    // descriptions and future shared states.
+    template <typename T = int>
+    struct slab_allocator
+    {
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = slab_allocator<U>;
+        };
+
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        slab_allocator() = default;
+
+        template <typename U>
+        constexpr slab_allocator(slab_allocator<U> const&) noexcept
+        {
+        }
+
+        [[nodiscard]] pointer allocate(size_type n)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+            return static_cast<pointer>(
+                detail::allocate_small(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            detail::deallocate_small(p, n * sizeof(T), alignof(T));
+        }
+
+        constexpr size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            hpx::construct_at(p, HPX_FORWARD(Args, args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p) noexcept
+        {
+            std::destroy_at(p);
+        }
+    };
+
+    template <typename T, typename U>
+    constexpr bool operator==(
+        slab_allocator<T> const&, slab_allocator<U> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    constexpr bool operator!=(
+        slab_allocator<T> const&, slab_allocator<U> const&) noexcept
+    {
+        return false;
+    }
+}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,330 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace hpx::util {
+
+    namespace detail {
+
+        namespace {
+
+            // Slabs are aligned to their size, which allows to find the
+            // header of the slab a block belongs to from the block address.
+            constexpr std::size_t slab_size = 64 * 1024;
+            constexpr std::size_t num_size_classes =
+                slab_allocator_max_size / slab_allocator_alignment;
+
+            constexpr std::size_t size_class(std::size_t size) noexcept
+            {
+                return (size - 1) / slab_allocator_alignment;
+            }
+
+            constexpr std::size_t block_size(std::size_t size_class) noexcept
+            {
+                return (size_class + 1) * slab_allocator_alignment;
+            }
+
+            struct free_block
+            {
+                free_block* next;
+            };
+
+            struct thread_cache;
+
+            struct slab_header
+            {
+                thread_cache* owner;
+                std::size_t size_class;
+            };
+
+            constexpr std::size_t slab_header_size =
+                ((sizeof(slab_header) + slab_allocator_alignment - 1) /
+                    slab_allocator_alignment) *
+                slab_allocator_alignment;
+
+            slab_header* get_slab_header(void* p) noexcept
+            {
+                return reinterpret_cast<slab_header*>(
+                    reinterpret_cast<std::uintptr_t>(p) & ~(slab_size - 1));
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // The slabs and free blocks of one thread. Instances are never
+            // destroyed as blocks may still be in use when the owning thread
+            // exits, they are handed to the next thread instead.
+            struct thread_cache
+            {
+                // Blocks deallocated by other threads, those are moved to the
+                // free lists by the owning thread once it runs out of blocks.
+                void push_remote(free_block* b) noexcept
+                {
+                    free_block* head =
+                        remote_free.load(std::memory_order_relaxed);
+                    do
+                    {
+                        b->next = head;
+                    } while (!remote_free.compare_exchange_weak(head, b,
+                        std::memory_order_release, std::memory_order_relaxed));
+                }
+
+                bool collect_remote() noexcept
+                {
+                    free_block* b = remote_free.exchange(
+                        nullptr, std::memory_order_acquire);
+                    if (b == nullptr)
+                    {
+                        return false;
+                    }
+
+                    while (b != nullptr)
+                    {
+                        free_block* next = b->next;
+                        free_block*& head =
+                            free_list[get_slab_header(b)->size_class];
+                        b->next = head;
+                        head = b;
+                        b = next;
+                    }
+                    return true;
+                }
+
+                void* allocate(std::size_t size)
+                {
+                    std::size_t const c = size_class(size);
+
+                    free_block* b = free_list[c];
+                    if (b == nullptr && collect_remote())
+                    {
+                        b = free_list[c];
+                    }
+
+                    if (b != nullptr)
+                    {
+                        free_list[c] = b->next;
+                        count(hits);
+                        return b;
+                    }
+
+                    // carve a new block out of the current slab of this size
+                    // class
+                    std::size_t const bsize = block_size(c);
+                    if (slab_end[c] - slab_next[c] <
+                        static_cast<std::ptrdiff_t>(bsize))
+                    {
+                        char* slab = static_cast<char*>(
+                            __aligned_alloc(slab_size, slab_size));
+                        if (slab == nullptr)
+                        {
+                            throw std::bad_alloc();
+                        }
+
+                        auto* header = reinterpret_cast<slab_header*>(slab);
+                        header->owner = this;
+                        header->size_class = c;
+
+                        slab_next[c] = slab + slab_header_size;
+                        slab_end[c] = slab + slab_size;
+                        count(misses);
+                    }
+                    else
+                    {
+                        count(hits);
+                    }
+
+                    void* p = slab_next[c];
+                    slab_next[c] += bsize;
+                    return p;
+                }
+
+                void deallocate(void* p) noexcept
+                {
+                    auto* b = static_cast<free_block*>(p);
+                    free_block*& head =
+                        free_list[get_slab_header(p)->size_class];
+                    b->next = head;
+                    head = b;
+                }
+
+                // the counters are written by the owning thread only
+                static void count(std::atomic<std::uint64_t>& counter) noexcept
+                {
+                    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+                }
+
+                free_block* free_list[num_size_classes] = {};
+                char* slab_next[num_size_classes] = {};
+                char* slab_end[num_size_classes] = {};
+
+                std::atomic<free_block*> remote_free{nullptr};
+
+                std::atomic<std::uint64_t> hits{0};
+                std::atomic<std::uint64_t> misses{0};
+
+                thread_cache* next_cache = nullptr;    // all caches
+                thread_cache* next_unused = nullptr;
+            };
+
+            ///////////////////////////////////////////////////////////////////
+            struct thread_caches
+            {
+                thread_cache* acquire()
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    thread_cache* cache = unused;
+                    if (cache != nullptr)
+                    {
+                        unused = cache->next_unused;
+                        return cache;
+                    }
+
+                    cache = new thread_cache;
+                    cache->next_cache = all;
+                    all = cache;
+                    return cache;
+                }
+
+                void release(thread_cache* cache) noexcept
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    cache->next_unused = unused;
+                    unused = cache;
+                }
+
+                std::uint64_t get_value(
+                    std::atomic<std::uint64_t> thread_cache::*counter,
+                    std::uint64_t& last_reset, bool reset) noexcept
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+
+                    std::uint64_t value = (shared.*counter).load(
+                        std::memory_order_relaxed);
+                    for (thread_cache* c = all; c != nullptr; c = c->next_cache)
+                    {
+                        value += (c->*counter).load(std::memory_order_relaxed);
+                    }
+
+                    std::uint64_t const result = value - last_reset;
+                    if (reset)
+                    {
+                        last_reset = value;
+                    }
+                    return result;
+                }
+
+                std::mutex mtx;
+                thread_cache* all = nullptr;
+                thread_cache* unused = nullptr;
+
+                // used by threads which are about to exit (protected by mtx)
+                thread_cache shared;
+
+                std::uint64_t hits_reset = 0;
+                std::uint64_t misses_reset = 0;
+            };
+
+            thread_caches& get_thread_caches()
+            {
+                // intentionally leaked, blocks may be deallocated during
+                // static destruction
+                static thread_caches* caches = new thread_caches;
+                return *caches;
+            }
+
+            struct thread_cache_holder
+            {
+                ~thread_cache_holder();
+
+                thread_cache* cache = nullptr;
+            };
+
+            thread_local bool thread_cache_destroyed = false;
+            thread_local thread_cache_holder thread_cache_holder_;
+
+            thread_cache_holder::~thread_cache_holder()
+            {
+                thread_cache_destroyed = true;
+                if (cache != nullptr)
+                {
+                    get_thread_caches().release(cache);
+                    cache = nullptr;
+                }
+            }
+
+            // returns nullptr if the calling thread is exiting
+            thread_cache* get_thread_cache()
+            {
+                if (thread_cache_destroyed)
+                {
+                    return nullptr;
+                }
+
+                thread_cache_holder& holder = thread_cache_holder_;
+                if (holder.cache == nullptr)
+                {
+                    holder.cache = get_thread_caches().acquire();
+                }
+                return holder.cache;
+            }
+        }    // namespace
+
+        ///////////////////////////////////////////////////////////////////////
+        void* slab_allocate(std::size_t size)
+        {
+            thread_cache* cache = get_thread_cache();
+            if (cache != nullptr)
+            {
+                return cache->allocate(size);
+            }
+
+            thread_caches& caches = get_thread_caches();
+            std::lock_guard<std::mutex> l(caches.mtx);
+            return caches.shared.allocate(size);
+        }
+
+        void slab_deallocate(void* p) noexcept
+        {
+            if (p == nullptr)
+            {
+                return;
+            }
+
+            thread_cache* owner = get_slab_header(p)->owner;
+            if (!thread_cache_destroyed && owner == thread_cache_holder_.cache)
+            {
+                owner->deallocate(p);
+                return;
+            }
+
+            // return the block to the thread owning the slab
+            owner->push_remote(static_cast<free_block*>(p));
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t get_slab_allocator_hits(bool reset) noexcept
+    {
+        detail::thread_caches& caches = detail::get_thread_caches();
+        return caches.get_value(
+            &detail::thread_cache::hits, caches.hits_reset, reset);
+    }
+
+    std::uint64_t get_slab_allocator_misses(bool reset) noexcept
+    {
+        detail::thread_caches& caches = detail::get_thread_caches();
+        return caches.get_value(
+            &detail::thread_cache::misses, caches.misses_reset, reset);
+    }
+}    // namespace hpx::util
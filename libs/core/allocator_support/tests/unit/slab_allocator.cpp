@@ -0,0 +1,140 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/slab_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using hpx::util::slab_allocator;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_same_thread()
+{
+    std::vector<std::pair<char*, std::size_t>> blocks;
+    std::set<char*> unique_blocks;
+
+    for (std::size_t i = 0; i != 10000; ++i)
+    {
+        std::size_t const size = 1 + i % hpx::util::slab_allocator_max_size;
+
+        slab_allocator<char> alloc;
+        char* p = alloc.allocate(size);
+        HPX_TEST(reinterpret_cast<std::uintptr_t>(p) %
+                hpx::util::slab_allocator_alignment ==
+            0);
+        HPX_TEST(unique_blocks.insert(p).second);
+
+        std::memset(p, static_cast<int>(i), size);
+        blocks.emplace_back(p, size);
+    }
+
+    for (auto const& b : blocks)
+    {
+        HPX_TEST_EQ(static_cast<unsigned char>(b.first[b.second - 1]),
+            static_cast<unsigned char>(b.first[0]));
+        slab_allocator<char>().deallocate(b.first, b.second);
+    }
+
+    // deallocated blocks are reused
+    std::uint64_t const misses = hpx::util::get_slab_allocator_misses(false);
+    std::uint64_t const hits = hpx::util::get_slab_allocator_hits(false);
+    for (auto const& b : blocks)
+    {
+        slab_allocator<char> alloc;
+        alloc.deallocate(alloc.allocate(b.second), b.second);
+    }
+    HPX_TEST_EQ(hpx::util::get_slab_allocator_misses(false), misses);
+    HPX_TEST_EQ(
+        hpx::util::get_slab_allocator_hits(false), hits + blocks.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cross_thread()
+{
+    std::mutex mtx;
+    std::vector<double*> shared;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            slab_allocator<double> alloc;
+            for (int i = 0; i != 10000; ++i)
+            {
+                double* p = alloc.allocate(1);
+                *p = t;
+
+                // blocks are likely deallocated by another thread
+                std::lock_guard<std::mutex> l(mtx);
+                shared.push_back(p);
+                if (shared.size() > 100)
+                {
+                    alloc.deallocate(shared.front(), 1);
+                    shared.erase(shared.begin());
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    for (double* p : shared)
+    {
+        slab_allocator<double>().deallocate(p, 1);
+    }
+}
+
+void test_thread_exit()
+{
+    // blocks may outlive the thread which allocated them
+    for (int i = 0; i != 10; ++i)
+    {
+        int* p = nullptr;
+        std::thread([&]() { p = slab_allocator<int>().allocate(4); }).join();
+
+        p[3] = i;
+        slab_allocator<int>().deallocate(p, 4);
+    }
+}
+
+void test_large_objects()
+{
+    // objects which are too large are allocated from the heap
+    slab_allocator<char> alloc;
+    char* p = alloc.allocate(hpx::util::slab_allocator_max_size + 1);
+    std::memset(p, 0, hpx::util::slab_allocator_max_size + 1);
+    alloc.deallocate(p, hpx::util::slab_allocator_max_size + 1);
+}
+
+void test_counters()
+{
+    HPX_TEST(hpx::util::get_slab_allocator_misses(true) != 0);
+    HPX_TEST_EQ(hpx::util::get_slab_allocator_misses(false), std::uint64_t(0));
+
+    HPX_TEST(hpx::util::get_slab_allocator_hits(true) != 0);
+    HPX_TEST_EQ(hpx::util::get_slab_allocator_hits(false), std::uint64_t(0));
+}
+
+int main()
+{
+    test_same_thread();
+    test_cross_thread();
+    test_thread_exit();
+    test_large_objects();
+    test_counters();
+
+    return hpx::util::report_errors();
+}
@@ -152,4 +152,43 @@ namespace hpx::execution::experimental {
     struct is_scheduling_property<get_annotation_t> : std::true_type
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The way bulk operations divide their iterations between the worker
+    /// threads.
+    enum class bulk_splitting
+    {
+        /// The iterations are split into chunks of a fixed size up front,
+        /// idle workers steal whole chunks from other workers.
+        static_ = 0,
+
+        /// Each worker starts with a contiguous range of iterations, idle
+        /// workers steal half of the remaining iterations of another worker.
+        /// This adapts to irregular workloads without creating many small
+        /// chunks.
+        lazy = 1
+    };
+
+    inline constexpr struct with_bulk_splitting_t final
+      : detail::property_base<with_bulk_splitting_t>
+    {
+    } with_bulk_splitting{};
+
+    inline constexpr struct get_bulk_splitting_t final
+      : hpx::functional::detail::tag_fallback<get_bulk_splitting_t>
+    {
+    private:
+        // simply return static_ if get_bulk_splitting is not supported
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr bulk_splitting tag_fallback_invoke(
+            get_bulk_splitting_t, Target&&) noexcept
+        {
+            return bulk_splitting::static_;
+        }
+    } get_bulk_splitting{};
+
+    template <>
+    struct is_scheduling_property<get_bulk_splitting_t> : std::true_type
+    {
+    };
 }    // namespace hpx::execution::experimental
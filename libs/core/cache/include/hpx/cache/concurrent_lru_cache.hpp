@@ -0,0 +1,645 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_lru_cache concurrent_lru_cache.hpp
+    ///        hpx/cache/concurrent_lru_cache.hpp
+    ///
+    /// \brief The \a concurrent_lru_cache implements a local (non-distributed)
+    ///        cache which can be accessed concurrently from many threads
+    ///        without external synchronization.
+    ///
+    /// The keys are distributed over a fixed number of independently locked
+    /// shards based on their hash value. Each shard stores its entries in a
+    /// hash table and approximates LRU replacement using the CLOCK algorithm:
+    /// accessing an entry sets its reference bit, eviction sweeps over the
+    /// entries of a shard, clearing reference bits until it finds an entry
+    /// which has not been accessed since the last sweep. Concurrent operations
+    /// on keys which map to different shards do not contend with each other.
+    ///
+    /// The overall capacity is split evenly across all shards. The cache can
+    /// therefore hold up to (num_shards() - 1) entries more than requested
+    /// if the capacity is not a multiple of the number of shards.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. Every shard maintains
+    ///                       its own instance, use \a for_each_statistics to
+    ///                       access them.
+    /// \tparam Hash          The hash function used for the keys.
+    /// \tparam KeyEqual      The function used to compare keys for equality.
+    /// \tparam Mutex         The lock type used to protect each of the shards.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+        typename Mutex = hpx::util::spinlock>
+    class concurrent_lru_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using mutex_type = Mutex;
+        using size_type = std::size_t;
+
+        static constexpr size_type default_num_shards = 32;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        struct slot
+        {
+            template <typename Entry_>
+            slot(key_type const& key, Entry_&& entry)
+              : value_(key, HPX_FORWARD(Entry_, entry))
+            {
+            }
+
+            entry_pair value_;
+            bool referenced_ = false;    // CLOCK reference bit
+        };
+
+        struct shard_data
+        {
+            using index_type =
+                std::unordered_map<key_type, size_type, hasher, key_equal>;
+
+            mutable mutex_type mtx_;
+            index_type index_;
+            std::vector<slot> slots_;
+            size_type hand_ = 0;
+            size_type max_size_ = 0;
+            std::atomic<size_type> current_size_{0};
+            statistics_type statistics_;
+        };
+
+        using shard_type = hpx::util::cache_aligned_data_derived<shard_data>;
+
+        static constexpr size_type round_to_power_of_two(size_type n) noexcept
+        {
+            size_type result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_lru_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold. The default is zero (no size
+        ///                   limitation).
+        /// \param num_shards [in] The number of independently locked shards
+        ///                   the entries are distributed over. This number is
+        ///                   rounded up to the next power of two. The default
+        ///                   is zero, which selects \a default_num_shards.
+        ///
+        explicit concurrent_lru_cache(
+            size_type max_size = 0, size_type num_shards = 0)
+          : num_shards_(round_to_power_of_two(
+                num_shards == 0 ? default_num_shards : num_shards))
+          , shards_(new shard_type[num_shards_])
+          , max_size_(0)
+        {
+            reserve(max_size);
+        }
+
+        concurrent_lru_cache(concurrent_lru_cache&& other) noexcept
+          : num_shards_(other.num_shards_)
+          , shards_(HPX_MOVE(other.shards_))
+          , max_size_(other.max_size_.load(std::memory_order_relaxed))
+          , hash_(HPX_MOVE(other.hash_))
+        {
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current number of entries held by this cache
+        ///          instance. The value may be outdated by the time it is
+        ///          returned if other threads modify the cache concurrently.
+        size_type size() const noexcept
+        {
+            size_type result = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                result +=
+                    shards_[i].current_size_.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum number of entries this cache instance is
+        ///             currently allowed to hold. If this number is zero the
+        ///             cache has no limitation with regard to a maximum size.
+        size_type capacity() const noexcept
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the number of shards used by this cache instance.
+        constexpr size_type num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum number of entries this
+        ///             cache will be allowed to hold. Entries will be
+        ///             evicted if the cache currently holds more entries.
+        ///
+        void reserve(size_type max_size)
+        {
+            max_size_.store(max_size, std::memory_order_relaxed);
+
+            size_type const shard_size =
+                (max_size + num_shards_ - 1) / num_shards_;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_data& shard = shards_[i];
+
+                std::lock_guard<mutex_type> l(shard.mtx_);
+                shard.max_size_ = shard_size;
+                while (shard_size != 0 && shard.slots_.size() > shard_size)
+                {
+                    evict(shard);
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not mark the entry as recently
+        ///               used.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool holds_key(key_type const& key) const
+        {
+            shard_data const& shard = get_shard(key);
+
+            std::lock_guard<mutex_type> l(shard.mtx_);
+            return shard.index_.find(key) != shard.index_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] If the entry indexed by the key is found in
+        ///               the cache this value on successful return will be a
+        ///               copy of the key stored in the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            shard_data& shard = get_shard(key);
+
+            std::lock_guard<mutex_type> l(shard.mtx_);
+            update_on_exit update(
+                shard.statistics_, statistics::method::get_entry);
+
+            auto it = shard.index_.find(key);
+            if (it == shard.index_.end())
+            {
+                // got miss
+                shard.statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            slot& s = shard.slots_[it->second];
+            s.referenced_ = true;
+
+            // update statistics
+            shard.statistics_.got_hit();
+
+            // got hit
+            realkey = s.value_.first;
+            entry = s.value_.second;
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               added to the cache, and \a false if the cache already
+        ///               holds an entry for the given key.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        bool insert(key_type const& key, Entry_&& entry)
+        {
+            shard_data& shard = get_shard(key);
+
+            std::lock_guard<mutex_type> l(shard.mtx_);
+            update_on_exit update(
+                shard.statistics_, statistics::method::insert_entry);
+
+            if (shard.index_.find(key) != shard.index_.end())
+            {
+                return false;
+            }
+
+            insert_nonexist(shard, key, HPX_FORWARD(Entry_, entry));
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. The entry is
+        ///               added to the cache if it is not held by the cache
+        ///               yet.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        void update(key_type const& key, Entry_&& entry)
+        {
+            shard_data& shard = get_shard(key);
+
+            std::lock_guard<mutex_type> l(shard.mtx_);
+            update_on_exit update(
+                shard.statistics_, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            auto it = shard.index_.find(key);
+            if (it == shard.index_.end())
+            {
+                // got miss
+                shard.statistics_.got_miss();    // update statistics
+                insert_nonexist(shard, key, HPX_FORWARD(Entry_, entry));
+                return;
+            }
+
+            // got hit!
+            slot& s = shard.slots_[it->second];
+            s.value_.second = HPX_FORWARD(Entry_, entry);
+            s.referenced_ = true;
+
+            // update statistics
+            shard.statistics_.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename F, typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool update_if(key_type const& key, Entry_&& entry, F&& f)
+        {
+            shard_data& shard = get_shard(key);
+
+            std::lock_guard<mutex_type> l(shard.mtx_);
+            update_on_exit update(
+                shard.statistics_, statistics::method::update_entry);
+
+            // Is it already in the cache?
+            auto it = shard.index_.find(key);
+            if (it == shard.index_.end())
+            {
+                // got miss
+                shard.statistics_.got_miss();    // update statistics
+                insert_nonexist(shard, key, HPX_FORWARD(Entry_, entry));
+                return true;
+            }
+
+            slot& s = shard.slots_[it->second];
+            if (f(key, s.value_.first))
+                return false;
+
+            // got hit!
+            s.value_.second = HPX_FORWARD(Entry_, entry);
+            s.referenced_ = true;
+
+            // update statistics
+            shard.statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache (passed as an
+        ///               \a entry_pair). An entry is removed from the cache
+        ///               whenever the value returned from this invocation is
+        ///               \a true.
+        ///
+        /// \note         The shards are processed one after the other, only
+        ///               one of them is locked at any point in time.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_data& shard = shards_[i];
+
+                std::lock_guard<mutex_type> l(shard.mtx_);
+                update_on_exit update(
+                    shard.statistics_, statistics::method::erase_entry);
+
+                for (size_type j = 0; j < shard.slots_.size(); /**/)
+                {
+                    if (ep(shard.slots_[j].value_))
+                    {
+                        ++erased;
+                        remove(shard, j);
+
+                        // update statistics
+                        shard.statistics_.got_eviction();
+                    }
+                    else
+                    {
+                        ++j;
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove the entry identified by the given key from the cache
+        ///
+        /// \param key    [in] The key for the entry which should be removed.
+        ///
+        /// \returns      This function returns \a true if the entry was held
+        ///               by the cache, otherwise it returns \a false.
+        bool erase(key_type const& key)
+        {
+            shard_data& shard = get_shard(key);
+
+            std::lock_guard<mutex_type> l(shard.mtx_);
+            update_on_exit update(
+                shard.statistics_, statistics::method::erase_entry);
+
+            auto it = shard.index_.find(key);
+            if (it == shard.index_.end())
+            {
+                return false;
+            }
+
+            remove(shard, it->second);
+
+            // update statistics
+            shard.statistics_.got_eviction();
+            return true;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_data& shard = shards_[i];
+
+                std::lock_guard<mutex_type> l(shard.mtx_);
+                erased += shard.slots_.size();
+
+                shard.index_.clear();
+                shard.slots_.clear();
+                shard.hand_ = 0;
+                shard.current_size_.store(0, std::memory_order_relaxed);
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Invoke the given function for the statistics instance of
+        ///        each of the shards.
+        ///
+        /// \param f      [in] A callable taking a reference to a
+        ///               \a statistics_type. The corresponding shard is locked
+        ///               while \a f is executed.
+        template <typename F>
+        void for_each_statistics(F&& f)
+        {
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_data& shard = shards_[i];
+
+                std::lock_guard<mutex_type> l(shard.mtx_);
+                f(shard.statistics_);
+            }
+        }
+
+    private:
+        shard_data& get_shard(key_type const& key) noexcept
+        {
+            return shards_[shard_index(key)];
+        }
+
+        shard_data const& get_shard(key_type const& key) const noexcept
+        {
+            return shards_[shard_index(key)];
+        }
+
+        size_type shard_index(key_type const& key) const noexcept
+        {
+            // scramble the hash value as many hash functions (e.g. for
+            // integral types) return the unmodified input
+            std::uint64_t const h = static_cast<std::uint64_t>(hash_(key)) *
+                0x9e3779b97f4a7c15ULL;
+            return static_cast<size_type>(h >> 32) & (num_shards_ - 1);
+        }
+
+        template <typename Entry_>
+        void insert_nonexist(
+            shard_data& shard, key_type const& key, Entry_&& entry)
+        {
+            // make room for the new entry first to avoid the CLOCK hand
+            // sweeping over (and evicting) the new entry right away
+            if (shard.max_size_ != 0 && shard.slots_.size() >= shard.max_size_)
+            {
+                evict(shard);
+            }
+
+            shard.slots_.emplace_back(key, HPX_FORWARD(Entry_, entry));
+            shard.index_.emplace(key, shard.slots_.size() - 1);
+            shard.current_size_.store(
+                shard.slots_.size(), std::memory_order_relaxed);
+
+            // update statistics
+            shard.statistics_.got_insertion();
+        }
+
+        // remove the entry at the given position by replacing it with the
+        // last entry of the shard
+        void remove(shard_data& shard, size_type pos)
+        {
+            HPX_ASSERT(pos < shard.slots_.size());
+
+            shard.index_.erase(shard.slots_[pos].value_.first);
+
+            size_type const last = shard.slots_.size() - 1;
+            if (pos != last)
+            {
+                shard.slots_[pos] = HPX_MOVE(shard.slots_[last]);
+                shard.index_[shard.slots_[pos].value_.first] = pos;
+            }
+            shard.slots_.pop_back();
+
+            shard.current_size_.store(
+                shard.slots_.size(), std::memory_order_relaxed);
+        }
+
+        // CLOCK replacement: advance the hand, giving each referenced entry a
+        // second chance, until an entry is found which was not accessed since
+        // the hand passed it the last time
+        void evict(shard_data& shard)
+        {
+            HPX_ASSERT(!shard.slots_.empty());
+
+            while (true)
+            {
+                if (shard.hand_ >= shard.slots_.size())
+                {
+                    shard.hand_ = 0;
+                }
+
+                slot& s = shard.slots_[shard.hand_];
+                if (!s.referenced_)
+                {
+                    break;
+                }
+
+                s.referenced_ = false;
+                ++shard.hand_;
+            }
+
+            // the hand now points to the entry moved into the evicted slot
+            remove(shard, shard.hand_);
+
+            // update statistics
+            shard.statistics_.got_eviction();
+        }
+
+    private:
+        size_type num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        std::atomic<size_type> max_size_;
+        hasher hash_;
+    };
+}    // namespace hpx::util::cache
@@ -0,0 +1,243 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_lru_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using cache_type = hpx::util::cache::concurrent_lru_cache<std::string,
+    std::string, hpx::util::cache::statistics::local_statistics>;
+
+void test_insert_and_get()
+{
+    cache_type c(0, 4);
+
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(4));
+    HPX_TEST_EQ(c.capacity(), static_cast<std::size_t>(0));
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(c.insert("green", "0,255,0"));
+    HPX_TEST(!c.insert("green", "0,128,0"));
+
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(3));
+    HPX_TEST(c.holds_key("yellow"));
+    HPX_TEST(!c.holds_key("blue"));
+
+    std::string key, value;
+    HPX_TEST(c.get_entry("green", key, value));
+    HPX_TEST_EQ(key, std::string("green"));
+    HPX_TEST_EQ(value, std::string("0,255,0"));
+    HPX_TEST(!c.get_entry("blue", value));
+
+    c.update("green", "0,128,0");
+    HPX_TEST(c.get_entry("green", value));
+    HPX_TEST_EQ(value, std::string("0,128,0"));
+
+    c.update("blue", "0,0,255");
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(4));
+
+    std::size_t hits = 0, misses = 0, insertions = 0;
+    c.for_each_statistics([&](auto& stats) {
+        hits += stats.hits();
+        misses += stats.misses();
+        insertions += stats.insertions();
+    });
+    HPX_TEST_EQ(hits, static_cast<std::size_t>(3));
+    HPX_TEST_EQ(misses, static_cast<std::size_t>(2));
+    HPX_TEST_EQ(insertions, static_cast<std::size_t>(4));
+}
+
+void test_update_if()
+{
+    cache_type c(0, 2);
+
+    auto reject = [](std::string const&, std::string const&) { return true; };
+    auto accept = [](std::string const&, std::string const&) {
+        return false;
+    };
+
+    // missing entries are always inserted
+    HPX_TEST(c.update_if("magenta", "255,0,255", reject));
+
+    HPX_TEST(!c.update_if("magenta", "0,0,0", reject));
+    std::string value;
+    HPX_TEST(c.get_entry("magenta", value));
+    HPX_TEST_EQ(value, std::string("255,0,255"));
+
+    HPX_TEST(c.update_if("magenta", "0,0,0", accept));
+    HPX_TEST(c.get_entry("magenta", value));
+    HPX_TEST_EQ(value, std::string("0,0,0"));
+}
+
+void test_erase()
+{
+    cache_type c(0, 8);
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(c.insert(std::to_string(i), std::to_string(i * i)));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(100));
+
+    // remove all entries with an odd key
+    std::size_t erased =
+        c.erase([](std::pair<std::string, std::string> const& p) {
+            return std::stoul(p.first) % 2 != 0;
+        });
+    HPX_TEST_EQ(erased, static_cast<std::size_t>(50));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(50));
+
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        std::string value;
+        HPX_TEST_EQ(c.get_entry(std::to_string(i), value), i % 2 == 0);
+        if (i % 2 == 0)
+        {
+            HPX_TEST_EQ(value, std::to_string(i * i));
+        }
+    }
+
+    HPX_TEST(c.erase(std::string("42")));
+    HPX_TEST(!c.erase(std::string("42")));
+    HPX_TEST(!c.erase(std::string("43")));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(49));
+
+    HPX_TEST_EQ(c.clear(), static_cast<std::size_t>(49));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_eviction()
+{
+    // use a single shard to make the eviction order predictable
+    hpx::util::cache::concurrent_lru_cache<int, int> c(3, 1);
+
+    HPX_TEST(c.insert(1, 1));
+    HPX_TEST(c.insert(2, 2));
+    HPX_TEST(c.insert(3, 3));
+
+    // touch entries 1 and 3, entry 2 is the only one not referenced
+    int value = 0;
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST(c.get_entry(3, value));
+
+    HPX_TEST(c.insert(4, 4));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(3));
+    HPX_TEST(c.holds_key(1));
+    HPX_TEST(!c.holds_key(2));
+    HPX_TEST(c.holds_key(3));
+    HPX_TEST(c.holds_key(4));
+
+    // all reference bits have been cleared by now, the new entry (4) has not
+    // been referenced either
+    HPX_TEST(c.insert(5, 5));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(3));
+    HPX_TEST(c.holds_key(5));
+
+    // shrinking the cache evicts entries
+    c.reserve(1);
+    HPX_TEST_EQ(c.capacity(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(1));
+}
+
+void test_capacity()
+{
+    hpx::util::cache::concurrent_lru_cache<int, int> c(64, 8);
+    for (int i = 0; i != 1000; ++i)
+    {
+        c.update(i, i);
+        HPX_TEST_LTE(c.size(), static_cast<std::size_t>(64));
+    }
+
+    // every entry still in the cache has to have the correct value
+    std::size_t found = 0;
+    for (int i = 0; i != 1000; ++i)
+    {
+        int value = -1;
+        if (c.get_entry(i, value))
+        {
+            HPX_TEST_EQ(value, i);
+            ++found;
+        }
+    }
+    HPX_TEST_EQ(found, c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    constexpr std::size_t num_threads = 8;
+    constexpr int num_keys = 512;
+    constexpr int num_iterations = 20000;
+
+    hpx::util::cache::concurrent_lru_cache<int, int,
+        hpx::util::cache::statistics::local_statistics>
+        c(num_keys / 2);
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            int key = static_cast<int>(t);
+            for (int i = 0; i != num_iterations; ++i)
+            {
+                key = (key * 17 + 11) % num_keys;
+
+                int value = -1;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, 2 * key);
+                }
+                else
+                {
+                    c.update(key, 2 * key);
+                }
+
+                if (i % 1000 == 0)
+                {
+                    c.erase([key](std::pair<int, int> const& p) {
+                        return p.first == key;
+                    });
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_LTE(c.size(), c.capacity());
+
+    std::size_t hits = 0, misses = 0;
+    c.for_each_statistics([&](auto& stats) {
+        hits += stats.hits();
+        misses += stats.misses();
+    });
+    HPX_TEST_LTE(num_threads * num_iterations, hits + misses);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_and_get();
+    test_update_if();
+    test_erase();
+    test_clock_eviction();
+    test_capacity();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
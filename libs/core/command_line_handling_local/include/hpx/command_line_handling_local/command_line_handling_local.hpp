@@ -65,6 +65,8 @@ namespace hpx::local::detail {
 
         void enable_logging_settings(hpx::program_options::variables_map& vm,
             std::vector<std::string>& ini_config);
+        void enable_tracing_settings(hpx::program_options::variables_map& vm,
+            std::vector<std::string>& ini_config);
 
         void store_command_line(int argc, char** argv);
         void store_unregistered_options(std::string const& cmd_name,
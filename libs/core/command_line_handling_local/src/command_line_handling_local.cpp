@@ -613,6 +613,7 @@ namespace hpx::local::detail {
         handle_high_priority_threads(vm, ini_config);
 
         enable_logging_settings(vm, ini_config);
+        enable_tracing_settings(vm, ini_config);
 
         if (debug_clp)
         {
@@ -678,6 +679,26 @@ namespace hpx::local::detail {
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void command_line_handling::enable_tracing_settings(
+        hpx::program_options::variables_map& vm,
+        std::vector<std::string>& ini_config)
+    {
+        if (vm.count("hpx:trace"))
+        {
+            ini_config.emplace_back("hpx.trace.enabled=1");
+            ini_config.emplace_back(
+                "hpx.trace.destination=" + vm["hpx:trace"].as<std::string>());
+        }
+
+        if (vm.count("hpx:sample"))
+        {
+            ini_config.emplace_back("hpx.sampling.enabled=1");
+            ini_config.emplace_back("hpx.sampling.destination=" +
+                vm["hpx:sample"].as<std::string>());
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void command_line_handling::store_command_line(int argc, char** argv)
     {
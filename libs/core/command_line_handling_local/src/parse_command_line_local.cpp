@@ -553,6 +553,17 @@ namespace hpx { namespace local { namespace detail {
             ("hpx:debug-app-log", value<std::string>()->implicit_value("cout"),
                 "enable all messages on the application log channel and send all "
                 "application logs to the target destination")
+            ("hpx:trace", value<std::string>()->implicit_value(
+                "hpx_trace.%locality%.json"),
+                "record a trace of the executed HPX threads and write it to "
+                "the given file at shutdown (default: "
+                "hpx_trace.%locality%.json)")
+            ("hpx:sample", value<std::string>()->implicit_value(
+                "hpx_samples.%locality%.folded"),
+                "periodically sample the HPX threads running on the worker "
+                "threads and write the samples in the folded stacks format "
+                "to the given file at shutdown (default: "
+                "hpx_samples.%locality%.folded)")
         ;
 
         all_options[options_type::hidden_options].add_options()
@@ -230,6 +230,149 @@ namespace hpx::concurrency::detail {
             }
         }
 
+        /// \brief Attempt to pop up to n items from the left of the queue.
+        ///
+        /// Attempt to pop up to n items from the left (beginning) of the
+        /// queue. The popped items are returned as the range [first, last).
+        /// If no items are left hpx::nullopt is returned.
+        hpx::optional<std::pair<T, T>> pop_left(T n) noexcept
+        {
+            HPX_ASSERT(n != 0);
+
+            range desired_range{0, 0};
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::nullopt;
+                }
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                T const count = expected_range.last - expected_range.first;
+                desired_range = range{
+                    expected_range.first + (count < n ? count : n),
+                    expected_range.last};
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<std::pair<T, T>>(
+                std::in_place, expected_range.first, desired_range.first);
+        }
+
+        /// \brief Attempt to pop up to n items from the right of the queue.
+        ///
+        /// Attempt to pop up to n items from the right (end) of the queue. The
+        /// popped items are returned as the range [first, last). If no items
+        /// are left hpx::nullopt is returned.
+        hpx::optional<std::pair<T, T>> pop_right(T n) noexcept
+        {
+            HPX_ASSERT(n != 0);
+
+            range desired_range{0, 0};
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::nullopt;
+                }
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                T const count = expected_range.last - expected_range.first;
+                desired_range = range{expected_range.first,
+                    expected_range.last - (count < n ? count : n)};
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<std::pair<T, T>>(
+                std::in_place, desired_range.last, expected_range.last);
+        }
+
+        /// \brief Attempt to pop up to n items from the given end of the
+        ///        queue.
+        ///
+        /// Attempt to pop up to n items from the given end of the queue. The
+        /// popped items are returned as the range [first, last). If no items
+        /// are left hpx::nullopt is returned.
+        template <queue_end Which>
+        hpx::optional<std::pair<T, T>> pop(T n) noexcept
+        {
+            if constexpr (Which == queue_end::left)
+            {
+                return pop_left(n);
+            }
+            else
+            {
+                return pop_right(n);
+            }
+        }
+
+        /// \brief Attempt to remove half of the items at the given end of the
+        ///        queue.
+        ///
+        /// Attempt to remove half of the items (rounded up) at the given end
+        /// of the queue. This allows to steal work from the thread owning the
+        /// queue while it continues popping items from the opposite end. The
+        /// removed items are returned as the range [first, last). If less
+        /// than min_items items are left hpx::nullopt is returned.
+        template <queue_end Which>
+        hpx::optional<std::pair<T, T>> steal_half(T min_items = 2) noexcept
+        {
+            range desired_range{0, 0};
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            T middle = 0;
+            do
+            {
+                if (expected_range.empty() ||
+                    expected_range.last - expected_range.first < min_items)
+                {
+                    return hpx::nullopt;
+                }
+
+                T const count = expected_range.last - expected_range.first;
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                if constexpr (Which == queue_end::left)
+                {
+                    middle = expected_range.first + count - count / 2;
+                    desired_range = range{middle, expected_range.last};
+                }
+                else
+                {
+                    middle = expected_range.first + count / 2;
+                    desired_range = range{expected_range.first, middle};
+                }
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            if constexpr (Which == queue_end::left)
+            {
+                return hpx::optional<std::pair<T, T>>(
+                    std::in_place, expected_range.first, middle);
+            }
+            else
+            {
+                return hpx::optional<std::pair<T, T>>(
+                    std::in_place, middle, expected_range.last);
+            }
+        }
+
         constexpr bool empty() const noexcept
         {
             return current_range.data_.load(std::memory_order_relaxed).empty();
@@ -23,6 +23,7 @@
 #include <iterator>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 unsigned int seed = std::random_device{}();
@@ -91,13 +92,66 @@ void test_basic()
         HPX_TEST(!q.pop_left());
         HPX_TEST(!q.pop_right());
     }
+
+    {
+        // Popping multiple items should give us the expected ranges, the
+        // last range may be shorter.
+        hpx::concurrency::detail::contiguous_index_queue<> q{3, 13};
+
+        auto curr = q.pop_left(4);
+        HPX_TEST(curr);
+        HPX_TEST_EQ(curr->first, std::uint32_t(3));
+        HPX_TEST_EQ(curr->second, std::uint32_t(7));
+
+        curr = q.pop_right(4);
+        HPX_TEST(curr);
+        HPX_TEST_EQ(curr->first, std::uint32_t(9));
+        HPX_TEST_EQ(curr->second, std::uint32_t(13));
+
+        curr = q.pop_left(4);
+        HPX_TEST(curr);
+        HPX_TEST_EQ(curr->first, std::uint32_t(7));
+        HPX_TEST_EQ(curr->second, std::uint32_t(9));
+
+        HPX_TEST(q.empty());
+        HPX_TEST(!q.pop_left(4));
+        HPX_TEST(!q.pop_right(4));
+    }
+
+    {
+        // Stealing half of the items should leave the other half (rounded
+        // down) in the queue.
+        hpx::concurrency::detail::contiguous_index_queue<> q{3, 10};
+
+        auto stolen =
+            q.steal_half<hpx::concurrency::detail::queue_end::right>();
+        HPX_TEST(stolen);
+        HPX_TEST_EQ(stolen->first, std::uint32_t(6));
+        HPX_TEST_EQ(stolen->second, std::uint32_t(10));
+        HPX_TEST_EQ(q.get_current_range().first, std::uint32_t(3));
+        HPX_TEST_EQ(q.get_current_range().second, std::uint32_t(6));
+
+        stolen = q.steal_half<hpx::concurrency::detail::queue_end::left>();
+        HPX_TEST(stolen);
+        HPX_TEST_EQ(stolen->first, std::uint32_t(3));
+        HPX_TEST_EQ(stolen->second, std::uint32_t(5));
+        HPX_TEST_EQ(q.get_current_range().first, std::uint32_t(5));
+        HPX_TEST_EQ(q.get_current_range().second, std::uint32_t(6));
+
+        // A single item is left to the owner of the queue.
+        HPX_TEST(!q.steal_half<hpx::concurrency::detail::queue_end::left>());
+        HPX_TEST(!q.steal_half<hpx::concurrency::detail::queue_end::right>());
+        HPX_TEST(q.steal_half<hpx::concurrency::detail::queue_end::right>(1));
+        HPX_TEST(q.empty());
+    }
 }
 
 enum class pop_mode
 {
     left,
     right,
-    random
+    random,
+    steal
 };
 
 void test_concurrent_worker(pop_mode m, std::size_t thread_index,
@@ -132,6 +186,23 @@ void test_concurrent_worker(pop_mode m, std::size_t thread_index,
             popped_indices.push_back(curr.value());
         }
         break;
+    case pop_mode::steal:
+    {
+        // The first thread pops ranges from the left, all other threads
+        // steal half of the remaining items from the right.
+        hpx::optional<std::pair<std::uint32_t, std::uint32_t>> range;
+        while (thread_index == 0 ?
+                (range = q.pop_left(7)) :
+                (range = q.steal_half<
+                     hpx::concurrency::detail::queue_end::right>(1)))
+        {
+            for (std::uint32_t i = range->first; i != range->second; ++i)
+            {
+                popped_indices.push_back(i);
+            }
+        }
+        break;
+    }
     default:
         HPX_TEST(false);
     }
@@ -207,6 +278,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_concurrent(pop_mode::left);
     test_concurrent(pop_mode::right);
     test_concurrent(pop_mode::random);
+    test_concurrent(pop_mode::steal);
 
     return hpx::local::finalize();
 }
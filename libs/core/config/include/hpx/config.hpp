@@ -403,6 +403,34 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Enable hierarchical (core group, NUMA domain, remote NUMA domains) stealing
+// of task batches in the shared priority queue scheduler.
+#if !defined(HPX_THREAD_QUEUE_HIERARCHICAL_STEALING)
+#  define HPX_THREAD_QUEUE_HIERARCHICAL_STEALING 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of tasks to steal in one go if hierarchical stealing is
+// enabled (at most half of the tasks of the victim queue are stolen).
+#if !defined(HPX_THREAD_QUEUE_MAX_STEAL_BATCH_SIZE)
+#  define HPX_THREAD_QUEUE_MAX_STEAL_BATCH_SIZE 64
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of neighboring queues on a NUMA domain forming a core group that is
+// tried first if hierarchical stealing is enabled.
+#if !defined(HPX_THREAD_QUEUE_CORE_GROUP_SIZE)
+#  define HPX_THREAD_QUEUE_CORE_GROUP_SIZE 4
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Minimum number of tasks required to steal tasks from a different NUMA domain
+// if hierarchical stealing is enabled.
+#if !defined(HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA)
+#  define HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA 4
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
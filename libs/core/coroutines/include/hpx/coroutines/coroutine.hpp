@@ -60,7 +60,8 @@ namespace hpx::threads::coroutines {
         using result_type = impl_type::result_type;
         using arg_type = impl_type::arg_type;
 
-        using functor_type = hpx::move_only_function<result_type(arg_type)>;
+        using functor_type = hpx::move_only_function<result_type(arg_type),
+            false, thread_function_storage_size>;
 
         coroutine(functor_type&& f, thread_id_type id,
             std::ptrdiff_t stack_size = detail::default_stack_size)
@@ -32,8 +32,16 @@
 
 #include <hpx/config.hpp>
 
+#include <cstddef>
+
 namespace hpx::threads::coroutines {
 
+    // size of the storage embedded into the function objects representing
+    // thread functions, those usually bind a callable and a couple of
+    // arguments which should not require a separate allocation
+    inline constexpr std::size_t thread_function_storage_size =
+        8 * sizeof(void*);
+
     namespace detail {
 
         class coroutine_self;
@@ -330,6 +330,8 @@ namespace hpx::threads::coroutines::detail::lx {
 
             m_sp[cb_idx] = this;
             m_sp[funp_idx] = reinterpret_cast<void*>(funp);
+            // terminate the chain of frame pointers at the trampoline
+            m_sp[fp_idx] = nullptr;
 
 #if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
             {
@@ -393,6 +395,8 @@ namespace hpx::threads::coroutines::detail::lx {
             fun* funp = trampoline<CoroutineImpl>;
             m_sp[cb_idx] = this;
             m_sp[funp_idx] = reinterpret_cast<void*>(funp);
+            // terminate the chain of frame pointers at the trampoline
+            m_sp[fp_idx] = nullptr;
 #if defined(HPX_HAVE_ADDRESS_SANITIZER)
             asan_stack_size = m_stack_size;
             asan_stack_bottom = const_cast<void const*>(m_stack);
@@ -499,6 +503,7 @@ namespace hpx::threads::coroutines::detail::lx {
         static constexpr std::size_t const context_size = 12;
         static constexpr std::size_t const cb_idx = 10;
         static constexpr std::size_t const funp_idx = 8;
+        static constexpr std::size_t const fp_idx = 7;
 #else
         // structure of context_data:
         // 7: valgrind_id (if enabled)
@@ -515,6 +520,7 @@ namespace hpx::threads::coroutines::detail::lx {
         static constexpr std::size_t const context_size = 8;
         static constexpr std::size_t const cb_idx = 6;
         static constexpr std::size_t const funp_idx = 4;
+        static constexpr std::size_t const fp_idx = 3;
 #endif
 
         std::ptrdiff_t m_stack_size;
@@ -61,7 +61,8 @@ namespace hpx::threads::coroutines::detail {
         using result_type = std::pair<thread_schedule_state, thread_id_type>;
         using arg_type = thread_restart_state;
 
-        using functor_type = hpx::move_only_function<result_type(arg_type)>;
+        using functor_type = hpx::move_only_function<result_type(arg_type),
+            false, thread_function_storage_size>;
 
         coroutine_impl(functor_type&& f, thread_id_type id,
             std::ptrdiff_t stack_size) noexcept
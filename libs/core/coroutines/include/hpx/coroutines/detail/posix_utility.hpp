@@ -32,6 +32,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_arena.hpp>
 
 // include unistd.h conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -83,6 +84,11 @@ namespace hpx::threads::coroutines::detail::posix {
 
     inline void* alloc_stack(std::size_t size)
     {
+        if (stack_arena.enabled)
+        {
+            return stack_arena_alloc(size);
+        }
+
         void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
             PROT_EXEC | PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
@@ -137,6 +143,12 @@ namespace hpx::threads::coroutines::detail::posix {
 
     inline bool reset_stack(void* stack, std::size_t size)
     {
+        // stacks taken from the arena are kept resident
+        if (stack_arena.enabled)
+        {
+            return false;
+        }
+
         void** watermark = static_cast<void**>(stack) +
             ((size - EXEC_PAGESIZE) / sizeof(void*));
 
@@ -155,6 +167,12 @@ namespace hpx::threads::coroutines::detail::posix {
 
     inline void free_stack(void* stack, std::size_t size)
     {
+        if (stack_arena.enabled)
+        {
+            stack_arena_free(stack, size);
+            return;
+        }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -0,0 +1,89 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#define HPX_COROUTINES_HAVE_STACK_ARENA
+#endif
+
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+
+// The stack arena carves coroutine stacks out of large memory regions instead
+// of mapping every stack separately. Released stacks are kept on per-worker
+// free lists (overflowing into a shared list) and are handed out again to new
+// coroutines, which avoids the mmap/munmap system calls and the page faults
+// otherwise caused by short lived tasks. Regions are mapped by the worker
+// thread requesting them, which places them on the NUMA domain of that worker
+// (first touch), and are optionally backed by huge pages and pre-faulted.
+// Memory held by the arena is returned to the system at process exit only.
+namespace hpx::threads::coroutines::detail::posix {
+
+    enum class stack_arena_huge_pages : std::uint8_t
+    {
+        none = 0,           // regular pages
+        transparent = 1,    // request transparent huge pages (madvise)
+        explicit_ = 2       // map the regions using MAP_HUGETLB
+    };
+
+    struct stack_arena_parameters
+    {
+        // the arena is used only if enabled, this has to be set before the
+        // first coroutine stack is allocated and may be reset only once all
+        // stacks allocated from the arena have been released
+        bool enabled = false;
+
+        // size of the memory regions stacks are carved from
+        std::size_t region_size = 16 * 1024 * 1024;
+
+        stack_arena_huge_pages huge_pages = stack_arena_huge_pages::none;
+
+        // touch all pages of a region while mapping it
+        bool prefault = true;
+
+        // maximal number of released stacks (per stack size) to keep on the
+        // free list of a worker thread before handing them to the shared list
+        std::size_t max_cached_stacks = 64;
+    };
+
+    // this global variable is used to configure the stack arena, it is
+    // initialized from the [hpx.stacks] configuration section
+    HPX_CORE_EXPORT extern stack_arena_parameters stack_arena;
+
+    // Allocate a stack of the given size, the returned pointer refers to the
+    // lowest address of the usable stack memory. A guard page is placed
+    // below each stack carved from a region (it is installed lazily when the
+    // stack is carved, stacks taken from a free list already have one), except
+    // for regions backed by explicit huge pages.
+    HPX_CORE_EXPORT void* stack_arena_alloc(std::size_t size);
+
+    // Return a stack to the free list of the calling worker thread
+    HPX_CORE_EXPORT void stack_arena_free(void* stack, std::size_t size);
+
+    // number of stacks served from a free list
+    HPX_CORE_EXPORT std::int64_t get_stack_arena_reuse_count(bool reset);
+
+    // number of stacks newly carved from a region
+    HPX_CORE_EXPORT std::int64_t get_stack_arena_allocation_count(bool reset);
+
+    // number of regions mapped
+    HPX_CORE_EXPORT std::int64_t get_stack_arena_region_count(bool reset);
+
+    // number of page faults taken while pre-faulting regions
+    HPX_CORE_EXPORT std::int64_t get_stack_arena_prefault_count(bool reset);
+}    // namespace hpx::threads::coroutines::detail::posix
+
+#endif
@@ -0,0 +1,316 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_arena.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace hpx::threads::coroutines::detail::posix {
+
+    stack_arena_parameters stack_arena;
+
+    namespace {
+
+        std::atomic<std::int64_t> reuse_count(0);
+        std::atomic<std::int64_t> allocation_count(0);
+        std::atomic<std::int64_t> region_count(0);
+        std::atomic<std::int64_t> prefault_count(0);
+
+        constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+
+        ///////////////////////////////////////////////////////////////////////
+        // released stacks of one size
+        struct free_list
+        {
+            std::size_t size;
+            std::vector<void*> stacks;
+        };
+
+        free_list& get_free_list(
+            std::vector<free_list>& lists, std::size_t size)
+        {
+            // there are only a handful of different stack sizes
+            for (free_list& l : lists)
+            {
+                if (l.size == size)
+                    return l;
+            }
+            return lists.emplace_back(free_list{size, {}});
+        }
+
+        // stacks overflowing the per-worker free lists, or released by
+        // exiting threads
+        struct shared_free_lists
+        {
+            bool pop(std::size_t size, void*& stack)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                free_list& fl = get_free_list(lists_, size);
+                if (fl.stacks.empty())
+                    return false;
+
+                stack = fl.stacks.back();
+                fl.stacks.pop_back();
+                return true;
+            }
+
+            void push(std::size_t size, void* const* first, void* const* last)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                free_list& fl = get_free_list(lists_, size);
+                fl.stacks.insert(fl.stacks.end(), first, last);
+            }
+
+            std::mutex mtx_;
+            std::vector<free_list> lists_;
+        };
+
+        shared_free_lists& get_shared_free_lists()
+        {
+            static shared_free_lists lists;
+            return lists;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        char* map_region(std::size_t& size, bool& huge_pages)
+        {
+            huge_pages = false;
+
+#if defined(MAP_HUGETLB)
+            if (stack_arena.huge_pages == stack_arena_huge_pages::explicit_)
+            {
+                std::size_t const huge_size =
+                    (size + huge_page_size - 1) & ~(huge_page_size - 1);
+                void* region = ::mmap(nullptr, huge_size,
+                    PROT_EXEC | PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (region != MAP_FAILED)
+                {
+                    size = huge_size;
+                    huge_pages = true;
+                    return static_cast<char*>(region);
+                }
+                // fall back to regular pages if no huge pages are available
+            }
+#endif
+
+            void* region = ::mmap(nullptr, size,
+                PROT_EXEC | PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                MAP_PRIVATE | MAP_ANON,
+#else
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                -1, 0);
+
+            if (region == MAP_FAILED)
+            {
+                throw std::runtime_error(
+                    "mmap() failed to allocate coroutine stack arena region");
+            }
+
+#if defined(MADV_HUGEPAGE)
+            if (stack_arena.huge_pages == stack_arena_huge_pages::transparent)
+            {
+                ::madvise(region, size, MADV_HUGEPAGE);
+            }
+#endif
+            return static_cast<char*>(region);
+        }
+
+        void prefault_region(char* region, std::size_t size)
+        {
+#if defined(MADV_POPULATE_WRITE)
+            if (::madvise(region, size, MADV_POPULATE_WRITE) == 0)
+            {
+                prefault_count += static_cast<std::int64_t>(
+                    size / EXEC_PAGESIZE);
+                return;
+            }
+#endif
+            for (std::size_t i = 0; i < size; i += EXEC_PAGESIZE)
+            {
+                *static_cast<char volatile*>(region + i) = 0;
+            }
+            prefault_count += static_cast<std::int64_t>(size / EXEC_PAGESIZE);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the part of the arena owned by a single (worker) thread
+        struct local_arena
+        {
+            local_arena() = default;
+
+            local_arena(local_arena const&) = delete;
+            local_arena(local_arena&&) = delete;
+            local_arena& operator=(local_arena const&) = delete;
+            local_arena& operator=(local_arena&&) = delete;
+
+            ~local_arena()
+            {
+                // make the cached stacks available to the remaining threads
+                for (free_list& fl : lists_)
+                {
+                    if (!fl.stacks.empty())
+                    {
+                        get_shared_free_lists().push(fl.size,
+                            fl.stacks.data(),
+                            fl.stacks.data() + fl.stacks.size());
+                    }
+                }
+            }
+
+            void* allocate(std::size_t size)
+            {
+                free_list& fl = get_free_list(lists_, size);
+                if (!fl.stacks.empty())
+                {
+                    void* stack = fl.stacks.back();
+                    fl.stacks.pop_back();
+                    ++reuse_count;
+                    return stack;
+                }
+
+                void* stack = nullptr;
+                if (get_shared_free_lists().pop(size, stack))
+                {
+                    ++reuse_count;
+                    return stack;
+                }
+
+                return carve(size);
+            }
+
+            void deallocate(void* stack, std::size_t size)
+            {
+                free_list& fl = get_free_list(lists_, size);
+                if (fl.stacks.size() < stack_arena.max_cached_stacks)
+                {
+                    fl.stacks.push_back(stack);
+                    return;
+                }
+
+                // hand over half of the cached stacks to the shared list to
+                // avoid acquiring the lock for every released stack
+                std::size_t const keep = fl.stacks.size() / 2;
+                fl.stacks.push_back(stack);
+                get_shared_free_lists().push(size, fl.stacks.data() + keep,
+                    fl.stacks.data() + fl.stacks.size());
+                fl.stacks.resize(keep);
+            }
+
+        private:
+            void* carve(std::size_t size)
+            {
+                // always leave room for a guard page
+                if (next_ == nullptr ||
+                    static_cast<std::size_t>(end_ - next_) <
+                        size + EXEC_PAGESIZE)
+                {
+                    std::size_t region_size = stack_arena.region_size;
+                    if (region_size < size + EXEC_PAGESIZE)
+                    {
+                        region_size = size + EXEC_PAGESIZE;
+                    }
+
+                    // the remainder of the current region is abandoned
+                    next_ = map_region(region_size, huge_pages_);
+                    end_ = next_ + region_size;
+                    ++region_count;
+
+                    if (stack_arena.prefault)
+                    {
+                        prefault_region(next_, region_size);
+                    }
+                }
+
+                // stacks carved from a region are adjacent to each other, a
+                // guard page below each of them catches a stack overflowing
+                // into its neighbor (explicit huge pages can't be protected
+                // page by page)
+                std::size_t const guard_size =
+                    huge_pages_ ? 0 : std::size_t(EXEC_PAGESIZE);
+                if (guard_size != 0 &&
+                    ::mprotect(next_, guard_size, PROT_NONE) != 0)
+                {
+                    throw std::runtime_error(
+                        "mprotect() failed to install the guard page of a "
+                        "coroutine stack, increase /proc/sys/vm/max_map_count");
+                }
+
+                void* stack = next_ + guard_size;
+                next_ += size + guard_size;
+                ++allocation_count;
+                return stack;
+            }
+
+            std::vector<free_list> lists_;
+            char* next_ = nullptr;
+            char* end_ = nullptr;
+            bool huge_pages_ = false;
+        };
+
+        local_arena& get_local_arena()
+        {
+            thread_local local_arena arena;
+            return arena;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* stack_arena_alloc(std::size_t size)
+    {
+        HPX_ASSERT(size % EXEC_PAGESIZE == 0);
+        return get_local_arena().allocate(size);
+    }
+
+    void stack_arena_free(void* stack, std::size_t size)
+    {
+        HPX_ASSERT(stack != nullptr);
+        get_local_arena().deallocate(stack, size);
+    }
+
+    std::int64_t get_stack_arena_reuse_count(bool reset)
+    {
+        return util::get_and_reset_value(reuse_count, reset);
+    }
+
+    std::int64_t get_stack_arena_allocation_count(bool reset)
+    {
+        return util::get_and_reset_value(allocation_count, reset);
+    }
+
+    std::int64_t get_stack_arena_region_count(bool reset)
+    {
+        return util::get_and_reset_value(region_count, reset);
+    }
+
+    std::int64_t get_stack_arena_prefault_count(bool reset)
+    {
+        return util::get_and_reset_value(prefault_count, reset);
+    }
+}    // namespace hpx::threads::coroutines::detail::posix
+
+#endif
+#endif
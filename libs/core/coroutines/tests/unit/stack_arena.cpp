@@ -0,0 +1,209 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_arena.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+constexpr std::size_t stack_size = 0x10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    posix::get_stack_arena_reuse_count(true);
+    posix::get_stack_arena_allocation_count(true);
+
+    std::vector<void*> stacks;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        void* stack = posix::stack_arena_alloc(stack_size);
+        HPX_TEST(stack != nullptr);
+
+        // the whole stack has to be usable
+        std::memset(stack, 0xcd, stack_size);
+        stacks.push_back(stack);
+    }
+
+    // all stacks have to be distinct and must not overlap
+    std::set<char*> sorted;
+    for (void* stack : stacks)
+    {
+        sorted.insert(static_cast<char*>(stack));
+    }
+    HPX_TEST_EQ(sorted.size(), stacks.size());
+
+    char* prev = nullptr;
+    for (char* stack : sorted)
+    {
+        HPX_TEST(prev == nullptr || prev + stack_size <= stack);
+        prev = stack;
+    }
+
+    HPX_TEST_EQ(posix::get_stack_arena_allocation_count(false),
+        static_cast<std::int64_t>(stacks.size()));
+    HPX_TEST_EQ(posix::get_stack_arena_reuse_count(false), 0);
+
+    // released stacks are handed out again
+    void* last = stacks.back();
+    posix::stack_arena_free(last, stack_size);
+    HPX_TEST(posix::stack_arena_alloc(stack_size) == last);
+    HPX_TEST_EQ(posix::get_stack_arena_reuse_count(false), 1);
+
+    for (void* stack : stacks)
+    {
+        posix::stack_arena_free(stack, stack_size);
+    }
+
+    // different stack sizes are kept apart
+    void* large = posix::stack_arena_alloc(4 * stack_size);
+    HPX_TEST(sorted.find(static_cast<char*>(large)) == sorted.end());
+    std::memset(large, 0xcd, 4 * stack_size);
+    posix::stack_arena_free(large, 4 * stack_size);
+
+    HPX_TEST_LTE(std::int64_t(1), posix::get_stack_arena_region_count(false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent()
+{
+    constexpr std::size_t num_threads = 4;
+    constexpr std::size_t num_iterations = 1000;
+
+    // stacks allocated on one thread and released on another
+    std::vector<std::vector<void*>> stacks(num_threads);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&stacks, t]() {
+            std::vector<void*> local;
+            for (std::size_t i = 0; i != num_iterations; ++i)
+            {
+                void* stack = posix::stack_arena_alloc(stack_size);
+                static_cast<char*>(stack)[stack_size - 1] = 1;
+                local.push_back(stack);
+
+                if (i % 3 == 0)
+                {
+                    posix::stack_arena_free(local.back(), stack_size);
+                    local.pop_back();
+                }
+            }
+            stacks[t] = std::move(local);
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    threads.clear();
+
+    std::set<void*> unique;
+    for (auto const& s : stacks)
+    {
+        unique.insert(s.begin(), s.end());
+    }
+    HPX_TEST_EQ(unique.size(),
+        num_threads * (num_iterations - (num_iterations + 2) / 3));
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&stacks, t]() {
+            for (void* stack : stacks[(t + 1) % num_threads])
+            {
+                posix::stack_arena_free(stack, stack_size);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+#if defined(__linux) || defined(linux) || defined(__linux__)
+// return the permissions of the mapping containing the given address
+std::string get_protection(void const* addr)
+{
+    std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(addr);
+
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line))
+    {
+        std::istringstream is(line);
+        std::uintptr_t begin = 0, end = 0;
+        char dash = 0;
+        std::string perms;
+        is >> std::hex >> begin >> dash >> end >> perms;
+        if (begin <= address && address < end)
+        {
+            return perms;
+        }
+    }
+    return "";
+}
+
+// the stacks carved from a region are separated by guard pages
+void test_guard_pages()
+{
+    std::vector<void*> stacks;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        stacks.push_back(posix::stack_arena_alloc(stack_size));
+    }
+
+    for (void* stack : stacks)
+    {
+        char const* p = static_cast<char const*>(stack);
+        HPX_TEST_EQ(get_protection(p - 1).substr(0, 3), std::string("---"));
+        HPX_TEST_EQ(get_protection(p).substr(0, 2), std::string("rw"));
+        HPX_TEST_EQ(
+            get_protection(p + stack_size - 1).substr(0, 2), std::string("rw"));
+    }
+
+    for (void* stack : stacks)
+    {
+        posix::stack_arena_free(stack, stack_size);
+    }
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    posix::stack_arena.enabled = true;
+    posix::stack_arena.region_size = 0x100000;
+    posix::stack_arena.max_cached_stacks = 16;
+
+    test_reuse();
+    test_concurrent();
+#if defined(__linux) || defined(linux) || defined(__linux__)
+    test_guard_pages();
+#endif
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,260 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/threading_base/detail/io_uring_service.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        // Submit the request to the io_uring service of the scheduler running
+        // the calling HPX thread. Returns the thread pool of that scheduler,
+        // or nullptr if the request was not submitted.
+        HPX_CORE_EXPORT hpx::threads::thread_pool_base* submit_file_request(
+            hpx::threads::detail::io_uring_request& req);
+
+        // Perform the request synchronously, returns the result of the
+        // corresponding system call or -errno.
+        HPX_CORE_EXPORT int perform_file_request(
+            hpx::threads::detail::io_uring_request const& req) noexcept;
+
+        // Invoke f(op) on a new HPX thread running on the given worker thread.
+        HPX_CORE_EXPORT void resume_file_operation(
+            hpx::threads::thread_pool_base* pool, std::size_t num_thread,
+            void (*f)(void*), void* op);
+
+        HPX_CORE_EXPORT std::exception_ptr make_file_error(
+            hpx::threads::detail::io_uring_request::operation op, int error);
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Result>
+        struct file_sender
+        {
+            hpx::threads::detail::io_uring_request req;
+
+            // the path for openat
+            std::string path;
+
+            template <typename Receiver>
+            struct operation_state : hpx::threads::detail::io_uring_request
+            {
+                HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+                std::string path;
+                hpx::threads::thread_pool_base* pool = nullptr;
+                int result = 0;
+
+                template <typename Receiver_>
+                operation_state(Receiver_&& receiver,
+                    hpx::threads::detail::io_uring_request const& req,
+                    std::string path)
+                  : hpx::threads::detail::io_uring_request(req)
+                  , receiver(HPX_FORWARD(Receiver_, receiver))
+                  , path(HPX_MOVE(path))
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                friend void tag_invoke(start_t, operation_state& os) noexcept
+                {
+                    os.on_complete = &operation_state::on_completed;
+                    if (os.op ==
+                        hpx::threads::detail::io_uring_request::operation::
+                            openat)
+                    {
+                        os.buffer = os.path.data();
+                    }
+
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() {
+                            os.pool = submit_file_request(os);
+                            if (os.pool == nullptr)
+                            {
+                                // io_uring is not available, block the
+                                // calling thread instead
+                                os.result = perform_file_request(os);
+                                os.complete();
+                            }
+                        },
+                        [&](std::exception_ptr ep) {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                        });
+                }
+
+            private:
+                // invoked by the scheduling loop, continue on a new HPX
+                // thread on the worker thread which submitted the request
+                static void on_completed(
+                    hpx::threads::detail::io_uring_request& req, int result,
+                    std::size_t num_thread)
+                {
+                    auto& os = static_cast<operation_state&>(req);
+                    os.result = result;
+                    resume_file_operation(
+                        os.pool, num_thread, &operation_state::resume, &os);
+                }
+
+                static void resume(void* op)
+                {
+                    static_cast<operation_state*>(op)->complete();
+                }
+
+                void complete()
+                {
+                    if (result < 0)
+                    {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(receiver), make_file_error(op, -result));
+                    }
+                    else if constexpr (std::is_void_v<Result>)
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(receiver));
+                    }
+                    else
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(receiver), static_cast<Result>(result));
+                    }
+                }
+            };
+
+            template <typename Receiver>
+            friend operation_state<Receiver> tag_invoke(
+                connect_t, file_sender&& s, Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver), s.req,
+                    HPX_MOVE(s.path)};
+            }
+
+            template <typename Receiver>
+            friend operation_state<Receiver> tag_invoke(
+                connect_t, file_sender& s, Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver), s.req, s.path};
+            }
+        };
+
+        template <typename Result, typename Env>
+        auto tag_invoke(get_completion_signatures_t, file_sender<Result> const&,
+            Env) noexcept
+            -> hpx::execution::experimental::completion_signatures<
+                set_value_t(Result), set_error_t(std::exception_ptr)>;
+
+        template <typename Env>
+        auto tag_invoke(get_completion_signatures_t, file_sender<void> const&,
+            Env) noexcept
+            -> hpx::execution::experimental::completion_signatures<
+                set_value_t(), set_error_t(std::exception_ptr)>;
+
+        // the kernel transfers at most 0x7ffff000 bytes per call
+        constexpr std::uint32_t limit_file_transfer_size(
+            std::size_t size) noexcept
+        {
+            return size < std::size_t(0x7ffff000) ?
+                static_cast<std::uint32_t>(size) :
+                std::uint32_t(0x7ffff000);
+        }
+    }    // namespace detail
+
+    // The file senders perform the file operations asynchronously if HPX was
+    // configured with HPX_WITH_IO_URING and io_uring is supported by the
+    // kernel: the request is submitted to an io_uring instance owned by the
+    // worker thread the sender is started on, the completion is reaped by the
+    // scheduling loop of that worker thread and the receiver is invoked on a
+    // new HPX thread running on the same worker thread. Otherwise (or if the
+    // sender is not started on an HPX thread) the operation is performed
+    // synchronously, blocking the calling thread, and the receiver is invoked
+    // inline. Errors are reported as std::system_error.
+
+    // Returns a sender which opens the file at the given path (relative to the
+    // directory dirfd, or AT_FDCWD) and sends the new file descriptor.
+    inline constexpr struct async_openat_t final
+    {
+        auto operator()(int dirfd, std::string path, int flags,
+            std::uint32_t mode = 0) const
+        {
+            detail::file_sender<int> s;
+            s.req.op =
+                hpx::threads::detail::io_uring_request::operation::openat;
+            s.req.fd = dirfd;
+            s.req.flags = flags;
+            s.req.mode = mode;
+            s.path = HPX_MOVE(path);
+            return s;
+        }
+    } async_openat{};
+
+    // Returns a sender which reads up to size bytes from the given offset of
+    // the file into the buffer and sends the number of bytes read (which is
+    // zero at the end of the file). The buffer has to stay alive until the
+    // operation has completed.
+    inline constexpr struct async_read_t final
+    {
+        auto operator()(int fd, void* buffer, std::size_t size,
+            std::uint64_t offset) const
+        {
+            detail::file_sender<std::size_t> s;
+            s.req.op = hpx::threads::detail::io_uring_request::operation::read;
+            s.req.fd = fd;
+            s.req.buffer = buffer;
+            s.req.size = detail::limit_file_transfer_size(size);
+            s.req.offset = offset;
+            return s;
+        }
+    } async_read{};
+
+    // Returns a sender which writes up to size bytes from the buffer to the
+    // given offset of the file and sends the number of bytes written. The
+    // buffer has to stay alive until the operation has completed.
+    inline constexpr struct async_write_t final
+    {
+        auto operator()(int fd, void const* buffer, std::size_t size,
+            std::uint64_t offset) const
+        {
+            detail::file_sender<std::size_t> s;
+            s.req.op = hpx::threads::detail::io_uring_request::operation::write;
+            s.req.fd = fd;
+            s.req.buffer = const_cast<void*>(buffer);
+            s.req.size = detail::limit_file_transfer_size(size);
+            s.req.offset = offset;
+            return s;
+        }
+    } async_write{};
+
+    // Returns a sender which flushes the file to the storage device (only
+    // its data if data_only is true, like fdatasync).
+    inline constexpr struct async_fsync_t final
+    {
+        auto operator()(int fd, bool data_only = false) const
+        {
+            detail::file_sender<void> s;
+            s.req.op = hpx::threads::detail::io_uring_request::operation::fsync;
+            s.req.fd = fd;
+            s.req.flags = data_only ? 1 : 0;
+            return s;
+        }
+    } async_fsync{};
+}    // namespace hpx::execution::experimental
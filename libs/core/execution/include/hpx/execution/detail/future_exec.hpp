@@ -25,6 +25,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
 #include <exception>
@@ -152,8 +153,14 @@ namespace hpx::lcos::detail {
         template <typename F>
         void operator()(F&& f, hpx::threads::thread_description desc) const
         {
+            // continuations are leaf tasks, run them stackless if enabled
+            auto policy = hpx::execution::experimental::with_stacksize(
+                hpx::launch::async,
+                threads::get_leaf_task_stacksize<F>(
+                    threads::thread_stacksize::default_));
+
             hpx::detail::post_policy_dispatch<hpx::launch::async_policy>::call(
-                hpx::launch::async, desc, HPX_FORWARD(F, f));
+                policy, desc, threads::make_leaf_task(HPX_FORWARD(F, f)));
         }
     };
 
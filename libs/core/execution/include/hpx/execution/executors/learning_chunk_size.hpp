@@ -0,0 +1,232 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/learning_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assertion/source_location.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // The chunking used for one invocation of an algorithm: the loop
+        // iterations are divided into (cores / core_divisor) *
+        // chunks_per_core chunks.
+        struct chunk_size_tuning_decision
+        {
+            std::uint32_t core_divisor = 1;
+            std::uint32_t chunks_per_core = 1;
+
+            // identify the measured candidate, if any
+            std::uint32_t candidate = 0;
+            std::uint32_t generation = 0;
+            bool measure = false;
+        };
+
+        // The measurements and the decision for one call site, entries are
+        // never deallocated.
+        class chunk_size_tuning_entry;
+
+        HPX_CORE_EXPORT chunk_size_tuning_entry* get_chunk_size_tuning_entry(
+            std::string const& key);
+
+        // select the chunking to use for the next invocation
+        HPX_CORE_EXPORT chunk_size_tuning_decision chunk_size_tuning_begin(
+            chunk_size_tuning_entry& entry);
+
+        // record the execution time of an invocation which used the given
+        // chunking
+        HPX_CORE_EXPORT void chunk_size_tuning_end(
+            chunk_size_tuning_entry& entry,
+            chunk_size_tuning_decision const& decision, std::size_t count,
+            std::uint64_t elapsed);
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of pieces is learned from the execution times of previous
+    /// invocations of the algorithms using the same key (a call site or an
+    /// annotation). Each key goes through a short exploration phase trying
+    /// different numbers of chunks per core and different numbers of cores,
+    /// all later invocations use the combination that has been fastest per
+    /// loop iteration.
+    ///
+    /// \note The learned decisions are shared by all objects constructed
+    ///       with the same key. They can be written to a file (see
+    ///       \a save_chunk_size_tuning) and loaded by later runs (see
+    ///       \a load_chunk_size_tuning), which skips the exploration phase.
+    ///       The runtime does this automatically if the configuration entry
+    ///       hpx.chunk_size_tuning.file is set.
+    ///
+    /// \note The number of cores is applied by limiting the number of
+    ///       created chunks. No measurement of the loop body (as done by
+    ///       \a auto_chunk_size) is performed.
+    ///
+    /// \note A single object must not be used by concurrently running
+    ///       algorithms, use one object per invocation instead (the objects
+    ///       are cheap to copy).
+    ///
+    struct learning_chunk_size
+    {
+    public:
+        /// Construct a \a learning_chunk_size executor parameters object
+        ///
+        /// \param key          [in] The name identifying the loop the
+        ///                     measurements are recorded for.
+        ///
+        explicit learning_chunk_size(std::string key)
+          : key_(HPX_MOVE(key))
+          , entry_(detail::get_chunk_size_tuning_entry(key_))
+        {
+        }
+
+        /// Construct a \a learning_chunk_size executor parameters object
+        ///
+        /// \param loc          [in] The call site identifying the loop the
+        ///                     measurements are recorded for, usually
+        ///                     HPX_CURRENT_SOURCE_LOCATION().
+        ///
+        explicit learning_chunk_size(hpx::source_location const& loc)
+          : learning_chunk_size(std::string(loc.file_name()) + ":" +
+                std::to_string(loc.line()))
+        {
+        }
+
+        /// Return the key the measurements are recorded for
+        std::string const& key() const noexcept
+        {
+            return key_;
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        void mark_begin_execution(Executor&&)
+        {
+            decision_ = detail::chunk_size_tuning_begin(*entry_);
+            count_ = 0;
+            if (decision_.measure)
+            {
+                start_ = hpx::chrono::high_resolution_clock::now();
+            }
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&&)
+        {
+            if (decision_.measure)
+            {
+                decision_.measure = false;
+                detail::chunk_size_tuning_end(*entry_, decision_, count_,
+                    hpx::chrono::high_resolution_clock::now() - start_);
+            }
+        }
+
+        template <typename Executor>
+        std::size_t get_chunk_size(Executor&,
+            hpx::chrono::steady_duration const&, std::size_t cores,
+            std::size_t count)
+        {
+            // algorithms which don't invoke mark_begin_execution use the
+            // current decision without measuring it
+            if (!decision_.measure)
+            {
+                decision_ = detail::chunk_size_tuning_begin(*entry_);
+                decision_.measure = false;
+            }
+            else if (count_ == 0)
+            {
+                // the first call sees the overall number of iterations
+                count_ = count;
+            }
+
+            std::size_t used_cores = cores / decision_.core_divisor;
+            if (used_cores == 0)
+            {
+                used_cores = 1;
+            }
+
+            std::size_t const chunks = used_cores * decision_.chunks_per_core;
+            return (count + chunks - 1) / chunks;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const /* version */)
+        {
+            // clang-format off
+            ar & key_;
+            // clang-format on
+
+            // the entry is local to the process
+            entry_ = detail::get_chunk_size_tuning_entry(key_);
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::string key_;
+        detail::chunk_size_tuning_entry* entry_;
+        detail::chunk_size_tuning_decision decision_;
+        std::size_t count_ = 0;
+        std::uint64_t start_ = 0;
+        /// \endcond
+    };
+
+    /// Load the chunking decisions written by \a save_chunk_size_tuning.
+    /// The loaded decisions replace the measurements recorded so far for the
+    /// same keys.
+    ///
+    /// \param filename     [in] The name of the file to read.
+    ///
+    /// \returns false if the file could not be opened, true otherwise.
+    ///
+    /// \throws hpx::exception if the file has an invalid format.
+    ///
+    HPX_CORE_EXPORT bool load_chunk_size_tuning(std::string const& filename);
+
+    /// Write the chunking decisions of all keys which have finished their
+    /// exploration phase.
+    ///
+    /// \param filename     [in] The name of the file to write.
+    ///
+    /// \throws hpx::exception if the file could not be written.
+    ///
+    HPX_CORE_EXPORT void save_chunk_size_tuning(std::string const& filename);
+
+    /// Forget all measurements and decisions, the next invocation for each
+    /// key starts a new exploration phase.
+    HPX_CORE_EXPORT void reset_chunk_size_tuning();
+}    // namespace hpx::execution::experimental
+
+namespace hpx::parallel::execution {
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::learning_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::parallel::execution
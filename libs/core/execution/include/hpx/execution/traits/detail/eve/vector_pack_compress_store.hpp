@@ -0,0 +1,50 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EVE)
+#include <cstddef>
+#include <memory>
+
+#include <eve/function/all.hpp>
+#include <eve/function/any.hpp>
+#include <eve/function/store.hpp>
+#include <eve/wide.hpp>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress_store(
+        eve::wide<T, Abi> const& val,
+        eve::logical<eve::wide<T, Abi>> const& msk, Iter dest)
+    {
+        if (eve::all(msk))
+        {
+            eve::store(val, std::addressof(*dest));
+            return val.size();
+        }
+
+        std::size_t count = 0;
+        if (eve::any(msk))
+        {
+            for (std::ptrdiff_t i = 0; i != val.size(); ++i)
+            {
+                if (msk.get(i))
+                {
+                    *dest++ = val.get(i);
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_DATAPAR_EVE)
+#include <eve/function/any.hpp>
 #include <eve/function/first_true.hpp>
 
 namespace hpx::parallel::traits {
@@ -24,6 +25,24 @@ namespace hpx::parallel::traits {
         }
         return -1;
     }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename Mask>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_of(Mask const& msk) noexcept
+    {
+        if (eve::any(msk))
+        {
+            for (int i = static_cast<int>(msk.size()) - 1; i != 0; --i)
+            {
+                if (msk.get(i))
+                {
+                    return i;
+                }
+            }
+            return 0;
+        }
+        return -1;
+    }
 }    // namespace hpx::parallel::traits
 
 #endif
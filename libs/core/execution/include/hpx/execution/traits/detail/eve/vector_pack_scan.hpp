@@ -0,0 +1,52 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EVE)
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+
+#include <eve/wide.hpp>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE eve::wide<T, Abi> slide_right(
+        eve::wide<T, Abi> const& v, T val) noexcept
+    {
+        return eve::wide<T, Abi>([&](auto i, auto) {
+            return i == 0 ? val : v.get(i - 1);
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE eve::wide<T, Abi> inclusive_scan(
+        eve::wide<T, Abi> v, Op&& op)
+    {
+        using vector_type = eve::wide<T, Abi>;
+
+        // combine each lane with the lane n positions below it
+        for (std::ptrdiff_t n = 1; n < v.size(); n *= 2)
+        {
+            vector_type const shifted([&](auto i, auto) {
+                return i < n ? v.get(i) : v.get(i - n);
+            });
+            vector_type const sums = HPX_INVOKE(op, shifted, v);
+            v = vector_type([&](auto i, auto) {
+                return i < n ? v.get(i) : sums.get(i);
+            });
+        }
+        return v;
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,49 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+
+#include <hpx/execution/traits/detail/simd/vector_pack_simd.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress_store(
+        datapar::experimental::simd<T, Abi> const& val,
+        datapar::experimental::simd_mask<T, Abi> const& msk, Iter dest)
+    {
+        if (datapar::experimental::all_of(msk))
+        {
+            val.copy_to(std::addressof(*dest),
+                datapar::experimental::element_aligned);
+            return val.size();
+        }
+
+        std::size_t count = 0;
+        if (datapar::experimental::any_of(msk))
+        {
+            for (std::size_t i = 0; i != val.size(); ++i)
+            {
+                if (msk[i])
+                {
+                    *dest++ = val[i];
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
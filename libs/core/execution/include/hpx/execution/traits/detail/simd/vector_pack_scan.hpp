@@ -0,0 +1,96 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_EXPERIMENTAL_SIMD)
+
+#include <hpx/execution/traits/detail/simd/vector_pack_simd.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+
+namespace hpx::parallel::traits {
+
+    namespace detail {
+
+        // Moves the lanes of v up by N positions, the lanes which become
+        // free are taken from fill
+        template <std::size_t N, typename T, typename Abi>
+        HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+        shift_lanes(datapar::experimental::simd<T, Abi> const& v,
+            datapar::experimental::simd<T, Abi> const& fill) noexcept
+        {
+            return datapar::experimental::simd<T, Abi>([&](auto i) {
+                constexpr std::size_t idx = decltype(i)::value;
+                if constexpr (idx < N)
+                {
+                    return static_cast<T>(fill[idx]);
+                }
+                else
+                {
+                    return static_cast<T>(v[idx - N]);
+                }
+            });
+        }
+
+        // Selects the lanes below N from v1, all others from v2
+        template <std::size_t N, typename T, typename Abi>
+        HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+        blend_lanes(datapar::experimental::simd<T, Abi> const& v1,
+            datapar::experimental::simd<T, Abi> const& v2) noexcept
+        {
+            return datapar::experimental::simd<T, Abi>([&](auto i) {
+                constexpr std::size_t idx = decltype(i)::value;
+                if constexpr (idx < N)
+                {
+                    return static_cast<T>(v1[idx]);
+                }
+                else
+                {
+                    return static_cast<T>(v2[idx]);
+                }
+            });
+        }
+
+        // One step of the logarithmic scan: combine each lane with the lane
+        // N positions below it
+        template <std::size_t N, typename T, typename Abi, typename Op>
+        HPX_HOST_DEVICE HPX_FORCEINLINE void inclusive_scan_step(
+            datapar::experimental::simd<T, Abi>& v, Op& op)
+        {
+            if constexpr (N < datapar::experimental::simd<T, Abi>::size())
+            {
+                datapar::experimental::simd<T, Abi> const sums =
+                    HPX_INVOKE(op, shift_lanes<N>(v, v), v);
+                v = blend_lanes<N>(v, sums);
+                inclusive_scan_step<2 * N>(v, op);
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+    slide_right(datapar::experimental::simd<T, Abi> const& v, T val) noexcept
+    {
+        return detail::shift_lanes<1>(
+            v, datapar::experimental::simd<T, Abi>(val));
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE datapar::experimental::simd<T, Abi>
+    inclusive_scan(datapar::experimental::simd<T, Abi> v, Op&& op)
+    {
+        detail::inclusive_scan_step<1>(v, op);
+        return v;
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
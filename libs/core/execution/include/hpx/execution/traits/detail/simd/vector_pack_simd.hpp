@@ -25,12 +25,14 @@ namespace hpx::datapar::experimental {
 
     using std::experimental::simd_abi::native;
 
+    using std::experimental::element_aligned;
     using std::experimental::memory_alignment_v;
     using std::experimental::vector_aligned;
 
     using std::experimental::all_of;
     using std::experimental::any_of;
     using std::experimental::find_first_set;
+    using std::experimental::find_last_set;
     using std::experimental::none_of;
     using std::experimental::popcount;
     using std::experimental::reduce;
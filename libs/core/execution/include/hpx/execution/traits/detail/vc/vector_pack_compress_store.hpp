@@ -0,0 +1,47 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <cstddef>
+#include <memory>
+
+#include <Vc/Vc>
+#include <Vc/global.h>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress_store(
+        Vc::Vector<T, Abi> const& val, Vc::Mask<T, Abi> const& msk, Iter dest)
+    {
+        if (Vc::all_of(msk))
+        {
+            val.store(std::addressof(*dest), Vc::Unaligned);
+            return val.size();
+        }
+
+        std::size_t count = 0;
+        if (Vc::any_of(msk))
+        {
+            for (std::size_t i = 0; i != val.size(); ++i)
+            {
+                if (msk[i])
+                {
+                    *dest++ = val[i];
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
@@ -25,6 +25,25 @@ namespace hpx::parallel::traits {
         }
         return -1;
     }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int find_last_of(
+        Vc::Mask<T, Abi> const& msk) noexcept
+    {
+        if (Vc::any_of(msk))
+        {
+            for (int i = static_cast<int>(msk.size()) - 1; i != 0; --i)
+            {
+                if (msk[i])
+                {
+                    return i;
+                }
+            }
+            return 0;
+        }
+        return -1;
+    }
 }    // namespace hpx::parallel::traits
 
 #endif
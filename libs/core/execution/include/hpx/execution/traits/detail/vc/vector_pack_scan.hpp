@@ -0,0 +1,50 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+
+#include <Vc/Vc>
+#include <Vc/global.h>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> slide_right(
+        Vc::Vector<T, Abi> const& v, T val) noexcept
+    {
+        Vc::Vector<T, Abi> result = v.shifted(-1);
+        result[0] = val;
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> inclusive_scan(
+        Vc::Vector<T, Abi> v, Op&& op)
+    {
+        using vector_type = Vc::Vector<T, Abi>;
+
+        // combine each lane with the lane n positions below it
+        vector_type const indices = vector_type::IndexesFromZero();
+        for (std::size_t n = 1; n < vector_type::size(); n *= 2)
+        {
+            vector_type const sums =
+                HPX_INVOKE(op, v.shifted(-static_cast<int>(n)), v);
+            v(indices >= vector_type(static_cast<T>(n))) = sums;
+        }
+        return v;
+    }
+}    // namespace hpx::parallel::traits
+
+#endif
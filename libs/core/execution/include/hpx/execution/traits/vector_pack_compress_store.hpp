@@ -0,0 +1,40 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#include <cstddef>
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // compress_store(v, msk, dest) stores the elements of v for which msk
+    // is set consecutively starting at dest, returns the number of stored
+    // elements
+    template <typename T, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::size_t compress_store(
+        T const& val, bool msk, Iter dest)
+    {
+        if (msk)
+        {
+            *dest = val;
+            return 1;
+        }
+        return 0;
+    }
+}    // namespace hpx::parallel::traits
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/eve/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_compress_store.hpp>
+#include <hpx/execution/traits/detail/vc/vector_pack_compress_store.hpp>
+#endif
+
+#endif
@@ -18,6 +18,13 @@ namespace hpx::parallel::traits {
     {
         return msk ? 0 : -1;
     }
+
+    ///////////////////////////////////////////////////////////////////////
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr int find_last_of(
+        bool msk) noexcept
+    {
+        return msk ? 0 : -1;
+    }
 }    // namespace hpx::parallel::traits
 
 #if !defined(__CUDACC__)
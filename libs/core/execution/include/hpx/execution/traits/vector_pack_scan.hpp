@@ -0,0 +1,41 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+
+namespace hpx::parallel::traits {
+
+    ///////////////////////////////////////////////////////////////////////
+    // slide_right(v, val) moves all elements of v one lane up, the first
+    // lane is set to val (the last element of v is dropped)
+    template <typename T>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T slide_right(T, T val) noexcept
+    {
+        return val;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // inclusive_scan(v, op) calculates the inclusive prefix sums (with
+    // respect to op) of the elements of v
+    template <typename T, typename Op>
+    HPX_HOST_DEVICE HPX_FORCEINLINE constexpr T inclusive_scan(
+        T val, Op&&) noexcept
+    {
+        return val;
+    }
+}    // namespace hpx::parallel::traits
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/eve/vector_pack_scan.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_scan.hpp>
+#include <hpx/execution/traits/detail/vc/vector_pack_scan.hpp>
+#endif
+
+#endif
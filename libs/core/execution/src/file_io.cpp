@@ -0,0 +1,124 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/algorithms/file_io.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <system_error>
+
+#if !defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::execution::experimental::detail {
+
+    using io_uring_request = hpx::threads::detail::io_uring_request;
+
+    hpx::threads::thread_pool_base* submit_file_request(io_uring_request& req)
+    {
+        // only HPX threads have a scheduling loop reaping the completions
+        auto* self = hpx::threads::get_self_id_data();
+        if (self == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto* scheduler = self->get_scheduler_base();
+        std::size_t const num_thread = hpx::get_local_worker_thread_num();
+        if (scheduler == nullptr || num_thread == std::size_t(-1) ||
+            !scheduler->get_io_uring_service().submit(num_thread, req))
+        {
+            return nullptr;
+        }
+        return scheduler->get_parent_pool();
+    }
+
+    int perform_file_request(
+        [[maybe_unused]] io_uring_request const& req) noexcept
+    {
+#if defined(HPX_WINDOWS)
+        return -ENOSYS;
+#else
+        long result = 0;
+        switch (req.op)
+        {
+        case io_uring_request::operation::openat:
+            result = ::openat(req.fd, static_cast<char const*>(req.buffer),
+                req.flags, static_cast<mode_t>(req.mode));
+            break;
+
+        case io_uring_request::operation::read:
+            result = ::pread(
+                req.fd, req.buffer, req.size, static_cast<off_t>(req.offset));
+            break;
+
+        case io_uring_request::operation::write:
+            result = ::pwrite(
+                req.fd, req.buffer, req.size, static_cast<off_t>(req.offset));
+            break;
+
+        case io_uring_request::operation::fsync:
+            result = req.flags != 0 ? ::fdatasync(req.fd) : ::fsync(req.fd);
+            break;
+
+        default:
+            return -EINVAL;
+        }
+        return result < 0 ? -errno : static_cast<int>(result);
+#endif
+    }
+
+    void resume_file_operation(hpx::threads::thread_pool_base* pool,
+        std::size_t num_thread, void (*f)(void*), void* op)
+    {
+        hpx::threads::thread_init_data data(
+            hpx::threads::make_thread_function_nullary([f, op]() { f(op); }),
+            "resume_file_operation", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(
+                hpx::threads::thread_schedule_hint_mode::thread,
+                static_cast<std::int16_t>(num_thread)),
+            hpx::threads::thread_stacksize::default_,
+            hpx::threads::thread_schedule_state::pending, true);
+
+        hpx::threads::register_work(data, pool);
+    }
+
+    std::exception_ptr make_file_error(
+        io_uring_request::operation op, int error)
+    {
+        char const* what = "";
+        switch (op)
+        {
+        case io_uring_request::operation::openat:
+            what = "hpx::execution::experimental::async_openat";
+            break;
+
+        case io_uring_request::operation::read:
+            what = "hpx::execution::experimental::async_read";
+            break;
+
+        case io_uring_request::operation::write:
+            what = "hpx::execution::experimental::async_write";
+            break;
+
+        case io_uring_request::operation::fsync:
+            what = "hpx::execution::experimental::async_fsync";
+            break;
+        }
+
+        return std::make_exception_ptr(
+            std::system_error(error, std::system_category(), what));
+    }
+}    // namespace hpx::execution::experimental::detail
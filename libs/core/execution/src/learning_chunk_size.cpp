@@ -0,0 +1,340 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/detail/execution_parameter_callbacks.hpp>
+#include <hpx/execution/executors/learning_chunk_size.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+namespace hpx::execution::experimental::detail {
+
+    // number of invocations measured for each candidate, the fastest of
+    // those is used to compare the candidates
+    inline constexpr std::uint32_t samples_per_candidate = 3;
+
+    // candidates for the number of chunks per core: 1, 2, 4, 8, 16
+    inline constexpr std::uint32_t num_chunks_per_core_candidates = 5;
+
+    // the candidates of the second stage are identified by this offset
+    inline constexpr std::uint32_t cores_stage = 32;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The exploration runs in two stages: first the number of chunks per core
+    // is determined using all cores, then the number of cores is halved as
+    // long as this is faster.
+    class chunk_size_tuning_entry
+    {
+    public:
+        using mutex_type = hpx::spinlock;
+
+        static constexpr std::uint32_t pack(
+            std::uint32_t core_divisor, std::uint32_t chunks_per_core) noexcept
+        {
+            return (core_divisor << 16) | chunks_per_core;
+        }
+
+        chunk_size_tuning_decision begin()
+        {
+            chunk_size_tuning_decision result;
+            if (get(result.core_divisor, result.chunks_per_core))
+            {
+                return result;
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+            if (get(result.core_divisor, result.chunks_per_core))
+            {
+                return result;
+            }
+
+            if (candidate_ < cores_stage)
+            {
+                result.chunks_per_core = 1u << candidate_;
+            }
+            else
+            {
+                result.core_divisor = 2u << (candidate_ - cores_stage);
+                result.chunks_per_core = best_chunks_per_core_;
+            }
+            result.candidate = candidate_;
+            result.generation = generation_;
+            result.measure = true;
+            return result;
+        }
+
+        void end(chunk_size_tuning_decision const& decision, std::size_t count,
+            std::uint64_t elapsed)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            double const time =
+                static_cast<double>(elapsed) / static_cast<double>(count);
+
+            std::lock_guard<mutex_type> l(mtx_);
+            if (decision.generation != generation_ ||
+                decision.candidate != candidate_ ||
+                decision_.load(std::memory_order_relaxed) != 0)
+            {
+                // measured a candidate which is not explored anymore
+                return;
+            }
+
+            if (time < current_time_)
+            {
+                current_time_ = time;
+            }
+
+            if (++samples_ != samples_per_candidate)
+            {
+                return;
+            }
+
+            // all samples for this candidate have been collected
+            if (current_time_ < best_time_)
+            {
+                best_time_ = current_time_;
+                best_core_divisor_ = decision.core_divisor;
+                best_chunks_per_core_ = decision.chunks_per_core;
+            }
+            else if (candidate_ >= cores_stage)
+            {
+                // using fewer cores did not help, it won't get better when
+                // using even less
+                converge();
+                return;
+            }
+
+            samples_ = 0;
+            current_time_ = (std::numeric_limits<double>::max)();
+
+            if (++candidate_ == num_chunks_per_core_candidates)
+            {
+                candidate_ = cores_stage;
+            }
+
+            if (candidate_ >= cores_stage &&
+                (2u << (candidate_ - cores_stage)) >
+                    hpx::parallel::execution::detail::get_os_thread_count())
+            {
+                converge();
+            }
+        }
+
+        void set(std::uint32_t core_divisor, std::uint32_t chunks_per_core)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            best_core_divisor_ = core_divisor;
+            best_chunks_per_core_ = chunks_per_core;
+            converge();
+        }
+
+        bool get(std::uint32_t& core_divisor,
+            std::uint32_t& chunks_per_core) const noexcept
+        {
+            std::uint32_t const d = decision_.load(std::memory_order_acquire);
+            if (d == 0)
+            {
+                return false;
+            }
+
+            core_divisor = d >> 16;
+            chunks_per_core = d & 0xffff;
+            return true;
+        }
+
+        void reset()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            decision_.store(0, std::memory_order_relaxed);
+            ++generation_;
+            candidate_ = 0;
+            samples_ = 0;
+            current_time_ = (std::numeric_limits<double>::max)();
+            best_time_ = (std::numeric_limits<double>::max)();
+            best_core_divisor_ = 1;
+            best_chunks_per_core_ = 1;
+        }
+
+    private:
+        void converge() noexcept
+        {
+            decision_.store(pack(best_core_divisor_, best_chunks_per_core_),
+                std::memory_order_release);
+        }
+
+        mutex_type mtx_;
+
+        // the packed decision, zero during the exploration phase
+        std::atomic<std::uint32_t> decision_{0};
+
+        std::uint32_t generation_ = 0;
+        std::uint32_t candidate_ = 0;
+        std::uint32_t samples_ = 0;
+        double current_time_ = (std::numeric_limits<double>::max)();
+
+        double best_time_ = (std::numeric_limits<double>::max)();
+        std::uint32_t best_core_divisor_ = 1;
+        std::uint32_t best_chunks_per_core_ = 1;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct chunk_size_tuning_registry
+    {
+        using mutex_type = hpx::spinlock;
+
+        mutex_type mtx_;
+        std::map<std::string, std::unique_ptr<chunk_size_tuning_entry>>
+            entries_;
+    };
+
+    chunk_size_tuning_registry& get_chunk_size_tuning_registry()
+    {
+        static chunk_size_tuning_registry registry;
+        return registry;
+    }
+
+    chunk_size_tuning_entry* get_chunk_size_tuning_entry(std::string const& key)
+    {
+        auto& registry = get_chunk_size_tuning_registry();
+
+        std::lock_guard<chunk_size_tuning_registry::mutex_type> l(
+            registry.mtx_);
+
+        auto& entry = registry.entries_[key];
+        if (!entry)
+        {
+            entry = std::make_unique<chunk_size_tuning_entry>();
+        }
+        return entry.get();
+    }
+
+    chunk_size_tuning_decision chunk_size_tuning_begin(
+        chunk_size_tuning_entry& entry)
+    {
+        return entry.begin();
+    }
+
+    void chunk_size_tuning_end(chunk_size_tuning_entry& entry,
+        chunk_size_tuning_decision const& decision, std::size_t count,
+        std::uint64_t elapsed)
+    {
+        entry.end(decision, count, elapsed);
+    }
+}    // namespace hpx::execution::experimental::detail
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Each line of the file holds one decision:
+    //
+    //      <core_divisor> <chunks_per_core> <key>
+    //
+    // empty lines and lines starting with '#' are ignored.
+    bool load_chunk_size_tuning(std::string const& filename)
+    {
+        std::ifstream in(filename);
+        if (!in.is_open())
+        {
+            return false;
+        }
+
+        std::string line;
+        for (std::size_t line_number = 1; std::getline(in, line); ++line_number)
+        {
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+
+            std::istringstream strm(line);
+
+            std::uint32_t core_divisor = 0;
+            std::uint32_t chunks_per_core = 0;
+            std::string key;
+            strm >> core_divisor >> chunks_per_core >> std::ws;
+            std::getline(strm, key);
+
+            if (!strm.eof() || key.empty() || core_divisor == 0 ||
+                core_divisor > 0xffff || chunks_per_core == 0 ||
+                chunks_per_core > 0xffff)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                    "hpx::execution::experimental::load_chunk_size_tuning",
+                    "invalid entry in {}, line {}: '{}'", filename,
+                    line_number, line);
+            }
+
+            detail::get_chunk_size_tuning_entry(key)->set(
+                core_divisor, chunks_per_core);
+        }
+        return true;
+    }
+
+    void save_chunk_size_tuning(std::string const& filename)
+    {
+        std::ofstream out(filename);
+        if (!out.is_open())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::execution::experimental::save_chunk_size_tuning",
+                "could not open chunk size tuning file: {}", filename);
+        }
+
+        out << "# <core_divisor> <chunks_per_core> <key>\n";
+
+        {
+            auto& registry = detail::get_chunk_size_tuning_registry();
+            std::lock_guard<detail::chunk_size_tuning_registry::mutex_type> l(
+                registry.mtx_);
+
+            for (auto const& [key, entry] : registry.entries_)
+            {
+                std::uint32_t core_divisor = 0;
+                std::uint32_t chunks_per_core = 0;
+                if (entry->get(core_divisor, chunks_per_core))
+                {
+                    out << core_divisor << " " << chunks_per_core << " " << key
+                        << "\n";
+                }
+            }
+        }
+
+        out.close();
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::execution::experimental::save_chunk_size_tuning",
+                "could not write chunk size tuning file: {}", filename);
+        }
+    }
+
+    void reset_chunk_size_tuning()
+    {
+        auto& registry = detail::get_chunk_size_tuning_registry();
+        std::lock_guard<detail::chunk_size_tuning_registry::mutex_type> l(
+            registry.mtx_);
+
+        for (auto& entry : registry.entries_)
+        {
+            entry.second->reset();
+        }
+    }
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,139 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_file_io()
+{
+    std::string const filename = "algorithm_file_io.dat";
+
+    std::vector<char> data(100000);
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        data[i] = static_cast<char>(i % 127);
+    }
+
+    int const fd = hpx::get<0>(*tt::sync_wait(ex::async_openat(
+        AT_FDCWD, filename, O_CREAT | O_TRUNC | O_RDWR, 0644)));
+    HPX_TEST_LTE(0, fd);
+
+    // write the two halves concurrently
+    std::size_t const half = data.size() / 2;
+    auto written = *tt::sync_wait(
+        ex::when_all(ex::async_write(fd, data.data(), half, 0),
+            ex::async_write(fd, data.data() + half, data.size() - half, half)));
+    HPX_TEST_EQ(hpx::get<0>(written) + hpx::get<1>(written), data.size());
+
+    tt::sync_wait(ex::async_fsync(fd, true));
+    tt::sync_wait(ex::async_fsync(fd));
+
+    // read the file back in many pieces concurrently, starting on the thread
+    // pool
+    {
+        std::size_t const piece = 1000;
+        std::vector<char> buffer(data.size());
+
+        auto reads = tt::sync_wait(
+            ex::schedule(ex::thread_pool_scheduler{}) | ex::let_value([&]() {
+                std::vector<decltype(ex::async_read(fd, nullptr, 0, 0))> s;
+                for (std::size_t i = 0; i < data.size(); i += piece)
+                {
+                    s.push_back(
+                        ex::async_read(fd, buffer.data() + i, piece, i));
+                }
+                return ex::when_all_vector(std::move(s));
+            }));
+
+        std::size_t total = 0;
+        for (std::size_t n : hpx::get<0>(*reads))
+        {
+            HPX_TEST_EQ(n, piece);
+            total += n;
+        }
+        HPX_TEST_EQ(total, data.size());
+        HPX_TEST(buffer == data);
+    }
+
+    // reading at the end of the file returns zero bytes
+    {
+        char c = 0;
+        auto read = tt::sync_wait(ex::async_read(fd, &c, 1, data.size()) |
+            ex::then([](std::size_t n) { return n; }));
+        HPX_TEST_EQ(hpx::get<0>(*read), std::size_t(0));
+    }
+
+    ::close(fd);
+    std::remove(filename.c_str());
+}
+
+void test_file_io_errors()
+{
+    bool caught_exception = false;
+    try
+    {
+        tt::sync_wait(ex::async_openat(
+            AT_FDCWD, "algorithm_file_io/does/not/exist", O_RDONLY));
+        HPX_TEST(false);
+    }
+    catch (std::system_error const& e)
+    {
+        HPX_TEST_EQ(e.code().value(), ENOENT);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        char c = 0;
+        tt::sync_wait(ex::async_read(-1, &c, 1, 0));
+        HPX_TEST(false);
+    }
+    catch (std::system_error const& e)
+    {
+        HPX_TEST_EQ(e.code().value(), EBADF);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+#if !defined(HPX_WINDOWS)
+    test_file_io();
+    test_file_io_errors();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
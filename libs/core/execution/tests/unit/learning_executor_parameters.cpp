@@ -0,0 +1,185 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "foreach_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+void test_learning_executor_parameters()
+{
+    using iterator_tag = std::random_access_iterator_tag;
+    using hpx::execution::experimental::learning_chunk_size;
+
+    {
+        learning_chunk_size p(HPX_CURRENT_SOURCE_LOCATION());
+        test_for_each(hpx::execution::par.with(p), iterator_tag());
+    }
+
+    {
+        learning_chunk_size p("test_learning_executor_parameters");
+        test_for_each_async(
+            hpx::execution::par(hpx::execution::task).with(p), iterator_tag());
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+    {
+        learning_chunk_size p("test_learning_executor_parameters");
+        test_for_each(
+            hpx::execution::par.on(par_exec).with(std::ref(p)), iterator_tag());
+    }
+
+    {
+        learning_chunk_size p("test_learning_executor_parameters");
+        test_for_each_async(hpx::execution::par(hpx::execution::task)
+                                .on(par_exec)
+                                .with(std::ref(p)),
+            iterator_tag());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// repeatedly invoking the same loop eventually finishes the exploration
+void test_learning_convergence()
+{
+    using hpx::execution::experimental::learning_chunk_size;
+
+    std::vector<std::size_t> c(10007);
+    for (int i = 0; i != 200; ++i)
+    {
+        learning_chunk_size p("test_learning_convergence");
+        hpx::for_each(hpx::execution::par.with(p), c.begin(), c.end(),
+            [](std::size_t& v) { ++v; });
+    }
+
+    for (std::size_t v : c)
+    {
+        HPX_TEST_EQ(v, std::size_t(200));
+    }
+
+    std::string const filename = "learning_executor_parameters.tuning";
+    hpx::execution::experimental::save_chunk_size_tuning(filename);
+
+    bool found = false;
+    {
+        std::ifstream in(filename);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (line.find("test_learning_convergence") != std::string::npos)
+            {
+                found = true;
+            }
+        }
+    }
+    HPX_TEST(found);
+
+    std::remove(filename.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_learning_load()
+{
+    using hpx::execution::experimental::learning_chunk_size;
+
+    std::string const filename = "learning_executor_parameters_load.tuning";
+    {
+        std::ofstream out(filename);
+        out << "# test\n\n2 4 test_learning_load\n";
+    }
+
+    HPX_TEST(hpx::execution::experimental::load_chunk_size_tuning(filename));
+
+    // 8 cores / 2 * 4 chunks per core
+    hpx::execution::parallel_executor par_exec;
+    learning_chunk_size p("test_learning_load");
+    HPX_TEST_EQ(hpx::parallel::execution::get_chunk_size(
+                    p, par_exec, std::size_t(8), std::size_t(1600)),
+        std::size_t(100));
+
+    // starting over uses a single chunk per core
+    hpx::execution::experimental::reset_chunk_size_tuning();
+    HPX_TEST_EQ(hpx::parallel::execution::get_chunk_size(
+                    p, par_exec, std::size_t(8), std::size_t(1600)),
+        std::size_t(200));
+
+    {
+        std::ofstream out(filename);
+        out << "2 test_learning_load\n";
+    }
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::execution::experimental::load_chunk_size_tuning(filename);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::invalid_data);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    std::remove(filename.c_str());
+
+    HPX_TEST(!hpx::execution::experimental::load_chunk_size_tuning(filename));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_learning_executor_parameters();
+    test_learning_convergence();
+    test_learning_load();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -40,6 +40,12 @@ namespace hpx::execution_base {
 
             struct agent_storage;
             HPX_CORE_EXPORT agent_storage* get_agent_storage();
+
+            // Return how often an agent has been installed in the given
+            // storage, this changes whenever the OS thread owning the storage
+            // switches between threads
+            HPX_CORE_EXPORT std::size_t get_agent_switch_count(
+                agent_storage const* storage) noexcept;
         }    // namespace detail
 
         struct HPX_CORE_EXPORT reset_agent
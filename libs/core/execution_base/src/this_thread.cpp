@@ -219,11 +219,13 @@ namespace hpx::execution_base {
 
                 agent_base* set(agent_base* context) noexcept
                 {
+                    ++switch_count_;
                     std::swap(context, impl_);
                     return context;
                 }
 
                 agent_base* impl_;
+                std::size_t switch_count_ = 0;
             };
 
             agent_storage* get_agent_storage()
@@ -231,6 +233,12 @@ namespace hpx::execution_base {
                 static thread_local agent_storage storage;
                 return &storage;
             }
+
+            std::size_t get_agent_switch_count(
+                agent_storage const* storage) noexcept
+            {
+                return storage->switch_count_;
+            }
         }    // namespace detail
 
         reset_agent::reset_agent(
@@ -26,6 +26,7 @@
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -58,9 +59,6 @@ namespace hpx::parallel::execution::detail {
         std::size_t const size = hpx::util::size(shape);
         results.resize(size);
 
-        auto post_policy = hpx::execution::experimental::with_stacksize(
-            policy, threads::thread_stacksize::small_);
-
         hpx::latch l(size + 1);
         std::size_t part_begin = 0;
         auto it = std::begin(shape);
@@ -76,20 +74,27 @@ namespace hpx::parallel::execution::detail {
             if (hierarchical_threshold != 0 &&
                 part_size > hierarchical_threshold)
             {
+                auto task = [&, part_begin, part_end, part_size, f,
+                                it]() mutable {
+                    for (std::size_t part_i = part_begin; part_i != part_end;
+                         ++part_i)
+                    {
+                        results[part_i] =
+                            hpx::detail::async_launch_policy_dispatch<
+                                Launch>::call(async_policy, desc, pool, f, *it,
+                                ts...);
+                        ++it;
+                    }
+                    l.count_down(part_size);
+                };
+
+                // run task on small stack (or stackless, if enabled)
+                auto post_policy =
+                    hpx::execution::experimental::with_stacksize(policy,
+                        threads::get_leaf_task_stacksize<decltype(task)>());
+
                 hpx::detail::post_policy_dispatch<Launch>::call(post_policy,
-                    desc, pool,
-                    [&, part_begin, part_end, part_size, f, it]() mutable {
-                        for (std::size_t part_i = part_begin;
-                             part_i != part_end; ++part_i)
-                        {
-                            results[part_i] =
-                                hpx::detail::async_launch_policy_dispatch<
-                                    Launch>::call(async_policy, desc, pool, f,
-                                    *it, ts...);
-                            ++it;
-                        }
-                        l.count_down(part_size);
-                    });
+                    desc, pool, threads::make_leaf_task(HPX_MOVE(task)));
 
                 std::advance(it, part_size);
             }
@@ -135,8 +140,6 @@ namespace hpx::parallel::execution::detail {
                 Launch policy, std::decay_t<F> f, S const& shape,
                 std::decay_t<Ts>... ts) {
                 std::size_t const size = hpx::util::size(shape);
-                auto post_policy = hpx::execution::experimental::with_stacksize(
-                    policy, threads::thread_stacksize::small_);
 
                 std::exception_ptr e;
                 hpx::spinlock mtx_e;
@@ -193,8 +196,16 @@ namespace hpx::parallel::execution::detail {
                     if (t != num_threads - 1 && hierarchical_threshold != 0 &&
                         part_size > hierarchical_threshold)
                     {
+                        // run task on small stack (or stackless, if enabled)
+                        auto post_policy =
+                            hpx::execution::experimental::with_stacksize(
+                                policy,
+                                threads::get_leaf_task_stacksize<decltype(
+                                    launcher)>());
+
                         hpx::detail::post_policy_dispatch<Launch>::call(
-                            post_policy, desc, pool, HPX_MOVE(launcher), true);
+                            post_policy, desc, pool,
+                            threads::make_leaf_task(HPX_MOVE(launcher)), true);
                         std::advance(it, part_size);
                     }
                     else if (part_size != 0)
@@ -30,6 +30,7 @@
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/topology/cpu_mask.hpp>
@@ -317,9 +318,9 @@ namespace hpx::parallel::execution::detail {
                 return;
             }
 
-            // run task on small stack
+            // run task on small stack (or stackless, if enabled)
             auto post_policy = hpx::execution::experimental::with_stacksize(
-                policy, threads::thread_stacksize::small_);
+                policy, threads::get_leaf_task_stacksize<Task>());
 
             // launch task on new thread, apply hint if none was given.
             auto hint = hpx::execution::experimental::get_hint(post_policy);
@@ -331,13 +332,14 @@ namespace hpx::parallel::execution::detail {
                             hpx::threads::thread_schedule_hint_mode::thread,
                             worker_thread));
 
-                hpx::detail::post_policy_dispatch<Launch>::call(
-                    policy, desc, pool, HPX_FORWARD(Task, task_f));
+                hpx::detail::post_policy_dispatch<Launch>::call(policy, desc,
+                    pool, threads::make_leaf_task(HPX_FORWARD(Task, task_f)));
             }
             else
             {
-                hpx::detail::post_policy_dispatch<Launch>::call(
-                    post_policy, desc, pool, HPX_FORWARD(Task, task_f));
+                hpx::detail::post_policy_dispatch<Launch>::call(post_policy,
+                    desc, pool,
+                    threads::make_leaf_task(HPX_FORWARD(Task, task_f)));
             }
         }
 
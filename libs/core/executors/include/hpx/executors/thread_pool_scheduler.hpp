@@ -150,6 +150,25 @@ namespace hpx::execution::experimental {
         }
 #endif
 
+        // support with_bulk_splitting property
+        friend constexpr thread_pool_policy_scheduler tag_invoke(
+            hpx::execution::experimental::with_bulk_splitting_t,
+            thread_pool_policy_scheduler const& scheduler,
+            hpx::execution::experimental::bulk_splitting splitting) noexcept
+        {
+            auto sched_with_splitting = scheduler;
+            sched_with_splitting.bulk_splitting_ = splitting;
+            return sched_with_splitting;
+        }
+
+        // support get_bulk_splitting property
+        friend constexpr hpx::execution::experimental::bulk_splitting
+        tag_invoke(hpx::execution::experimental::get_bulk_splitting_t,
+            thread_pool_policy_scheduler const& scheduler) noexcept
+        {
+            return scheduler.bulk_splitting_;
+        }
+
         friend auto tag_invoke(
             hpx::execution::experimental::get_processing_units_mask_t,
             thread_pool_policy_scheduler const& exec)
@@ -333,6 +352,8 @@ namespace hpx::execution::experimental {
             hpx::threads::detail::get_self_or_default_pool();
         Policy policy_;
         std::size_t num_cores_ = 0;
+        hpx::execution::experimental::bulk_splitting bulk_splitting_ =
+            hpx::execution::experimental::bulk_splitting::static_;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         char const* annotation_ = nullptr;
 #endif
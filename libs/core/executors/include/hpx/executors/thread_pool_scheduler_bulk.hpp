@@ -11,6 +11,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/detail/contiguous_index_queue.hpp>
 #include <hpx/concurrency/detail/non_contiguous_index_queue.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/datastructures/tuple.hpp>
@@ -128,6 +129,22 @@ namespace hpx::execution::experimental::detail {
         }
 
     private:
+        // Perform the work for the indices (iterators) [i_begin, i_end) in the
+        // given shape.
+        template <typename Ts>
+        void do_work_range(Ts& ts, std::size_t const i_begin,
+            std::size_t const i_end) const
+        {
+            using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
+
+            auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
+            for (std::size_t i = i_begin; i != i_end; (void) ++it, ++i)
+            {
+                bulk_scheduler_invoke_helper(
+                    index_pack_type{}, op_state->f, *it, ts);
+            }
+        }
+
         // Perform the work in one element indexed by index. The index
         // represents a range of indices (iterators) in the given shape.
         template <typename Ts>
@@ -139,19 +156,12 @@ namespace hpx::execution::experimental::detail {
 
             hpx::util::itt::mark_event e(notify_event);
 #endif
-            using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
-
             auto const i_begin =
                 static_cast<std::size_t>(index) * task_f->chunk_size;
             auto const i_end =
                 (std::min)(i_begin + task_f->chunk_size, task_f->size);
 
-            auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
-            for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
-            {
-                bulk_scheduler_invoke_helper(
-                    index_pack_type{}, op_state->f, *it, ts);
-            }
+            do_work_range(ts, i_begin, i_end);
         }
 
         template <hpx::concurrency::detail::queue_end Which, typename Ts>
@@ -190,6 +200,75 @@ namespace hpx::execution::experimental::detail {
             }
         }
 
+        // Process the range of indices owned by worker_thread, chunk_size
+        // indices at a time. Once the range is empty, steal half of the
+        // remaining indices of a neighboring thread, make them the new local
+        // range, and start over. The work is done once no neighbor has more
+        // than one index left.
+        template <hpx::concurrency::detail::queue_end Which, typename Ts>
+        void do_work_lazy(Ts& ts) const
+        {
+            auto worker_thread = task_f->worker_thread;
+            auto& local_range = op_state->ranges[worker_thread].data_;
+
+            static constexpr auto opposite_end =
+                hpx::concurrency::detail::opposite_end_v<Which>;
+
+            hpx::optional<std::pair<std::uint32_t, std::uint32_t>> range;
+            while (true)
+            {
+                while ((range = local_range.template pop<Which>(
+                            task_f->chunk_size)))
+                {
+                    do_work_range(ts, range->first, range->second);
+                }
+
+                if (!task_f->allow_stealing)
+                {
+                    break;
+                }
+
+                // Then steal from the opposite end of the neighboring ranges
+                bool stolen = false;
+                for (std::uint32_t offset = 1;
+                     offset != op_state->num_worker_threads; ++offset)
+                {
+                    std::size_t neighbor_thread =
+                        (worker_thread + offset) % op_state->num_worker_threads;
+                    auto& neighbor_range =
+                        op_state->ranges[neighbor_thread].data_;
+
+                    if ((range = neighbor_range
+                                     .template steal_half<opposite_end>()))
+                    {
+                        // the local range is empty, thus concurrent thieves
+                        // will not modify it
+                        local_range.reset(range->first, range->second);
+                        stolen = true;
+                        break;
+                    }
+                }
+
+                if (!stolen)
+                {
+                    break;
+                }
+            }
+        }
+
+        template <hpx::concurrency::detail::queue_end Which, typename Ts>
+        void do_work_splitting(Ts& ts) const
+        {
+            if (op_state->splitting == bulk_splitting::lazy)
+            {
+                do_work_lazy<Which>(ts);
+            }
+            else
+            {
+                do_work<Which>(ts);
+            }
+        }
+
     public:
         // Visit the values sent from the predecessor sender. This function
         // first tries to handle all chunks in the queue owned by worker_thread.
@@ -206,11 +285,13 @@ namespace hpx::execution::experimental::detail {
             // schedule chunks from the end, if needed
             if (task_f->reverse_placement)
             {
-                do_work<hpx::concurrency::detail::queue_end::right>(ts);
+                do_work_splitting<hpx::concurrency::detail::queue_end::right>(
+                    ts);
             }
             else
             {
-                do_work<hpx::concurrency::detail::queue_end::left>(ts);
+                do_work_splitting<hpx::concurrency::detail::queue_end::left>(
+                    ts);
             }
         }
     };
@@ -381,14 +462,35 @@ namespace hpx::execution::experimental::detail {
             queue.reset(part_begin, part_end, num_threads);
         }
 
+        // Initialize the range of indices of a worker thread, used for lazy
+        // splitting.
+        void init_range(std::uint32_t const worker_thread,
+            std::uint32_t const size, std::uint32_t num_threads) noexcept
+        {
+            auto& range = op_state->ranges[worker_thread].data_;
+            auto const part_begin = static_cast<std::uint32_t>(
+                (std::uint64_t(worker_thread) * size) / num_threads);
+            auto const part_end = static_cast<std::uint32_t>(
+                (std::uint64_t(worker_thread + 1) * size) / num_threads);
+            range.reset(part_begin, part_end);
+        }
+
+        bool has_work(std::uint32_t const worker_thread) const noexcept
+        {
+            if (op_state->splitting == bulk_splitting::lazy)
+            {
+                return !op_state->ranges[worker_thread].data_.empty();
+            }
+            return !op_state->queues[worker_thread].data_.empty();
+        }
+
         // Spawn a task which will process a number of chunks. If the queue
         // contains no chunks no task will be spawned.
         template <typename Task>
         void do_work_task(Task&& task_f) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
-            auto& queue = op_state->queues[worker_thread].data_;
-            if (queue.empty())
+            if (!has_work(worker_thread))
             {
                 // If the queue is empty we don't spawn a task. We only signal
                 // that this "task" is ready.
@@ -453,9 +555,14 @@ namespace hpx::execution::experimental::detail {
                 return;
             }
 
-            // Calculate chunk size and number of chunks
+            // Calculate chunk size and number of chunks. With lazy splitting
+            // the chunk size is only the number of indices a worker takes
+            // from its range at a time, thus it can be smaller.
+            bool const lazy = op_state->splitting == bulk_splitting::lazy;
             std::uint32_t chunk_size = get_bulk_scheduler_chunk_size(
-                op_state->num_worker_threads, size);
+                lazy ? op_state->num_worker_threads * 8 :
+                       op_state->num_worker_threads,
+                size);
             std::uint32_t num_chunks = (size + chunk_size - 1) / chunk_size;
 
             // launch only as many tasks as we have chunks
@@ -486,7 +593,14 @@ namespace hpx::execution::experimental::detail {
             for (std::uint32_t worker_thread = 0;
                  worker_thread != op_state->num_worker_threads; ++worker_thread)
             {
-                if (hint.placement_mode() == placement::breadth_first ||
+                if (lazy)
+                {
+                    // ranges are always split depth-first, stealing
+                    // re-balances them anyways
+                    init_range(
+                        worker_thread, size, op_state->num_worker_threads);
+                }
+                else if (hint.placement_mode() == placement::breadth_first ||
                     hint.placement_mode() == placement::breadth_first_reverse)
                 {
                     init_queue_breadth_first(worker_thread, num_chunks,
@@ -604,6 +718,12 @@ namespace hpx::execution::experimental::detail {
     // thread will be spawned. Once the HPX thread has finished working on its
     // own queue, it will attempt to steal work from other queues.
     //
+    // If the scheduler has the bulk_splitting::lazy property set, each worker
+    // thread instead owns a contiguous range of indices, which it processes a
+    // few indices at a time. Idle worker threads steal half of the remaining
+    // range of another worker thread. This keeps the threads busy for
+    // irregular workloads without creating a large number of chunks up front.
+    //
     // Since predecessor sender must complete on an HPX thread (the completion
     // scheduler is a thread_pool_scheduler; otherwise the customization defined
     // in this file is not chosen) it will be reused as one of the worker
@@ -710,9 +830,13 @@ namespace hpx::execution::experimental::detail {
             operation_state_type op_state;
             std::size_t num_worker_threads;
             hpx::threads::mask_type pu_mask;
+            bulk_splitting splitting;
             std::vector<hpx::util::cache_aligned_data<
                 hpx::concurrency::detail::non_contiguous_index_queue<>>>
                 queues;
+            std::vector<hpx::util::cache_aligned_data<
+                hpx::concurrency::detail::contiguous_index_queue<>>>
+                ranges;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
@@ -737,7 +861,13 @@ namespace hpx::execution::experimental::detail {
               , num_worker_threads(
                     hpx::parallel::execution::processing_units_count(scheduler))
               , pu_mask(pumask)
-              , queues(num_worker_threads)
+              , splitting(
+                    hpx::execution::experimental::get_bulk_splitting(scheduler))
+              , queues(splitting == bulk_splitting::static_ ?
+                        num_worker_threads :
+                        0)
+              , ranges(
+                    splitting == bulk_splitting::lazy ? num_worker_threads : 0)
               , shape(HPX_FORWARD(Shape_, shape))
               , f(HPX_FORWARD(F_, f))
               , receiver(HPX_FORWARD(Receiver_, receiver))
@@ -0,0 +1,153 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the static splitting and the lazy (work-stealing)
+// splitting of the iterations of bulk operations on the thread_pool_scheduler
+// for workloads where the cost of an iteration depends on its index.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// spin for the given number of steps
+std::uint64_t spin(std::size_t steps)
+{
+    std::uint64_t volatile result = 0;
+    for (std::size_t i = 0; i != steps; ++i)
+    {
+        result = result + i;
+    }
+    return result;
+}
+
+// the number of steps performed by iteration i of n
+std::size_t get_steps(
+    std::string const& workload, std::size_t i, std::size_t n, std::size_t base)
+{
+    if (workload == "linear")
+    {
+        // the cost grows linearly with the index
+        return base * 2 * i / n;
+    }
+    if (workload == "front")
+    {
+        // the first 5% of the iterations are 20 times as expensive
+        return i < n / 20 ? base * 20 : base;
+    }
+    if (workload == "random")
+    {
+        // pseudo-random costs in [0, 4 * base)
+        std::uint64_t h = i * 0x9e3779b97f4a7c15ull;
+        return static_cast<std::size_t>((h >> 32) % (4 * base));
+    }
+
+    // uniform cost
+    return base;
+}
+
+double run_benchmark(ex::thread_pool_scheduler const& sched, int test_count,
+    std::vector<std::size_t> const& steps)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    for (int t = 0; t < test_count; ++t)
+    {
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+
+        ex::schedule(sched) |
+            ex::bulk(steps.size(), [&](std::size_t i) { spin(steps[i]); }) |
+            tt::sync_wait();
+
+        time += hpx::chrono::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t n = vm["n"].as<std::size_t>();
+    std::size_t base = vm["steps"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "n            : " << n << std::endl;
+    std::cout << "steps        : " << base << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << hpx::get_os_thread_count()
+              << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    ex::thread_pool_scheduler const static_sched{};
+    ex::thread_pool_scheduler const lazy_sched =
+        ex::with_bulk_splitting(static_sched, ex::bulk_splitting::lazy);
+
+    std::vector<std::size_t> steps(n);
+    for (std::string const workload : {"uniform", "linear", "front", "random"})
+    {
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            steps[i] = get_steps(workload, i, n, base);
+        }
+
+        double const t_static = run_benchmark(static_sched, test_count, steps);
+        double const t_lazy = run_benchmark(lazy_sched, test_count, steps);
+
+        hpx::util::format_to(std::cout,
+            "{1}: static {2}(sec), lazy {3}(sec), speedup {4}\n", workload,
+            t_static, t_lazy, t_static / t_lazy);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("n",
+            hpx::program_options::value<std::size_t>()->default_value(100000),
+            "number of iterations of the bulk operation (default: 100000)")
+        ("steps",
+            hpx::program_options::value<std::size_t>()->default_value(1000),
+            "average number of steps per iteration (default: 1000)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)");
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,173 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+bool is_stackless()
+{
+    hpx::threads::thread_data* thrd = hpx::threads::get_self_id_data();
+    HPX_TEST(thrd != nullptr);
+    return thrd->is_stackless();
+}
+
+// all bulk executions started by this function share their call site
+std::size_t run_bulk()
+{
+    hpx::execution::parallel_executor exec;
+
+    std::atomic<std::size_t> stackless_count(0);
+    std::vector<int> v(10000);
+
+    hpx::parallel::execution::bulk_async_execute(exec,
+        [&](int) {
+            if (is_stackless())
+                ++stackless_count;
+        },
+        v)
+        .get();
+
+    HPX_TEST_LT(stackless_count.load(), v.size() + 1);
+    return stackless_count.load();
+}
+
+void test_bulk()
+{
+    // the chunks of the first execution run on stackful threads, once those
+    // have completed without suspending later chunks run stackless
+    run_bulk();
+
+    // the calling thread executes part of the work itself
+    std::size_t const stackless_count = run_bulk();
+    if (hpx::get_os_thread_count() > 1)
+    {
+        HPX_TEST_LT(std::size_t(0), stackless_count);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+enum class action
+{
+    none,
+    sleep,
+    yield
+};
+
+// all continuations attached by the same instantiation of this function share
+// their call site
+template <int CallSite>
+bool run_continuation(action a)
+{
+    hpx::future<bool> f =
+        hpx::make_ready_future().then([a](hpx::future<void>&&) {
+            bool const stackless = is_stackless();
+            if (a == action::sleep)
+            {
+                hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            else if (a == action::yield)
+            {
+                hpx::this_thread::yield();
+            }
+            return stackless;
+        });
+    return f.get();
+}
+
+void test_continuation()
+{
+    std::int64_t const blocking_count =
+        hpx::threads::get_stackless_blocking_count(false);
+
+    // the first continuation runs stackful, all later ones stackless
+    HPX_TEST(!run_continuation<0>(action::none));
+    HPX_TEST(run_continuation<0>(action::none));
+    HPX_TEST(run_continuation<0>(action::none));
+
+    HPX_TEST_EQ(
+        hpx::threads::get_stackless_blocking_count(false), blocking_count);
+}
+
+void test_suspending_continuation()
+{
+    std::int64_t const blocking_count =
+        hpx::threads::get_stackless_blocking_count(false);
+
+    // continuations which suspend are never run stackless
+    HPX_TEST(!run_continuation<1>(action::sleep));
+    HPX_TEST(!run_continuation<1>(action::none));
+
+    HPX_TEST(!run_continuation<2>(action::yield));
+    HPX_TEST(!run_continuation<2>(action::none));
+
+    HPX_TEST_EQ(
+        hpx::threads::get_stackless_blocking_count(false), blocking_count);
+}
+
+void test_occasionally_suspending_continuation()
+{
+    std::int64_t const blocking_count =
+        hpx::threads::get_stackless_blocking_count(false);
+
+    HPX_TEST(!run_continuation<3>(action::none));
+
+    // a stackless thread sleeping blocks its worker thread
+    HPX_TEST(run_continuation<3>(action::sleep));
+    HPX_TEST_EQ(hpx::threads::get_stackless_blocking_count(false),
+        blocking_count + 1);
+
+    // all subsequent threads created from the same call site are stackful
+    HPX_TEST(!run_continuation<3>(action::none));
+
+    // the same holds for yielding
+    HPX_TEST(!run_continuation<4>(action::none));
+    HPX_TEST(run_continuation<4>(action::yield));
+    HPX_TEST(!run_continuation<4>(action::none));
+
+    HPX_TEST_EQ(hpx::threads::get_stackless_blocking_count(false),
+        blocking_count + 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST(hpx::threads::get_stackless_leaf_tasks());
+
+    test_bulk();
+    test_continuation();
+    test_suspending_continuation();
+    test_occasionally_suspending_continuation();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.stacks.stackless_leaf_tasks=1"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
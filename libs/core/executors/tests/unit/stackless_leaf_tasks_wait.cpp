@@ -0,0 +1,121 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Leaf tasks which wait for a result are run on stackful threads. This test
+// runs on a single worker thread, all results waited for are produced by
+// threads queued on the same worker thread as the waiting leaf task.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+bool is_stackless()
+{
+    hpx::threads::thread_data* thrd = hpx::threads::get_self_id_data();
+    HPX_TEST(thrd != nullptr);
+    return thrd->is_stackless();
+}
+
+void wait_for_task()
+{
+    // the value is produced by a task queued on the only worker thread
+    hpx::future<int> f = hpx::async([]() {
+        // the producer waits itself
+        hpx::execution_base::this_thread::sleep_for(
+            std::chrono::milliseconds(1));
+        return 42;
+    });
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+void wait_for_nested_bulk()
+{
+    hpx::execution::parallel_executor exec;
+
+    std::atomic<std::size_t> count(0);
+    std::vector<int> v(1000);
+
+    hpx::parallel::execution::bulk_async_execute(
+        exec, [&](int) { ++count; }, v)
+        .get();
+
+    HPX_TEST_EQ(count.load(), v.size());
+}
+
+void wait_with_timeout()
+{
+    hpx::promise<void> p;
+    hpx::future<void> f = p.get_future();
+
+    // nothing sets the value in the meantime
+    HPX_TEST(f.wait_for(std::chrono::milliseconds(10)) ==
+        hpx::future_status::timeout);
+
+    hpx::future<void> setter = hpx::async([&p]() { p.set_value(); });
+    HPX_TEST(f.wait_for(std::chrono::seconds(60)) == hpx::future_status::ready);
+    setter.get();
+}
+
+// each waiting function is run from its own call site
+template <typename F>
+void test_wait(F f)
+{
+    std::int64_t const blocking_count =
+        hpx::threads::get_stackless_blocking_count(false);
+
+    for (int i = 0; i != 3; ++i)
+    {
+        hpx::future<bool> r =
+            hpx::make_ready_future().then([f](hpx::future<void>&&) {
+                f();
+                return is_stackless();
+            });
+        HPX_TEST(!r.get());
+    }
+
+    // no stackless thread had to block the worker thread
+    HPX_TEST_EQ(
+        hpx::threads::get_stackless_blocking_count(false), blocking_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST(hpx::threads::get_stackless_leaf_tasks());
+    HPX_TEST_EQ(hpx::get_os_thread_count(), std::size_t(1));
+
+    test_wait([] { wait_for_task(); });
+    test_wait([] { wait_for_nested_bulk(); });
+    test_wait([] { wait_with_timeout(); });
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=1", "hpx.stacks.stackless_leaf_tasks=1"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
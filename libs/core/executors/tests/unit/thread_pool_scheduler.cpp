@@ -330,6 +330,10 @@ void test_properties()
         // thread_pool_scheduler holds the property.
     }
 
+    HPX_TEST(ex::get_bulk_splitting(sched) == ex::bulk_splitting::static_);
+    HPX_TEST(ex::get_bulk_splitting(ex::with_bulk_splitting(
+                 sched, ex::bulk_splitting::lazy)) == ex::bulk_splitting::lazy);
+
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
     {
         char const* annotation = "<test>";
@@ -1664,6 +1668,31 @@ void test_bulk()
         }
     }
 
+    {
+        // with lazy splitting idle workers steal half of the remaining
+        // iterations of other workers, make the workload irregular to have
+        // them do so
+        auto sched = ex::with_bulk_splitting(
+            ex::thread_pool_scheduler{}, ex::bulk_splitting::lazy);
+
+        for (int n : {0, 1, 10, 43, 10007})
+        {
+            std::vector<std::atomic<int>> v(n);
+            ex::schedule(sched) | ex::bulk(n, [&](int i) {
+                if (i < n / 4)
+                {
+                    hpx::this_thread::yield();
+                }
+                ++v[i];
+            }) | tt::sync_wait();
+
+            for (int i = 0; i < n; ++i)
+            {
+                HPX_TEST_EQ(v[i].load(), 1);
+            }
+        }
+    }
+
     for (auto n : ns)
     {
         int i_fail = 3;
@@ -1,5 +1,5 @@
 //  Copyright (c) 2011 Thomas Heller
-//  Copyright (c) 2013-2022 Hartmut Kaiser
+//  Copyright (c) 2013-2023 Hartmut Kaiser
 //  Copyright (c) 2014-2019 Agustin Berge
 //  Copyright (c) 2017 Google
 //
@@ -29,6 +29,9 @@
 
 namespace hpx::util::detail {
 
+    // default size of the embedded storage of hpx::function and
+    // hpx::move_only_function, callables which do not fit are allocated
+    // separately
     inline constexpr std::size_t function_storage_size = 3 * sizeof(void*);
 
     ///////////////////////////////////////////////////////////////////////////
@@ -41,22 +44,9 @@ namespace hpx::util::detail {
             function_base_vtable const* empty_vptr) noexcept
           : vptr(empty_vptr)
           , object(nullptr)
-          , storage_init()
         {
         }
 
-        function_base(function_base const& other, vtable const* empty_vtable);
-        function_base(function_base&& other, vtable const* empty_vptr) noexcept;
-        ~function_base();
-
-        void op_assign(function_base const& other, vtable const* empty_vtable);
-        void op_assign(
-            function_base&& other, vtable const* empty_vtable) noexcept;
-
-        void destroy() noexcept;
-        void reset(vtable const* empty_vptr) noexcept;
-        void swap(function_base& f) noexcept;
-
         constexpr bool empty() const noexcept
         {
             return object == nullptr;
@@ -74,10 +64,130 @@ namespace hpx::util::detail {
     protected:
         vtable const* vptr;
         void* object;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // function_base with an embedded storage of StorageSize bytes
+    template <std::size_t StorageSize>
+    class function_storage : public function_base
+    {
+        static_assert(StorageSize >= sizeof(void*),
+            "the embedded storage should be able to hold at least a pointer");
+
+        using vtable = function_base_vtable;
+
+    public:
+        static constexpr std::size_t storage_size = StorageSize;
+
+        explicit constexpr function_storage(
+            function_base_vtable const* empty_vptr) noexcept
+          : function_base(empty_vptr)
+          , storage_init()
+        {
+        }
+
+        function_storage(
+            function_storage const& other, vtable const* /* empty_vtable */)
+          : function_base(other.vptr)
+        {
+            if (other.object != nullptr)
+            {
+                object = vptr->copy(
+                    storage, StorageSize, other.object, /*destroy*/ false);
+            }
+        }
+
+        function_storage(
+            function_storage&& other, vtable const* empty_vptr) noexcept
+          : function_base(other.vptr)
+        {
+            object = other.object;
+            if (object == &other.storage)
+            {
+                std::memcpy(storage, other.storage, StorageSize);
+                object = &storage;
+            }
+
+            other.vptr = empty_vptr;
+            other.object = nullptr;
+        }
+
+        ~function_storage()
+        {
+            destroy();
+        }
+
+        void op_assign(
+            function_storage const& other, vtable const* /* empty_vtable */)
+        {
+            if (vptr == other.vptr)
+            {
+                if (this != &other && object)
+                {
+                    HPX_ASSERT(other.object != nullptr);
+
+                    // reuse object storage
+                    object = vptr->copy(object, std::size_t(-1), other.object,
+                        /*destroy*/ true);
+                }
+            }
+            else
+            {
+                destroy();
+                vptr = other.vptr;
+                if (other.object != nullptr)
+                {
+                    object = vptr->copy(
+                        storage, StorageSize, other.object, /*destroy*/ false);
+                }
+                else
+                {
+                    object = nullptr;
+                }
+            }
+        }
+
+        void op_assign(
+            function_storage&& other, vtable const* empty_vtable) noexcept
+        {
+            if (this != &other)
+            {
+                swap(other);
+                other.reset(empty_vtable);
+            }
+        }
+
+        void destroy() noexcept
+        {
+            if (object != nullptr)
+            {
+                vptr->deallocate(object, StorageSize, /*destroy*/ true);
+            }
+        }
+
+        void reset(vtable const* empty_vptr) noexcept
+        {
+            destroy();
+            vptr = empty_vptr;
+            object = nullptr;
+        }
+
+        void swap(function_storage& f) noexcept
+        {
+            std::swap(vptr, f.vptr);
+            std::swap(object, f.object);
+            std::swap(storage, f.storage);
+            if (object == &f.storage)
+                object = &storage;
+            if (f.object == &storage)
+                f.object = &f.storage;
+        }
+
+    protected:
         union
         {
             char storage_init;
-            mutable unsigned char storage[function_storage_size];
+            mutable unsigned char storage[StorageSize];
         };
     };
 
@@ -112,14 +222,16 @@ namespace hpx::util::detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Sig, bool Copyable, bool Serializable>
+    template <typename Sig, bool Copyable, bool Serializable,
+        std::size_t StorageSize = function_storage_size>
     class basic_function;
 
-    template <bool Copyable, typename R, typename... Ts>
-    class basic_function<R(Ts...), Copyable, /*Serializable*/ false>
-      : public function_base
+    template <bool Copyable, typename R, typename... Ts,
+        std::size_t StorageSize>
+    class basic_function<R(Ts...), Copyable, /*Serializable*/ false,
+        StorageSize> : public function_storage<StorageSize>
     {
-        using base_type = function_base;
+        using base_type = function_storage<StorageSize>;
         using vtable = function_vtable<R(Ts...), Copyable>;
 
     public:
@@ -177,10 +289,10 @@ namespace hpx::util::detail {
                 }
                 else
                 {
-                    destroy();
+                    base_type::destroy();
                     vptr = f_vptr;
-                    buffer = vtable::template allocate<T>(
-                        storage, function_storage_size);
+                    buffer =
+                        vtable::template allocate<T>(storage, StorageSize);
                 }
                 object = hpx::construct_at(
                     static_cast<T*>(buffer), HPX_FORWARD(F, f));
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
 
 #include <cstddef>
 #include <memory>
@@ -56,14 +57,14 @@ namespace hpx::util::detail {
             return *reinterpret_cast<T const*>(obj);
         }
 
+        // callables which do not fit into the embedded storage are
+        // allocated from the slabs of the allocating thread
         template <typename T>
         static void* allocate(void* storage, std::size_t storage_size)
         {
-            using storage_t = std::aligned_storage_t<sizeof(T), alignof(T)>;
-
             if (sizeof(T) > storage_size)
             {
-                return new storage_t;
+                return util::detail::allocate_small(sizeof(T), alignof(T));
             }
             return storage;
         }
@@ -72,8 +73,6 @@ namespace hpx::util::detail {
         static void _deallocate(
             void* obj, std::size_t storage_size, bool destroy) noexcept
         {
-            using storage_t = std::aligned_storage_t<sizeof(T), alignof(T)>;
-
             if (destroy)
             {
                 std::destroy_at(std::addressof(get<T>(obj)));
@@ -81,7 +80,7 @@ namespace hpx::util::detail {
 
             if (sizeof(T) > storage_size)
             {
-                delete static_cast<storage_t*>(obj);
+                util::detail::deallocate_small(obj, sizeof(T), alignof(T));
             }
         }
         void (*deallocate)(void*, std::size_t storage_size, bool) noexcept;
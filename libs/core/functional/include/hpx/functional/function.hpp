@@ -1,5 +1,5 @@
 //  Copyright (c) 2011 Thomas Heller
-//  Copyright (c) 2013-2022 Hartmut Kaiser
+//  Copyright (c) 2013-2023 Hartmut Kaiser
 //  Copyright (c) 2014-2015 Agustin Berge
 //
 //  SPDX-License-Identifier: BSL-1.0
@@ -34,15 +34,22 @@ namespace hpx {
     /// hpx::function results in \a hpx#error#bad_function_call exception being
     /// thrown. hpx::function satisfies the requirements of CopyConstructible
     /// and CopyAssignable.
-    template <typename Sig, bool Serializable = false>
+    ///
+    /// The optional parameter \a StorageSize specifies the size (in bytes) of
+    /// the embedded storage. Targets which do not fit into this storage are
+    /// allocated separately.
+    template <typename Sig, bool Serializable = false,
+        std::size_t StorageSize = util::detail::function_storage_size>
     class function;
 
-    template <typename R, typename... Ts, bool Serializable>
-    class function<R(Ts...), Serializable>
-      : public util::detail::basic_function<R(Ts...), true, Serializable>
+    template <typename R, typename... Ts, bool Serializable,
+        std::size_t StorageSize>
+    class function<R(Ts...), Serializable, StorageSize>
+      : public util::detail::basic_function<R(Ts...), true, Serializable,
+            StorageSize>
     {
-        using base_type =
-            util::detail::basic_function<R(Ts...), true, Serializable>;
+        using base_type = util::detail::basic_function<R(Ts...), true,
+            Serializable, StorageSize>;
 
     public:
         using result_type = R;
@@ -85,8 +92,9 @@ namespace hpx {
     namespace distributed {
 
         // serializable function is equivalent to hpx::distributed::function
-        template <typename Sig>
-        using function = hpx::function<Sig, true>;
+        template <typename Sig,
+            std::size_t StorageSize = util::detail::function_storage_size>
+        using function = hpx::function<Sig, true, StorageSize>;
     }    // namespace distributed
 }    // namespace hpx
 
@@ -107,32 +115,38 @@ namespace hpx::util {
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::traits {
 
-    template <typename Sig, bool Serializable>
-    struct get_function_address<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_address<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
-        static constexpr std::size_t call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+        using function_type = hpx::function<Sig, Serializable, StorageSize>;
+
+        static constexpr std::size_t call(function_type const& f) noexcept
         {
             return f.get_function_address();
         }
     };
 
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
-        static constexpr char const* call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+        using function_type = hpx::function<Sig, Serializable, StorageSize>;
+
+        static constexpr char const* call(function_type const& f) noexcept
         {
             return f.get_function_annotation();
         }
     };
 
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation_itt<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation_itt<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
-        static util::itt::string_handle call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+        using function_type = hpx::function<Sig, Serializable, StorageSize>;
+
+        static util::itt::string_handle call(function_type const& f) noexcept
         {
             return f.get_function_annotation_itt();
         }
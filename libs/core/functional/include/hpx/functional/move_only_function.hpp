@@ -1,5 +1,5 @@
 //  Copyright (c) 2011 Thomas Heller
-//  Copyright (c) 2013-2022 Hartmut Kaiser
+//  Copyright (c) 2013-2023 Hartmut Kaiser
 //  Copyright (c) 2014-2015 Agustin Berge
 //
 //  SPDX-License-Identifier: BSL-1.0
@@ -42,15 +42,22 @@ namespace hpx {
     /// specifier (if any) are added to its operator(). hpx::move_only_function
     /// satisfies the requirements of MoveConstructible and MoveAssignable, but
     /// does not satisfy CopyConstructible or CopyAssignable.
-    template <typename Sig, bool Serializable = false>
+    ///
+    /// The optional parameter \a StorageSize specifies the size (in bytes) of
+    /// the embedded storage. Targets which do not fit into this storage are
+    /// allocated separately.
+    template <typename Sig, bool Serializable = false,
+        std::size_t StorageSize = util::detail::function_storage_size>
     class move_only_function;
 
-    template <typename R, typename... Ts, bool Serializable>
-    class move_only_function<R(Ts...), Serializable>
-      : public util::detail::basic_function<R(Ts...), false, Serializable>
+    template <typename R, typename... Ts, bool Serializable,
+        std::size_t StorageSize>
+    class move_only_function<R(Ts...), Serializable, StorageSize>
+      : public util::detail::basic_function<R(Ts...), false, Serializable,
+            StorageSize>
     {
-        using base_type =
-            util::detail::basic_function<R(Ts...), false, Serializable>;
+        using base_type = util::detail::basic_function<R(Ts...), false,
+            Serializable, StorageSize>;
 
     public:
         using result_type = R;
@@ -96,8 +103,10 @@ namespace hpx {
 
         // serializable move_only_function is equivalent to
         // hpx::distributed::move_only_function
-        template <typename Sig>
-        using move_only_function = hpx::move_only_function<Sig, true>;
+        template <typename Sig,
+            std::size_t StorageSize = util::detail::function_storage_size>
+        using move_only_function =
+            hpx::move_only_function<Sig, true, StorageSize>;
     }    // namespace distributed
 }    // namespace hpx
 
@@ -119,33 +128,41 @@ namespace hpx::util {
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::traits {
 
-    template <typename Sig, bool Serializable>
-    struct get_function_address<hpx::move_only_function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_address<
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
-        static constexpr std::size_t call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+        using function_type =
+            hpx::move_only_function<Sig, Serializable, StorageSize>;
+
+        static constexpr std::size_t call(function_type const& f) noexcept
         {
             return f.get_function_address();
         }
     };
 
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation<hpx::move_only_function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation<
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
-        static constexpr char const* call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+        using function_type =
+            hpx::move_only_function<Sig, Serializable, StorageSize>;
+
+        static constexpr char const* call(function_type const& f) noexcept
         {
             return f.get_function_annotation();
         }
     };
 
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-    template <typename Sig, bool Serializable>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
     struct get_function_annotation_itt<
-        hpx::move_only_function<Sig, Serializable>>
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
-        static util::itt::string_handle call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+        using function_type =
+            hpx::move_only_function<Sig, Serializable, StorageSize>;
+
+        static util::itt::string_handle call(function_type const& f) noexcept
         {
             return f.get_function_annotation_itt();
         }
@@ -1,5 +1,5 @@
 //  Copyright (c) 2011 Thomas Heller
-//  Copyright (c) 2013-2022 Hartmut Kaiser
+//  Copyright (c) 2013-2023 Hartmut Kaiser
 //  Copyright (c) 2014-2019 Agustin Berge
 //  Copyright (c) 2017 Google
 //
@@ -18,19 +18,24 @@
 #include <hpx/functional/serialization/detail/vtable/serializable_vtable.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
 #include <utility>
 
 namespace hpx::util::detail {
 
-    template <bool Copyable, typename R, typename... Ts>
-    class basic_function<R(Ts...), Copyable, /*Serializable*/ true>
-      : public basic_function<R(Ts...), Copyable, /*Serializable*/ false>
+    template <bool Copyable, typename R, typename... Ts,
+        std::size_t StorageSize>
+    class basic_function<R(Ts...), Copyable, /*Serializable*/ true,
+        StorageSize>
+      : public basic_function<R(Ts...), Copyable, /*Serializable*/ false,
+            StorageSize>
     {
         using vtable = function_vtable<R(Ts...), Copyable>;
         using serializable_vtable = serializable_function_vtable<vtable>;
-        using base_type = basic_function<R(Ts...), Copyable, false>;
+        using base_type =
+            basic_function<R(Ts...), Copyable, false, StorageSize>;
 
     public:
         constexpr basic_function() noexcept
@@ -87,7 +92,7 @@ namespace hpx::util::detail {
 
                 vptr = serializable_vptr->vptr;
                 object = serializable_vptr->load_object(
-                    storage, function_storage_size, ar, version);
+                    storage, StorageSize, ar, version);
             }
         }
 
@@ -27,104 +27,6 @@
 namespace hpx::util::detail {
 
     ///////////////////////////////////////////////////////////////////////////
-    function_base::function_base(
-        function_base const& other, vtable const* /* empty_vtable */)
-      : vptr(other.vptr)
-      , object(other.object)
-    {
-        if (other.object != nullptr)
-        {
-            object = vptr->copy(storage, detail::function_storage_size,
-                other.object, /*destroy*/ false);
-        }
-    }
-
-    function_base::function_base(
-        function_base&& other, vtable const* empty_vptr) noexcept
-      : vptr(other.vptr)
-      , object(other.object)
-    {
-        if (object == &other.storage)
-        {
-            std::memcpy(storage, other.storage, function_storage_size);
-            object = &storage;
-        }
-
-        other.vptr = empty_vptr;
-        other.object = nullptr;
-    }
-
-    function_base::~function_base()
-    {
-        destroy();
-    }
-
-    void function_base::op_assign(
-        function_base const& other, vtable const* /* empty_vtable */)
-    {
-        if (vptr == other.vptr)
-        {
-            if (this != &other && object)
-            {
-                HPX_ASSERT(other.object != nullptr);
-
-                // reuse object storage
-                object = vptr->copy(
-                    object, std::size_t(-1), other.object, /*destroy*/ true);
-            }
-        }
-        else
-        {
-            destroy();
-            vptr = other.vptr;
-            if (other.object != nullptr)
-            {
-                object = vptr->copy(storage, detail::function_storage_size,
-                    other.object, /*destroy*/ false);
-            }
-            else
-            {
-                object = nullptr;
-            }
-        }
-    }
-
-    void function_base::op_assign(
-        function_base&& other, vtable const* empty_vtable) noexcept
-    {
-        if (this != &other)
-        {
-            swap(other);
-            other.reset(empty_vtable);
-        }
-    }
-
-    void function_base::destroy() noexcept
-    {
-        if (object != nullptr)
-        {
-            vptr->deallocate(object, function_storage_size, /*destroy*/ true);
-        }
-    }
-
-    void function_base::reset(vtable const* empty_vptr) noexcept
-    {
-        destroy();
-        vptr = empty_vptr;
-        object = nullptr;
-    }
-
-    void function_base::swap(function_base& f) noexcept
-    {
-        std::swap(vptr, f.vptr);
-        std::swap(object, f.object);
-        std::swap(storage, f.storage);
-        if (object == &f.storage)
-            object = &storage;
-        if (f.object == &storage)
-            f.object = &f.storage;
-    }
-
     std::size_t function_base::get_function_address() const
     {
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
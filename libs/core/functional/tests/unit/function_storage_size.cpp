@@ -0,0 +1,126 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional/function.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+struct callable
+{
+    int operator()(int x) const
+    {
+        return *p + x + static_cast<int>(i + j);
+    }
+
+    std::shared_ptr<int> p;
+    std::size_t i;
+    std::size_t j;
+};
+
+constexpr std::size_t storage_size = 8 * sizeof(void*);
+
+// returns whether the target is stored inside the function object itself
+template <typename F, typename T>
+bool is_embedded(F const& f, T const* target)
+{
+    auto const* begin = reinterpret_cast<char const*>(&f);
+    auto const* p = reinterpret_cast<char const*>(target);
+    return p >= begin && p < begin + sizeof(F);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_function()
+{
+    static_assert(sizeof(callable) > hpx::util::detail::function_storage_size);
+    static_assert(sizeof(callable) <= storage_size);
+
+    auto p = std::make_shared<int>(1);
+
+    hpx::function<int(int)> small = callable{p, 2, 3};
+    HPX_TEST_EQ(small(4), 10);
+    HPX_TEST(!is_embedded(small, small.target<callable>()));
+
+    hpx::function<int(int), false, storage_size> f = callable{p, 2, 3};
+    HPX_TEST_EQ(f(4), 10);
+    HPX_TEST(is_embedded(f, f.target<callable>()));
+
+    // copy
+    hpx::function<int(int), false, storage_size> g(f);
+    HPX_TEST_EQ(g(5), 11);
+    HPX_TEST(is_embedded(g, g.target<callable>()));
+    HPX_TEST_EQ(p.use_count(), 4);
+
+    // move
+    hpx::function<int(int), false, storage_size> h(std::move(f));
+    HPX_TEST(f.empty());
+    HPX_TEST_EQ(h(6), 12);
+    HPX_TEST(is_embedded(h, h.target<callable>()));
+
+    // assignment and swap
+    g = [](int x) { return x; };
+    HPX_TEST_EQ(g(7), 7);
+    HPX_TEST_EQ(p.use_count(), 3);
+
+    g.swap(h);
+    HPX_TEST_EQ(g(6), 12);
+    HPX_TEST_EQ(h(6), 6);
+    HPX_TEST(is_embedded(g, g.target<callable>()));
+
+    h = g;
+    HPX_TEST_EQ(h(6), 12);
+    HPX_TEST_EQ(p.use_count(), 4);
+
+    g.reset();
+    h.reset();
+    HPX_TEST_EQ(p.use_count(), 2);
+}
+
+void test_move_only_function()
+{
+    auto p = std::make_shared<int>(1);
+
+    hpx::move_only_function<int(int), false, storage_size> f =
+        callable{p, 2, 3};
+    HPX_TEST_EQ(f(4), 10);
+    HPX_TEST(is_embedded(f, f.target<callable>()));
+
+    hpx::move_only_function<int(int), false, storage_size> g(std::move(f));
+    HPX_TEST(f.empty());
+    HPX_TEST_EQ(g(4), 10);
+    HPX_TEST(is_embedded(g, g.target<callable>()));
+
+    // callables exceeding the embedded storage are still supported
+    struct large
+    {
+        int operator()(int x) const
+        {
+            return x + static_cast<int>(data[0]);
+        }
+
+        std::size_t data[16];
+    };
+
+    f = large{{1}};
+    HPX_TEST_EQ(f(4), 5);
+    HPX_TEST(!is_embedded(f, f.target<large>()));
+
+    g = std::move(f);
+    HPX_TEST_EQ(g(4), 5);
+    HPX_TEST_EQ(p.use_count(), 1);
+}
+
+int main()
+{
+    test_function();
+    test_move_only_function();
+
+    return hpx::util::report_errors();
+}
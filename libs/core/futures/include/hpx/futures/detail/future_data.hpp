@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/datastructures/detail/small_vector.hpp>
@@ -30,9 +31,11 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -93,7 +96,13 @@ namespace hpx::lcos::detail {
         future_data_refcnt_base& operator=(future_data_refcnt_base&&) = delete;
 
     public:
-        using completed_callback_type = hpx::move_only_function<void()>;
+        // continuations typically capture a reference to the shared state,
+        // a future, and the continuation function
+        static constexpr std::size_t completed_callback_storage_size =
+            6 * sizeof(void*);
+
+        using completed_callback_type = hpx::move_only_function<void(), false,
+            completed_callback_storage_size>;
         using completed_callback_vector_type =
             hpx::detail::small_vector<completed_callback_type, 1>;
 
@@ -111,6 +120,35 @@ namespace hpx::lcos::detail {
             delete this;
         }
 
+        // custom allocator support, shared states are allocated from the
+        // slabs of the allocating thread
+        [[nodiscard]] static void* operator new(std::size_t size)
+        {
+            return util::detail::allocate_small(
+                size, alignof(std::max_align_t));
+        }
+
+        static void operator delete(void* p, std::size_t size) noexcept
+        {
+            util::detail::deallocate_small(p, size, alignof(std::max_align_t));
+        }
+
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+        [[nodiscard]] static void* operator new(
+            std::size_t size, std::align_val_t alignment)
+        {
+            return util::detail::allocate_small(
+                size, static_cast<std::size_t>(alignment));
+        }
+
+        static void operator delete(
+            void* p, std::size_t size, std::align_val_t alignment) noexcept
+        {
+            util::detail::deallocate_small(
+                p, size, static_cast<std::size_t>(alignment));
+        }
+#endif
+
         // This is a tag type used to convey the information that the caller is
         // _not_ going to addref the future_data instance
         struct init_no_addref
@@ -252,6 +290,30 @@ namespace hpx::lcos::detail {
             exception = 4 | ready
         };
 
+    protected:
+        // Additional flags kept in the state word next to the state itself.
+        // They describe who has to be notified once the shared state becomes
+        // ready, which allows to attach a single continuation and to make the
+        // shared state ready without acquiring mtx_.
+        enum state_flags : std::uint32_t
+        {
+            state_mask = 7,
+
+            // the first continuation is being stored in on_completed_single_
+            continuation_claimed = 8,
+
+            // on_completed_single_ holds a continuation
+            continuation_set = 16,
+
+            // further continuations were stored in on_completed_ (protected
+            // by mtx_)
+            continuation_list = 32,
+
+            // threads may be suspended on cond_ (protected by mtx_)
+            has_waiters = 64
+        };
+
+    public:
         // Return whether or not the data is available for this \a future.
         bool is_ready(
             std::memory_order order = std::memory_order_acquire) const noexcept
@@ -261,12 +323,12 @@ namespace hpx::lcos::detail {
 
         bool has_value() const noexcept
         {
-            return state_.load(std::memory_order_acquire) == value;
+            return get_state() == value;
         }
 
         bool has_exception() const noexcept
         {
-            return state_.load(std::memory_order_acquire) == exception;
+            return get_state() == exception;
         }
 
         virtual void execute_deferred(error_code& /*ec*/ = throws) {}
@@ -336,8 +398,48 @@ namespace hpx::lcos::detail {
         }
 
     protected:
+        state get_state(
+            std::memory_order order = std::memory_order_acquire) const noexcept
+        {
+            return static_cast<state>(state_.load(order) & state_mask);
+        }
+
+        // Change the state to the given (ready) state. Throws if the shared
+        // state was made ready before.
+        void mark_ready(state s, char const* func)
+        {
+            HPX_ASSERT((s & ready) != 0);
+
+            std::uint32_t old_state = state_.load(std::memory_order_relaxed);
+            do
+            {
+                if ((old_state & ready) != 0)
+                {
+                    // this future should be 'empty' still (it can't be made
+                    // ready more than once).
+                    HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
+                        func, "data has already been set for this future");
+                    return;
+                }
+            } while (!state_.compare_exchange_weak(old_state, old_state | s,
+                std::memory_order_acq_rel, std::memory_order_relaxed));
+
+            // nothing else needs to be done if nobody has attached a
+            // continuation or is waiting for the shared state
+            if ((old_state & ~std::uint32_t(state_mask)) != 0)
+            {
+                notify_ready(old_state);
+            }
+        }
+
+        // Wake up all waiting threads and run the continuations after the
+        // shared state was made ready, old_state is the state word as seen
+        // immediately before.
+        void notify_ready(std::uint32_t old_state);
+
         mutable mutex_type mtx_;
-        std::atomic<state> state_;    // current state
+        std::atomic<std::uint32_t> state_;    // current state and flags
+        completed_callback_type on_completed_single_;
         completed_callback_vector_type on_completed_;
         local::detail::condition_variable cond_;    // threads waiting in read
     };
@@ -448,51 +550,10 @@ namespace hpx::lcos::detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, HPX_FORWARD(Ts, ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
-            {
-                // this future should be 'empty' still (it can't be made ready
-                // more than once).
-                l.unlock();
-                HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
-                    "future_data_base::set_value",
-                    "data has already been set for this future");
-                return;
-            }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
+            // This also runs all registered continuations.
+            this->mark_ready(value, "future_data_base::set_value");
         }
 
         void set_exception(std::exception_ptr data) override
@@ -508,51 +569,10 @@ namespace hpx::lcos::detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             hpx::construct_at(exception_ptr, HPX_MOVE(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
-            {
-                // this future should be 'empty' still (it can't be made ready
-                // more than once).
-                l.unlock();
-                HPX_THROW_EXCEPTION(hpx::error::promise_already_satisfied,
-                    "future_data_base::set_exception",
-                    "data has already been set for this future");
-                return;
-            }
-
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-            HPX_ASSERT_DOESNT_OWN_LOCK(l);
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-            {
-                handle_on_completed(HPX_MOVE(on_completed));
-            }
+            // This also runs all registered continuations.
+            this->mark_ready(exception, "future_data_base::set_exception");
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -600,7 +620,7 @@ namespace hpx::lcos::detail {
             // and no reader
 
             // release any stored data and callback functions
-            switch (state_.exchange(empty))
+            switch (state_.exchange(empty) & base_type::state_mask)
             {
             case value:
             {
@@ -620,18 +640,20 @@ namespace hpx::lcos::detail {
                 break;
             }
 
+            on_completed_single_.reset();
             on_completed_.clear();
         }
 
         std::exception_ptr get_exception_ptr() const override
         {
-            HPX_ASSERT(state_.load(std::memory_order_acquire) == exception);
+            HPX_ASSERT(this->get_state() == exception);
             return *reinterpret_cast<std::exception_ptr const*>(&storage_);
         }
 
     protected:
         using base_type::mtx_;
         using base_type::on_completed_;
+        using base_type::on_completed_single_;
         using base_type::state_;
 
     private:
@@ -19,6 +19,7 @@
 #include <hpx/threading_base/annotated_function.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <mutex>
@@ -113,7 +114,7 @@ namespace hpx::lcos::detail {
         // thread was suspended, in this case we need to load it again.
         if (s == empty)
         {
-            s = state_.load(std::memory_order_relaxed);
+            s = get_state(std::memory_order_relaxed);
         }
 
         if (s == value)
@@ -253,25 +254,98 @@ namespace hpx::lcos::detail {
         if (!data_sink)
             return;
 
-        if (is_ready(std::memory_order_relaxed))
+        // Most shared states have exactly one continuation, it is stored
+        // without acquiring the lock. The continuation is run by whoever comes
+        // last, either this thread or the one making the shared state ready.
+        std::uint32_t s = state_.load(std::memory_order_acquire);
+        while ((s & (ready | continuation_claimed)) == 0)
         {
-            // invoke the callback (continuation) function right away
-            handle_on_completed(HPX_MOVE(data_sink));
+            if (state_.compare_exchange_weak(s, s | continuation_claimed,
+                    std::memory_order_acquire, std::memory_order_acquire))
+            {
+                on_completed_single_ = HPX_MOVE(data_sink);
+
+                s = state_.fetch_or(
+                    continuation_set, std::memory_order_acq_rel);
+                if ((s & ready) != 0)
+                {
+                    // the shared state was made ready in the meantime
+                    completed_callback_type on_completed =
+                        HPX_MOVE(on_completed_single_);
+                    handle_on_completed(HPX_MOVE(on_completed));
+                }
+                return;
+            }
         }
-        else
+
+        if ((s & ready) == 0)
         {
+            // additional continuations are stored under the lock
             std::unique_lock l(mtx_);
-            if (is_ready())
+            s = state_.fetch_or(continuation_list, std::memory_order_acq_rel);
+            if ((s & ready) == 0)
             {
-                l.unlock();
+                on_completed_.push_back(HPX_MOVE(data_sink));
+                return;
+            }
+        }
 
-                // invoke the callback (continuation) function
-                handle_on_completed(HPX_MOVE(data_sink));
+        // invoke the callback (continuation) function right away
+        handle_on_completed(HPX_MOVE(data_sink));
+    }
+
+    void future_data_base<traits::detail::future_data_void>::notify_ready(
+        std::uint32_t old_state)
+    {
+        completed_callback_vector_type on_completed;
+        if ((old_state & (continuation_list | has_waiters)) != 0)
+        {
+            // At this point the lock needs to be acquired to safely access the
+            // registered continuations and the waiting threads
+            std::unique_lock<mutex_type> l(mtx_);
+
+            on_completed = HPX_MOVE(on_completed_);
+            on_completed_.clear();
+
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            while (
+                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
+            {
+                l = std::unique_lock<mutex_type>(mtx_);
             }
-            else
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+            HPX_ASSERT_DOESNT_OWN_LOCK(l);
+        }
+
+        // If the continuation is still being stored, the thread storing it
+        // will run it.
+        if ((old_state & continuation_set) != 0)
+        {
+            completed_callback_type on_completed_single =
+                HPX_MOVE(on_completed_single_);
+            if (on_completed.empty())
             {
-                on_completed_.push_back(HPX_MOVE(data_sink));
+                handle_on_completed(HPX_MOVE(on_completed_single));
+                return;
             }
+
+            // the single continuation was attached first
+            on_completed.insert(
+                on_completed.begin(), HPX_MOVE(on_completed_single));
+        }
+
+        // invoke the callback (continuation) functions
+        if (!on_completed.empty())
+        {
+            handle_on_completed(HPX_MOVE(on_completed));
         }
     }
 
@@ -279,11 +353,14 @@ namespace hpx::lcos::detail {
     future_data_base<traits::detail::future_data_void>::wait(error_code& ec)
     {
         // block if this entry is empty
-        state s = state_.load(std::memory_order_acquire);
+        state s = get_state();
         if (s == empty)
         {
+            // announce this thread to the one making the shared state ready
             std::unique_lock l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+            s = static_cast<state>(
+                state_.fetch_or(has_waiters, std::memory_order_acq_rel) &
+                state_mask);
             if (s == empty)
             {
                 cond_.wait(l, "future_data_base::wait", ec);
@@ -293,7 +370,7 @@ namespace hpx::lcos::detail {
                 }
 
                 // reload the state, it's not empty anymore
-                s = state_.load(std::memory_order_relaxed);
+                s = get_state(std::memory_order_relaxed);
             }
         }
 
@@ -309,10 +386,12 @@ namespace hpx::lcos::detail {
         std::chrono::steady_clock::time_point const& abs_time, error_code& ec)
     {
         // block if this entry is empty
-        if (state_.load(std::memory_order_acquire) == empty)
+        if (get_state() == empty)
         {
+            // announce this thread to the one making the shared state ready
             std::unique_lock l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            if ((state_.fetch_or(has_waiters, std::memory_order_acq_rel) &
+                    ready) == 0)
             {
                 threads::thread_restart_state const reason = cond_.wait_until(
                     l, abs_time, "future_data_base::wait_until", ec);
@@ -322,7 +401,7 @@ namespace hpx::lcos::detail {
                 }
 
                 if (reason == threads::thread_restart_state::timeout &&
-                    state_.load(std::memory_order_acquire) == empty)
+                    get_state() == empty)
                 {
                     return hpx::future_status::timeout;
                 }
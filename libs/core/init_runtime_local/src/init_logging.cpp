@@ -13,6 +13,7 @@
 #include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/get_worker_thread_num.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/util/get_entry_as.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -951,6 +952,21 @@ namespace hpx { namespace util {
             init_hpx_console_log(ini);
             init_app_console_log(ini);
             init_debuglog_console_log(ini);
+
+            // hand off writing the log records to a background thread
+            if (get_entry_as<int>(ini, "hpx.logging.async", 0) != 0)
+            {
+                logging::binary::start(get_entry_as<std::size_t>(
+                    ini, "hpx.logging.async_buffer_size", 4096));
+
+                agas_logger()->set_async(true);
+                parcel_logger()->set_async(true);
+                timing_logger()->set_async(true);
+                hpx_logger()->set_async(true);
+                hpx_error_logger()->set_async(true);
+                app_logger()->set_async(true);
+                debuglog_logger()->set_async(true);
+            }
         }
 
         void init_logging_local(runtime_configuration& ini)
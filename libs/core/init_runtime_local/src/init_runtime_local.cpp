@@ -10,6 +10,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling_local/command_line_handling_local.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#include <hpx/coroutines/detail/stack_arena.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -42,6 +43,7 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -154,6 +156,20 @@ namespace hpx {
             return 0;
         }
 
+        namespace detail {
+
+            // reset the global options which were set for the runtime that
+            // has been destroyed
+            void deactivate_global_options() noexcept
+            {
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+                // all stacks allocated from the arena have been released at
+                // this point, the next runtime may be configured differently
+                threads::coroutines::detail::posix::stack_arena.enabled = false;
+#endif
+            }
+        }    // namespace detail
+
         int stop(error_code& ec)
         {
             if (threads::get_self_ptr())
@@ -176,7 +192,19 @@ namespace hpx {
             int result = rt->wait();
 
             rt->stop();
-            rt->rethrow_exception();
+            try
+            {
+                rt->rethrow_exception();
+            }
+            catch (...)
+            {
+                rt.reset();
+                detail::deactivate_global_options();
+                throw;
+            }
+
+            rt.reset();
+            detail::deactivate_global_options();
 
             return result;
         }
@@ -232,10 +260,28 @@ namespace hpx {
             void activate_global_options(
                 local::detail::command_line_handling& cmdline)
             {
+                threads::set_stackless_leaf_tasks(
+                    cmdline.rtcfg_.use_stackless_leaf_tasks());
+
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
                 threads::coroutines::detail::posix::use_guard_pages =
                     cmdline.rtcfg_.use_stack_guard_pages();
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+                if (cmdline.rtcfg_.use_stack_arena())
+                {
+                    namespace posix = threads::coroutines::detail::posix;
+
+                    posix::stack_arena.region_size = static_cast<std::size_t>(
+                        cmdline.rtcfg_.get_stack_arena_region_size());
+                    posix::stack_arena.huge_pages =
+                        static_cast<posix::stack_arena_huge_pages>(
+                            cmdline.rtcfg_.get_stack_arena_huge_pages());
+                    posix::stack_arena.prefault =
+                        cmdline.rtcfg_.use_stack_arena_prefault();
+                    posix::stack_arena.enabled = true;
+                }
+#endif
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
                 if (cmdline.rtcfg_.enable_lock_detection())
@@ -343,8 +389,12 @@ namespace hpx {
             {
                 if (blocking)
                 {
-                    return run(*rt, cfg.hpx_main_f_, cfg.vm_, HPX_MOVE(startup),
-                        HPX_MOVE(shutdown));
+                    int const result = run(*rt, cfg.hpx_main_f_, cfg.vm_,
+                        HPX_MOVE(startup), HPX_MOVE(shutdown));
+
+                    rt.reset();
+                    deactivate_global_options();
+                    return result;
                 }
 
                 // non-blocking version
@@ -0,0 +1,182 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/logging/level.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hpx::util::logging {
+
+    class logger;
+    class message;
+
+    /**
+    @brief Asynchronous binary logging
+
+    Log records are written as fixed-size binary records (timestamp, thread,
+    format string, and arguments) into a lock-free ring buffer owned by the
+    calling thread. A background OS thread collects the records from all
+    threads, formats them, and passes them on to the destinations of the
+    logger the record was written to. Nothing is formatted on the calling
+    thread.
+
+    The format string is stored by address and must have static storage
+    duration (usually a string literal). Only <tt>{}</tt> placeholders are
+    supported, format specifications are ignored. Arguments may be of
+    arithmetic, enumeration, or pointer type. Character pointers are printed
+    as strings and must point to strings with static storage duration as
+    well.
+
+    If the background thread was not started, records are formatted and
+    written on the calling thread. If the ring buffer of the calling thread
+    is full, the record is dropped.
+
+    @code
+    HPX_LOG_BINARY(hpx::util::agas, level::debug,
+        "resolved {} to locality {}", gid_msb, locality_id);
+    @endcode
+    */
+    namespace binary {
+
+        inline constexpr std::size_t max_arguments = 6;
+
+        enum class argument_type : std::uint8_t
+        {
+            none = 0,
+            signed_integer = 1,
+            unsigned_integer = 2,
+            floating_point = 3,
+            pointer = 4,
+            string = 5
+        };
+
+        struct argument
+        {
+            argument_type type;
+            union
+            {
+                std::int64_t i;
+                std::uint64_t u;
+                double d;
+                void const* p;
+                char const* s;
+            };
+        };
+
+        // The binary representation of a log record
+        struct record
+        {
+            std::uint64_t timestamp;    // nanoseconds
+            logger* log;
+            char const* format;    // null for asynchronously written messages
+            message* msg;          // the formatted message, if any
+            std::uint32_t thread;    // sequence number of the writing thread
+            level lvl;
+            std::uint32_t num_arguments;
+            argument arguments[max_arguments];
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        namespace detail {
+
+            template <typename T>
+            argument make_argument(T value) noexcept
+            {
+                argument arg;
+                if constexpr (std::is_enum_v<T>)
+                {
+                    return make_argument(
+                        static_cast<std::underlying_type_t<T>>(value));
+                }
+                else if constexpr (std::is_same_v<T, bool> ||
+                    (std::is_integral_v<T> && std::is_unsigned_v<T>))
+                {
+                    arg.type = argument_type::unsigned_integer;
+                    arg.u = static_cast<std::uint64_t>(value);
+                }
+                else if constexpr (std::is_integral_v<T>)
+                {
+                    arg.type = argument_type::signed_integer;
+                    arg.i = static_cast<std::int64_t>(value);
+                }
+                else if constexpr (std::is_floating_point_v<T>)
+                {
+                    arg.type = argument_type::floating_point;
+                    arg.d = static_cast<double>(value);
+                }
+                else if constexpr (std::is_same_v<T, char const*> ||
+                    std::is_same_v<T, char*>)
+                {
+                    arg.type = argument_type::string;
+                    arg.s = value;
+                }
+                else
+                {
+                    static_assert(std::is_pointer_v<T>,
+                        "binary log arguments must be of arithmetic, "
+                        "enumeration, or pointer type");
+                    arg.type = argument_type::pointer;
+                    arg.p = static_cast<void const*>(value);
+                }
+                return arg;
+            }
+
+            HPX_CORE_EXPORT void write(logger& l, level lvl,
+                char const* format, argument const* args,
+                std::size_t num_args) noexcept;
+        }    // namespace detail
+
+        // Write a binary log record to the given logger
+        template <typename... Ts>
+        void log(logger& l, level lvl, char const* format,
+            Ts const&... ts) noexcept
+        {
+            static_assert(sizeof...(Ts) <= max_arguments,
+                "too many arguments for a binary log record");
+
+            if constexpr (sizeof...(Ts) == 0)
+            {
+                detail::write(l, lvl, format, nullptr, 0);
+            }
+            else
+            {
+                argument const args[] = {
+                    detail::make_argument<std::decay_t<Ts const&>>(ts)...};
+                detail::write(l, lvl, format, args, sizeof...(Ts));
+            }
+        }
+
+        // Hand a message which was gathered and formatted on the calling
+        // thread to the background thread for writing it to the destinations
+        // of the given logger. Returns false if the background thread is not
+        // running or if the ring buffer of the calling thread is full, the
+        // message is moved from only if it was accepted.
+        HPX_CORE_EXPORT bool write_async(logger& l, message& msg) noexcept;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Start the background thread processing the log records, the given
+        // capacity is the number of records each thread can buffer.
+        HPX_CORE_EXPORT void start(std::size_t capacity = 4096);
+
+        // Process all outstanding records and stop the background thread
+        HPX_CORE_EXPORT void stop();
+
+        HPX_CORE_EXPORT bool is_running() noexcept;
+
+        // Process all records which were written so far
+        HPX_CORE_EXPORT void flush();
+
+        // Number of records which were dropped because a ring buffer was
+        // full
+        HPX_CORE_EXPORT std::uint64_t dropped_records(
+            bool reset = false) noexcept;
+    }    // namespace binary
+}    // namespace hpx::util::logging
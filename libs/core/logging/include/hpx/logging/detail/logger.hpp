@@ -17,6 +17,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/logging/binary_log.hpp>
 #include <hpx/logging/format/named_write.hpp>
 #include <hpx/logging/level.hpp>
 #include <hpx/modules/format.hpp>
@@ -144,6 +145,23 @@ namespace hpx::util::logging {
             m_level = level;
         }
 
+        /** @brief Write messages asynchronously
+
+        If enabled, messages are formatted on the calling thread but are
+        written to the destinations by the background thread of the binary
+        logging backend (see binary::start). Messages are written directly if
+        the background thread is not running or can't accept more records.
+        */
+        void set_async(bool async) noexcept
+        {
+            m_is_async = async;
+        }
+
+        bool is_async() const noexcept
+        {
+            return m_is_async;
+        }
+
         /** @brief Marks this logger as initialized
 
         You might log messages before the logger is initialized.
@@ -171,15 +189,26 @@ namespace hpx::util::logging {
         // called after all data has been gathered
         void write(message msg)
         {
-            if (m_is_caching_off)
-                m_writer(msg);
-            else
+            if (!m_is_caching_off)
+            {
                 m_cache.push_back(HPX_MOVE(msg));
+            }
+            else if (m_is_async)
+            {
+                message formatted = m_writer.format_message(msg);
+                if (!binary::write_async(*this, formatted))
+                    m_writer.write_formatted(formatted);
+            }
+            else
+            {
+                m_writer(msg);
+            }
         }
 
     private:
         mutable std::vector<message> m_cache;
         mutable bool m_is_caching_off = false;
+        bool m_is_async = false;
         writer::named_write m_writer;
         level m_level;
     };
@@ -156,4 +156,14 @@ HPX_DEFINE_LOG(g_l, logger_type)
 
 #define HPX_LOG_FORMAT(NAME, LEVEL, FORMAT, ...)                               \
     HPX_LOG_USE_LOG(NAME, LEVEL).format(FORMAT, __VA_ARGS__)
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Write a binary log record, the first argument after the level is the
+    // format string (see binary_log.hpp)
+#define HPX_LOG_BINARY(NAME, LEVEL, ...)                                       \
+    if (!(HPX_PP_CAT(NAME, _logger)()->is_enabled(LEVEL)))                     \
+        ;                                                                      \
+    else                                                                       \
+        ::hpx::util::logging::binary::log(                                     \
+            *HPX_PP_CAT(NAME, _logger)(), LEVEL, __VA_ARGS__)
 }    // namespace hpx::util::logging::destination
@@ -394,14 +394,27 @@ namespace hpx::util::logging::writer {
         }
 
         void operator()(message const& msg) const
+        {
+            message formatted = format_message(msg);
+#if defined(HPX_COMPUTE_HOST_CODE)
+            write_formatted(formatted);
+#endif
+        }
+
+        /** @brief Applies the formatters to the given message
+         */
+        message format_message(message const& msg) const
         {
             std::stringstream out;
             m_format(out, msg);
+            return message(HPX_MOVE(out));
+        }
 
-#if defined(HPX_COMPUTE_HOST_CODE)
-            message formatted(HPX_MOVE(out));
-            m_destination(formatted);
-#endif
+        /** @brief Writes an already formatted message to the destinations
+         */
+        void write_formatted(message const& msg) const
+        {
+            m_destination(msg);
         }
 
         /** @brief Replaces a formatter from the named formatter.
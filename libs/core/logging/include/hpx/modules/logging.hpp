@@ -72,6 +72,11 @@ namespace hpx {
 #define LAS_(lvl) LHPX_(lvl, "  [AS] ")  /* addressing service */
 #define LBT_(lvl) LHPX_(lvl, "  [BT] ")  /* bootstrap */
 
+// binary logging, those take a format string and its arguments
+#define LTM_BIN_(lvl, ...) LHPX_BIN_(lvl, "  [TM] ", __VA_ARGS__)
+#define LRT_BIN_(lvl, ...) LHPX_BIN_(lvl, "  [RT] ", __VA_ARGS__)
+#define LLCO_BIN_(lvl, ...) LHPX_BIN_(lvl, " [LCO] ", __VA_ARGS__)
+
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::util {
 
@@ -91,6 +96,10 @@ namespace hpx::util {
     HPX_LOG_FORMAT(hpx::util::agas, ::hpx::util::logging::level::lvl, "{} ",   \
         ::hpx::util::logging::level::lvl) /**/
 
+#define LAGAS_BIN_(lvl, ...)                                                   \
+    HPX_LOG_BINARY(                                                            \
+        hpx::util::agas, ::hpx::util::logging::level::lvl, __VA_ARGS__) /**/
+
 #define LAGAS_ENABLED(lvl)                                                     \
     hpx::util::agas_logger()->is_enabled(::hpx::util::logging::level::lvl) /**/
 
@@ -101,6 +110,10 @@ namespace hpx::util {
     HPX_LOG_FORMAT(hpx::util::parcel, ::hpx::util::logging::level::lvl, "{} ", \
         ::hpx::util::logging::level::lvl) /**/
 
+#define LPT_BIN_(lvl, ...)                                                     \
+    HPX_LOG_BINARY(                                                            \
+        hpx::util::parcel, ::hpx::util::logging::level::lvl, __VA_ARGS__) /**/
+
 #define LPT_ENABLED(lvl)                                                       \
     hpx::util::parcel_logger()->is_enabled(                                    \
         ::hpx::util::logging::level::lvl) /**/
@@ -126,6 +139,11 @@ namespace hpx::util {
     HPX_LOG_FORMAT(hpx::util::hpx, ::hpx::util::logging::level::lvl, "{}{}",   \
         ::hpx::util::logging::level::lvl, (cat)) /**/
 
+// the category has to be a string literal
+#define LHPX_BIN_(lvl, cat, ...)                                               \
+    HPX_LOG_BINARY(                                                            \
+        hpx::util::hpx, ::hpx::util::logging::level::lvl, cat __VA_ARGS__) /**/
+
 #define LHPX_ENABLED(lvl)                                                      \
     hpx::util::hpx_logger()->is_enabled(::hpx::util::logging::level::lvl) /**/
 
@@ -265,6 +283,13 @@ namespace hpx ::util {
     #define LAS_(lvl)             if(true) {} else hpx::util::detail::dummy_log
     #define LBT_(lvl)             if(true) {} else hpx::util::detail::dummy_log
 
+    #define LAGAS_BIN_(lvl, ...)      if(true) {} else hpx::util::detail::dummy_log.format(__VA_ARGS__)
+    #define LPT_BIN_(lvl, ...)        if(true) {} else hpx::util::detail::dummy_log.format(__VA_ARGS__)
+    #define LHPX_BIN_(lvl, cat, ...)  if(true) {} else hpx::util::detail::dummy_log.format(__VA_ARGS__)
+    #define LTM_BIN_(lvl, ...)        if(true) {} else hpx::util::detail::dummy_log.format(__VA_ARGS__)
+    #define LRT_BIN_(lvl, ...)        if(true) {} else hpx::util::detail::dummy_log.format(__VA_ARGS__)
+    #define LLCO_BIN_(lvl, ...)       if(true) {} else hpx::util::detail::dummy_log.format(__VA_ARGS__)
+
     #define LFATAL_               if(true) {} else hpx::util::detail::dummy_log
 
     #define LAGAS_CONSOLE_(lvl)   if(true) {} else hpx::util::detail::dummy_log
@@ -0,0 +1,528 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOGGING)
+#include <hpx/assert.hpp>
+#include <hpx/logging/binary_log.hpp>
+#include <hpx/logging/detail/logger.hpp>
+#include <hpx/logging/message.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx::util::logging::binary {
+
+    namespace {
+
+        // avoid false sharing between the producer and the consumer
+        constexpr std::size_t cache_line_size = 64;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Bounded lock-free ring buffer with a single producer (the owning
+        // thread) and a single consumer (the thread processing the records).
+        class ring_buffer
+        {
+        public:
+            explicit ring_buffer(std::size_t capacity)
+              : records_(new record[capacity])
+              , mask_(capacity - 1)
+            {
+                HPX_ASSERT((capacity & mask_) == 0);
+            }
+
+            // called by the producer only
+            bool full() noexcept
+            {
+                std::size_t const tail = tail_.load(std::memory_order_relaxed);
+                if (tail - head_cache_ <= mask_)
+                {
+                    return false;
+                }
+                head_cache_ = head_.load(std::memory_order_acquire);
+                return tail - head_cache_ > mask_;
+            }
+
+            bool push(record const& r) noexcept
+            {
+                if (full())
+                {
+                    return false;
+                }
+
+                std::size_t const tail = tail_.load(std::memory_order_relaxed);
+                records_[tail & mask_] = r;
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            // called by the producer only, marks a push which is in progress
+            // while the records may be drained for the last time
+            void begin_push() noexcept
+            {
+                in_flight_.store(true, std::memory_order_seq_cst);
+            }
+
+            void end_push() noexcept
+            {
+                in_flight_.store(false, std::memory_order_release);
+            }
+
+            bool in_flight() const noexcept
+            {
+                return in_flight_.load(std::memory_order_seq_cst);
+            }
+
+            // called by the consumer only
+            template <typename F>
+            void pop_all(F&& f)
+            {
+                std::size_t head = head_.load(std::memory_order_relaxed);
+                std::size_t const tail = tail_.load(std::memory_order_acquire);
+                for (/**/; head != tail; ++head)
+                {
+                    f(records_[head & mask_]);
+                }
+                head_.store(head, std::memory_order_release);
+            }
+
+        private:
+            std::unique_ptr<record[]> records_;
+            std::size_t mask_;
+
+            alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+            alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+            std::size_t head_cache_ = 0;    // producer's view of head_
+            std::atomic<bool> in_flight_{false};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_arguments(std::ostream& os, record const& r)
+        {
+            std::size_t arg = 0;
+            for (char const* p = r.format; *p != '\0'; ++p)
+            {
+                if ((p[0] == '{' && p[1] == '{') ||
+                    (p[0] == '}' && p[1] == '}'))
+                {
+                    os << *p++;
+                    continue;
+                }
+
+                if (*p != '{')
+                {
+                    os << *p;
+                    continue;
+                }
+
+                // skip format specification, if any
+                while (p[1] != '\0' && p[1] != '}')
+                    ++p;
+                if (p[1] == '}')
+                    ++p;
+
+                if (arg == r.num_arguments)
+                {
+                    os << "{?}";
+                    continue;
+                }
+
+                argument const& a = r.arguments[arg++];
+                switch (a.type)
+                {
+                case argument_type::signed_integer:
+                    os << a.i;
+                    break;
+                case argument_type::unsigned_integer:
+                    os << a.u;
+                    break;
+                case argument_type::floating_point:
+                    os << a.d;
+                    break;
+                case argument_type::pointer:
+                    os << a.p;
+                    break;
+                case argument_type::string:
+                    os << (a.s != nullptr ? a.s : "(null)");
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        void process(record const& r)
+        {
+            writer::named_write const& w = r.log->writer();
+            if (r.msg != nullptr)
+            {
+                std::unique_ptr<message> msg(r.msg);
+                w.write_formatted(*msg);
+                return;
+            }
+
+            std::stringstream out;
+            util::format_to(out, "({:08x}) {:016x} ", r.thread, r.timestamp);
+            format_value(out, "", r.lvl);
+            out << ' ';
+            write_arguments(out, r);
+            out << '\n';
+
+            w.write_formatted(message(HPX_MOVE(out)));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct registry
+        {
+            ring_buffer* acquire()
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                if (!unused.empty())
+                {
+                    ring_buffer* ring = unused.back();
+                    unused.pop_back();
+                    return ring;
+                }
+
+                rings.push_back(std::make_unique<ring_buffer>(capacity));
+                return rings.back().get();
+            }
+
+            void release(ring_buffer* ring)
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                unused.push_back(ring);
+            }
+
+            // process all records written so far, returns the number of
+            // processed records
+            std::size_t drain()
+            {
+                std::lock_guard<std::mutex> pl(process_mtx);
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    for (auto& ring : rings)
+                    {
+                        ring->pop_all(
+                            [&](record const& r) { pending.push_back(r); });
+                    }
+                }
+
+                // records of different threads are processed in time order
+                std::stable_sort(pending.begin(), pending.end(),
+                    [](record const& lhs, record const& rhs) {
+                        return lhs.timestamp < rhs.timestamp;
+                    });
+
+                for (record const& r : pending)
+                {
+                    try
+                    {
+                        process(r);
+                    }
+                    catch (...)
+                    {
+                        // errors of the destinations are ignored
+                    }
+                }
+
+                std::size_t const count = pending.size();
+                pending.clear();
+                return count;
+            }
+
+            // wait for the records which are being pushed right now, the
+            // running flag has to be reset before
+            void wait_for_producers()
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                for (auto& ring : rings)
+                {
+                    while (ring->in_flight())
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            void run()
+            {
+                while (running.load(std::memory_order_acquire))
+                {
+                    if (drain() == 0)
+                    {
+                        std::this_thread::sleep_for(
+                            std::chrono::milliseconds(1));
+                    }
+                }
+            }
+
+            std::mutex mtx;    // protects rings and unused
+            std::vector<std::unique_ptr<ring_buffer>> rings;
+            std::vector<ring_buffer*> unused;
+            std::size_t capacity = 4096;
+
+            std::mutex process_mtx;    // serializes processing
+            std::vector<record> pending;
+
+            std::mutex worker_mtx;    // serializes start and stop
+            std::thread worker;
+            std::atomic<bool> running{false};
+
+            std::atomic<std::uint64_t> dropped{0};
+            std::atomic<std::uint32_t> next_thread_num{0};
+        };
+
+        registry& get_registry()
+        {
+            // intentionally leaked, records may be written during static
+            // destruction
+            static registry* r = new registry;
+            return *r;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct thread_data
+        {
+            ~thread_data();
+
+            ring_buffer* ring = nullptr;
+            std::uint32_t thread_num = get_registry().next_thread_num++;
+        };
+
+        thread_local bool thread_data_destroyed = false;
+        thread_local thread_data thread_data_;
+
+        thread_data::~thread_data()
+        {
+            thread_data_destroyed = true;
+            if (ring != nullptr)
+            {
+                get_registry().release(ring);
+                ring = nullptr;
+            }
+        }
+
+        // returns nullptr if the calling thread is exiting
+        thread_data* get_thread_data()
+        {
+            if (thread_data_destroyed)
+            {
+                return nullptr;
+            }
+            return &thread_data_;
+        }
+
+        ring_buffer* get_ring(thread_data& data)
+        {
+            if (data.ring == nullptr)
+            {
+                data.ring = get_registry().acquire();
+            }
+            return data.ring;
+        }
+
+        // Records may be pushed only while the background thread is running,
+        // records pushed after stop() has drained the ring buffers would be
+        // lost. stop() resets the running flag first and then waits for all
+        // ring buffers being pushed to by producers which might not have seen
+        // that yet. The flag marking a push in progress is owned by the ring
+        // buffer of the producer, producers don't contend on shared state.
+        class producer_scope
+        {
+        public:
+            explicit producer_scope(ring_buffer& ring) noexcept
+              : ring_(ring)
+            {
+                ring_.begin_push();
+                active_ =
+                    get_registry().running.load(std::memory_order_seq_cst);
+            }
+
+            ~producer_scope()
+            {
+                ring_.end_push();
+            }
+
+            producer_scope(producer_scope const&) = delete;
+            producer_scope& operator=(producer_scope const&) = delete;
+
+            // returns whether records may be pushed
+            bool active() const noexcept
+            {
+                return active_;
+            }
+
+        private:
+            ring_buffer& ring_;
+            bool active_;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void write(logger& l, level lvl, char const* format,
+            argument const* args, std::size_t num_args) noexcept
+        {
+            record r;
+            r.timestamp = hpx::chrono::high_resolution_clock::now();
+            r.log = &l;
+            r.format = format;
+            r.msg = nullptr;
+            r.thread = std::uint32_t(-1);
+            r.lvl = lvl;
+            r.num_arguments = static_cast<std::uint32_t>(num_args);
+            std::copy(args, args + num_args, r.arguments);
+
+            thread_data* data = get_thread_data();
+            if (data != nullptr)
+            {
+                r.thread = data->thread_num;
+
+                // the ring buffer is created only once the background thread
+                // is running, it then has the configured capacity
+                if (is_running())
+                {
+                    ring_buffer* ring = get_ring(*data);
+                    producer_scope producer(*ring);
+                    if (producer.active())
+                    {
+                        if (!ring->push(r))
+                        {
+                            ++get_registry().dropped;
+                        }
+                        return;
+                    }
+                }
+            }
+
+            // no background processing, write the record directly
+            try
+            {
+                process(r);
+            }
+            catch (...)
+            {
+                // errors of the destinations are ignored
+            }
+        }
+    }    // namespace detail
+
+    bool write_async(logger& l, message& msg) noexcept
+    {
+        thread_data* data = get_thread_data();
+        if (data == nullptr || !is_running())
+        {
+            return false;
+        }
+
+        ring_buffer* ring = get_ring(*data);
+        producer_scope producer(*ring);
+        if (!producer.active() || ring->full())
+        {
+            return false;
+        }
+
+        record r;
+        r.timestamp = hpx::chrono::high_resolution_clock::now();
+        r.log = &l;
+        r.format = nullptr;
+        r.thread = data->thread_num;
+        r.num_arguments = 0;
+        try
+        {
+            r.msg = new message(HPX_MOVE(msg));
+        }
+        catch (...)
+        {
+            return false;
+        }
+
+        // this can't fail as the ring was not full and we are its only
+        // producer
+        ring->push(r);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void start(std::size_t capacity)
+    {
+        registry& reg = get_registry();
+
+        std::lock_guard<std::mutex> l(reg.worker_mtx);
+        if (reg.running.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // round up the capacity to the next power of two
+        std::size_t cap = 1;
+        while (cap < capacity)
+            cap <<= 1;
+
+        {
+            std::lock_guard<std::mutex> ll(reg.mtx);
+            reg.capacity = cap;
+        }
+
+        // make sure all records are processed before the loggers are
+        // destroyed
+        static bool registered = (std::atexit([] { stop(); }), true);
+        (void) registered;
+
+        reg.running.store(true, std::memory_order_release);
+        reg.worker = std::thread([&reg] { reg.run(); });
+    }
+
+    void stop()
+    {
+        registry& reg = get_registry();
+        {
+            std::lock_guard<std::mutex> l(reg.worker_mtx);
+            if (!reg.running.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            reg.running.store(false, std::memory_order_seq_cst);
+            reg.worker.join();
+            reg.wait_for_producers();
+        }
+        reg.drain();
+    }
+
+    bool is_running() noexcept
+    {
+        return get_registry().running.load(std::memory_order_acquire);
+    }
+
+    void flush()
+    {
+        get_registry().drain();
+    }
+
+    std::uint64_t dropped_records(bool reset) noexcept
+    {
+        registry& reg = get_registry();
+        return reset ? reg.dropped.exchange(0) : reg.dropped.load();
+    }
+}    // namespace hpx::util::logging::binary
+
+#endif    // HPX_HAVE_LOGGING
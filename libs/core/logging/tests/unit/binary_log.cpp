@@ -0,0 +1,343 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(HPX_HAVE_LOGGING)
+#include <hpx/logging/binary_log.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace logging = hpx::util::logging;
+namespace binary = hpx::util::logging::binary;
+
+///////////////////////////////////////////////////////////////////////////////
+// collects all messages written to a logger
+struct sink
+{
+    void add(std::string const& msg)
+    {
+        std::unique_lock<std::mutex> l(mtx);
+        messages.push_back(msg);
+        cond.notify_all();
+
+        // stall the thread writing the message if requested
+        cond.wait(l, [&] { return !blocked; });
+    }
+
+    std::vector<std::string> get()
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        return messages;
+    }
+
+    std::size_t size()
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        return messages.size();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        messages.clear();
+    }
+
+    void block()
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        blocked = true;
+    }
+
+    void unblock()
+    {
+        std::lock_guard<std::mutex> l(mtx);
+        blocked = false;
+        cond.notify_all();
+    }
+
+    // wait for the given number of messages
+    void wait(std::size_t count)
+    {
+        std::unique_lock<std::mutex> l(mtx);
+        cond.wait(l, [&] { return messages.size() >= count; });
+    }
+
+    std::mutex mtx;
+    std::condition_variable cond;
+    std::vector<std::string> messages;
+    bool blocked = false;
+};
+
+struct capture : logging::destination::manipulator
+{
+    explicit capture(sink& s)
+      : s_(&s)
+    {
+    }
+
+    void operator()(logging::message const& msg) override
+    {
+        s_->add(msg.full_string());
+    }
+
+    sink* s_;
+};
+
+sink messages;
+logging::logger test_logger;
+
+// strip the thread number and the time stamp of a formatted record
+std::string strip_header(std::string const& msg)
+{
+    // "(%08x) %016x "
+    std::size_t const header = 1 + 8 + 2 + 16 + 1;
+    HPX_TEST_LT(header, msg.size());
+    HPX_TEST_EQ(msg[0], '(');
+    HPX_TEST_EQ(msg[9], ')');
+    return msg.substr(header);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+enum class color
+{
+    red = 1,
+    green = 2
+};
+
+void test_format()
+{
+    HPX_TEST(!binary::is_running());
+    messages.clear();
+
+    // without the background thread records are written right away
+    binary::log(test_logger, logging::level::info,
+        "int {} uint {} double {} enum {} bool {} string {}", -7,
+        std::uint16_t(42), 2.5, color::green, true, "text");
+    binary::log(test_logger, logging::level::error,
+        "{{escaped}} {:x} spec ignored, missing {}", 255);
+    binary::log(test_logger, logging::level::debug, "no arguments");
+
+    std::vector<std::string> msgs = messages.get();
+    HPX_TEST_EQ(msgs.size(), std::size_t(3));
+    HPX_TEST_EQ(strip_header(msgs[0]),
+        std::string("    <info> int -7 uint 42 double 2.5 enum 2 bool 1 "
+                    "string text\n"));
+    HPX_TEST_EQ(strip_header(msgs[1]),
+        std::string("   <error> {escaped} 255 spec ignored, missing {?}\n"));
+    HPX_TEST_EQ(
+        strip_header(msgs[2]), std::string("   <debug> no arguments\n"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_dropped_records()
+{
+    messages.clear();
+    binary::dropped_records(true);
+
+    // this is the first record written by this thread through the
+    // background thread, so this thread's ring buffer is created with the
+    // given capacity
+    std::size_t const capacity = 16;
+    binary::start(capacity);
+
+    // stall the background thread while it writes the first record, the
+    // ring buffer has been emptied at that point
+    messages.block();
+    binary::log(test_logger, logging::level::info, "first");
+    messages.wait(1);
+
+    std::size_t const excess = 10;
+    for (std::size_t i = 0; i != capacity + excess; ++i)
+    {
+        binary::log(test_logger, logging::level::info, "record {}", i);
+    }
+    HPX_TEST_EQ(binary::dropped_records(false), std::uint64_t(excess));
+
+    messages.unblock();
+    binary::stop();
+
+    HPX_TEST_EQ(messages.size(), capacity + 1);
+    HPX_TEST_EQ(binary::dropped_records(true), std::uint64_t(excess));
+    HPX_TEST_EQ(binary::dropped_records(false), std::uint64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_ordering()
+{
+    messages.clear();
+    binary::dropped_records(true);
+
+    // the producer threads are new, their ring buffers are large enough
+    binary::start(4096);
+
+    std::size_t const num_threads = 4;
+    std::size_t const num_records = 1000;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([t] {
+            for (std::size_t i = 0; i != num_records; ++i)
+            {
+                binary::log(test_logger, logging::level::info,
+                    "producer {} record {}", t, i);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    binary::stop();
+    HPX_TEST_EQ(binary::dropped_records(true), std::uint64_t(0));
+
+    // the records of each producer are written in order
+    std::vector<std::size_t> next(num_threads, 0);
+    for (std::string const& msg : messages.get())
+    {
+        std::istringstream in(strip_header(msg));
+        std::string lvl, producer, record;
+        std::size_t t = 0, i = 0;
+        in >> lvl >> producer >> t >> record >> i;
+        HPX_TEST(!in.fail());
+        HPX_TEST_LT(t, num_threads);
+        if (t < num_threads)
+        {
+            HPX_TEST_EQ(i, next[t]);
+            next[t] = i + 1;
+        }
+    }
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        HPX_TEST_EQ(next[t], num_records);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_start_stop()
+{
+    messages.clear();
+
+    // records written before starting the background thread are written
+    // right away
+    binary::log(test_logger, logging::level::info, "before start");
+    HPX_TEST_EQ(messages.size(), std::size_t(1));
+
+    // stop writes all outstanding records
+    binary::start();
+    HPX_TEST(binary::is_running());
+
+    // the ring buffer of this thread is small (see test_dropped_records)
+    std::size_t const count = 100;
+    std::thread([&] {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            binary::log(test_logger, logging::level::info, "record {}", i);
+        }
+
+        logging::message msg;
+        msg << "asynchronous message\n";
+        HPX_TEST(binary::write_async(test_logger, msg));
+    }).join();
+
+    binary::stop();
+    HPX_TEST(!binary::is_running());
+
+    std::vector<std::string> msgs = messages.get();
+    HPX_TEST_EQ(msgs.size(), count + 2);
+    HPX_TEST_EQ(msgs.back(), std::string("asynchronous message\n"));
+
+    // stopping twice is fine
+    binary::stop();
+
+    // records written after stopping are written right away
+    binary::log(test_logger, logging::level::info, "after stop");
+    HPX_TEST_EQ(messages.size(), count + 3);
+
+    logging::message after;
+    after << "not accepted";
+    HPX_TEST(!binary::write_async(test_logger, after));
+    HPX_TEST_EQ(after.full_string(), std::string("not accepted"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// no record may be lost while the background thread is stopped concurrently
+void test_concurrent_stop()
+{
+    std::size_t const num_threads = 4;
+
+    for (int round = 0; round != 50; ++round)
+    {
+        messages.clear();
+        binary::dropped_records(true);
+
+        std::atomic<bool> done(false);
+        std::atomic<std::uint64_t> written(0);
+
+        binary::start();
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t != num_threads; ++t)
+        {
+            threads.emplace_back([&] {
+                while (!done.load())
+                {
+                    binary::log(test_logger, logging::level::info, "record");
+                    ++written;
+                }
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        binary::stop();
+
+        done = true;
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        // records written after stop() are written right away
+        HPX_TEST_EQ(messages.size() + binary::dropped_records(true),
+            written.load());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_logger.writer().set_destination("capture", capture(messages));
+    test_logger.writer().destination("capture");
+    test_logger.mark_as_initialized();
+
+    test_format();
+    test_dropped_records();
+    test_ordering();
+    test_start_stop();
+    test_concurrent_stop();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
@@ -110,9 +110,19 @@ namespace hpx::util {
         bool enable_spinlock_deadlock_detection() const;
         std::size_t get_spinlock_deadlock_detection_limit() const;
 
+        // Run leaf tasks (chunks of parallel algorithms, continuations) on
+        // stackless threads
+        bool use_stackless_leaf_tasks() const;
+
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // settings of the coroutine stack arena
+        bool use_stack_arena() const;
+        std::ptrdiff_t get_stack_arena_region_size() const;
+        int get_stack_arena_huge_pages() const;
+        bool use_stack_arena_prefault() const;
 #endif
 
         // return trace_depth for stack-backtraces
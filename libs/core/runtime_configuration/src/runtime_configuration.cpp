@@ -211,9 +211,14 @@ namespace hpx { namespace util {
                 HPX_PP_EXPAND(HPX_LARGE_STACK_SIZE)) "}",
             "huge_size = ${HPX_HUGE_STACK_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_HUGE_STACK_SIZE)) "}",
+            "stackless_leaf_tasks = ${HPX_STACKLESS_LEAF_TASKS:0}",
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_arena = ${HPX_USE_STACK_ARENA:0}",
+            "arena_region_size = ${HPX_STACK_ARENA_REGION_SIZE:0x1000000}",
+            "arena_huge_pages = ${HPX_STACK_ARENA_HUGE_PAGES:0}",
+            "arena_prefault = ${HPX_STACK_ARENA_PREFAULT:1}",
 #endif
 
             "[hpx.threadpools]",
@@ -257,6 +262,38 @@ namespace hpx { namespace util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "hierarchical_stealing = "
+            "${HPX_THREAD_QUEUE_HIERARCHICAL_STEALING:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_HIERARCHICAL_STEALING)) "}",
+            "max_steal_batch_size = "
+            "${HPX_THREAD_QUEUE_MAX_STEAL_BATCH_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_STEAL_BATCH_SIZE)) "}",
+            "core_group_size = "
+            "${HPX_THREAD_QUEUE_CORE_GROUP_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_CORE_GROUP_SIZE)) "}",
+            "min_tasks_to_steal_numa = "
+            "${HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA)) "}",
+
+            // task tracing (see hpx/threading_base/thread_tracing.hpp)
+            "[hpx.trace]",
+            "enabled = ${HPX_TRACE:0}",
+            "destination = ${HPX_TRACE_DESTINATION:hpx_trace.%locality%.json}",
+            "buffer_size = ${HPX_TRACE_BUFFER_SIZE:1048576}",
+
+            // sampling profiler (see hpx/threading_base/thread_sampling.hpp)
+            "[hpx.sampling]",
+            "enabled = ${HPX_SAMPLING:0}",
+            "destination = "
+            "${HPX_SAMPLING_DESTINATION:hpx_samples.%locality%.folded}",
+            "interval = ${HPX_SAMPLING_INTERVAL:1000}",
+            "stacks = ${HPX_SAMPLING_STACKS:0}",
+            "max_entries = ${HPX_SAMPLING_MAX_ENTRIES:4096}",
+
+            // learned chunk sizes (see
+            // hpx/execution/executors/learning_chunk_size.hpp)
+            "[hpx.chunk_size_tuning]",
+            "file = ${HPX_CHUNK_SIZE_TUNING_FILE:}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -376,6 +413,8 @@ namespace hpx { namespace util {
             // general logging
             "[hpx.logging]",
             "level = ${HPX_LOGLEVEL:0}",
+            "async = ${HPX_LOGASYNC:0}",
+            "async_buffer_size = ${HPX_LOGASYNC_BUFFER_SIZE:4096}",
             "destination = ${HPX_LOGDESTINATION:console}",
             "format = ${HPX_LOGFORMAT:" HPX_LOGFORMAT
                 "P%parentloc%/%hpxparent%.%hpxparentphase% %time%("
@@ -1100,8 +1139,55 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_arena() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_arena", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    std::ptrdiff_t runtime_configuration::get_stack_arena_region_size() const
+    {
+        return init_stack_size("arena_region_size", "0x1000000", 0x1000000);
+    }
+
+    int runtime_configuration::get_stack_arena_huge_pages() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "arena_huge_pages", 0);
+        }
+        return 0;    // default is to use regular pages
+    }
+
+    bool runtime_configuration::use_stack_arena_prefault() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "arena_prefault", 1) !=
+                0;
+        }
+        return true;    // default is true
+    }
 #endif
 
+    bool runtime_configuration::use_stackless_leaf_tasks() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "stackless_leaf_tasks", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
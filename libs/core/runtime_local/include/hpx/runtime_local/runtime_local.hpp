@@ -396,6 +396,20 @@ namespace hpx {
         void init_global_data();
         void deinit_global_data();
 
+        // start recording the task trace if enabled by the configuration,
+        // write the recorded trace of this locality
+        void init_tracing();
+        void deinit_tracing();
+
+        // start taking samples if enabled by the configuration, write the
+        // samples of this locality
+        void init_sampling();
+        void deinit_sampling();
+
+        // load and save the learned chunk sizes if a file is configured
+        void init_chunk_size_tuning();
+        void deinit_chunk_size_tuning();
+
         threads::thread_result_type run_helper(
             hpx::function<runtime::hpx_main_function_type> const& func,
             int& result, bool call_startup_functions);
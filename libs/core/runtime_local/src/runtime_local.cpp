@@ -12,6 +12,7 @@
 #include <hpx/coroutines/coroutine.hpp>
 #include <hpx/coroutines/signal_handler_debugging.hpp>
 #include <hpx/debugging/backtrace.hpp>
+#include <hpx/execution/executors/learning_chunk_size.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/function.hpp>
@@ -34,9 +35,12 @@
 #include <hpx/thread_support/set_thread_name.hpp>
 #include <hpx/threading_base/external_timer.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/thread_sampling.hpp>
+#include <hpx/threading_base/thread_tracing.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/from_string.hpp>
+#include <hpx/util/get_entry_as.hpp>
 #include <hpx/version.hpp>
 
 #include <atomic>
@@ -329,6 +333,9 @@ namespace hpx {
 
         init_global_data();
         util::reinit_construct();
+        init_tracing();
+        init_sampling();
+        init_chunk_size_tuning();
 
         if (initialize)
         {
@@ -364,6 +371,9 @@ namespace hpx {
     {
         init_global_data();
         util::reinit_construct();
+        init_tracing();
+        init_sampling();
+        init_chunk_size_tuning();
 
         LPROGRESS_;
     }
@@ -539,6 +549,14 @@ namespace hpx {
             static std::uint64_t uptime = 0;
             return uptime;
         }
+
+        // the files written at shutdown are named after the locality
+        std::uint32_t get_locality_id_or_zero(runtime const& rt)
+        {
+            error_code ec(throwmode::lightweight);
+            std::uint32_t const locality_id = rt.get_locality_id(ec);
+            return ec ? 0 : locality_id;
+        }
     }    // namespace
 
     void runtime::init_global_data()
@@ -559,6 +577,133 @@ namespace hpx {
         runtime_ = nullptr;
     }
 
+    void runtime::init_tracing()
+    {
+        if (util::get_entry_as<int>(rtcfg_, "hpx.trace.enabled", 0) != 0)
+        {
+            threads::tracing::enable(util::get_entry_as<std::size_t>(
+                rtcfg_, "hpx.trace.buffer_size", 1048576));
+        }
+    }
+
+    void runtime::deinit_tracing()
+    {
+        if (!threads::tracing::is_enabled())
+        {
+            return;
+        }
+
+        threads::tracing::disable();
+
+        try
+        {
+            threads::tracing::dump(rtcfg_.get_entry("hpx.trace.destination",
+                                       "hpx_trace.%locality%.json"),
+                get_locality_id_or_zero(*this));
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << "hpx::runtime::stop: could not write the task trace: "
+                      << e.what() << "\n";
+        }
+    }
+
+    void runtime::init_sampling()
+    {
+        if (util::get_entry_as<int>(rtcfg_, "hpx.sampling.enabled", 0) != 0)
+        {
+            if (!threads::sampling::is_supported())
+            {
+                std::cerr << "hpx::runtime: sampling HPX threads is not "
+                             "supported on this platform\n";
+                return;
+            }
+
+            threads::sampling::enable(
+                util::get_entry_as<std::uint64_t>(
+                    rtcfg_, "hpx.sampling.interval", 1000),
+                util::get_entry_as<int>(rtcfg_, "hpx.sampling.stacks", 0) != 0,
+                util::get_entry_as<std::size_t>(
+                    rtcfg_, "hpx.sampling.max_entries", 4096));
+        }
+    }
+
+    void runtime::deinit_sampling()
+    {
+        if (!threads::sampling::is_enabled())
+        {
+            return;
+        }
+
+        // the signal handler records raw addresses only, they are
+        // symbolized while writing the samples
+        threads::sampling::disable();
+
+        try
+        {
+            threads::sampling::dump(
+                rtcfg_.get_entry("hpx.sampling.destination",
+                    "hpx_samples.%locality%.folded"),
+                get_locality_id_or_zero(*this));
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << "hpx::runtime::stop: could not write the samples: "
+                      << e.what() << "\n";
+        }
+    }
+
+    void runtime::init_chunk_size_tuning()
+    {
+        std::string const filename =
+            rtcfg_.get_entry("hpx.chunk_size_tuning.file", "");
+        if (filename.empty())
+        {
+            return;
+        }
+
+        try
+        {
+            // the file doesn't exist before the first run
+            execution::experimental::load_chunk_size_tuning(filename);
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << "hpx::runtime: could not load the chunk size tuning "
+                         "file: "
+                      << e.what() << "\n";
+        }
+    }
+
+    void runtime::deinit_chunk_size_tuning()
+    {
+        std::string const filename =
+            rtcfg_.get_entry("hpx.chunk_size_tuning.file", "");
+        if (filename.empty())
+        {
+            return;
+        }
+
+        // all localities load the same file, only the first one writes it
+        error_code ec(throwmode::lightweight);
+        std::uint32_t const locality_id = get_locality_id(ec);
+        if (!ec && locality_id != 0)
+        {
+            return;
+        }
+
+        try
+        {
+            execution::experimental::save_chunk_size_tuning(filename);
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << "hpx::runtime::stop: could not write the chunk size "
+                         "tuning file: "
+                      << e.what() << "\n";
+        }
+    }
+
     std::uint64_t runtime::get_system_uptime()
     {
         std::int64_t diff =
@@ -1612,6 +1757,12 @@ namespace hpx {
             io_pool_.clear();
         }
 #endif
+
+        // all worker threads have exited, write the task trace and the
+        // samples
+        deinit_tracing();
+        deinit_sampling();
+        deinit_chunk_size_tuning();
     }
 
     // Second step in termination: shut down all services.
@@ -1863,6 +2014,12 @@ namespace hpx {
             util::external_timer::register_thread(name);
 #endif
 
+        // worker threads are sampled if the sampling profiler is enabled
+        if (type == runtime_local::os_thread_type::worker_thread)
+        {
+            threads::sampling::register_thread();
+        }
+
         // call thread-specific user-supplied on_start handler
         if (on_start_func_)
         {
@@ -1917,6 +2074,9 @@ namespace hpx {
         // reset PAPI support
         thread_support_->unregister_thread();
 
+        // stop sampling this thread, if needed
+        threads::sampling::unregister_thread();
+
         // reset thread local storage
         detail::thread_name().clear();
     }
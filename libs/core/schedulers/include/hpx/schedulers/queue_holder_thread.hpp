@@ -113,8 +113,6 @@ namespace hpx::threads::policies {
         mutable util::cache_line_data<std::tuple<std::size_t, std::size_t>>
             rollover_counters_;
 
-        static util::internal_allocator<threads::thread_data> thread_alloc_;
-
         using task_description = thread_init_data;
 
         // -------------------------------------
@@ -562,9 +560,8 @@ namespace hpx::threads::policies {
         // ----------------------------------------------------------------
         static void deallocate(threads::thread_data* p) noexcept
         {
-            using threads::thread_data;
-            std::destroy_at(p);
-            thread_alloc_.deallocate(p, 1);
+            // thread_data objects know how they were allocated
+            p->destroy();
         }
 
         // ----------------------------------------------------------------
@@ -730,6 +727,43 @@ namespace hpx::threads::policies {
             return 0;
         }
 
+        // ----------------------------------------------------------------
+        // Steal a batch of up to half of the high priority tasks held by the
+        // victim. Bound tasks are never stolen.
+        std::size_t steal_half_HP(thread_holder_type* victim,
+            std::int64_t max_count, std::int64_t min_count)
+        {
+            if (owns_hp_queue() && victim->hp_queue_)
+            {
+                return hp_queue_->steal_half(
+                    victim->hp_queue_, max_count, min_count);
+            }
+            return 0;
+        }
+
+        // ----------------------------------------------------------------
+        // Steal a batch of up to half of the normal (or if there are none,
+        // low) priority tasks held by the victim.
+        std::size_t steal_half(thread_holder_type* victim,
+            std::int64_t max_count, std::int64_t min_count)
+        {
+            std::size_t stolen = 0;
+            if (owns_np_queue())
+            {
+                stolen = np_queue_->steal_half(
+                    victim->np_queue_, max_count, min_count);
+                if (stolen > 0)
+                    return stolen;
+            }
+
+            if (owns_lp_queue() && victim->lp_queue_)
+            {
+                stolen = lp_queue_->steal_half(
+                    victim->lp_queue_, max_count, min_count);
+            }
+            return stolen;
+        }
+
         // ----------------------------------------------------------------
         inline std::size_t get_queue_length()
         {
@@ -1009,8 +1043,4 @@ namespace hpx::threads::policies {
             tq_deb.timed(deb_queues, prefix, queue_data_print(this));
         }
     };
-
-    template <typename QueueType>
-    util::internal_allocator<threads::thread_data>
-        queue_holder_thread<QueueType>::thread_alloc_;
 }    // namespace hpx::threads::policies
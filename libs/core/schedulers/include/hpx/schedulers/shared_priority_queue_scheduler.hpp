@@ -27,6 +27,7 @@
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -170,6 +171,7 @@ namespace hpx::threads::policies {
           , num_domains_(1)
           , affinity_data_(init.affinity_data_)
           , queue_parameters_(init.thread_queue_init_)
+          , victims_(init.num_worker_threads_)
           , initialized_(false)
           , debug_init_(false)
           , thread_init_counter_(0)
@@ -591,6 +593,98 @@ namespace hpx::threads::policies {
             return false;
         }
 
+        // Walk the victims of the given worker in order of increasing distance
+        // and move a batch of up to half of the tasks of the first victim
+        // holding enough work to the queues of the receiver. Remote victims
+        // are only considered if NUMA stealing is enabled.
+        std::size_t steal_batch(
+            std::size_t thread_num, thread_holder_type* receiver)
+        {
+            std::int64_t const max_count =
+                queue_parameters_.max_steal_batch_size_;
+
+            for (steal_victim const& victim : victims_[thread_num])
+            {
+                if (victim.remote_ && !numa_stealing_)
+                    break;
+
+                std::int64_t const min_count = victim.remote_ ?
+                    queue_parameters_.min_tasks_to_steal_numa_ :
+                    queue_parameters_.min_tasks_to_steal_pending_;
+
+                std::size_t stolen = receiver->steal_half_HP(
+                    victim.holder_, max_count, min_count);
+                if (stolen == 0)
+                {
+                    stolen = receiver->steal_half(
+                        victim.holder_, max_count, min_count);
+                }
+
+                if (stolen != 0)
+                {
+                    spq_deb.debug(debug::str<>("steal_batch"), "thread_num",
+                        thread_num, "stolen", debug::dec<4>(stolen), "remote",
+                        victim.remote_);
+                    return stolen;
+                }
+            }
+            return 0;
+        }
+
+        // Order the potential victims of the given worker by distance: the
+        // other queues of its core group (consecutive queues on the same
+        // NUMA domain), the remaining queues of its NUMA domain, and the
+        // queues on all other NUMA domains.
+        void init_steal_victims(std::size_t local_thread)
+        {
+            std::size_t const domain = d_lookup_[local_thread];
+            std::size_t const q_index = q_lookup_[local_thread];
+            std::size_t const count = q_counts_[domain];
+
+            std::size_t group_size =
+                static_cast<std::size_t>(queue_parameters_.core_group_size_);
+            if (group_size == 0 || group_size > count)
+                group_size = count;
+
+            std::size_t const group_begin = (q_index / group_size) * group_size;
+            std::size_t const group_end =
+                (std::min)(group_begin + group_size, count);
+            std::size_t const group_count = group_end - group_begin;
+
+            std::vector<steal_victim>& victims = victims_[local_thread];
+            victims.clear();
+
+            for (std::size_t i = 1; i < group_count; ++i)
+            {
+                std::size_t const q = group_begin +
+                    fast_mod(q_index - group_begin + i, group_count);
+                victims.push_back(
+                    steal_victim{numa_holder_[domain].thread_queue(q), false});
+            }
+
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                std::size_t const q = fast_mod(q_index + i, count);
+                if (q < group_begin || q >= group_end)
+                {
+                    victims.push_back(steal_victim{
+                        numa_holder_[domain].thread_queue(q), false});
+                }
+            }
+
+            for (std::size_t d = 1; d < num_domains_; ++d)
+            {
+                std::size_t const dom = fast_mod(domain + d, num_domains_);
+                std::size_t const remote_count = q_counts_[dom];
+                for (std::size_t i = 0; i < remote_count; ++i)
+                {
+                    std::size_t const q = fast_mod(q_index + i, remote_count);
+                    victims.push_back(
+                        steal_victim{numa_holder_[dom].thread_queue(q), true});
+                }
+            }
+        }
+
         // Return the next thread to be executed, return false if none available
         virtual bool get_next_thread(std::size_t thread_num, bool running,
             threads::thread_id_ref_type& thrd, bool enable_stealing) override
@@ -625,13 +719,26 @@ namespace hpx::threads::policies {
             std::size_t domain = d_lookup_[this_thread];
             std::size_t q_index = q_lookup_[this_thread];
 
-            // first try a high priority task, allow stealing if stealing of HP
-            // tasks in on, this will be fine but send a null function for
-            // normal tasks
-            bool result = steal_by_function<threads::thread_id_ref_type>(domain,
-                q_index, numa_stealing_, core_stealing_, nullptr, thrd,
-                "SBF-get_next_thread", get_next_thread_function_HP,
-                get_next_thread_function);
+            bool result = false;
+            if (queue_parameters_.hierarchical_stealing_ && core_stealing_)
+            {
+                // only look at the local queues, batches of tasks are stolen
+                // by wait_or_add_new below
+                result = numa_holder_[domain].get_next_thread_HP(
+                             q_index, thrd, false, false) ||
+                    numa_holder_[domain].get_next_thread(
+                        q_index, thrd, false, false);
+            }
+            else
+            {
+                // first try a high priority task, allow stealing if stealing
+                // of HP tasks in on, this will be fine but send a null
+                // function for normal tasks
+                result = steal_by_function<threads::thread_id_ref_type>(domain,
+                    q_index, numa_stealing_, core_stealing_, nullptr, thrd,
+                    "SBF-get_next_thread", get_next_thread_function_HP,
+                    get_next_thread_function);
+            }
 
             if (result)
                 return result;
@@ -686,6 +793,20 @@ namespace hpx::threads::policies {
                 q_index, "numa_stealing ", numa_stealing_, "core_stealing ",
                 core_stealing_);
 
+            if (queue_parameters_.hierarchical_stealing_ && core_stealing_)
+            {
+                // convert the local staged tasks first, then steal a batch of
+                // tasks from the closest victim that has enough work
+                if (!numa_holder_[domain].add_new_HP(
+                        receiver, q_index, added, false, false) &&
+                    !numa_holder_[domain].add_new(
+                        receiver, q_index, added, false, false))
+                {
+                    added = steal_batch(this_thread, receiver);
+                }
+                return added == 0;
+            }
+
             bool added_tasks = steal_by_function<std::size_t>(domain, q_index,
                 numa_stealing_, core_stealing_, receiver, added,
                 "wait_or_add_new", add_new_function_HP, add_new_function);
@@ -1194,6 +1315,11 @@ namespace hpx::threads::policies {
                 std::this_thread::yield();
             }
 
+            if (queue_parameters_.hierarchical_stealing_)
+            {
+                init_steal_victims(local_thread);
+            }
+
             lock.lock();
             if (!debug_init_)
             {
@@ -1391,6 +1517,16 @@ namespace hpx::threads::policies {
 
         const thread_queue_init_parameters queue_parameters_;
 
+        // the queues a worker steals from if hierarchical stealing is
+        // enabled, ordered by increasing distance
+        struct steal_victim
+        {
+            thread_holder_type* holder_;
+            // the victim is located on a different NUMA domain
+            bool remote_;
+        };
+        std::vector<std::vector<steal_victim>> victims_;
+
         // used to make sure the scheduler is only initialized once on a thread
         std::mutex init_mutex;
         bool initialized_;
@@ -30,6 +30,7 @@
 #include <hpx/timing/tick_counter.hpp>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -136,6 +137,60 @@ namespace hpx::threads::policies {
             return added;
         }
 
+        // ----------------------------------------------------------------
+        // Move a batch of up to half (but at most max_count) of the pending
+        // threads of the 'stealfrom' queue to the pending queue of this
+        // queue. If no pending threads could be taken, staged tasks are
+        // converted instead. Nothing is stolen if the victim holds less than
+        // min_count tasks.
+        //
+        // This is not thread safe, only the thread owning the holder should
+        // call this function
+        std::size_t steal_half(thread_queue_type* stealfrom,
+            std::int64_t max_count, std::int64_t min_count)
+        {
+            if (stealfrom == this || max_count <= 0)
+            {
+                return 0;
+            }
+
+            std::int64_t const pending =
+                stealfrom->work_items_count_.data_.load(
+                    std::memory_order_relaxed);
+            if (pending > 0 && pending >= min_count)
+            {
+                std::int64_t count = (std::min)((pending + 1) / 2, max_count);
+
+                std::size_t stolen = 0;
+                threads::thread_id_ref_type thrd;
+                while (count-- != 0 && stealfrom->work_items_.pop(thrd, true))
+                {
+                    --stealfrom->work_items_count_.data_;
+                    schedule_work(HPX_MOVE(thrd), true);
+                    ++stolen;
+                }
+
+                if (stolen != 0)
+                {
+                    tqmc_deb.debug(debug::str<>("steal_half"), "pending",
+                        debug::dec<4>(stolen), "D",
+                        debug::dec<2>(holder_->domain_index_), "Q",
+                        debug::dec<3>(queue_index_));
+                    return stolen;
+                }
+            }
+
+            std::int64_t const staged =
+                stealfrom->new_tasks_count_.data_.load(
+                    std::memory_order_relaxed);
+            if (staged > 0 && staged >= min_count)
+            {
+                return add_new(
+                    (std::min)((staged + 1) / 2, max_count), stealfrom, true);
+            }
+            return 0;
+        }
+
     public:
         explicit thread_queue_mc(thread_queue_init_parameters const& parameters,
             std::size_t queue_num = std::size_t(-1))
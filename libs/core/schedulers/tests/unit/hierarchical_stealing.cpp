@@ -0,0 +1,83 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test exercises the hierarchical batch stealing mode of the
+// shared_priority_queue_scheduler. All tasks are created on the same worker
+// thread, other worker threads have to steal them to make progress.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci(std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+
+    hpx::future<std::uint64_t> lhs = hpx::async(&fibonacci, n - 1);
+    std::uint64_t const rhs = fibonacci(n - 2);
+    return lhs.get() + rhs;
+}
+
+void test_fork_join()
+{
+    HPX_TEST_EQ(fibonacci(20), static_cast<std::uint64_t>(6765));
+}
+
+void test_high_priority_tasks()
+{
+    constexpr std::size_t num_tasks = 1000;
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(2 * num_tasks);
+
+    hpx::threads::thread_schedule_hint const hint(
+        static_cast<std::int16_t>(hpx::get_worker_thread_num()));
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(
+            hpx::launch::async_policy(hpx::threads::thread_priority::high,
+                hpx::threads::thread_stacksize::default_, hint),
+            [&count]() { ++count; }));
+        tasks.push_back(hpx::async(
+            hpx::launch::async_policy(hpx::threads::thread_priority::normal,
+                hpx::threads::thread_stacksize::default_, hint),
+            [&count]() { ++count; }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(count.load(), 2 * num_tasks);
+}
+
+int hpx_main()
+{
+    test_fork_join();
+    test_high_priority_tasks();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.scheduler=shared-priority",
+        "hpx.thread_queue.hierarchical_stealing=1",
+        "hpx.thread_queue.max_steal_batch_size=8",
+        "hpx.thread_queue.core_group_size=2"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
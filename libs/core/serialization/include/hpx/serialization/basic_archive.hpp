@@ -43,7 +43,8 @@ namespace hpx::serialization {
         disable_data_chunking = 0x00020000,
         archive_is_saving = 0x00040000,
         archive_is_preprocessing = 0x00080000,
-        all_archive_flags = 0x000fe000    // all of the above
+        enable_zero_copy_receive = 0x00100000,
+        all_archive_flags = 0x001fe000    // all of the above
     };
 
 #if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
@@ -124,6 +125,14 @@ namespace hpx::serialization {
                 flags_ & std::uint32_t(archive_flags::disable_data_chunking));
         }
 
+        // Trivially copyable arrays are stored suitably aligned such that the
+        // receiving end can refer to them in place (see buffer_view)
+        constexpr bool enable_zero_copy_receive() const noexcept
+        {
+            return bool(flags_ &
+                std::uint32_t(archive_flags::enable_zero_copy_receive));
+        }
+
         constexpr std::uint32_t flags() const noexcept
         {
             return flags_;
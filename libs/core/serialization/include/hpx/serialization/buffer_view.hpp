@@ -0,0 +1,222 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization {
+
+    namespace detail {
+
+        template <typename T>
+        inline constexpr bool use_array_view_v =
+            std::is_trivially_copyable_v<T> &&
+            std::is_default_constructible_v<T> &&
+            (hpx::traits::is_bitwise_serializable_v<T> ||
+                !hpx::traits::is_not_bitwise_serializable_v<T>);
+
+        // Store the given array such that the receiving end can refer to it
+        // in place, if possible.
+        template <typename Archive, typename T>
+        void save_array_view(Archive& ar, T const* data, std::size_t size)
+        {
+            if constexpr (use_array_view_v<T>)
+            {
+                if (!ar.disable_array_optimization() &&
+                    !ar.endianess_differs())
+                {
+                    ar.save_binary_view(data, size * sizeof(T), alignof(T));
+                    return;
+                }
+            }
+            ar << hpx::serialization::make_array(data, size);
+        }
+
+        // Load an array stored using save_array_view. Returns a pointer
+        // referring to the array in place if that is possible (the archive
+        // buffer is kept alive by the archive's buffer owner). Otherwise the
+        // array is copied into the memory returned by allocate(size) and
+        // nullptr is returned.
+        template <typename T, typename Archive, typename Allocate>
+        T const* load_array_view(
+            Archive& ar, std::size_t size, Allocate&& allocate)
+        {
+            if constexpr (use_array_view_v<T>)
+            {
+                if (!ar.disable_array_optimization() &&
+                    !ar.endianess_differs())
+                {
+                    void const* data =
+                        ar.load_binary_view(size * sizeof(T), alignof(T));
+                    if (data != nullptr)
+                    {
+                        if (ar.get_buffer_owner() != nullptr &&
+                            reinterpret_cast<std::uintptr_t>(data) %
+                                    alignof(T) ==
+                                0)
+                        {
+                            return static_cast<T const*>(data);
+                        }
+
+                        // the data can't be referred to in place
+                        std::memcpy(allocate(size), data, size * sizeof(T));
+                        return nullptr;
+                    }
+
+                    // nothing was consumed, copy the data instead
+                    ar.load_binary_view(
+                        allocate(size), size * sizeof(T), alignof(T));
+                    return nullptr;
+                }
+            }
+
+            T* target = allocate(size);
+            ar >> hpx::serialization::make_array(target, size);
+            return nullptr;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A buffer_view is a read-only, reference counted view of a contiguous
+    // range of trivially copyable objects. If the archive it is deserialized
+    // from has zero-copy receive enabled (see
+    // archive_flags::enable_zero_copy_receive) and an owner of the archive
+    // buffer was set, the deserialized view refers to the data in place,
+    // inside the received buffer, which is kept alive for as long as the view
+    // exists. Otherwise the data is copied into newly allocated memory.
+    //
+    // A view created from existing data does not manage the lifetime of that
+    // data unless an owner is passed to the constructor, the data has to
+    // stay alive until the view has been serialized.
+    template <typename T>
+    class buffer_view
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "buffer_view can only refer to trivially copyable types");
+
+    public:
+        using value_type = T;
+        using const_iterator = T const*;
+
+        buffer_view() = default;
+
+        buffer_view(T const* data, std::size_t size,
+            std::shared_ptr<void const> owner = {}) noexcept
+          : data_(data)
+          , size_(size)
+          , owner_(HPX_MOVE(owner))
+        {
+        }
+
+        template <typename Allocator>
+        explicit buffer_view(std::vector<T, Allocator> const& v) noexcept
+          : data_(v.data())
+          , size_(v.size())
+        {
+        }
+
+        constexpr T const* data() const noexcept
+        {
+            return data_;
+        }
+
+        constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        constexpr const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+
+        constexpr const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        constexpr T const& operator[](std::size_t idx) const noexcept
+        {
+            HPX_ASSERT(idx < size_);
+            return data_[idx];
+        }
+
+        // return the object keeping the viewed data alive (if any)
+        std::shared_ptr<void const> const& owner() const noexcept
+        {
+            return owner_;
+        }
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, unsigned int const) const
+        {
+            ar << size_;    // -V128
+            if (size_ != 0)
+            {
+                detail::save_array_view(ar, data_, size_);
+            }
+        }
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned int const)
+        {
+            ar >> size_;    // -V128
+
+            data_ = nullptr;
+            owner_.reset();
+
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            T const* data = detail::load_array_view<T>(
+                ar, size_, [this](std::size_t size) {
+                    T* copy = new T[size];
+                    owner_ =
+                        std::shared_ptr<T>(copy, std::default_delete<T[]>());
+                    data_ = copy;
+                    return copy;
+                });
+
+            if (data != nullptr)
+            {
+                data_ = data;
+                owner_ = ar.get_buffer_owner();
+            }
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+        T const* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::shared_ptr<void const> owner_;
+    };
+}    // namespace hpx::serialization
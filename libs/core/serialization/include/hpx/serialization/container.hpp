@@ -15,6 +15,9 @@
 
 namespace hpx::serialization {
 
+    // maximal alignment supported for data stored using save_binary_view
+    inline constexpr std::size_t max_view_alignment = 64;
+
     struct erased_output_container
     {
         virtual ~erased_output_container() = default;
@@ -27,6 +30,12 @@ namespace hpx::serialization {
         virtual void save_binary(void const* address, std::size_t count) = 0;
         virtual std::size_t save_binary_chunk(
             void const* address, std::size_t count) = 0;
+
+        // Store the given data such that the receiving end can refer to it
+        // in place, either as a separate chunk or aligned inside the
+        // container, returns the number of bytes the container has grown
+        virtual std::size_t save_binary_view(void const* address,
+            std::size_t count, std::size_t alignment, bool allow_chunking) = 0;
         virtual void reset() = 0;
         virtual std::size_t get_num_chunks() const noexcept = 0;
         virtual void flush() = 0;
@@ -45,5 +54,15 @@ namespace hpx::serialization {
             std::size_t zero_copy_serialization_threshold) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+
+        // Return a pointer to data stored using save_binary_view, nullptr if
+        // the data can't be accessed in place (the data has not been consumed
+        // in this case)
+        virtual void const* load_binary_view(
+            std::size_t count, std::size_t alignment, bool allow_chunking) = 0;
+
+        // Copy data stored using save_binary_view to the given address
+        virtual void load_binary_view(void* address, std::size_t count,
+            std::size_t alignment, bool allow_chunking) = 0;
     };
 }    // namespace hpx::serialization
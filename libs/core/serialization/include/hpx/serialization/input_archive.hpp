@@ -278,8 +278,63 @@ namespace hpx::serialization {
             size_ += count;
         }
 
+        // Return a pointer to data stored using
+        // output_archive::save_binary_view which refers to the data in place,
+        // either inside the archive buffer or inside a received chunk. The
+        // returned pointer is valid as long as the archive buffer is alive
+        // (see set_buffer_owner). Returns nullptr, without consuming any data,
+        // if the data has to be copied using the overload below instead.
+        void const* load_binary_view(std::size_t count, std::size_t alignment)
+        {
+            if (0 == count || !enable_zero_copy_receive())
+                return nullptr;
+
+            void const* data = buffer_->load_binary_view(
+                count, alignment, !disable_data_chunking());
+            if (data != nullptr)
+            {
+                size_ += count;
+            }
+            return data;
+        }
+
+        // Copy data stored using output_archive::save_binary_view to the
+        // given address. This is equivalent to load_binary_chunk if zero-copy
+        // receive is not enabled.
+        void load_binary_view(
+            void* address, std::size_t count, std::size_t alignment)
+        {
+            if (0 == count)
+                return;
+
+            if (!enable_zero_copy_receive())
+            {
+                load_binary_chunk(address, count);
+                return;
+            }
+
+            buffer_->load_binary_view(
+                address, count, alignment, !disable_data_chunking());
+
+            size_ += count;
+        }
+
+        // Objects referring to the archive buffer in place keep a reference
+        // to its owner (if any), this allows for the buffer to outlive the
+        // archive.
+        void set_buffer_owner(std::shared_ptr<void const> owner) noexcept
+        {
+            owner_ = HPX_MOVE(owner);
+        }
+
+        std::shared_ptr<void const> const& get_buffer_owner() const noexcept
+        {
+            return owner_;
+        }
+
     private:
         std::unique_ptr<erased_input_container> buffer_;
+        std::shared_ptr<void const> owner_;
     };
 }    // namespace hpx::serialization
 
@@ -122,42 +122,12 @@ namespace hpx::serialization {
             }
             else
             {
-                std::size_t new_current = current_ + count;
-                if (new_current > access_traits::size(cont_))
-                {
-                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
-                        "input_container::load_binary",
-                        "archive data bstream is too short");
-                    return;
-                }
+                std::size_t const new_current =
+                    check_size(count, "input_container::load_binary");
 
                 access_traits::read(cont_, count, current_, address);
 
-                current_ = new_current;
-
-                if (chunks_ != nullptr)
-                {
-                    current_chunk_size_ += count;
-
-                    // make sure we switch to the next serialization_chunk if
-                    // necessary
-                    std::size_t current_chunk_size =
-                        get_chunk_size(current_chunk_);
-                    if (current_chunk_size != 0 &&
-                        current_chunk_size_ >= current_chunk_size)
-                    {
-                        // raise an error if we read past the serialization_chunk
-                        if (current_chunk_size_ > current_chunk_size)
-                        {
-                            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
-                                "input_container::load_binary",
-                                "archive data bstream structure mismatch");
-                            return;
-                        }
-                        ++current_chunk_;
-                        current_chunk_size_ = 0;
-                    }
-                }
+                advance(new_current, "input_container::load_binary");
             }
         }
 
@@ -195,6 +165,134 @@ namespace hpx::serialization {
             }
         }
 
+        void const* load_binary_view(std::size_t count, std::size_t alignment,
+            bool allow_chunking) override
+        {
+            // compressed data can't be accessed in place
+            if (filter_ != nullptr)
+            {
+                return nullptr;
+            }
+
+            if (allow_chunking && chunks_ != nullptr &&
+                count >= zero_copy_serialization_threshold_)
+            {
+                HPX_ASSERT(current_chunk_ != std::size_t(-1));
+                HPX_ASSERT(get_chunk_type(current_chunk_) ==
+                    chunk_type::chunk_type_pointer);
+
+                if (get_chunk_size(current_chunk_) != count)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "input_container::load_binary_view",
+                        "archive data bstream data chunk size mismatch");
+                    return nullptr;
+                }
+
+                // the chunk was received into a separate buffer
+                return get_chunk_data(current_chunk_++).pos_;
+            }
+
+            // the data can be referred to in place only if the container
+            // gives access to it, nothing is consumed otherwise
+            std::size_t const padding = view_padding(alignment);
+            std::size_t const new_current = check_size(
+                padding + count, "input_container::load_binary_view");
+
+            void const* data = access_traits::data(cont_, current_ + padding);
+            if (data == nullptr)
+            {
+                return nullptr;
+            }
+
+            skip_view_padding(padding);
+            advance(new_current, "input_container::load_binary_view");
+
+            return data;
+        }
+
+        void load_binary_view(void* address, std::size_t count,
+            std::size_t alignment, bool allow_chunking) override
+        {
+            // compressed data and separate chunks are stored without padding
+            if (filter_ != nullptr ||
+                (allow_chunking && count >= zero_copy_serialization_threshold_))
+            {
+                if (allow_chunking)
+                {
+                    this->input_container::load_binary_chunk(address, count);
+                }
+                else
+                {
+                    this->input_container::load_binary(address, count);
+                }
+                return;
+            }
+
+            skip_view_padding(view_padding(alignment));
+            this->input_container::load_binary(address, count);
+        }
+
+    private:
+        // number of padding bytes inserted by the sending end in front of
+        // data stored in place (see output_container::save_binary_view)
+        std::size_t view_padding(std::size_t alignment) const noexcept
+        {
+            HPX_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+            HPX_ASSERT(alignment <= max_view_alignment);
+
+            return (alignment - (current_ & (alignment - 1))) &
+                (alignment - 1);
+        }
+
+        void skip_view_padding(std::size_t padding)
+        {
+            if (padding != 0)
+            {
+                char skipped[max_view_alignment];
+                this->input_container::load_binary(skipped, padding);
+            }
+        }
+
+        std::size_t check_size(std::size_t count, char const* name) const
+        {
+            std::size_t const new_current = current_ + count;
+            if (new_current > access_traits::size(cont_))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error, name,
+                    "archive data bstream is too short");
+            }
+            return new_current;
+        }
+
+        void advance(std::size_t new_current, char const* name)
+        {
+            std::size_t const count = new_current - current_;
+            current_ = new_current;
+
+            if (chunks_ != nullptr)
+            {
+                current_chunk_size_ += count;
+
+                // make sure we switch to the next serialization_chunk if
+                // necessary
+                std::size_t current_chunk_size = get_chunk_size(current_chunk_);
+                if (current_chunk_size != 0 &&
+                    current_chunk_size_ >= current_chunk_size)
+                {
+                    // raise an error if we read past the serialization_chunk
+                    if (current_chunk_size_ > current_chunk_size)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                            name, "archive data bstream structure mismatch");
+                    }
+                    ++current_chunk_;
+                    current_chunk_size_ = 0;
+                }
+            }
+        }
+
+    public:
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -363,6 +363,26 @@ namespace hpx::serialization {
             }
         }
 
+        // Store a contiguous range of trivially copyable objects such that
+        // the receiving end can refer to it in place (see
+        // input_archive::load_binary_view). This is equivalent to
+        // save_binary_chunk if zero-copy receive is not enabled.
+        void save_binary_view(
+            void const* address, std::size_t count, std::size_t alignment)
+        {
+            if (count == 0)
+                return;
+
+            if (!enable_zero_copy_receive())
+            {
+                save_binary_chunk(address, count);
+                return;
+            }
+
+            size_ += buffer_->save_binary_view(
+                address, count, alignment, !disable_data_chunking());
+        }
+
     private:
         std::unique_ptr<erased_output_container> buffer_;
     };
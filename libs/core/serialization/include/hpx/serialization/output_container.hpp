@@ -279,6 +279,36 @@ namespace hpx::serialization {
             }
         }
 
+        std::size_t save_binary_view(void const* address, std::size_t count,
+            std::size_t alignment, bool allow_chunking) override
+        {
+            if (allow_chunking && count >= zero_copy_serialization_threshold_)
+            {
+                // the receiving end will refer to the chunk directly
+                return this->output_container::save_binary_chunk(
+                    address, count);
+            }
+
+            // align the data relative to the beginning of the container,
+            // the receiving end places the container at a suitably aligned
+            // address
+            HPX_ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0);
+            HPX_ASSERT(alignment <= max_view_alignment);
+
+            std::size_t const padding =
+                (alignment - (current_ & (alignment - 1))) & (alignment - 1);
+            if (padding != 0)
+            {
+                static constexpr char zeros[max_view_alignment] = {};
+                this->output_container::save_binary(zeros, padding);
+            }
+
+            this->output_container::save_binary(address, count);
+
+            // the container has grown by count bytes plus padding
+            return padding + count;
+        }
+
         bool is_preprocessing() const noexcept override
         {
             return access_traits::is_preprocessing();
@@ -374,6 +404,21 @@ namespace hpx::serialization {
             }
         }
 
+        std::size_t save_binary_view(void const* address, std::size_t count,
+            std::size_t /* alignment */, bool allow_chunking) override
+        {
+            // the receiving end can't refer to compressed data in place, so
+            // no padding is required
+            if (allow_chunking)
+            {
+                return this->filtered_output_container::save_binary_chunk(
+                    address, count);
+            }
+
+            this->filtered_output_container::save_binary(address, count);
+            return count;
+        }
+
     protected:
         std::size_t start_compressing_at_;
         binary_filter* filter_;
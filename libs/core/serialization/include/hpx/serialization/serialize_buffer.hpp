@@ -12,6 +12,7 @@
 #include <hpx/modules/errors.hpp>
 
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/buffer_view.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 
@@ -306,7 +307,7 @@ namespace hpx::serialization {
 
             if (size_ != 0)
             {
-                ar << hpx::serialization::make_array(data_.get(), size_);
+                detail::save_array_view(ar, data_.get(), size_);
             }
         }
 
@@ -316,14 +317,28 @@ namespace hpx::serialization {
         {
             ar >> size_ >> alloc_;    // -V128
 
-            data_.reset(alloc_.allocate(size_),
-                [alloc = this->alloc_, size = this->size_](T* p) {
-                    serialize_buffer::deleter<allocator_type>(p, alloc, size);
-                });
+            auto allocate = [this](std::size_t size) {
+                data_.reset(alloc_.allocate(size),
+                    [alloc = this->alloc_, size](T* p) {
+                        serialize_buffer::deleter<allocator_type>(
+                            p, alloc, size);
+                    });
+                return data_.get();
+            };
 
-            if (size_ != 0)
+            if (size_ == 0)
+            {
+                allocate(size_);
+                return;
+            }
+
+            T const* data = detail::load_array_view<T>(ar, size_, allocate);
+            if (data != nullptr)
             {
-                ar >> hpx::serialization::make_array(data_.get(), size_);
+                // refer to the data in place, keeping the archive buffer
+                // alive
+                data_ = buffer_type(const_cast<T*>(data),
+                    [owner = ar.get_buffer_owner()](T*) noexcept {});
             }
         }
 
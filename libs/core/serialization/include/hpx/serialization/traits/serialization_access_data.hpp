@@ -57,6 +57,13 @@ namespace hpx::traits {
             return decompressed_size;
         }
 
+        // return a pointer to the data at the given position, if available
+        static constexpr void const* data(Container const& /* cont */,
+            std::size_t /* current */) noexcept
+        {
+            return nullptr;
+        }
+
         static constexpr void reset(Container& /* cont */) noexcept {}
     };
 
@@ -148,6 +155,12 @@ namespace hpx::traits {
             }
         }
 
+        static void const* data(
+            Container const& cont, std::size_t current) noexcept
+        {
+            return &cont[current];
+        }
+
         static std::size_t init_data(Container const& cont,
             serialization::binary_filter* filter, std::size_t current,
             std::size_t decompressed_size)
@@ -0,0 +1,299 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/buffer_view.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+constexpr auto zero_copy_receive =
+    hpx::serialization::archive_flags::enable_zero_copy_receive;
+
+// a container which doesn't give access to its data in place
+struct stream_buffer
+{
+    std::vector<char> data_;
+};
+
+namespace hpx::traits {
+
+    template <>
+    struct serialization_access_data<stream_buffer>
+      : default_serialization_access_data<stream_buffer>
+    {
+        static std::size_t size(stream_buffer const& cont) noexcept
+        {
+            return cont.data_.size();
+        }
+
+        static void read(stream_buffer const& cont, std::size_t count,
+            std::size_t current, void* address) noexcept
+        {
+            std::memcpy(address, &cont.data_[current], count);
+        }
+    };
+}    // namespace hpx::traits
+
+template <typename T>
+bool is_inside(std::vector<char> const& buffer, T const* p)
+{
+    char const* c = reinterpret_cast<char const*>(p);
+    return c >= buffer.data() && c < buffer.data() + buffer.size();
+}
+
+template <typename T>
+void test_equal(
+    std::vector<T> const& v, hpx::serialization::buffer_view<T> const& view)
+{
+    HPX_TEST_EQ(v.size(), view.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(v[i], view[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// small arrays are stored aligned inside the archive buffer
+template <typename T>
+void test_in_place(std::size_t size)
+{
+    std::vector<T> v(size);
+    std::iota(v.begin(), v.end(), T(1));
+
+    auto buffer = std::make_shared<std::vector<char>>();
+    {
+        hpx::serialization::output_archive oarchive(
+            *buffer, zero_copy_receive);
+
+        // misalign the data following the flag
+        oarchive << char('a') << hpx::serialization::buffer_view<T>(v)
+                 << char('b');
+    }
+
+    hpx::serialization::buffer_view<T> view;
+    char a = 0, b = 0;
+    {
+        hpx::serialization::input_archive iarchive(*buffer);
+        iarchive.set_buffer_owner(buffer);
+        iarchive >> a >> view >> b;
+    }
+
+    HPX_TEST_EQ(a, 'a');
+    HPX_TEST_EQ(b, 'b');
+    test_equal(v, view);
+
+    if (size == 0)
+    {
+        HPX_TEST(view.empty());
+        return;
+    }
+
+    // the view refers to the data inside of the buffer and keeps it alive
+    HPX_TEST(is_inside(*buffer, view.data()));
+    HPX_TEST_EQ(
+        reinterpret_cast<std::uintptr_t>(view.data()) % alignof(T), 0ul);
+    HPX_TEST(view.owner() == buffer);
+
+    std::vector<char> const* data = buffer.get();
+    buffer.reset();
+    HPX_TEST_EQ(view.owner().get(), static_cast<void const*>(data));
+    test_equal(v, view);
+}
+
+// large arrays are sent as separate chunks and referred to in place
+void test_in_place_chunk()
+{
+    std::vector<double> v(HPX_ZERO_COPY_SERIALIZATION_THRESHOLD);
+    std::iota(v.begin(), v.end(), 1.0);
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, zero_copy_receive, &chunks);
+        oarchive << hpx::serialization::buffer_view<double>(v) << 42;
+        oarchive.flush();
+        size = oarchive.bytes_written();
+    }
+
+    HPX_TEST_LT(std::size_t(1), chunks.size());
+
+    hpx::serialization::buffer_view<double> view;
+    int i = 0;
+    {
+        hpx::serialization::input_archive iarchive(buffer, size, &chunks);
+        iarchive.set_buffer_owner(std::make_shared<int>(0));
+        iarchive >> view >> i;
+    }
+
+    HPX_TEST_EQ(i, 42);
+
+    // the chunk refers to the original data in this case
+    HPX_TEST_EQ(view.data(), v.data());
+    test_equal(v, view);
+}
+
+// without an owner for the buffer the data has to be copied
+void test_copy()
+{
+    std::vector<std::int64_t> v(100);
+    std::iota(v.begin(), v.end(), 1);
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, zero_copy_receive);
+        oarchive << hpx::serialization::buffer_view<std::int64_t>(v);
+    }
+
+    hpx::serialization::buffer_view<std::int64_t> view;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> view;
+    }
+
+    HPX_TEST(!is_inside(buffer, view.data()));
+    HPX_TEST(view.owner() != nullptr);
+    test_equal(v, view);
+}
+
+// the data has to be copied if the container doesn't give access to it
+void test_no_data_access()
+{
+    std::vector<double> v(100);
+    std::iota(v.begin(), v.end(), 1.0);
+
+    // vary the padding in front of the data
+    for (std::size_t prefix = 0; prefix != alignof(double); ++prefix)
+    {
+        stream_buffer buffer;
+        {
+            hpx::serialization::output_archive oarchive(
+                buffer.data_, zero_copy_receive);
+
+            for (std::size_t i = 0; i != prefix; ++i)
+            {
+                oarchive << char('a');
+            }
+            oarchive << hpx::serialization::buffer_view<double>(v)
+                     << char('b');
+        }
+
+        hpx::serialization::buffer_view<double> view;
+        char b = 0;
+        {
+            hpx::serialization::input_archive iarchive(buffer);
+            iarchive.set_buffer_owner(std::make_shared<int>(0));
+
+            for (std::size_t i = 0; i != prefix; ++i)
+            {
+                char a = 0;
+                iarchive >> a;
+                HPX_TEST_EQ(a, 'a');
+            }
+            iarchive >> view >> b;
+        }
+
+        HPX_TEST_EQ(b, 'b');
+        HPX_TEST(!is_inside(buffer.data_, view.data()));
+        test_equal(v, view);
+    }
+}
+
+// without zero-copy receive the archive format is unchanged
+void test_compatibility()
+{
+    std::vector<float> v(100);
+    std::iota(v.begin(), v.end(), 1.0f);
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << char('a') << hpx::serialization::buffer_view<float>(v);
+    }
+
+    auto expected = std::make_shared<std::vector<char>>();
+    {
+        hpx::serialization::output_archive oarchive(*expected);
+        oarchive << char('a') << v.size()
+                 << hpx::serialization::make_array(v.data(), v.size());
+    }
+    HPX_TEST(buffer == *expected);
+
+    hpx::serialization::buffer_view<float> view;
+    char a = 0;
+    {
+        hpx::serialization::input_archive iarchive(*expected);
+        iarchive.set_buffer_owner(expected);
+        iarchive >> a >> view;
+    }
+
+    HPX_TEST_EQ(a, 'a');
+    HPX_TEST(!is_inside(*expected, view.data()));
+    test_equal(v, view);
+}
+
+void test_serialize_buffer()
+{
+    using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+    std::vector<double> v(100);
+    std::iota(v.begin(), v.end(), 1.0);
+
+    auto buffer = std::make_shared<std::vector<char>>();
+    {
+        hpx::serialization::output_archive oarchive(
+            *buffer, zero_copy_receive);
+        oarchive << char('a')
+                 << buffer_type(v.data(), v.size(), buffer_type::reference);
+    }
+
+    buffer_type received;
+    char a = 0;
+    {
+        hpx::serialization::input_archive iarchive(*buffer);
+        iarchive.set_buffer_owner(buffer);
+        iarchive >> a >> received;
+    }
+
+    HPX_TEST_EQ(a, 'a');
+    HPX_TEST(is_inside(*buffer, received.data()));
+    HPX_TEST_EQ(v.size(), received.size());
+
+    // the received buffer keeps the archive buffer alive
+    buffer.reset();
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        HPX_TEST_EQ(v[i], received[i]);
+    }
+}
+
+int main()
+{
+    test_in_place<char>(0);
+    test_in_place<char>(100);
+    test_in_place<std::int32_t>(100);
+    test_in_place<double>(1000);
+
+    test_in_place_chunk();
+    test_copy();
+    test_no_data_access();
+    test_compatibility();
+    test_serialize_buffer();
+
+    return hpx::util::report_errors();
+}
@@ -16,6 +16,8 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_sampling.hpp>
+#include <hpx/threading_base/thread_tracing.hpp>
 
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
@@ -657,12 +659,17 @@ namespace hpx::threads::detail {
                             [[maybe_unused]] tfunc_time_wrapper
                                 tfunc_time_collector(idle_rate);
 
+                            std::uint64_t const trace_start =
+                                tracing::is_enabled() ? tracing::now() : 0;
+
                             // thread returns new required state store the
                             // returned state in the thread
                             {
                                 is_active_wrapper utilization(
                                     counters.is_active_);
                                 auto* thrdptr = get_thread_id_data(thrd);
+                                sampling::scoped_current_thread sampled(
+                                    thrdptr);
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
                                 util::itt::caller_context cctx(ctx);
                                 // util::itt::undo_frame_context undoframe(fctx);
@@ -710,6 +717,13 @@ namespace hpx::threads::detail {
                                 thread_schedule_state::active,
                                 thrd_stat.get_previous());
 
+                            if (trace_start != 0)
+                            {
+                                tracing::thread_executed(
+                                    get_thread_id_data(thrd), trace_start,
+                                    thrd_stat.get_previous());
+                            }
+
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
                             ++counters.executed_thread_phases_;
 #endif
@@ -852,6 +866,24 @@ namespace hpx::threads::detail {
             {
                 ++idle_loop_count;
 
+                // handle expired timers, this makes the woken threads
+                // available to this worker thread right away
+                if (scheduler.SchedulingPolicy::get_timer_wheel().poll(
+                        num_thread) != 0)
+                {
+                    idle_loop_count = 0;
+                    continue;
+                }
+
+                // handle completed file operations submitted by this worker
+                // thread
+                if (scheduler.SchedulingPolicy::get_io_uring_service().poll(
+                        num_thread) != 0)
+                {
+                    idle_loop_count = 0;
+                    continue;
+                }
+
                 if (scheduler.SchedulingPolicy::wait_or_add_new(num_thread,
                         running, idle_loop_count, enable_stealing_staged,
                         added))
@@ -985,6 +1017,11 @@ namespace hpx::threads::detail {
             {
                 busy_loop_count = 0;
 
+                // make sure timers expire even if this worker thread is busy
+                scheduler.SchedulingPolicy::get_timer_wheel().poll(num_thread);
+                scheduler.SchedulingPolicy::get_io_uring_service().poll(
+                    num_thread);
+
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
                 // do background work in parcel layer and in agas
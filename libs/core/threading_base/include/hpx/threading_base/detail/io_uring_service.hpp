@@ -0,0 +1,117 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A file operation submitted to the io_uring_service. The request is owned
+    // by the caller and has to stay alive until its callback has been invoked.
+    struct io_uring_request
+    {
+        enum class operation : std::uint8_t
+        {
+            openat,
+            read,
+            write,
+            fsync
+        };
+
+        operation op = operation::read;
+
+        // the file descriptor (the directory file descriptor for openat)
+        int fd = -1;
+
+        // the buffer to read to or to write from, the null terminated path
+        // for openat
+        void* buffer = nullptr;
+        std::uint32_t size = 0;
+        std::uint64_t offset = 0;
+
+        // the flags for openat, non-zero for fsync to only flush the data
+        int flags = 0;
+        std::uint32_t mode = 0;
+
+        // Invoked by the worker thread which submitted the request once the
+        // operation has completed, the result is the return value of the
+        // corresponding system call or -errno.
+        void (*on_complete)(
+            io_uring_request& req, int result, std::size_t num_thread) =
+            nullptr;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Asynchronous file I/O for the worker threads of a scheduler.
+    //
+    // Each worker thread lazily creates its own io_uring instance on its first
+    // submission. The requests are submitted right away, the completions are
+    // reaped by calling poll() from the scheduling loop of the same worker
+    // thread, i.e. the callbacks are invoked on the worker thread which
+    // submitted the corresponding request.
+    //
+    // If io_uring is not available (HPX was not configured with
+    // HPX_WITH_IO_URING, the kernel does not support the required operations,
+    // or the ring is full) submit() returns false and the caller is expected
+    // to perform the operation synchronously.
+    class HPX_CORE_EXPORT io_uring_service
+    {
+    public:
+        explicit io_uring_service(std::size_t num_threads);
+        ~io_uring_service();
+
+        io_uring_service(io_uring_service const&) = delete;
+        io_uring_service& operator=(io_uring_service const&) = delete;
+
+        // Submit the given request to the ring of the given worker thread,
+        // this has to be called on that worker thread.
+        bool submit(std::size_t num_thread, io_uring_request& req);
+
+        // Invoke the callbacks of all completed requests submitted by the
+        // given worker thread, returns the number of completed requests.
+        std::size_t poll(std::size_t num_thread)
+        {
+            if (pending(num_thread) == 0)
+            {
+                return 0;
+            }
+            return reap_completions(num_thread);
+        }
+
+        // Return the number of requests submitted by the given worker thread
+        // which have not completed yet
+        std::size_t pending(std::size_t num_thread) const noexcept
+        {
+            return num_thread < rings_.size() ?
+                rings_[num_thread].data_.pending_.load(
+                    std::memory_order_relaxed) :
+                0;
+        }
+
+    private:
+        std::size_t reap_completions(std::size_t num_thread);
+
+        struct ring;
+
+        struct ring_data
+        {
+            std::unique_ptr<ring> ring_;
+            bool unavailable_ = false;
+            std::atomic<std::size_t> pending_{0};
+        };
+
+        std::vector<hpx::util::cache_aligned_data<ring_data>> rings_;
+    };
+}    // namespace hpx::threads::detail
@@ -0,0 +1,139 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Hierarchical timer wheel used by the schedulers to implement timed
+    // suspension (sleep_for, timed waits, etc.) without creating an operating
+    // system timer for each request.
+    //
+    // The wheel consists of num_levels levels of num_slots slots each, a slot
+    // of level k spans num_slots^k ticks of 'resolution' each. Timers are
+    // inserted into the lowest level that can hold their deadline and are
+    // moved to the lower levels as the time advances. Deadlines beyond the
+    // range of the wheel are moved towards the top level repeatedly.
+    //
+    // The wheel is advanced by calling poll() (usually from the scheduling
+    // loop), all timers which have expired are removed as one batch and their
+    // callbacks are invoked on the polling thread outside of the lock. Timers
+    // never fire early, but may fire up to one tick late (plus the time
+    // until the wheel is polled next).
+    //
+    // The entries are owned by the caller and have to stay alive until they
+    // have either fired or were canceled.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+        using callback_type = hpx::move_only_function<void(std::size_t)>;
+
+        static constexpr std::size_t num_levels = 4;
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+
+        // the duration of one tick (2^16 ns, i.e. ~65.5us)
+        static constexpr std::size_t tick_bits = 16;
+        static constexpr std::chrono::nanoseconds resolution{
+            std::int64_t(1) << tick_bits};
+
+        class entry
+        {
+        public:
+            entry() = default;
+
+            entry(entry const&) = delete;
+            entry& operator=(entry const&) = delete;
+
+        private:
+            friend class timer_wheel;
+
+            enum class state : std::uint8_t
+            {
+                idle,
+                armed,
+                firing,
+                fired,
+                canceled
+            };
+
+            entry* prev_ = nullptr;
+            entry* next_ = nullptr;
+            std::uint64_t tick_ = 0;
+            std::uint8_t level_ = 0;    // the slot the entry is linked into
+            std::uint8_t slot_ = 0;
+            callback_type callback_;
+            std::atomic<state> state_{state::idle};
+        };
+
+        timer_wheel();
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+
+        // Arm the given entry, the callback will be invoked with the number
+        // of the polling thread once the deadline has passed.
+        void add(entry& e, clock_type::time_point deadline, callback_type f);
+
+        // Cancel the given entry, returns false if the entry has already
+        // fired (or is firing concurrently, in which case this waits for the
+        // callback to have been invoked).
+        bool cancel(entry& e) noexcept;
+
+        // Invoke the callbacks of all expired entries, returns the number of
+        // fired entries. Does nothing if another thread is polling
+        // concurrently.
+        std::size_t poll(std::size_t num_thread);
+
+        // Return whether there are armed timers
+        bool empty() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed);
+        }
+
+        // Return the time the wheel has to be polled next at the latest (or
+        // clock_type::time_point::max() if no timers are armed)
+        clock_type::time_point next_poll_time() const noexcept;
+
+    private:
+        static std::uint64_t to_tick(clock_type::time_point t) noexcept;
+
+        void insert(entry& e) noexcept;
+        void unlink(entry& e) noexcept;
+        void cascade(std::size_t level) noexcept;
+        void update_next_tick() noexcept;
+
+        using mutex_type = hpx::util::detail::spinlock;
+        mutable mutex_type mtx_;
+
+        // the next tick to be processed
+        std::uint64_t current_tick_;
+
+        entry* slots_[num_levels][num_slots];
+        std::uint64_t occupied_[num_levels];
+
+        std::atomic<std::size_t> size_{0};
+
+        // the first tick at which poll() may have work to do
+        std::atomic<std::uint64_t> next_tick_;
+    };
+}    // namespace hpx::threads::detail
@@ -15,10 +15,14 @@
 #include <hpx/execution_base/agent_base.hpp>
 #include <hpx/execution_base/context_base.hpp>
 #include <hpx/execution_base/resource_base.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <string>
+#include <utility>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -68,6 +72,63 @@ namespace hpx::threads {
 
         execution_context context_;
     };
+
+    // The agent installed while a stackless thread is executed. Stackless
+    // threads can't be suspended, this agent blocks the underlying OS thread
+    // instead and remembers the call site of the leaf task executed by the
+    // thread as suspending (see stackless_leaf_tasks.hpp).
+    struct HPX_CORE_EXPORT stackless_execution_agent
+      : hpx::execution_base::agent_base
+    {
+        explicit stackless_execution_agent(thread_data* thrd) noexcept
+          : thread_(thrd)
+        {
+        }
+
+        std::string description() const override;
+
+        execution_context const& context() const noexcept override
+        {
+            return context_;
+        }
+
+        void yield(char const* desc) override;
+        void yield_k(std::size_t k, char const* desc) override;
+        void suspend(char const* desc) override;
+        void resume(char const* desc) override;
+        void abort(char const* desc) override;
+        void sleep_for(hpx::chrono::steady_duration const& sleep_duration,
+            char const* desc) override;
+        void sleep_until(hpx::chrono::steady_time_point const& sleep_time,
+            char const* desc) override;
+
+        // set the agent of the OS thread the stackless thread is executed on
+        void set_os_agent(hpx::execution_base::agent_base* agent) noexcept
+        {
+            os_agent_ = agent;
+            call_site_ = nullptr;
+            blocked_ = false;
+        }
+
+        // set the call site of the leaf task executed by the stackless
+        // thread, returns the previous call site
+        std::atomic<detail::leaf_task_state>* set_leaf_task_call_site(
+            std::atomic<detail::leaf_task_state>* call_site) noexcept
+        {
+            std::swap(call_site_, call_site);
+            return call_site;
+        }
+
+    private:
+        void set_blocked() noexcept;
+
+        thread_data* thread_;
+        hpx::execution_base::agent_base* os_agent_ = nullptr;
+        std::atomic<detail::leaf_task_state>* call_site_ = nullptr;
+        bool blocked_ = false;
+
+        execution_context context_;
+    };
 }    // namespace hpx::threads
 
 #include <hpx/config/warnings_suffix.hpp>
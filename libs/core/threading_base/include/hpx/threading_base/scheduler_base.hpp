@@ -12,6 +12,8 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/io_uring_service.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -99,6 +101,24 @@ namespace hpx::threads::policies {
 
         void idle_callback(std::size_t num_thread);
 
+        /// Return the timer wheel used to implement the timed suspension of
+        /// the threads managed by this scheduler. It is polled by the
+        /// scheduling loop, i.e. expired timers are handled by the worker
+        /// threads of this scheduler.
+        threads::detail::timer_wheel& get_timer_wheel() noexcept
+        {
+            return timer_wheel_;
+        }
+
+        /// Return the service used for the asynchronous file I/O of the
+        /// threads managed by this scheduler. It is polled by the scheduling
+        /// loop, i.e. the completions are handled by the worker threads which
+        /// submitted the requests.
+        threads::detail::io_uring_service& get_io_uring_service() noexcept
+        {
+            return io_uring_service_;
+        }
+
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
         /// possibly idling OS threads
@@ -356,6 +376,12 @@ namespace hpx::threads::policies {
         std::atomic<polling_work_count_function_ptr>
             polling_work_count_function_cuda_;
 
+        // timers for the timed suspension of threads
+        threads::detail::timer_wheel timer_wheel_;
+
+        // asynchronous file I/O
+        threads::detail::io_uring_service io_uring_service_;
+
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
     public:
         // manage scheduler-local data
@@ -0,0 +1,148 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// Leaf tasks are short tasks which are not expected to suspend, like the
+// chunks of work created by the parallel algorithms or the continuations
+// attached to futures. If enabled, such tasks are run on stackless threads,
+// which avoids allocating (and switching to) a stack for each of them.
+//
+// A stackless thread can't be suspended, a leaf task is therefore run on a
+// stackless thread only once a task created from the same call site has run
+// to completion on a stackful thread without suspending. A call site is
+// identified by the type of the task. As soon as a task created from a call
+// site suspends (or yields), all leaf tasks subsequently created from it are
+// run on stackful threads.
+//
+// A stackless thread created from a call site whose tasks suspend only
+// occasionally may still have to wait. The worker thread executing it is then
+// blocked until the thread can continue, which deadlocks if the awaited
+// result can only be produced by the blocked worker thread.
+namespace hpx::threads {
+
+    // Enable or disable running leaf tasks on stackless threads, this is
+    // initialized from the configuration entry hpx.stacks.stackless_leaf_tasks
+    HPX_CORE_EXPORT void set_stackless_leaf_tasks(bool enable) noexcept;
+    HPX_CORE_EXPORT bool get_stackless_leaf_tasks() noexcept;
+
+    // Return the number of stackless threads that have blocked
+    HPX_CORE_EXPORT std::int64_t get_stackless_blocking_count(bool reset);
+
+    namespace detail {
+
+        enum class leaf_task_state : std::uint8_t
+        {
+            // no task has completed so far
+            unknown = 0,
+            // a task has completed without suspending
+            non_suspending = 1,
+            // a task has suspended, this state is final
+            suspending = 2
+        };
+
+        // The state of the call site creating leaf tasks of the given type
+        template <typename F>
+        inline std::atomic<leaf_task_state> leaf_task_call_site{
+            leaf_task_state::unknown};
+
+        // Count a stackless thread which has blocked its worker thread
+        HPX_CORE_EXPORT void increment_stackless_blocking_count() noexcept;
+
+        // Observes whether the leaf task executed during its lifetime
+        // suspends and updates the state of its call site accordingly
+        class HPX_CORE_EXPORT leaf_task_scope
+        {
+        public:
+            explicit leaf_task_scope(
+                std::atomic<leaf_task_state>& call_site) noexcept;
+            ~leaf_task_scope();
+
+            leaf_task_scope(leaf_task_scope const&) = delete;
+            leaf_task_scope(leaf_task_scope&&) = delete;
+            leaf_task_scope& operator=(leaf_task_scope const&) = delete;
+            leaf_task_scope& operator=(leaf_task_scope&&) = delete;
+
+        private:
+            std::atomic<leaf_task_state>& call_site_;
+            std::atomic<leaf_task_state>* prev_call_site_ = nullptr;
+            hpx::execution_base::this_thread::detail::agent_storage*
+                agent_storage_ = nullptr;
+            std::size_t agent_switches_ = 0;
+        };
+
+        // Invoke the leaf task f and observe whether it suspends while the
+        // state of its call site isn't settled yet
+        template <typename F>
+        class leaf_task
+        {
+        public:
+            template <typename F_,
+                typename Enable =
+                    std::enable_if_t<!std::is_same_v<std::decay_t<F_>,
+                        leaf_task>>>
+            explicit leaf_task(F_&& f)
+              : f_(HPX_FORWARD(F_, f))
+            {
+            }
+
+            template <typename... Ts>
+            decltype(auto) operator()(Ts&&... ts)
+            {
+                auto& call_site = leaf_task_call_site<F>;
+                if (call_site.load(std::memory_order_relaxed) ==
+                        leaf_task_state::suspending ||
+                    !get_stackless_leaf_tasks())
+                {
+                    return HPX_INVOKE(f_, HPX_FORWARD(Ts, ts)...);
+                }
+
+                leaf_task_scope scope(call_site);
+                return HPX_INVOKE(f_, HPX_FORWARD(Ts, ts)...);
+            }
+
+        private:
+            F f_;
+        };
+    }    // namespace detail
+
+    // Return the stack size to use for leaf tasks of type F. This is
+    // thread_stacksize::nostack if stackless leaf tasks are enabled and a
+    // task of this type has completed without suspending while none has
+    // suspended so far, otherwise it is the given fallback.
+    template <typename F>
+    thread_stacksize get_leaf_task_stacksize(
+        thread_stacksize fallback = thread_stacksize::small_) noexcept
+    {
+        if (detail::leaf_task_call_site<std::decay_t<F>>.load(
+                std::memory_order_relaxed) !=
+                detail::leaf_task_state::non_suspending ||
+            !get_stackless_leaf_tasks())
+        {
+            return fallback;
+        }
+        return thread_stacksize::nostack;
+    }
+
+    // Wrap the leaf task f such that the state of its call site is updated
+    // when it runs
+    template <typename F>
+    detail::leaf_task<std::decay_t<F>> make_leaf_task(F&& f)
+    {
+        return detail::leaf_task<std::decay_t<F>>(HPX_FORWARD(F, f));
+    }
+}    // namespace hpx::threads
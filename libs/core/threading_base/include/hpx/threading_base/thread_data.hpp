@@ -732,7 +732,8 @@ namespace hpx { namespace threads {
     {
         if (is_stackless())
         {
-            return static_cast<thread_data_stackless*>(this)->call();
+            return static_cast<thread_data_stackless*>(this)->call(
+                agent_storage);
         }
         return static_cast<thread_data_stackful*>(this)->call(agent_storage);
     }
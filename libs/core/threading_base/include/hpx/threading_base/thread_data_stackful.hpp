@@ -9,7 +9,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/function.hpp>
@@ -55,7 +55,7 @@ namespace hpx::threads {
             return this;
         }
 
-        static util::internal_allocator<thread_data_stackful> thread_alloc_;
+        static util::slab_allocator<thread_data_stackful> thread_alloc_;
 
     public:
         HPX_FORCEINLINE coroutine_type::result_type call(
@@ -9,12 +9,14 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/stackless_coroutine.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/construct_at.hpp>
@@ -54,14 +56,22 @@ namespace hpx::threads {
             return this;
         }
 
-        static util::internal_allocator<thread_data_stackless> thread_alloc_;
+        static util::slab_allocator<thread_data_stackless> thread_alloc_;
 
     public:
-        stackless_coroutine_type::result_type call()
+        stackless_coroutine_type::result_type call(
+            hpx::execution_base::this_thread::detail::agent_storage*
+                agent_storage)
         {
             HPX_ASSERT(get_state().state() == thread_schedule_state::active);
             HPX_ASSERT(this == coroutine_.get_thread_id().get());
 
+            // blocking operations performed by the thread fall back to
+            // blocking the agent of the current OS thread
+            hpx::execution_base::this_thread::reset_agent ctx(
+                agent_storage, agent_);
+            agent_.set_os_agent(ctx.old_);
+
             return coroutine_(this->thread_data::set_state_ex(
                 thread_restart_state::signaled));
         }
@@ -138,6 +148,7 @@ namespace hpx::threads {
             std::ptrdiff_t stacksize, thread_id_addref addref)
           : thread_data(init_data, queue, stacksize, true, addref)
           , coroutine_(HPX_MOVE(init_data.func), thread_id_type(this_()))
+          , agent_(this_())
         {
             HPX_ASSERT(coroutine_.is_ready());
         }
@@ -154,8 +165,14 @@ namespace hpx::threads {
             thread_alloc_.deallocate(this, 1);
         }
 
+        stackless_execution_agent& get_agent() noexcept
+        {
+            return agent_;
+        }
+
     private:
         stackless_coroutine_type coroutine_;
+        stackless_execution_agent agent_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
@@ -40,7 +40,15 @@ namespace hpx::threads::policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE) noexcept
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            bool hierarchical_stealing =
+                HPX_THREAD_QUEUE_HIERARCHICAL_STEALING != 0,
+            std::int64_t max_steal_batch_size = std::int64_t(
+                HPX_THREAD_QUEUE_MAX_STEAL_BATCH_SIZE),
+            std::int64_t core_group_size = std::int64_t(
+                HPX_THREAD_QUEUE_CORE_GROUP_SIZE),
+            std::int64_t min_tasks_to_steal_numa = std::int64_t(
+                HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA)) noexcept
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -56,6 +64,10 @@ namespace hpx::threads::policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , hierarchical_stealing_(hierarchical_stealing)
+          , max_steal_batch_size_(max_steal_batch_size)
+          , core_group_size_(core_group_size)
+          , min_tasks_to_steal_numa_(min_tasks_to_steal_numa)
         {
         }
 
@@ -74,5 +86,9 @@ namespace hpx::threads::policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        bool hierarchical_stealing_;
+        std::int64_t max_steal_batch_size_;
+        std::int64_t core_group_size_;
+        std::int64_t min_tasks_to_steal_numa_;
     };
 }    // namespace hpx::threads::policies
@@ -0,0 +1,146 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file thread_sampling.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Built-in sampling profiler attributing samples to HPX threads.
+///
+/// If enabled, every registered worker thread is interrupted periodically
+/// (after it has consumed the configured amount of CPU time) by a timer
+/// signal. Each sample is attributed to the description (annotation) of the
+/// HPX thread that was running on the worker thread at that point, or to
+/// \a <scheduler> if the worker thread was executing the scheduling loop.
+/// Optionally, the call stack of the running HPX thread (i.e. the stack of
+/// its coroutine) is recorded as well by following the chain of frame
+/// pointers, which requires the code to be compiled with frame pointers. The
+/// signal handler records raw addresses only, which are symbolized when the
+/// samples are written. The samples are aggregated into a histogram per
+/// description which is exposed through the performance counter
+/// \a /threads/count/samples, and they can be written in the folded stacks
+/// format understood by flamegraph.pl and speedscope.
+///
+/// The description of the running HPX thread is published by the scheduling
+/// loop whenever an HPX thread is resumed, i.e. annotations changed while
+/// an HPX thread is running are taken into account once it was suspended
+/// and resumed.
+///
+/// Sampling is enabled using the configuration setting
+/// \a hpx.sampling.enabled or the command line option \a --hpx:sample, in
+/// which case the samples of each locality are written at shutdown.
+/// Sampling is supported on Linux only.
+namespace hpx::threads::sampling {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> enabled;
+
+        HPX_CORE_EXPORT void set_current(thread_data const* thrd) noexcept;
+        HPX_CORE_EXPORT void reset_current() noexcept;
+    }    // namespace detail
+    /// \endcond
+
+    /// Return whether samples are currently being taken
+    inline bool is_enabled() noexcept
+    {
+        return detail::enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Return whether sampling is supported on this platform
+    HPX_CORE_EXPORT bool is_supported() noexcept;
+
+    /// Publish the given HPX thread as the one running on the calling worker
+    /// thread for the lifetime of this object
+    class scoped_current_thread
+    {
+    public:
+        explicit scoped_current_thread(thread_data const* thrd) noexcept
+          : active_(is_enabled())
+        {
+            if (active_)
+            {
+                detail::set_current(thrd);
+            }
+        }
+
+        ~scoped_current_thread()
+        {
+            if (active_)
+            {
+                detail::reset_current();
+            }
+        }
+
+        scoped_current_thread(scoped_current_thread const&) = delete;
+        scoped_current_thread& operator=(scoped_current_thread const&) = delete;
+
+    private:
+        bool active_;
+    };
+
+    /// Register the calling OS thread for being sampled
+    HPX_CORE_EXPORT void register_thread();
+
+    /// Stop sampling the calling OS thread, its samples are retained
+    HPX_CORE_EXPORT void unregister_thread() noexcept;
+
+    /// Start taking samples, discard all previously taken samples.
+    ///
+    /// \param interval_us  The CPU time (in microseconds) a worker thread
+    ///                     consumes between two samples.
+    /// \param stacks       Record the call stack of the running HPX thread
+    ///                     with each sample.
+    /// \param max_entries  The maximal number of distinct samples (i.e.
+    ///                     descriptions or description and call stack
+    ///                     combinations) recorded per worker thread, any
+    ///                     further distinct samples are dropped.
+    ///
+    /// \throws hpx::exception with \a hpx::error::not_implemented if sampling
+    ///         is not supported on this platform.
+    HPX_CORE_EXPORT void enable(std::uint64_t interval_us = 1000,
+        bool stacks = false, std::size_t max_entries = 4096);
+
+    /// Stop taking samples, the taken samples are retained.
+    HPX_CORE_EXPORT void disable() noexcept;
+
+    /// Return the number of samples taken for each description
+    HPX_CORE_EXPORT std::vector<std::pair<std::string, std::uint64_t>>
+    get_histogram();
+
+    /// Return the number of samples taken for the given description (or for
+    /// all descriptions if \a description is empty) since the last reset.
+    HPX_CORE_EXPORT std::int64_t get_sample_count(
+        std::string const& description, bool reset);
+
+    /// Return the number of samples dropped because the table of the
+    /// sampled worker thread was full
+    HPX_CORE_EXPORT std::uint64_t dropped_samples() noexcept;
+
+    /// Write all taken samples in the folded stacks format, i.e. one line
+    /// per distinct call stack holding the description and the frames from
+    /// the outermost to the innermost one, separated by ';', followed by
+    /// the number of samples.
+    HPX_CORE_EXPORT void write_folded(std::ostream& os);
+
+    /// Write all taken samples in the folded stacks format to the given
+    /// file, any occurrence of \a %locality% in the file name is replaced
+    /// with the locality id.
+    HPX_CORE_EXPORT void dump(
+        std::string const& filename, std::uint32_t locality_id);
+}    // namespace hpx::threads::sampling
@@ -0,0 +1,96 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file thread_tracing.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/coroutines/thread_id_type.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+/// Built-in, low-overhead task tracing.
+///
+/// If enabled, the scheduling loop records the creation of HPX threads and
+/// every period of time an HPX thread was executing (including the state the
+/// thread was left in, i.e. whether it was suspended, yielded, or has
+/// terminated), and the parcel layer records sent and received parcels. Each
+/// OS thread records its events into its own buffer. The recorded events can
+/// be written in the Chrome trace event format (JSON) which can be loaded
+/// into Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+///
+/// Tracing is enabled using the configuration setting
+/// \a hpx.trace.enabled or the command line option \a --hpx:trace, in which
+/// case the trace of each locality is written at shutdown.
+namespace hpx::threads::tracing {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> enabled;
+    }    // namespace detail
+    /// \endcond
+
+    /// Return whether events are currently being recorded
+    inline bool is_enabled() noexcept
+    {
+        return detail::enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Return the current timestamp as used for the recorded events
+    inline std::uint64_t now() noexcept
+    {
+        return hpx::chrono::high_resolution_clock::now();
+    }
+
+    /// Start recording events, discard all previously recorded events.
+    ///
+    /// \param max_events  The maximal number of events recorded by each OS
+    ///                    thread, any further events are dropped.
+    HPX_CORE_EXPORT void enable(std::size_t max_events = 1048576);
+
+    /// Stop recording events, the recorded events are retained.
+    HPX_CORE_EXPORT void disable() noexcept;
+
+    /// Record the creation of an HPX thread
+    HPX_CORE_EXPORT void thread_created(
+        thread_id_type const& id, thread_init_data const& data) noexcept;
+
+    /// Record that the given HPX thread was executing since the time
+    /// \a start, \a state is the state the thread has returned.
+    HPX_CORE_EXPORT void thread_executed(thread_data const* thrd,
+        std::uint64_t start, thread_schedule_state state) noexcept;
+
+    /// Record a parcel which was sent to the given locality
+    HPX_CORE_EXPORT void parcel_sent(std::uint64_t parcel_id,
+        std::size_t size, std::uint32_t destination) noexcept;
+
+    /// Record a parcel which was received from the given locality
+    HPX_CORE_EXPORT void parcel_received(std::uint64_t parcel_id,
+        std::size_t size, std::uint32_t source) noexcept;
+
+    /// Return the number of events dropped because the buffer of the
+    /// recording OS thread was full
+    HPX_CORE_EXPORT std::size_t dropped_events() noexcept;
+
+    /// Write all recorded events in the Chrome trace event format, the
+    /// locality id is used as the process id.
+    HPX_CORE_EXPORT void write(std::ostream& os, std::uint32_t locality_id);
+
+    /// Write all recorded events in the Chrome trace event format to the
+    /// given file, any occurrence of \a %locality% in the file name is
+    /// replaced with the locality id.
+    HPX_CORE_EXPORT void dump(
+        std::string const& filename, std::uint32_t locality_id);
+}    // namespace hpx::threads::tracing
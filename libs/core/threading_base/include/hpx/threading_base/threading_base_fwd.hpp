@@ -55,7 +55,8 @@ namespace hpx::threads {
     using thread_arg_type = thread_restart_state;
 
     using thread_function_sig = thread_result_type(thread_arg_type);
-    using thread_function_type = hpx::move_only_function<thread_function_sig>;
+    using thread_function_type = hpx::move_only_function<thread_function_sig,
+        false, coroutines::thread_function_storage_size>;
 
     using thread_self = coroutines::detail::coroutine_self;
     using thread_self_impl_type = coroutines::detail::coroutine_impl;
@@ -12,6 +12,7 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_tracing.hpp>
 
 #include <cstddef>
 
@@ -88,6 +89,11 @@ namespace hpx::threads::detail {
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
+        if (tracing::is_enabled())
+        {
+            tracing::thread_created(id.noref(), data);
+        }
+
         // NOLINTNEXTLINE(bugprone-branch-clone)
         LTM_(info)
             .format("create_thread: pool({}), scheduler({}), thread({}), "
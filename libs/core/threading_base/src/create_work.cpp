@@ -12,6 +12,7 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_tracing.hpp>
 
 namespace hpx::threads::detail {
 
@@ -101,6 +102,11 @@ namespace hpx::threads::detail {
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
 
+        if (tracing::is_enabled())
+        {
+            tracing::thread_created(id.noref(), data);
+        }
+
         // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
         // thread.
         scheduler->do_some_work(data.schedulehint.hint);
@@ -0,0 +1,418 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/detail/io_uring_service.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#if defined(HPX_HAVE_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+#endif
+
+namespace hpx::threads::detail {
+
+#if defined(HPX_HAVE_IO_URING)
+    namespace {
+
+        // number of submission queue entries of each ring
+        inline constexpr std::uint32_t queue_depth = 64;
+
+        // completions are handled in batches of this size, the callbacks are
+        // invoked without holding the lock
+        inline constexpr std::size_t completion_batch_size = 32;
+
+        int io_uring_setup(std::uint32_t entries, io_uring_params* p) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, std::uint32_t to_submit,
+            std::uint32_t min_complete, std::uint32_t flags) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(int fd, unsigned int opcode, void const* arg,
+            unsigned int nr_args) noexcept
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        template <typename T>
+        T* ring_ptr(void* ring, std::uint32_t offset) noexcept
+        {
+            return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+        }
+
+        std::uint32_t load_acquire(std::uint32_t const* p) noexcept
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        void store_release(std::uint32_t* p, std::uint32_t value) noexcept
+        {
+            __atomic_store_n(p, value, __ATOMIC_RELEASE);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_service::ring
+    {
+        ring() = default;
+
+        ring(ring const&) = delete;
+        ring& operator=(ring const&) = delete;
+
+        ~ring()
+        {
+            if (sqes_ != nullptr)
+            {
+                ::munmap(sqes_, sqes_size_);
+            }
+            if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+            {
+                ::munmap(cq_ring_, cq_ring_size_);
+            }
+            if (sq_ring_ != nullptr)
+            {
+                ::munmap(sq_ring_, sq_ring_size_);
+            }
+            if (ring_fd_ != -1)
+            {
+                ::close(ring_fd_);
+            }
+        }
+
+        bool init()
+        {
+            io_uring_params p;
+            std::memset(&p, 0, sizeof(p));
+
+            ring_fd_ = io_uring_setup(queue_depth, &p);
+            if (ring_fd_ < 0)
+            {
+                ring_fd_ = -1;
+                return false;
+            }
+
+            // map the submission and completion queues
+            sq_ring_size_ =
+                p.sq_off.array + p.sq_entries * sizeof(std::uint32_t);
+            cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+
+            bool const single_mmap =
+                (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single_mmap)
+            {
+                sq_ring_size_ = cq_ring_size_ =
+                    (std::max)(sq_ring_size_, cq_ring_size_);
+            }
+
+            sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+            if (sq_ring_ == MAP_FAILED)
+            {
+                sq_ring_ = nullptr;
+                return false;
+            }
+
+            if (single_mmap)
+            {
+                cq_ring_ = sq_ring_;
+            }
+            else
+            {
+                cq_ring_ = ::mmap(nullptr, cq_ring_size_,
+                    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                    IORING_OFF_CQ_RING);
+                if (cq_ring_ == MAP_FAILED)
+                {
+                    cq_ring_ = nullptr;
+                    return false;
+                }
+            }
+
+            sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+            sqes_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+            if (sqes_ == MAP_FAILED)
+            {
+                sqes_ = nullptr;
+                return false;
+            }
+
+            sq_head_ = ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.head);
+            sq_tail_ = ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.tail);
+            sq_mask_ = *ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.ring_mask);
+            sq_entries_ = p.sq_entries;
+            sq_array_ = ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.array);
+
+            cq_head_ = ring_ptr<std::uint32_t>(cq_ring_, p.cq_off.head);
+            cq_tail_ = ring_ptr<std::uint32_t>(cq_ring_, p.cq_off.tail);
+            cq_mask_ = *ring_ptr<std::uint32_t>(cq_ring_, p.cq_off.ring_mask);
+            cq_entries_ = p.cq_entries;
+            cqes_ = ring_ptr<io_uring_cqe>(cq_ring_, p.cq_off.cqes);
+
+            // all operations used by the senders have to be supported
+            // (Linux 5.6 and later)
+            std::size_t const probe_size = sizeof(io_uring_probe) +
+                (IORING_OP_LAST + 1) * sizeof(io_uring_probe_op);
+            std::vector<std::uint64_t> storage(probe_size / 8 + 1, 0);
+            auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+
+            if (io_uring_register(ring_fd_, IORING_REGISTER_PROBE, probe,
+                    IORING_OP_LAST + 1) != 0)
+            {
+                return false;
+            }
+
+            for (std::uint8_t const op : {IORING_OP_OPENAT, IORING_OP_READ,
+                     IORING_OP_WRITE, IORING_OP_FSYNC})
+            {
+                if (probe->last_op < op ||
+                    !(probe->ops[op].flags & IO_URING_OP_SUPPORTED))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool submit(io_uring_request& req)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // never submit more requests than the completion queue can hold
+            std::uint32_t const tail = *sq_tail_;
+            if (outstanding_ == cq_entries_ ||
+                tail - load_acquire(sq_head_) == sq_entries_)
+            {
+                return false;
+            }
+
+            std::uint32_t const index = tail & sq_mask_;
+            io_uring_sqe& sqe = static_cast<io_uring_sqe*>(sqes_)[index];
+            std::memset(&sqe, 0, sizeof(sqe));
+
+            sqe.fd = req.fd;
+            sqe.user_data = reinterpret_cast<std::uint64_t>(&req);
+
+            switch (req.op)
+            {
+            case io_uring_request::operation::openat:
+                sqe.opcode = IORING_OP_OPENAT;
+                sqe.addr = reinterpret_cast<std::uint64_t>(req.buffer);
+                sqe.len = req.mode;
+                sqe.open_flags = static_cast<std::uint32_t>(req.flags);
+                break;
+
+            case io_uring_request::operation::read:
+                sqe.opcode = IORING_OP_READ;
+                sqe.addr = reinterpret_cast<std::uint64_t>(req.buffer);
+                sqe.len = req.size;
+                sqe.off = req.offset;
+                break;
+
+            case io_uring_request::operation::write:
+                sqe.opcode = IORING_OP_WRITE;
+                sqe.addr = reinterpret_cast<std::uint64_t>(req.buffer);
+                sqe.len = req.size;
+                sqe.off = req.offset;
+                break;
+
+            case io_uring_request::operation::fsync:
+                sqe.opcode = IORING_OP_FSYNC;
+                sqe.fsync_flags = req.flags != 0 ? IORING_FSYNC_DATASYNC : 0;
+                break;
+
+            default:
+                HPX_ASSERT(false);
+                return false;
+            }
+
+            sq_array_[index] = index;
+            store_release(sq_tail_, tail + 1);
+
+            ++to_submit_;
+            ++outstanding_;
+
+            flush();
+            return true;
+        }
+
+        // hand all queued submissions to the kernel, requests which were not
+        // accepted (e.g. because of a temporary lack of resources) are
+        // submitted again on the next call
+        void flush() noexcept
+        {
+            if (to_submit_ == 0)
+            {
+                return;
+            }
+
+            int const ret = io_uring_enter(ring_fd_, to_submit_, 0, 0);
+            if (ret > 0)
+            {
+                to_submit_ -= (std::min)(
+                    to_submit_, static_cast<std::uint32_t>(ret));
+            }
+        }
+
+        // collect at most completion_batch_size completions
+        std::size_t reap(io_uring_cqe* cqes)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            flush();
+
+            std::uint32_t head = *cq_head_;
+            std::uint32_t const tail = load_acquire(cq_tail_);
+
+            std::size_t count = 0;
+            while (head != tail && count != completion_batch_size)
+            {
+                cqes[count++] = cqes_[head & cq_mask_];
+                ++head;
+            }
+
+            store_release(cq_head_, head);
+            outstanding_ -= static_cast<std::uint32_t>(count);
+            return count;
+        }
+
+        using mutex_type = hpx::util::detail::spinlock;
+        mutex_type mtx_;
+
+        int ring_fd_ = -1;
+
+        void* sq_ring_ = nullptr;
+        std::size_t sq_ring_size_ = 0;
+        void* cq_ring_ = nullptr;
+        std::size_t cq_ring_size_ = 0;
+        void* sqes_ = nullptr;
+        std::size_t sqes_size_ = 0;
+
+        std::uint32_t* sq_head_ = nullptr;
+        std::uint32_t* sq_tail_ = nullptr;
+        std::uint32_t sq_mask_ = 0;
+        std::uint32_t sq_entries_ = 0;
+        std::uint32_t* sq_array_ = nullptr;
+
+        std::uint32_t* cq_head_ = nullptr;
+        std::uint32_t* cq_tail_ = nullptr;
+        std::uint32_t cq_mask_ = 0;
+        std::uint32_t cq_entries_ = 0;
+        io_uring_cqe* cqes_ = nullptr;
+
+        std::uint32_t to_submit_ = 0;
+        std::uint32_t outstanding_ = 0;
+    };
+#else
+    struct io_uring_service::ring
+    {
+    };
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_service::io_uring_service(std::size_t num_threads)
+      : rings_(num_threads)
+    {
+    }
+
+    io_uring_service::~io_uring_service()
+    {
+        // the scheduler is destroyed only after all of its threads have
+        // finished, i.e. all requests have completed
+        for ([[maybe_unused]] auto const& data : rings_)
+        {
+            HPX_ASSERT(data.data_.pending_.load(std::memory_order_relaxed) ==
+                0);
+        }
+    }
+
+    bool io_uring_service::submit(
+        [[maybe_unused]] std::size_t num_thread,
+        [[maybe_unused]] io_uring_request& req)
+    {
+#if defined(HPX_HAVE_IO_URING)
+        if (num_thread >= rings_.size())
+        {
+            return false;
+        }
+
+        ring_data& data = rings_[num_thread].data_;
+        if (data.unavailable_)
+        {
+            return false;
+        }
+
+        if (!data.ring_)
+        {
+            auto r = std::make_unique<ring>();
+            if (!r->init())
+            {
+                data.unavailable_ = true;
+                return false;
+            }
+            data.ring_ = HPX_MOVE(r);
+        }
+
+        // account for the request before it can complete
+        data.pending_.fetch_add(1, std::memory_order_relaxed);
+        if (!data.ring_->submit(req))
+        {
+            data.pending_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::size_t io_uring_service::reap_completions(
+        [[maybe_unused]] std::size_t num_thread)
+    {
+#if defined(HPX_HAVE_IO_URING)
+        ring_data& data = rings_[num_thread].data_;
+        HPX_ASSERT(data.ring_);
+
+        std::size_t total = 0;
+        io_uring_cqe cqes[completion_batch_size];
+        while (std::size_t const count = data.ring_->reap(cqes))
+        {
+            data.pending_.fetch_sub(count, std::memory_order_relaxed);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                auto* req = reinterpret_cast<io_uring_request*>(
+                    static_cast<std::uintptr_t>(cqes[i].user_data));
+                req->on_complete(*req, cqes[i].res, num_thread);
+            }
+            total += count;
+        }
+        return total;
+#else
+        return 0;
+#endif
+    }
+}    // namespace hpx::threads::detail
@@ -0,0 +1,335 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        constexpr std::uint64_t slot_mask = timer_wheel::num_slots - 1;
+
+        // the number of ticks spanned by one slot of the given level
+        constexpr std::uint64_t level_granularity(std::size_t level) noexcept
+        {
+            return std::uint64_t(1) << (level * timer_wheel::slot_bits);
+        }
+
+        // the index of the lowest set bit
+        inline std::size_t lowest_bit(std::uint64_t v) noexcept
+        {
+            HPX_ASSERT(v != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return static_cast<std::size_t>(__builtin_ctzll(v));
+#else
+            std::size_t n = 0;
+            while ((v & 1) == 0)
+            {
+                v >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::timer_wheel()
+      : current_tick_(to_tick(clock_type::now()))
+      , slots_{}
+      , occupied_{}
+      , next_tick_((std::numeric_limits<std::uint64_t>::max)())
+    {
+    }
+
+    std::uint64_t timer_wheel::to_tick(clock_type::time_point t) noexcept
+    {
+        auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            t.time_since_epoch())
+                            .count();
+        return ns <= 0 ? 0 : static_cast<std::uint64_t>(ns) >> tick_bits;
+    }
+
+    void timer_wheel::add(
+        entry& e, clock_type::time_point deadline, callback_type f)
+    {
+        HPX_ASSERT(e.state_.load(std::memory_order_relaxed) !=
+            entry::state::armed);
+
+        e.callback_ = HPX_MOVE(f);
+
+        // round up, timers must not fire early
+        e.tick_ = to_tick(deadline - std::chrono::nanoseconds(1)) + 1;
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        if (size_.load(std::memory_order_relaxed) == 0)
+        {
+            // the wheel may not have been polled for a while
+            current_tick_ =
+                (std::max)(current_tick_, to_tick(clock_type::now()));
+        }
+
+        e.state_.store(entry::state::armed, std::memory_order_relaxed);
+        insert(e);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        update_next_tick();
+    }
+
+    bool timer_wheel::cancel(entry& e) noexcept
+    {
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (e.state_.load(std::memory_order_relaxed) ==
+                entry::state::armed)
+            {
+                unlink(e);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                e.state_.store(
+                    entry::state::canceled, std::memory_order_relaxed);
+                e.callback_.reset();
+                return true;
+            }
+        }
+
+        // the entry is being fired concurrently, wait for the callback to be
+        // taken out of the entry
+        hpx::util::yield_while([&e]() {
+            return e.state_.load(std::memory_order_acquire) ==
+                entry::state::firing;
+        });
+        return false;
+    }
+
+    std::size_t timer_wheel::poll(std::size_t num_thread)
+    {
+        if (empty())
+        {
+            return 0;
+        }
+
+        std::uint64_t const now = to_tick(clock_type::now());
+        if (now < next_tick_.load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        // collect all expired entries as one batch
+        entry* expired = nullptr;
+        {
+            std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return 0;    // somebody else is polling
+            }
+
+            while (current_tick_ <= now)
+            {
+                std::uint64_t const tick = current_tick_;
+                std::size_t const slot = tick & slot_mask;
+
+                // move the entries of the higher levels down, if needed
+                if (slot == 0)
+                {
+                    for (std::size_t level = num_levels - 1; level != 0;
+                         --level)
+                    {
+                        if ((tick & (level_granularity(level) - 1)) == 0)
+                        {
+                            cascade(level);
+                        }
+                    }
+                }
+
+                if (entry* e = slots_[0][slot]; e != nullptr)
+                {
+                    slots_[0][slot] = nullptr;
+                    occupied_[0] &= ~(std::uint64_t(1) << slot);
+
+                    entry* last = e;
+                    std::size_t count = 1;
+                    for (/**/; last->next_ != nullptr; last = last->next_)
+                    {
+                        last->state_.store(
+                            entry::state::firing, std::memory_order_relaxed);
+                        ++count;
+                    }
+                    last->state_.store(
+                        entry::state::firing, std::memory_order_relaxed);
+
+                    last->next_ = expired;
+                    expired = e;
+                    size_.fetch_sub(count, std::memory_order_relaxed);
+                }
+
+                // skip ahead to the next occupied slot of the lowest level or
+                // to the next tick at which entries have to be cascaded
+                std::uint64_t const pending =
+                    slot == slot_mask ? 0 : occupied_[0] >> (slot + 1);
+                current_tick_ = pending != 0 ?
+                    tick + 1 + lowest_bit(pending) :
+                    (tick | slot_mask) + 1;
+
+                if (size_.load(std::memory_order_relaxed) == 0)
+                {
+                    // nothing left to do
+                    current_tick_ = now + 1;
+                    break;
+                }
+            }
+
+            if (current_tick_ > now + 1)
+            {
+                current_tick_ = now + 1;
+            }
+            update_next_tick();
+        }
+
+        // invoke the callbacks outside of the lock
+        std::size_t fired = 0;
+        while (expired != nullptr)
+        {
+            entry* e = expired;
+            expired = e->next_;
+
+            callback_type f = HPX_MOVE(e->callback_);
+            e->prev_ = e->next_ = nullptr;
+
+            // the entry may go out of scope as soon as it is marked as fired
+            e->state_.store(entry::state::fired, std::memory_order_release);
+
+            f(num_thread);
+            ++fired;
+        }
+        return fired;
+    }
+
+    timer_wheel::clock_type::time_point timer_wheel::next_poll_time()
+        const noexcept
+    {
+        std::uint64_t const tick = next_tick_.load(std::memory_order_relaxed);
+        if (tick == (std::numeric_limits<std::uint64_t>::max)())
+        {
+            return clock_type::time_point::max();
+        }
+        return clock_type::time_point(std::chrono::duration_cast<
+            clock_type::duration>(std::chrono::nanoseconds(tick << tick_bits)));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Insert the entry into the lowest level which covers its deadline, the
+    // lock must be held.
+    void timer_wheel::insert(entry& e) noexcept
+    {
+        std::uint64_t tick = e.tick_;
+        if (tick < current_tick_)
+        {
+            tick = current_tick_;    // expired already, fire on next poll
+        }
+
+        std::uint64_t const delta = tick - current_tick_;
+
+        std::size_t level = 0;
+        while (level != num_levels - 1 && delta >= level_granularity(level + 1))
+        {
+            ++level;
+        }
+
+        if (delta >= level_granularity(num_levels))
+        {
+            // beyond the range of the wheel, the entry will be re-inserted
+            // once the farthest slot is cascaded
+            tick = current_tick_ + level_granularity(num_levels) - 1;
+        }
+
+        std::size_t const slot = (tick >> (level * slot_bits)) & slot_mask;
+
+        e.level_ = static_cast<std::uint8_t>(level);
+        e.slot_ = static_cast<std::uint8_t>(slot);
+        e.prev_ = nullptr;
+        e.next_ = slots_[level][slot];
+        if (e.next_ != nullptr)
+        {
+            e.next_->prev_ = &e;
+        }
+        slots_[level][slot] = &e;
+        occupied_[level] |= std::uint64_t(1) << slot;
+    }
+
+    void timer_wheel::unlink(entry& e) noexcept
+    {
+        if (e.prev_ != nullptr)
+        {
+            e.prev_->next_ = e.next_;
+        }
+        else
+        {
+            HPX_ASSERT(slots_[e.level_][e.slot_] == &e);
+            slots_[e.level_][e.slot_] = e.next_;
+            if (e.next_ == nullptr)
+            {
+                occupied_[e.level_] &= ~(std::uint64_t(1) << e.slot_);
+            }
+        }
+
+        if (e.next_ != nullptr)
+        {
+            e.next_->prev_ = e.prev_;
+        }
+        e.prev_ = e.next_ = nullptr;
+    }
+
+    // Move all entries of the current slot of the given level to the lower
+    // levels
+    void timer_wheel::cascade(std::size_t level) noexcept
+    {
+        std::size_t const slot =
+            (current_tick_ >> (level * slot_bits)) & slot_mask;
+
+        entry* e = slots_[level][slot];
+        slots_[level][slot] = nullptr;
+        occupied_[level] &= ~(std::uint64_t(1) << slot);
+
+        while (e != nullptr)
+        {
+            entry* next = e->next_;
+            insert(*e);
+            e = next;
+        }
+    }
+
+    // Compute the first tick at which poll() has to do some work, the lock
+    // must be held.
+    void timer_wheel::update_next_tick() noexcept
+    {
+        if (size_.load(std::memory_order_relaxed) == 0)
+        {
+            next_tick_.store((std::numeric_limits<std::uint64_t>::max)(),
+                std::memory_order_relaxed);
+            return;
+        }
+
+        // the next occupied slot of the lowest level in the current round or
+        // the start of the next round (where the higher levels are cascaded)
+        std::size_t const slot = current_tick_ & slot_mask;
+        std::uint64_t const pending = occupied_[0] >> slot;
+        next_tick_.store(pending != 0 ?
+                current_tick_ + lowest_bit(pending) :
+                (current_tick_ | slot_mask) + 1,
+            std::memory_order_relaxed);
+    }
+}    // namespace hpx::threads::detail
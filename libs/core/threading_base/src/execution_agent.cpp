@@ -14,6 +14,7 @@
 #include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
@@ -26,6 +27,7 @@
 #include <hpx/threading_base/detail/reset_backtrace.hpp>
 #endif
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -213,4 +215,87 @@ namespace hpx::threads {
             thread_schedule_state::pending, statex, thread_priority::normal,
             thread_schedule_hint{}, false);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::string stackless_execution_agent::description() const
+    {
+        return hpx::util::format("{}: {}", thread_->get_thread_id(),
+            thread_->get_description());
+    }
+
+    void stackless_execution_agent::yield(char const* desc)
+    {
+        HPX_ASSERT(os_agent_ != nullptr);
+        set_blocked();
+        os_agent_->yield(desc);
+    }
+
+    void stackless_execution_agent::yield_k(std::size_t k, char const* desc)
+    {
+        HPX_ASSERT(os_agent_ != nullptr);
+
+        // short spins don't give up the worker thread
+        if (k >= 16)
+        {
+            set_blocked();
+        }
+        os_agent_->yield_k(k, desc);
+    }
+
+    void stackless_execution_agent::suspend(char const* desc)
+    {
+        HPX_ASSERT(os_agent_ != nullptr);
+        set_blocked();
+        os_agent_->suspend(desc);
+    }
+
+    void stackless_execution_agent::resume(char const* desc)
+    {
+        HPX_ASSERT(os_agent_ != nullptr);
+        os_agent_->resume(desc);
+    }
+
+    void stackless_execution_agent::abort(char const* desc)
+    {
+        HPX_ASSERT(os_agent_ != nullptr);
+        os_agent_->abort(desc);
+    }
+
+    void stackless_execution_agent::sleep_for(
+        hpx::chrono::steady_duration const& sleep_duration, char const* desc)
+    {
+        HPX_ASSERT(os_agent_ != nullptr);
+        set_blocked();
+        os_agent_->sleep_for(sleep_duration, desc);
+    }
+
+    void stackless_execution_agent::sleep_until(
+        hpx::chrono::steady_time_point const& sleep_time, char const* desc)
+    {
+        HPX_ASSERT(os_agent_ != nullptr);
+        set_blocked();
+        os_agent_->sleep_until(sleep_time, desc);
+    }
+
+    void stackless_execution_agent::set_blocked() noexcept
+    {
+        // leaf tasks subsequently created from the same call site are run on
+        // stackful threads
+        if (call_site_ != nullptr)
+        {
+            call_site_->store(detail::leaf_task_state::suspending,
+                std::memory_order_relaxed);
+        }
+
+        // count every blocking thread only once
+        if (!blocked_)
+        {
+            blocked_ = true;
+            detail::increment_stackless_blocking_count();
+
+            LTM_(warning).format("stackless_execution_agent: stackless thread "
+                                 "({}) blocks its worker thread",
+                thread_->get_thread_id());
+        }
+    }
 }    // namespace hpx::threads
@@ -51,6 +51,7 @@ namespace hpx::threads::policies {
       , polling_function_cuda_(&null_polling_function)
       , polling_work_count_function_mpi_(&null_polling_work_count_function)
       , polling_work_count_function_cuda_(&null_polling_work_count_function)
+      , io_uring_service_(num_threads)
     {
         scheduler_base::set_scheduler_mode(mode);
 
@@ -87,6 +88,26 @@ namespace hpx::threads::policies {
             std::chrono::milliseconds period(std::lround((std::min)(
                 data.max_idle_backoff_time_, std::pow(2.0, exponent))));
 
+            // do not sleep while file operations are in flight, their
+            // completions have to be reaped by this thread
+            if (io_uring_service_.pending(num_thread) != 0)
+            {
+                return;
+            }
+
+            // do not sleep past the expiration of the next timer
+            using clock_type = threads::detail::timer_wheel::clock_type;
+            auto const next_timer = timer_wheel_.next_poll_time();
+            if (next_timer != clock_type::time_point::max())
+            {
+                auto const now = clock_type::now();
+                period = next_timer <= now ?
+                    std::chrono::milliseconds(0) :
+                    (std::min)(period,
+                        std::chrono::ceil<std::chrono::milliseconds>(
+                            next_timer - now));
+            }
+
             ++data.wait_count_;
 
             std::unique_lock<pu_mutex_type> l(mtx_);
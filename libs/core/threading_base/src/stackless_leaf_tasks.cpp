@@ -0,0 +1,105 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_data_stackless.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    namespace {
+
+        std::atomic<bool> stackless_leaf_tasks(false);
+        std::atomic<std::int64_t> blocking_count(0);
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_stackless_leaf_tasks(bool enable) noexcept
+    {
+        stackless_leaf_tasks.store(enable, std::memory_order_relaxed);
+    }
+
+    bool get_stackless_leaf_tasks() noexcept
+    {
+        return stackless_leaf_tasks.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t get_stackless_blocking_count(bool reset)
+    {
+        return util::get_and_reset_value(blocking_count, reset);
+    }
+
+    namespace detail {
+
+        void increment_stackless_blocking_count() noexcept
+        {
+            ++blocking_count;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        leaf_task_scope::leaf_task_scope(
+            std::atomic<leaf_task_state>& call_site) noexcept
+          : call_site_(call_site)
+        {
+            thread_data* self = get_self_id_data();
+            if (self != nullptr && self->is_stackless())
+            {
+                // a stackless thread can't be switched away from, its
+                // execution agent reports blocking operations instead
+                prev_call_site_ = static_cast<thread_data_stackless*>(self)
+                                      ->get_agent()
+                                      .set_leaf_task_call_site(&call_site_);
+            }
+            else
+            {
+                // the agent storage of the OS thread records every switch
+                // between threads, a stackful thread which suspends is
+                // resumed through a switch (possibly on another OS thread)
+                agent_storage_ =
+                    hpx::execution_base::this_thread::detail::
+                        get_agent_storage();
+                agent_switches_ = hpx::execution_base::this_thread::detail::
+                    get_agent_switch_count(agent_storage_);
+            }
+        }
+
+        leaf_task_scope::~leaf_task_scope()
+        {
+            if (agent_storage_ == nullptr)
+            {
+                thread_data* self = get_self_id_data();
+                static_cast<thread_data_stackless*>(self)
+                    ->get_agent()
+                    .set_leaf_task_call_site(prev_call_site_);
+            }
+            else
+            {
+                auto* storage = hpx::execution_base::this_thread::detail::
+                    get_agent_storage();
+                if (storage != agent_storage_ ||
+                    hpx::execution_base::this_thread::detail::
+                            get_agent_switch_count(storage) != agent_switches_)
+                {
+                    call_site_.store(
+                        leaf_task_state::suspending, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            // the task has completed without suspending, this doesn't
+            // override the state of a call site whose tasks have suspended
+            leaf_task_state expected = leaf_task_state::unknown;
+            call_site_.compare_exchange_strong(expected,
+                leaf_task_state::non_suspending, std::memory_order_relaxed);
+        }
+    }    // namespace detail
+}    // namespace hpx::threads
@@ -449,6 +449,32 @@ namespace hpx::this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        // stackless threads can't be suspended, they can only yield their
+        // worker thread (see stackless_leaf_tasks.hpp)
+        if (get_thread_id_data(id)->is_stackless())
+        {
+            if (state != threads::thread_schedule_state::pending)
+            {
+                HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                    "this_thread::suspend",
+                    "stackless thread({}) can't be suspended", id.noref());
+                return threads::thread_restart_state::unknown;
+            }
+
+            if (nextid)
+            {
+                auto* scheduler =
+                    get_thread_id_data(nextid)->get_scheduler_base();
+                scheduler->schedule_thread(
+                    HPX_MOVE(nextid), threads::thread_schedule_hint());
+            }
+            hpx::execution_base::this_thread::yield("this_thread::suspend");
+
+            if (&ec != &throws)
+                ec = make_success_code();
+            return threads::thread_restart_state::signaled;
+        }
+
         threads::thread_restart_state statex =
             threads::thread_restart_state::unknown;
 
@@ -521,6 +547,25 @@ namespace hpx::this_thread {
         if (ec)
             return threads::thread_restart_state::unknown;
 
+        // stackless threads can't be suspended, they wait for the given time
+        // point while blocking their worker thread instead
+        if (get_thread_id_data(id)->is_stackless())
+        {
+            if (nextid)
+            {
+                auto* scheduler =
+                    get_thread_id_data(nextid)->get_scheduler_base();
+                scheduler->schedule_thread(
+                    HPX_MOVE(nextid), threads::thread_schedule_hint());
+            }
+            hpx::execution_base::this_thread::sleep_until(
+                abs_time.value(), "this_thread::suspend");
+
+            if (&ec != &throws)
+                ec = make_success_code();
+            return threads::thread_restart_state::timeout;
+        }
+
         // let the thread manager do other things while waiting
         threads::thread_restart_state statex =
             threads::thread_restart_state::unknown;
@@ -0,0 +1,799 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_sampling.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+
+#if !defined(sigev_notify_thread_id)
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+#define HPX_THREAD_SAMPLING_SUPPORTED
+#endif
+
+namespace hpx::threads::sampling {
+
+    namespace detail {
+
+        std::atomic<bool> enabled(false);
+    }    // namespace detail
+
+    namespace {
+
+        // the maximal number of frames recorded for each sample
+        constexpr std::size_t max_frames = 64;
+
+        // the maximal distance between two consecutive frame pointers,
+        // larger frames end the walk of the call stack
+        constexpr std::uintptr_t max_frame_size = 1 << 20;
+
+        // the maximal number of slots probed while looking for a sample
+        constexpr std::size_t max_probes = 64;
+
+        // what was running on a worker thread while a sample was taken
+        enum class sample_kind : std::uint8_t
+        {
+            scheduler = 0,      // the scheduling loop
+            description = 1,    // an HPX thread with a description
+            address = 2         // an HPX thread with a function address
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Table of distinct samples and their counts, filled in by the
+        // signal handler of the owning thread (single writer, no allocation)
+        // and read concurrently by any other thread. An entry is published by
+        // setting its key, it is never modified afterwards except for its
+        // count.
+        class sample_table
+        {
+            struct entry
+            {
+                std::atomic<std::uint64_t> key{0};    // 0: unused
+                std::atomic<std::uint64_t> count{0};
+                std::uintptr_t value = 0;
+                std::uint32_t num_frames = 0;
+                sample_kind kind = sample_kind::scheduler;
+            };
+
+        public:
+            // must not be called while samples are being recorded
+            void reset(std::size_t capacity, std::size_t frames_per_entry)
+            {
+                std::size_t cap = 1;
+                while (cap < capacity)
+                    cap <<= 1;
+
+                if (cap != capacity_ || frames_per_entry != frames_per_entry_)
+                {
+                    entries_.reset(new entry[cap]);
+                    frames_.reset(frames_per_entry != 0 ?
+                            new void*[cap * frames_per_entry] :
+                            nullptr);
+                    capacity_ = cap;
+                    frames_per_entry_ = frames_per_entry;
+                    return;
+                }
+
+                for (std::size_t i = 0; i != capacity_; ++i)
+                {
+                    entries_[i].key.store(0, std::memory_order_relaxed);
+                    entries_[i].count.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            // called from the signal handler of the owning thread only
+            bool record(sample_kind kind, std::uintptr_t value,
+                void* const* frames, std::size_t num_frames) noexcept
+            {
+                if (capacity_ == 0)
+                {
+                    return false;
+                }
+
+                num_frames = (std::min)(num_frames, frames_per_entry_);
+
+                std::uint64_t const key = hash(kind, value, frames, num_frames);
+                std::size_t const mask = capacity_ - 1;
+                for (std::size_t i = 0; i != (std::min)(capacity_, max_probes);
+                     ++i)
+                {
+                    std::size_t const slot = (key + i) & mask;
+                    entry& e = entries_[slot];
+                    void** stored = get_frames(slot);
+
+                    std::uint64_t const k =
+                        e.key.load(std::memory_order_relaxed);
+                    if (k == 0)
+                    {
+                        e.value = value;
+                        e.kind = kind;
+                        e.num_frames = static_cast<std::uint32_t>(num_frames);
+                        std::copy(frames, frames + num_frames, stored);
+                        e.count.store(1, std::memory_order_relaxed);
+                        e.key.store(key, std::memory_order_release);
+                        return true;
+                    }
+
+                    if (k == key && e.kind == kind && e.value == value &&
+                        e.num_frames == num_frames &&
+                        std::equal(frames, frames + num_frames, stored))
+                    {
+                        e.count.store(
+                            e.count.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // f(kind, value, frames, num_frames, count)
+            template <typename F>
+            void for_each(F&& f) const
+            {
+                for (std::size_t i = 0; i != capacity_; ++i)
+                {
+                    entry const& e = entries_[i];
+                    if (e.key.load(std::memory_order_acquire) == 0)
+                    {
+                        continue;
+                    }
+                    f(e.kind, e.value, get_frames(i),
+                        static_cast<std::size_t>(e.num_frames),
+                        e.count.load(std::memory_order_relaxed));
+                }
+            }
+
+        private:
+            void** get_frames(std::size_t slot) const noexcept
+            {
+                return frames_per_entry_ != 0 ?
+                    &frames_[slot * frames_per_entry_] :
+                    nullptr;
+            }
+
+            static std::uint64_t hash(sample_kind kind, std::uintptr_t value,
+                void* const* frames, std::size_t num_frames) noexcept
+            {
+                // FNV-1a
+                std::uint64_t h = 14695981039346656037ull;
+                auto const combine = [&h](std::uint64_t v) {
+                    h = (h ^ v) * 1099511628211ull;
+                };
+
+                combine(static_cast<std::uint64_t>(kind));
+                combine(value);
+                for (std::size_t i = 0; i != num_frames; ++i)
+                {
+                    combine(reinterpret_cast<std::uintptr_t>(frames[i]));
+                }
+                return h != 0 ? h : 1;
+            }
+
+            std::unique_ptr<entry[]> entries_;
+            std::unique_ptr<void*[]> frames_;
+            std::size_t capacity_ = 0;
+            std::size_t frames_per_entry_ = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct sampled_thread
+        {
+            // the HPX thread currently running on this thread, written by
+            // this thread only, read by its signal handler
+            std::atomic<sample_kind> kind{sample_kind::scheduler};
+            std::atomic<std::uintptr_t> value{0};
+
+            // set while the signal handler is taking a sample
+            std::atomic<bool> sampling{false};
+
+            sample_table table;
+            std::atomic<std::uint64_t> dropped{0};
+
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+            pid_t tid = 0;
+            pthread_t handle{};
+            timer_t timer{};
+            bool has_timer = false;
+#endif
+            bool registered = false;
+        };
+
+        thread_local sampled_thread* current_thread = nullptr;
+
+        ///////////////////////////////////////////////////////////////////////
+        struct registry
+        {
+            std::mutex mtx;    // protects all members
+            std::vector<std::unique_ptr<sampled_thread>> threads;
+            std::vector<sampled_thread*> unused;
+
+            std::uint64_t interval_us = 1000;
+            std::size_t max_entries = 4096;
+            std::atomic<bool> stacks{false};
+            bool handler_installed = false;
+
+            // the sample counts at the last reset of the performance
+            // counters, the empty key is used for the total count
+            std::map<std::string, std::uint64_t> baselines;
+        };
+
+        registry& get_registry()
+        {
+            // intentionally leaked, worker threads may be unregistered during
+            // static destruction
+            static registry* r = new registry;
+            return *r;
+        }
+
+        std::size_t frames_per_entry(registry const& reg) noexcept
+        {
+            return reg.stacks.load(std::memory_order_relaxed) ? max_frames : 0;
+        }
+
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+        ///////////////////////////////////////////////////////////////////////
+        // Record the interrupted instruction followed by the return addresses
+        // found by following the chain of frame pointers. This only reads the
+        // stack of the interrupted thread and is therefore async-signal-safe,
+        // unlike unwinding based on the exception handling tables. The walk
+        // ends at the first frame pointer which doesn't point into the stack
+        // above the previous frame, e.g. in code compiled without frame
+        // pointers or at the outermost frame.
+        std::size_t walk_frames(
+            void** frames, std::size_t max_num_frames, void* context) noexcept
+        {
+            auto const& mcontext =
+                static_cast<ucontext_t const*>(context)->uc_mcontext;
+#if defined(__x86_64__)
+            auto const pc =
+                static_cast<std::uintptr_t>(mcontext.gregs[REG_RIP]);
+            auto fp = static_cast<std::uintptr_t>(mcontext.gregs[REG_RBP]);
+            auto lower = static_cast<std::uintptr_t>(mcontext.gregs[REG_RSP]);
+#elif defined(__aarch64__)
+            auto const pc = static_cast<std::uintptr_t>(mcontext.pc);
+            auto fp = static_cast<std::uintptr_t>(mcontext.regs[29]);
+            auto lower = static_cast<std::uintptr_t>(mcontext.sp);
+#else
+            (void) frames;
+            (void) max_num_frames;
+            (void) context;
+            return 0;
+#endif
+#if defined(__x86_64__) || defined(__aarch64__)
+            std::size_t num_frames = 0;
+            if (max_num_frames == 0 || pc == 0)
+            {
+                return num_frames;
+            }
+            frames[num_frames++] = reinterpret_cast<void*>(pc);
+
+            // each frame holds the frame pointer of its caller followed by
+            // the return address into its caller
+            while (num_frames != max_num_frames && fp >= lower &&
+                fp - lower <= max_frame_size &&
+                fp % alignof(std::uintptr_t) == 0)
+            {
+                auto const* frame = reinterpret_cast<std::uintptr_t const*>(fp);
+                std::uintptr_t const return_address = frame[1];
+                if (return_address == 0)
+                {
+                    break;
+                }
+                frames[num_frames++] = reinterpret_cast<void*>(return_address);
+
+                lower = fp + 2 * sizeof(std::uintptr_t);
+                fp = frame[0];
+            }
+            return num_frames;
+#endif
+        }
+
+        // The signal handler records the description published for the
+        // running HPX thread and the raw addresses of its call stack only,
+        // both are symbolized when the samples are written.
+        void take_sample(sampled_thread& t, void* context) noexcept
+        {
+            sample_kind const kind = t.kind.load(std::memory_order_acquire);
+            std::uintptr_t const value =
+                t.value.load(std::memory_order_acquire);
+
+            void* frames[max_frames];
+            std::size_t num_frames = 0;
+            if (kind != sample_kind::scheduler &&
+                get_registry().stacks.load(std::memory_order_relaxed))
+            {
+                num_frames = walk_frames(frames, max_frames, context);
+            }
+
+            if (!t.table.record(kind, value, frames, num_frames))
+            {
+                t.dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void handle_signal(int, siginfo_t*, void* context)
+        {
+            int const saved_errno = errno;
+
+            sampled_thread* t = current_thread;
+            if (t != nullptr)
+            {
+                t->sampling.store(true);
+                if (detail::enabled.load())
+                {
+                    take_sample(*t, context);
+                }
+                t->sampling.store(false, std::memory_order_release);
+            }
+
+            errno = saved_errno;
+        }
+
+        void install_handler(registry& reg)
+        {
+            if (reg.handler_installed)
+            {
+                return;
+            }
+
+            // the handler is never uninstalled as signals may still be
+            // pending after sampling was disabled
+            struct sigaction sa = {};
+            sa.sa_sigaction = &handle_signal;
+            sa.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&sa.sa_mask);
+            if (sigaction(SIGPROF, &sa, nullptr) != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::kernel_error,
+                    "hpx::threads::sampling::enable",
+                    "could not install the SIGPROF signal handler");
+            }
+            reg.handler_installed = true;
+        }
+
+        void start_timer(sampled_thread& t, std::uint64_t interval_us) noexcept
+        {
+            HPX_ASSERT(!t.has_timer);
+
+            // measure the CPU time consumed by the sampled thread
+            clockid_t clock;
+            if (pthread_getcpuclockid(t.handle, &clock) != 0)
+            {
+                return;
+            }
+
+            struct sigevent sev = {};
+            sev.sigev_notify = SIGEV_THREAD_ID;
+            sev.sigev_signo = SIGPROF;
+            sev.sigev_notify_thread_id = t.tid;
+            if (timer_create(clock, &sev, &t.timer) != 0)
+            {
+                return;
+            }
+
+            struct itimerspec spec = {};
+            spec.it_interval.tv_sec =
+                static_cast<time_t>(interval_us / 1000000);
+            spec.it_interval.tv_nsec =
+                static_cast<long>((interval_us % 1000000) * 1000);
+            spec.it_value = spec.it_interval;
+            if (timer_settime(t.timer, 0, &spec, nullptr) != 0)
+            {
+                timer_delete(t.timer);
+                return;
+            }
+            t.has_timer = true;
+        }
+
+        void stop_timer(sampled_thread& t) noexcept
+        {
+            if (t.has_timer)
+            {
+                timer_delete(t.timer);
+                t.has_timer = false;
+            }
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        std::string get_description(sample_kind kind, std::uintptr_t value)
+        {
+            switch (kind)
+            {
+            case sample_kind::description:
+                return reinterpret_cast<char const*>(value);
+
+            case sample_kind::address:
+                return hpx::util::format("address {:#x}", value);
+
+            default:
+                break;
+            }
+            return "<scheduler>";
+        }
+
+        // the names of functions may not contain the separator of the
+        // folded stacks format
+        std::string sanitize(std::string name)
+        {
+            std::replace(name.begin(), name.end(), ';', ':');
+            std::replace(name.begin(), name.end(), '\n', ' ');
+            return name;
+        }
+
+        std::string get_function_name(void* address)
+        {
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+            Dl_info info = {};
+            if (dladdr(address, &info) != 0 && info.dli_sname != nullptr)
+            {
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(
+                    info.dli_sname, nullptr, nullptr, &status);
+                if (demangled != nullptr)
+                {
+                    std::string name(demangled);
+                    std::free(demangled);
+                    return sanitize(HPX_MOVE(name));
+                }
+                return sanitize(info.dli_sname);
+            }
+#endif
+            return hpx::util::format("{}", address);
+        }
+
+        // sum up the samples per description
+        std::map<std::string, std::uint64_t> collect_histogram(registry& reg)
+        {
+            std::map<std::string, std::uint64_t> histogram;
+            for (auto const& t : reg.threads)
+            {
+                t->table.for_each([&](sample_kind kind, std::uintptr_t value,
+                                      void* const*, std::size_t,
+                                      std::uint64_t count) {
+                    histogram[get_description(kind, value)] += count;
+                });
+            }
+            return histogram;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void set_current(thread_data const* thrd) noexcept
+        {
+            sampled_thread* t = current_thread;
+            if (t == nullptr)
+            {
+                return;
+            }
+
+            // taking the description may acquire a lock, which is why it is
+            // done here and not in the signal handler
+            thread_description const desc = thrd->get_description();
+
+            t->kind.store(sample_kind::scheduler, std::memory_order_release);
+            if (desc.kind() == thread_description::data_type_description)
+            {
+                t->value.store(
+                    reinterpret_cast<std::uintptr_t>(desc.get_description()),
+                    std::memory_order_release);
+                t->kind.store(
+                    sample_kind::description, std::memory_order_release);
+            }
+            else
+            {
+                t->value.store(desc.get_address(), std::memory_order_release);
+                t->kind.store(sample_kind::address, std::memory_order_release);
+            }
+        }
+
+        void reset_current() noexcept
+        {
+            sampled_thread* t = current_thread;
+            if (t != nullptr)
+            {
+                t->kind.store(
+                    sample_kind::scheduler, std::memory_order_release);
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool is_supported() noexcept
+    {
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void register_thread()
+    {
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+        if (current_thread != nullptr)
+        {
+            return;
+        }
+
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> l(reg.mtx);
+
+        sampled_thread* t = nullptr;
+        if (!reg.unused.empty())
+        {
+            t = reg.unused.back();
+            reg.unused.pop_back();
+        }
+        else
+        {
+            reg.threads.push_back(std::make_unique<sampled_thread>());
+            t = reg.threads.back().get();
+            if (detail::enabled.load(std::memory_order_relaxed))
+            {
+                t->table.reset(reg.max_entries, frames_per_entry(reg));
+            }
+        }
+
+        t->kind.store(sample_kind::scheduler, std::memory_order_relaxed);
+        t->tid = static_cast<pid_t>(::syscall(SYS_gettid));
+        t->handle = pthread_self();
+        t->registered = true;
+        current_thread = t;
+
+        if (detail::enabled.load(std::memory_order_relaxed))
+        {
+            start_timer(*t, reg.interval_us);
+        }
+#endif
+    }
+
+    void unregister_thread() noexcept
+    {
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+        sampled_thread* t = current_thread;
+        if (t == nullptr)
+        {
+            return;
+        }
+
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> l(reg.mtx);
+
+        stop_timer(*t);
+        t->registered = false;
+        reg.unused.push_back(t);
+        current_thread = nullptr;
+#endif
+    }
+
+    void enable([[maybe_unused]] std::uint64_t interval_us,
+        [[maybe_unused]] bool stacks, [[maybe_unused]] std::size_t max_entries)
+    {
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+        if (interval_us == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::threads::sampling::enable",
+                "the sampling interval must not be zero");
+        }
+
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> l(reg.mtx);
+
+        install_handler(reg);
+
+        // stop taking samples and wait for all signal handlers still
+        // running to finish before discarding the samples
+        detail::enabled.store(false);
+        for (auto const& t : reg.threads)
+        {
+            stop_timer(*t);
+            while (t->sampling.load())
+            {
+                /**/;
+            }
+        }
+
+        reg.interval_us = interval_us;
+        reg.max_entries = max_entries;
+        reg.stacks.store(stacks, std::memory_order_relaxed);
+        reg.baselines.clear();
+
+        for (auto const& t : reg.threads)
+        {
+            t->table.reset(max_entries, frames_per_entry(reg));
+            t->dropped.store(0, std::memory_order_relaxed);
+        }
+
+        detail::enabled.store(true);
+
+        for (auto const& t : reg.threads)
+        {
+            if (t->registered)
+            {
+                start_timer(*t, interval_us);
+            }
+        }
+#else
+        HPX_THROW_EXCEPTION(hpx::error::not_implemented,
+            "hpx::threads::sampling::enable",
+            "sampling is not supported on this platform");
+#endif
+    }
+
+    void disable() noexcept
+    {
+        detail::enabled.store(false);
+
+#if defined(HPX_THREAD_SAMPLING_SUPPORTED)
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> l(reg.mtx);
+        for (auto const& t : reg.threads)
+        {
+            stop_timer(*t);
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::pair<std::string, std::uint64_t>> get_histogram()
+    {
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> l(reg.mtx);
+
+        auto histogram = collect_histogram(reg);
+        return {histogram.begin(), histogram.end()};
+    }
+
+    std::int64_t get_sample_count(std::string const& description, bool reset)
+    {
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> l(reg.mtx);
+
+        std::uint64_t count = 0;
+        for (auto const& e : collect_histogram(reg))
+        {
+            if (description.empty() || e.first == description)
+            {
+                count += e.second;
+            }
+        }
+
+        std::uint64_t& baseline = reg.baselines[description];
+        std::int64_t const result = static_cast<std::int64_t>(count - baseline);
+        if (reset)
+        {
+            baseline = count;
+        }
+        return result;
+    }
+
+    std::uint64_t dropped_samples() noexcept
+    {
+        registry& reg = get_registry();
+        std::lock_guard<std::mutex> l(reg.mtx);
+
+        std::uint64_t dropped = 0;
+        for (auto const& t : reg.threads)
+        {
+            dropped += t->dropped.load(std::memory_order_relaxed);
+        }
+        return dropped;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void write_folded(std::ostream& os)
+    {
+        // merge the samples of all threads, symbolizing each address only
+        // once
+        std::map<std::string, std::uint64_t> stacks;
+        std::unordered_map<void*, std::string> names;
+        {
+            registry& reg = get_registry();
+            std::lock_guard<std::mutex> l(reg.mtx);
+
+            for (auto const& t : reg.threads)
+            {
+                t->table.for_each([&](sample_kind kind, std::uintptr_t value,
+                                      void* const* frames,
+                                      std::size_t num_frames,
+                                      std::uint64_t count) {
+                    std::string stack = sanitize(get_description(kind, value));
+                    for (std::size_t i = num_frames; i != 0; --i)
+                    {
+                        // all but the innermost frame hold a return address,
+                        // which may already belong to the next function
+                        void* address = frames[i - 1];
+                        if (i != 1)
+                        {
+                            address = static_cast<char*>(address) - 1;
+                        }
+
+                        auto it = names.find(address);
+                        if (it == names.end())
+                        {
+                            it = names
+                                     .emplace(
+                                         address, get_function_name(address))
+                                     .first;
+                        }
+                        stack += ';';
+                        stack += it->second;
+                    }
+                    stacks[HPX_MOVE(stack)] += count;
+                });
+            }
+        }
+
+        for (auto const& e : stacks)
+        {
+            os << e.first << ' ' << e.second << '\n';
+        }
+    }
+
+    void dump(std::string const& filename, std::uint32_t locality_id)
+    {
+        std::string name = filename;
+        std::string const placeholder = "%locality%";
+        for (std::string::size_type p = name.find(placeholder);
+             p != std::string::npos; p = name.find(placeholder, p))
+        {
+            name.replace(p, placeholder.size(), std::to_string(locality_id));
+        }
+
+        std::ofstream out(name);
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::threads::sampling::dump",
+                "could not open samples file: {}", name);
+        }
+
+        write_folded(out);
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::threads::sampling::dump",
+                "could not write samples file: {}", name);
+        }
+    }
+}    // namespace hpx::threads::sampling
@@ -0,0 +1,462 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/threading_base/thread_tracing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    namespace detail {
+
+        std::atomic<bool> enabled(false);
+    }    // namespace detail
+
+    namespace {
+
+        enum class event_type : std::uint8_t
+        {
+            thread_created,
+            thread_executed,
+            parcel_sent,
+            parcel_received
+        };
+
+        struct event
+        {
+            std::uint64_t timestamp;
+            std::uint64_t duration;    // thread_executed only
+            std::uint64_t id;          // thread or parcel id
+            char const* description;    // nullptr if address is valid
+            std::uint64_t address;      // or parcel size
+            std::uint32_t phase;        // or source/destination locality
+            event_type type;
+            thread_schedule_state state;
+        };
+
+        void set_description(
+            event& e, thread_description const& desc) noexcept
+        {
+            if (desc.kind() == thread_description::data_type_description)
+            {
+                e.description = desc.get_description();
+                e.address = 0;
+            }
+            else
+            {
+                e.description = nullptr;
+                e.address = desc.get_address();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The events recorded by one OS thread. The buffer is filled by its
+        // OS thread only, the lock is contended only while the events are
+        // being written.
+        class buffer
+        {
+            static constexpr std::size_t chunk_size = 4096;
+
+        public:
+            buffer(std::size_t seq_num, std::size_t global_thread_num)
+              : seq_num_(seq_num)
+              , global_thread_num_(global_thread_num)
+            {
+            }
+
+            bool push(event const& e, std::size_t max_events) noexcept
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+                if (size_ >= max_events)
+                {
+                    return false;
+                }
+
+                std::size_t const chunk = size_ / chunk_size;
+                if (chunk == chunks_.size())
+                {
+                    try
+                    {
+                        chunks_.push_back(
+                            std::make_unique<event[]>(chunk_size));
+                    }
+                    catch (...)
+                    {
+                        return false;
+                    }
+                }
+
+                chunks_[chunk][size_ % chunk_size] = e;
+                ++size_;
+                return true;
+            }
+
+            void clear() noexcept
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+                size_ = 0;
+            }
+
+            template <typename F>
+            void for_each(F&& f)
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+                for (std::size_t i = 0; i != size_; ++i)
+                {
+                    f(chunks_[i / chunk_size][i % chunk_size]);
+                }
+            }
+
+            std::size_t seq_num() const noexcept
+            {
+                return seq_num_;
+            }
+
+            std::size_t global_thread_num() const noexcept
+            {
+                return global_thread_num_;
+            }
+
+        private:
+            hpx::util::detail::spinlock mtx_;
+            std::vector<std::unique_ptr<event[]>> chunks_;
+            std::size_t size_ = 0;
+            std::size_t const seq_num_;
+            std::size_t const global_thread_num_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct registry
+        {
+            buffer* create_buffer()
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                buffers.push_back(std::make_unique<buffer>(
+                    buffers.size() + 1,
+                    threads::detail::get_global_thread_num_tss()));
+                return buffers.back().get();
+            }
+
+            std::mutex mtx;    // protects buffers
+            std::vector<std::unique_ptr<buffer>> buffers;
+
+            std::atomic<std::size_t> max_events{1048576};
+            std::atomic<std::size_t> dropped{0};
+            std::atomic<std::uint64_t> start{0};
+        };
+
+        registry& get_registry()
+        {
+            // intentionally leaked, the buffers are referenced from thread
+            // local storage
+            static registry* r = new registry;
+            return *r;
+        }
+
+        void record(event const& e) noexcept
+        {
+            static thread_local buffer* buf = nullptr;
+
+            registry& reg = get_registry();
+            if (buf == nullptr)
+            {
+                try
+                {
+                    buf = reg.create_buffer();
+                }
+                catch (...)
+                {
+                    ++reg.dropped;
+                    return;
+                }
+            }
+
+            if (!buf->push(e, reg.max_events.load(std::memory_order_relaxed)))
+            {
+                ++reg.dropped;
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_string(std::ostream& os, char const* str)
+        {
+            os << '"';
+            for (/**/; *str != '\0'; ++str)
+            {
+                char const c = *str;
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    hpx::util::format_to(
+                        os, "\\u{:04x}", static_cast<unsigned>(c));
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+            os << '"';
+        }
+
+        // timestamps are written in microseconds relative to the start of
+        // the trace
+        void write_time(std::ostream& os, std::uint64_t ns)
+        {
+            hpx::util::format_to(os, "{}.{:03}", ns / 1000, ns % 1000);
+        }
+
+        void write_event(std::ostream& os, event const& e,
+            std::uint32_t locality_id, std::size_t tid, std::uint64_t start)
+        {
+            std::uint64_t const ts =
+                e.timestamp > start ? e.timestamp - start : 0;
+
+            os << ",\n{\"name\":";
+            switch (e.type)
+            {
+            case event_type::thread_executed:
+                if (e.description != nullptr)
+                {
+                    write_string(os, e.description);
+                }
+                else
+                {
+                    hpx::util::format_to(os, "\"address {:#x}\"", e.address);
+                }
+                os << ",\"cat\":\"thread\",\"ph\":\"X\",\"ts\":";
+                write_time(os, ts);
+                os << ",\"dur\":";
+                write_time(os, e.duration);
+                hpx::util::format_to(os,
+                    ",\"pid\":{},\"tid\":{},\"args\":{{\"thread\":\"{:#x}\","
+                    "\"phase\":{},\"state\":\"{}\"}}}}",
+                    locality_id, tid, e.id, e.phase,
+                    get_thread_state_name(e.state));
+                break;
+
+            case event_type::thread_created:
+                os << "\"create\",\"cat\":\"thread\",\"ph\":\"i\",\"s\":\"t\","
+                      "\"ts\":";
+                write_time(os, ts);
+                hpx::util::format_to(os,
+                    ",\"pid\":{},\"tid\":{},\"args\":{{\"thread\":\"{:#x}\","
+                    "\"description\":",
+                    locality_id, tid, e.id);
+                if (e.description != nullptr)
+                {
+                    write_string(os, e.description);
+                }
+                else
+                {
+                    hpx::util::format_to(os, "\"address {:#x}\"", e.address);
+                }
+                os << "}}";
+                break;
+
+            case event_type::parcel_sent:
+                [[fallthrough]];
+            case event_type::parcel_received:
+            {
+                bool const sent = e.type == event_type::parcel_sent;
+                os << (sent ? "\"parcel sent\"" : "\"parcel received\"")
+                   << ",\"cat\":\"parcel\",\"ph\":\"i\",\"s\":\"t\",\"ts\":";
+                write_time(os, ts);
+                hpx::util::format_to(os,
+                    ",\"pid\":{},\"tid\":{},\"args\":{{\"parcel\":\"{:#x}\","
+                    "\"size\":{},\"{}\":{}}}}}",
+                    locality_id, tid, e.id, e.address,
+                    sent ? "destination" : "source", e.phase);
+                break;
+            }
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable(std::size_t max_events)
+    {
+        registry& reg = get_registry();
+        {
+            std::lock_guard<std::mutex> l(reg.mtx);
+            for (auto& buf : reg.buffers)
+            {
+                buf->clear();
+            }
+        }
+
+        reg.max_events.store(max_events, std::memory_order_relaxed);
+        reg.dropped.store(0, std::memory_order_relaxed);
+        reg.start.store(now(), std::memory_order_relaxed);
+
+        detail::enabled.store(true, std::memory_order_release);
+    }
+
+    void disable() noexcept
+    {
+        detail::enabled.store(false, std::memory_order_release);
+    }
+
+    void thread_created(thread_id_type const& id,
+        [[maybe_unused]] thread_init_data const& data) noexcept
+    {
+        event e;
+        e.timestamp = now();
+        e.duration = 0;
+        e.id = reinterpret_cast<std::uint64_t>(id.get());
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        set_description(e, data.description);
+#else
+        set_description(e, thread_description());
+#endif
+        e.phase = 0;
+        e.type = event_type::thread_created;
+        e.state = thread_schedule_state::unknown;
+
+        record(e);
+    }
+
+    void thread_executed(thread_data const* thrd, std::uint64_t start,
+        thread_schedule_state state) noexcept
+    {
+        event e;
+        e.timestamp = start;
+        e.duration = now() - start;
+        e.id = reinterpret_cast<std::uint64_t>(thrd);
+        set_description(e, thrd->get_description());
+        e.phase = static_cast<std::uint32_t>(thrd->get_thread_phase());
+        e.type = event_type::thread_executed;
+        e.state = state;
+
+        record(e);
+    }
+
+    void parcel_sent(std::uint64_t parcel_id, std::size_t size,
+        std::uint32_t destination) noexcept
+    {
+        event e;
+        e.timestamp = now();
+        e.duration = 0;
+        e.id = parcel_id;
+        e.description = nullptr;
+        e.address = size;
+        e.phase = destination;
+        e.type = event_type::parcel_sent;
+        e.state = thread_schedule_state::unknown;
+
+        record(e);
+    }
+
+    void parcel_received(std::uint64_t parcel_id, std::size_t size,
+        std::uint32_t source) noexcept
+    {
+        event e;
+        e.timestamp = now();
+        e.duration = 0;
+        e.id = parcel_id;
+        e.description = nullptr;
+        e.address = size;
+        e.phase = source;
+        e.type = event_type::parcel_received;
+        e.state = thread_schedule_state::unknown;
+
+        record(e);
+    }
+
+    std::size_t dropped_events() noexcept
+    {
+        return get_registry().dropped.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void write(std::ostream& os, std::uint32_t locality_id)
+    {
+        registry& reg = get_registry();
+        std::uint64_t const start = reg.start.load(std::memory_order_relaxed);
+
+        hpx::util::format_to(os,
+            "{{\"displayTimeUnit\":\"ns\",\"otherData\":{{\"locality\":{},"
+            "\"dropped_events\":{}}},\"traceEvents\":[\n"
+            "{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},"
+            "\"args\":{{\"name\":\"locality#{}\"}}}}",
+            locality_id, dropped_events(), locality_id, locality_id);
+
+        std::lock_guard<std::mutex> l(reg.mtx);
+        for (auto& buf : reg.buffers)
+        {
+            std::size_t const tid = buf->seq_num();
+            std::size_t const num_thread = buf->global_thread_num();
+            if (num_thread != static_cast<std::size_t>(-1))
+            {
+                hpx::util::format_to(os,
+                    ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},"
+                    "\"tid\":{},\"args\":{{\"name\":\"worker-thread#{}\"}}}},"
+                    "\n{{\"name\":\"thread_sort_index\",\"ph\":\"M\","
+                    "\"pid\":{},\"tid\":{},\"args\":{{\"sort_index\":{}}}}}",
+                    locality_id, tid, num_thread, locality_id, tid,
+                    num_thread);
+            }
+            else
+            {
+                hpx::util::format_to(os,
+                    ",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},"
+                    "\"tid\":{},\"args\":{{\"name\":\"os-thread#{}\"}}}}",
+                    locality_id, tid, tid);
+            }
+
+            buf->for_each([&](event const& e) {
+                write_event(os, e, locality_id, tid, start);
+            });
+        }
+
+        os << "\n]}\n";
+    }
+
+    void dump(std::string const& filename, std::uint32_t locality_id)
+    {
+        std::string name = filename;
+        std::string const placeholder = "%locality%";
+        for (std::string::size_type p = name.find(placeholder);
+             p != std::string::npos; p = name.find(placeholder, p))
+        {
+            name.replace(p, placeholder.size(), std::to_string(locality_id));
+        }
+
+        std::ofstream out(name);
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::threads::tracing::dump",
+                "could not open trace file: {}", name);
+        }
+
+        write(out, locality_id);
+        if (!out)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::threads::tracing::dump",
+                "could not write trace file: {}", name);
+        }
+    }
+}    // namespace hpx::threads::tracing
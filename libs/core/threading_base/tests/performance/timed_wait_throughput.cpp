@@ -0,0 +1,160 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  This benchmark measures the throughput of timed waits, both for waits
+//  which time out (sleep_for) and for waits which are satisfied before their
+//  timeout expires (condition_variable::wait_for with a notifying partner),
+//  i.e. the cost of arming and of canceling a timer.
+
+#include <hpx/local/condition_variable.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Each task sleeps 'waits' times for the given duration
+double expiring_waits(
+    std::size_t tasks, std::size_t waits, std::chrono::microseconds delay)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(tasks);
+    for (std::size_t i = 0; i != tasks; ++i)
+    {
+        futures.push_back(hpx::async([waits, delay]() {
+            for (std::size_t j = 0; j != waits; ++j)
+            {
+                hpx::this_thread::sleep_for(delay);
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Pairs of tasks take turns, each waits with a (long) timeout for its partner
+// to notify it
+struct ping_pong
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+    std::size_t turn = 0;
+    std::size_t timeouts = 0;
+};
+
+void take_turns(ping_pong& p, std::size_t self, std::size_t waits,
+    std::chrono::milliseconds timeout)
+{
+    std::unique_lock<hpx::mutex> l(p.mtx);
+    for (std::size_t j = 0; j != waits; ++j)
+    {
+        while (p.turn % 2 != self)
+        {
+            if (p.cond.wait_for(l, timeout) == hpx::cv_status::timeout)
+            {
+                ++p.timeouts;
+            }
+        }
+        ++p.turn;
+        p.cond.notify_one();
+    }
+}
+
+double canceled_waits(std::size_t tasks, std::size_t waits,
+    std::chrono::milliseconds timeout, std::size_t& timeouts)
+{
+    std::vector<ping_pong> pairs((tasks + 1) / 2);
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(2 * pairs.size());
+    for (auto& p : pairs)
+    {
+        futures.push_back(hpx::async(
+            &take_turns, std::ref(p), std::size_t(0), waits, timeout));
+        futures.push_back(hpx::async(
+            &take_turns, std::ref(p), std::size_t(1), waits, timeout));
+    }
+    hpx::wait_all(futures);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    timeouts = 0;
+    for (auto const& p : pairs)
+    {
+        timeouts += p.timeouts;
+    }
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const waits = vm["waits"].as<std::size_t>();
+    std::chrono::microseconds const delay(vm["delay"].as<std::uint64_t>());
+    std::chrono::milliseconds const timeout(vm["timeout"].as<std::uint64_t>());
+
+    std::size_t const total = tasks * waits;
+
+    double const expiring_time = expiring_waits(tasks, waits, delay);
+    std::cout << "Expiring waits:  " << (total / expiring_time)
+              << " [op/s] (" << (expiring_time / total) << " [s/op])\n";
+
+    // every notification ends one wait of the partner task
+    std::size_t timeouts = 0;
+    double const canceled_time =
+        canceled_waits(tasks, waits, timeout, timeouts);
+    std::size_t const canceled_total = 2 * ((tasks + 1) / 2) * waits;
+    std::cout << "Canceled waits:  " << (canceled_total / canceled_time)
+              << " [op/s] (" << (canceled_time / canceled_total)
+              << " [s/op], " << timeouts << " timeouts)\n";
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::size_t>()->default_value(1000),
+         "number of concurrently waiting tasks (default: 1000)")
+        ("waits", value<std::size_t>()->default_value(100),
+         "number of timed waits per task (default: 100)")
+        ("delay", value<std::uint64_t>()->default_value(100),
+         "duration of the expiring waits in microseconds (default: 100)")
+        ("timeout", value<std::uint64_t>()->default_value(1000),
+         "timeout of the canceled waits in milliseconds (default: 1000)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,97 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sampling = hpx::threads::sampling;
+
+///////////////////////////////////////////////////////////////////////////////
+double sampled_task()
+{
+    // keep the worker thread busy for a while
+    double result = 0.0;
+    hpx::chrono::high_resolution_timer t;
+    while (t.elapsed() < 0.1)
+    {
+        for (std::size_t i = 0; i != 1000; ++i)
+        {
+            result += static_cast<double>(i) * 0.5;
+        }
+    }
+    return result;
+}
+
+int hpx_main()
+{
+    if (!sampling::is_supported())
+    {
+        HPX_TEST_THROW(sampling::enable(), hpx::exception);
+        return hpx::local::finalize();
+    }
+
+    sampling::enable(100, true);
+    HPX_TEST(sampling::is_enabled());
+
+    std::vector<hpx::future<double>> tasks;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        tasks.push_back(hpx::async(
+            hpx::annotated_function(&sampled_task, "sampled_task")));
+    }
+    hpx::wait_all(tasks);
+
+    sampling::disable();
+    HPX_TEST(!sampling::is_enabled());
+
+    std::int64_t const total = sampling::get_sample_count("", false);
+    HPX_TEST_LT(std::int64_t(0), total);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    std::uint64_t count = 0;
+    for (auto const& e : sampling::get_histogram())
+    {
+        if (e.first == "sampled_task")
+        {
+            count = e.second;
+        }
+    }
+    HPX_TEST_LT(std::uint64_t(0), count);
+    HPX_TEST_EQ(sampling::get_sample_count("sampled_task", false),
+        static_cast<std::int64_t>(count));
+
+    std::stringstream strm;
+    sampling::write_folded(strm);
+    HPX_TEST_NEQ(strm.str().find("sampled_task"), std::string::npos);
+#endif
+
+    // resetting the count does not discard the samples
+    HPX_TEST_EQ(sampling::get_sample_count("", true), total);
+    HPX_TEST_EQ(sampling::get_sample_count("", false), std::int64_t(0));
+    HPX_TEST_NEQ(sampling::get_histogram().size(), std::size_t(0));
+
+    // enabling the sampling again discards all samples
+    sampling::enable();
+    sampling::disable();
+    HPX_TEST_LT(sampling::get_sample_count("", false), total);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,85 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tracing = hpx::threads::tracing;
+
+///////////////////////////////////////////////////////////////////////////////
+void traced_task()
+{
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+std::size_t count_created(std::string const& trace)
+{
+    std::string const create = "\"name\":\"create\"";
+
+    std::size_t count = 0;
+    for (std::size_t p = trace.find(create); p != std::string::npos;
+         p = trace.find(create, p + create.size()))
+    {
+        ++count;
+    }
+    return count;
+}
+
+int hpx_main()
+{
+    tracing::enable();
+    HPX_TEST(tracing::is_enabled());
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        tasks.push_back(
+            hpx::async(hpx::annotated_function(&traced_task, "traced_task")));
+    }
+    hpx::wait_all(tasks);
+
+    tracing::disable();
+    HPX_TEST(!tracing::is_enabled());
+    HPX_TEST_EQ(tracing::dropped_events(), std::size_t(0));
+
+    std::stringstream strm;
+    tracing::write(strm, 0);
+
+    std::string const trace = strm.str();
+    HPX_TEST_NEQ(trace.find("\"traceEvents\":["), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"name\":\"create\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"state\":\"pending\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"state\":\"terminated\""), std::string::npos);
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_NEQ(trace.find("\"name\":\"traced_task\""), std::string::npos);
+#endif
+
+    // threads are not recorded while tracing is disabled
+    hpx::async(&traced_task).get();
+
+    std::stringstream strm2;
+    tracing::write(strm2, 0);
+    HPX_TEST_EQ(count_created(strm2.str()), count_created(trace));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
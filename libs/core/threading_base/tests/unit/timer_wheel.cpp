@@ -0,0 +1,128 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+using clock_type = timer_wheel::clock_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_wheel_expiration()
+{
+    timer_wheel wheel;
+    HPX_TEST(wheel.empty());
+    HPX_TEST(wheel.next_poll_time() == clock_type::time_point::max());
+
+    // the deadlines cover all levels of the wheel
+    std::vector<std::chrono::microseconds> const delays = {
+        std::chrono::microseconds(0), std::chrono::microseconds(10),
+        std::chrono::microseconds(500), std::chrono::milliseconds(5),
+        std::chrono::milliseconds(50), std::chrono::milliseconds(300)};
+
+    std::vector<timer_wheel::entry> entries(delays.size());
+    std::vector<clock_type::time_point> deadlines(delays.size());
+    std::vector<clock_type::time_point> fired(delays.size());
+
+    auto const now = clock_type::now();
+    for (std::size_t i = 0; i != delays.size(); ++i)
+    {
+        deadlines[i] = now + delays[i];
+        wheel.add(entries[i], deadlines[i],
+            [&, i](std::size_t) { fired[i] = clock_type::now(); });
+    }
+    HPX_TEST_EQ(wheel.size(), delays.size());
+    HPX_TEST(wheel.next_poll_time() <= deadlines[0] + timer_wheel::resolution);
+
+    std::size_t count = 0;
+    while (count != delays.size())
+    {
+        count += wheel.poll(0);
+    }
+    HPX_TEST(wheel.empty());
+
+    // timers never fire early
+    for (std::size_t i = 0; i != delays.size(); ++i)
+    {
+        HPX_TEST(fired[i] >= deadlines[i]);
+    }
+}
+
+void test_wheel_cancel()
+{
+    timer_wheel wheel;
+
+    bool fired = false;
+    timer_wheel::entry near, far;
+    wheel.add(near, clock_type::now() + std::chrono::milliseconds(1),
+        [&](std::size_t) { fired = true; });
+
+    // far beyond the range of the wheel
+    wheel.add(far, clock_type::now() + std::chrono::hours(24),
+        [&](std::size_t) { fired = true; });
+    HPX_TEST_EQ(wheel.size(), std::size_t(2));
+
+    HPX_TEST(wheel.cancel(near));
+    HPX_TEST(!wheel.cancel(near));
+    HPX_TEST_EQ(wheel.size(), std::size_t(1));
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(5));
+    HPX_TEST_EQ(wheel.poll(0), std::size_t(0));
+    HPX_TEST(!fired);
+
+    HPX_TEST(wheel.cancel(far));
+    HPX_TEST(wheel.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_timed_suspension()
+{
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async([i]() {
+            auto const delay = std::chrono::microseconds(100 * (i % 50));
+            auto const start = clock_type::now();
+            hpx::this_thread::sleep_for(delay);
+            HPX_TEST(clock_type::now() - start >= delay);
+        }));
+    }
+    hpx::wait_all(futures);
+
+    // waits which are ended before the timer expires cancel the timer
+    hpx::promise<void> p;
+    hpx::future<void> f = p.get_future();
+    hpx::future<void> waiting = hpx::async([&f]() {
+        HPX_TEST(f.wait_for(std::chrono::seconds(60)) ==
+            hpx::future_status::ready);
+    });
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    p.set_value();
+    waiting.get();
+}
+
+int hpx_main()
+{
+    test_wheel_expiration();
+    test_wheel_cancel();
+    test_timed_suspension();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -127,6 +127,22 @@ namespace hpx { namespace threads {
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.init_threads_count",
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
+        bool const hierarchical_stealing =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.hierarchical_stealing",
+                HPX_THREAD_QUEUE_HIERARCHICAL_STEALING) != 0;
+        std::int64_t const max_steal_batch_size =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_steal_batch_size",
+                HPX_THREAD_QUEUE_MAX_STEAL_BATCH_SIZE);
+        std::int64_t const core_group_size =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.core_group_size",
+                HPX_THREAD_QUEUE_CORE_GROUP_SIZE);
+        std::int64_t const min_tasks_to_steal_numa =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.min_tasks_to_steal_numa",
+                HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_NUMA);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
 
@@ -144,7 +160,8 @@ namespace hpx { namespace threads {
             min_add_new_count, max_add_new_count, min_delete_count,
             max_delete_count, max_terminated_threads, init_threads_count,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            large_stacksize, huge_stacksize, hierarchical_stealing,
+            max_steal_batch_size, core_group_size, min_tasks_to_steal_numa);
     }
 
     void threadmanager::create_scheduler_user_defined(
@@ -11,6 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
+#include <hpx/cache/concurrent_lru_cache.hpp>
 #include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
@@ -66,11 +67,20 @@ namespace hpx { namespace agas {
         using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
             hpx::util::cache::statistics::local_full_statistics>;
 
+        // Entries referring to a single object (count == 1) are stored in a
+        // sharded cache which can be accessed without acquiring the global
+        // gva_cache_mtx_. Range entries rely on the overlap based ordering of
+        // gva_cache_key and remain in gva_cache_.
+        using gva_object_cache_type =
+            hpx::util::cache::concurrent_lru_cache<naming::gid_type, gva,
+                hpx::util::cache::statistics::local_full_statistics>;
+
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
         mutable mutex_type gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
+        std::shared_ptr<gva_object_cache_type> gva_object_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
@@ -950,8 +960,7 @@ namespace hpx { namespace agas {
         ///                   before the parcel has been delivered to its
         ///                   destination.
         void route(parcelset::parcel p,
-            hpx::function<void(
-                std::error_code const&, parcelset::parcel const&)>&&,
+            parcelset::parcel_write_handler_type&&,
             threads::thread_priority local_priority =
                 threads::thread_priority::default_);
 #endif
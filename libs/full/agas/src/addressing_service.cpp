@@ -120,6 +120,7 @@ namespace hpx { namespace agas {
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
+      , gva_object_cache_(new gva_object_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
       , refcnt_requests_count_(0)
@@ -135,7 +136,10 @@ namespace hpx { namespace agas {
       , locality_()
     {
         if (caching_)
+        {
             gva_cache_->reserve(ini_.get_agas_local_cache_size());
+            gva_object_cache_->reserve(ini_.get_agas_local_cache_size());
+        }
     }
 
     void addressing_service::bootstrap(
@@ -192,8 +196,10 @@ namespace hpx { namespace agas {
         // create the hierarchy based on the topology
         if (caching_)
         {
-            std::size_t previous = gva_cache_->size();
+            std::size_t previous =
+                gva_cache_->size() + gva_object_cache_->size();
             gva_cache_->reserve(cache_size);
+            gva_object_cache_->reserve(cache_size);
 
             LAGAS_(info).format(
                 "addressing_service::adjust_local_cache_size, previous size: "
@@ -1218,16 +1224,14 @@ namespace hpx { namespace agas {
 #if defined(HPX_HAVE_NETWORKING)
     ///////////////////////////////////////////////////////////////////////////
     void addressing_service::route(parcelset::parcel p,
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&
-            f,
+        parcelset::parcel_write_handler_type&& f,
         threads::thread_priority local_priority)
     {
         if (HPX_UNLIKELY(nullptr == threads::get_self_ptr()))
         {
             // reschedule this call as an HPX thread
             void (addressing_service::*route_ptr)(parcelset::parcel,
-                hpx::function<void(
-                    std::error_code const&, parcelset::parcel const&)>&&,
+                parcelset::parcel_write_handler_type&&,
                 threads::thread_priority) = &addressing_service::route;
 
             threads::thread_init_data data(
@@ -1650,6 +1654,17 @@ namespace hpx { namespace agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
+            // single objects don't need the global lock, their keys can't
+            // collide with other entries
+            if (count == 1)
+            {
+                gva_object_cache_->update(gid, g);
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
             const gva_cache_key key(gid, count);
 
             {
@@ -1700,6 +1715,15 @@ namespace hpx { namespace agas {
         {
             return false;
         }
+
+        naming::gid_type const stripped_gid =
+            naming::detail::get_stripped_gid(gid);
+        if (gva_object_cache_->get_entry(stripped_gid, gva))
+        {
+            idbase = stripped_gid;
+            return true;
+        }
+
         gva_cache_key k(gid);
         gva_cache_key idbase_key;
 
@@ -1740,6 +1764,8 @@ namespace hpx { namespace agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
+            gva_object_cache_->clear();
+
             std::lock_guard<mutex_type> lock(gva_cache_mtx_);
 
             gva_cache_->clear();
@@ -1787,6 +1813,8 @@ namespace hpx { namespace agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
+            gva_object_cache_->erase(gid);
+
             std::lock_guard<mutex_type> lock(gva_cache_mtx_);
 
             gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
@@ -1816,84 +1844,122 @@ namespace hpx { namespace agas {
 
     ///////////////////////////////////////////////////////////////////////////
     // Helper functions to access the current cache statistics
+    namespace detail {
+
+        // combine the statistics of the range cache and of all shards of the
+        // object cache
+        template <typename F>
+        std::uint64_t accumulate_cache_statistics(
+            addressing_service& service, F&& f)
+        {
+            std::uint64_t result = 0;
+            {
+                std::lock_guard<addressing_service::mutex_type> lock(
+                    service.gva_cache_mtx_);
+                result = static_cast<std::uint64_t>(
+                    f(service.gva_cache_->get_statistics()));
+            }
+
+            service.gva_object_cache_->for_each_statistics(
+                [&](auto& stats) {
+                    result += static_cast<std::uint64_t>(f(stats));
+                });
+            return result;
+        }
+    }    // namespace detail
+
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
     {
+        std::uint64_t const object_entries = gva_object_cache_->size();
+
         std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->size();
+        return gva_cache_->size() + object_entries;
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.hits(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.misses(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.evictions(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.insertions(reset);
+        });
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_get_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_insert_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_update_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_erase_entry_count(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_get_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_insert_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_update_entry_time(reset);
+        });
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return detail::accumulate_cache_statistics(*this, [reset](auto& stats) {
+            return stats.get_erase_entry_time(reset);
+        });
     }
 
     void addressing_service::register_server_instances()
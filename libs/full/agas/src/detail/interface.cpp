@@ -496,8 +496,7 @@ namespace hpx { namespace agas { namespace detail { namespace impl {
 #if defined(HPX_HAVE_NETWORKING)
     ///////////////////////////////////////////////////////////////////////////
     void route(parcelset::parcel&& p,
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&
-            f,
+        parcelset::parcel_write_handler_type&& f,
         threads::thread_priority local_priority)
     {
         return naming::get_agas_client().route(
@@ -67,8 +67,7 @@ namespace hpx { namespace agas {
 
 #if defined(HPX_HAVE_NETWORKING)
         void route(parcelset::parcel&& p,
-            hpx::function<void(
-                std::error_code const&, parcelset::parcel const&)>&& f);
+            parcelset::parcel_write_handler_type&& f);
 #endif
 
         resolved_type resolve_gid(naming::gid_type const& id);
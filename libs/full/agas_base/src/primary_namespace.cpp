@@ -207,8 +207,7 @@ namespace hpx { namespace agas {
 
 #if defined(HPX_HAVE_NETWORKING)
     void primary_namespace::route(parcelset::parcel&& p,
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&
-            f)
+        parcelset::parcel_write_handler_type&& f)
     {
         // compose request
         naming::gid_type const& id = p.destination();
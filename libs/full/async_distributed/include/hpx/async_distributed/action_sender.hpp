@@ -0,0 +1,742 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file action_sender.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/basic_action.hpp>
+#include <hpx/actions_base/traits/action_priority.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/base_lco_with_value.hpp>
+#include <hpx/async_distributed/continuation.hpp>
+#include <hpx/async_distributed/detail/post_callback.hpp>
+#include <hpx/async_distributed/detail/promise_lco.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/server/component_heap.hpp>
+#include <hpx/components_base/server/managed_component_base.hpp>
+#include <hpx/components_base/traits/component_type_database.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/invoke_fused.hpp>
+#include <hpx/futures/traits/get_remote_result.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/parcelset_base/parcel_interface.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::distributed::experimental::detail {
+
+    // The interface the LCO used as the continuation of a remote action
+    // invocation reports its result to.
+    template <typename Result>
+    struct action_completion_base
+    {
+        using value_type =
+            std::conditional_t<std::is_void_v<Result>, util::unused_type,
+                Result>;
+
+        virtual void set_result(value_type&& result) = 0;
+        virtual void set_exception(std::exception_ptr const& e) = 0;
+
+    protected:
+        ~action_completion_base() = default;
+    };
+
+    // The LCO the response of a remote action invocation is sent to. As
+    // set_value_action is a direct action, the result is passed on from the
+    // thread decoding the response parcel without creating a shared state.
+    template <typename Result, typename RemoteResult>
+    class action_sender_lco final
+      : public lcos::base_lco_with_value<Result, RemoteResult>
+    {
+        using base_type = lcos::base_lco_with_value<Result, RemoteResult>;
+        using result_type = typename base_type::result_type;
+
+    public:
+        explicit action_sender_lco(
+            action_completion_base<Result>* target) noexcept
+          : target_(target)
+        {
+        }
+
+        void set_value(RemoteResult&& result) override
+        {
+            if constexpr (std::is_void_v<Result>)
+            {
+                target_->set_result(util::unused_type());
+            }
+            else
+            {
+                target_->set_result(
+                    hpx::traits::get_remote_result<Result, RemoteResult>::call(
+                        HPX_MOVE(result)));
+            }
+        }
+
+        void set_exception(std::exception_ptr const& e) override
+        {
+            target_->set_exception(e);
+        }
+
+        result_type get_value() override
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "action_sender_lco::get_value",
+                "the result of an action sender can't be queried");
+        }
+
+        // This is the component id. Every component needs to have an
+        // embedded enumerator 'value' which is used by the generic action
+        // implementation to associate this component with a given action.
+        enum
+        {
+            value = components::component_promise
+        };
+
+    private:
+        template <typename>
+        friend struct components::detail_adl_barrier::init;
+
+        void set_back_ptr(components::managed_component<action_sender_lco>* bp)
+        {
+            HPX_ASSERT(bp);
+            HPX_UNUSED(bp);
+        }
+
+        // intrusive reference counting, noop since the lifetime of the LCO
+        // is controlled by the operation state embedding it
+        friend void intrusive_ptr_add_ref(action_sender_lco* /*p*/) noexcept {}
+        friend void intrusive_ptr_release(action_sender_lco* /*p*/) noexcept {}
+
+        action_completion_base<Result>* target_;
+    };
+}    // namespace hpx::distributed::experimental::detail
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx {
+
+    namespace traits {
+
+        template <typename Result, typename RemoteResult>
+        struct managed_component_dtor_policy<
+            distributed::experimental::detail::action_sender_lco<Result,
+                RemoteResult>>
+        {
+            using type = managed_object_is_lifetime_controlled;
+        };
+
+        template <typename Result, typename RemoteResult>
+        struct component_type_database<
+            distributed::experimental::detail::action_sender_lco<Result,
+                RemoteResult>>
+        {
+            static components::component_type value;
+
+            static components::component_type get() noexcept
+            {
+                // Like promises, the LCOs are never created remotely, we can
+                // assign the component types locally.
+                if (value == components::component_invalid)
+                {
+                    value = derived_component_type(++detail::unique_type,
+                        components::component_base_lco_with_value);
+                }
+                return value;
+            }
+
+            static void set(components::component_type /* t */)
+            {
+                HPX_ASSERT(false);
+            }
+        };
+
+        template <typename Result, typename RemoteResult>
+        components::component_type component_type_database<
+            distributed::experimental::detail::action_sender_lco<Result,
+                RemoteResult>>::value = components::component_invalid;
+    }    // namespace traits
+
+    namespace components::detail {
+
+        template <typename Result, typename RemoteResult>
+        struct component_heap_impl<hpx::components::managed_component<
+            distributed::experimental::detail::action_sender_lco<Result,
+                RemoteResult>>>
+        {
+            using valid = void;
+            using heap_type = typename hpx::components::managed_component<
+                distributed::experimental::detail::action_sender_lco<Result,
+                    RemoteResult>>::heap_type;
+
+            HPX_ALWAYS_EXPORT static heap_type& call()
+            {
+                util::reinitializable_static<heap_type> heap;
+                return heap.get();
+            }
+        };
+    }    // namespace components::detail
+}    // namespace hpx
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::distributed::experimental::detail {
+
+    // A single invocation of a (remote) action whose result is delivered to
+    // an LCO embedded in this object. The invocation is finished once the
+    // result has arrived and the parcel has been sent, only then finish() is
+    // called. This guarantees that neither the LCO nor the parcel write
+    // handler refer to this object after it has been completed.
+    template <typename Action>
+    class remote_invocation
+      : public action_completion_base<typename hpx::traits::extract_action<
+            Action>::type::local_result_type>
+    {
+    public:
+        using action_type = typename hpx::traits::extract_action<Action>::type;
+        using result_type = typename action_type::local_result_type;
+        using remote_result_type = typename action_type::remote_result_type;
+        using value_type =
+            typename action_completion_base<result_type>::value_type;
+
+    private:
+        using lco_type = action_sender_lco<result_type, remote_result_type>;
+        using wrapping_type = components::managed_component<lco_type>;
+
+        struct write_handler
+        {
+            remote_invocation* invocation;
+
+#if defined(HPX_HAVE_NETWORKING)
+            void operator()(
+                std::error_code const& ec, parcelset::parcel const& p) const
+            {
+                if (ec)
+                {
+                    invocation->on_sent(HPX_GET_EXCEPTION(ec,
+                        "remote_invocation::write_handler",
+                        parcelset::dump_parcel(p)));
+                }
+                else
+                {
+                    invocation->on_sent(std::exception_ptr());
+                }
+            }
+#else
+            void operator()() const
+            {
+                invocation->on_sent(std::exception_ptr());
+            }
+#endif
+        };
+
+    public:
+        remote_invocation() noexcept
+          : lco_(this)
+        {
+        }
+
+        remote_invocation(remote_invocation const&) = delete;
+        remote_invocation(remote_invocation&&) = delete;
+        remote_invocation& operator=(remote_invocation const&) = delete;
+        remote_invocation& operator=(remote_invocation&&) = delete;
+
+        ~remote_invocation()
+        {
+            if (wrapper_ != nullptr)
+            {
+                std::destroy_at(wrapper_);
+                hpx::components::component_heap<wrapping_type>().free(
+                    wrapper_);
+            }
+        }
+
+        // Invoke the action on the given target, the result will be sent
+        // back to the embedded LCO.
+        template <typename... Ts>
+        void invoke(hpx::id_type const& id, Ts&&... vs)
+        {
+            HPX_ASSERT(wrapper_ == nullptr);
+
+            // The gid of the LCO is taken from the (pooled) component heap,
+            // the LCO itself is embedded, its lifetime is not managed by
+            // AGAS.
+            void* ptr =
+                hpx::components::component_heap<wrapping_type>().alloc();
+            wrapper_ = new (ptr) wrapping_type(&lco_);
+
+            hpx::id_type cont_id(wrapper_->get_unmanaged_id());
+            naming::detail::set_dont_store_in_cache(cont_id);
+
+            naming::address addr(agas::get_locality(),
+                components::get_component_type<lco_type>(), wrapper_);
+
+            // the caller keeps the target alive, send an unmanaged id
+            hpx::id_type target = id;
+            if (id.get_management_type() ==
+                hpx::id_type::management_type::managed)
+            {
+                target = hpx::id_type(
+                    id.get_gid(), hpx::id_type::management_type::unmanaged);
+            }
+
+            hpx::post_p_cb<action_type>(
+                actions::typed_continuation<result_type, remote_result_type>(
+                    HPX_MOVE(cont_id), HPX_MOVE(addr)),
+                target, actions::action_priority<action_type>(),
+                write_handler{this}, HPX_FORWARD(Ts, vs)...);
+        }
+
+        bool has_exception() const noexcept
+        {
+            return static_cast<bool>(exception_);
+        }
+
+        std::exception_ptr& get_exception() noexcept
+        {
+            return exception_;
+        }
+
+        value_type& get_result() noexcept
+        {
+            HPX_ASSERT(result_.has_value());
+            return *result_;
+        }
+
+    protected:
+        // called once the invocation has finished, either with a result or
+        // with an exception
+        virtual void finish() = 0;
+
+    private:
+        void set_result(value_type&& result) override
+        {
+            result_.emplace(HPX_MOVE(result));
+            arrive();
+        }
+
+        void set_exception(std::exception_ptr const& e) override
+        {
+            exception_ = e;
+            arrive();
+        }
+
+        void on_sent(std::exception_ptr&& e)
+        {
+            if (e)
+            {
+                // the result won't arrive if the parcel couldn't be sent
+                int expected = 2;
+                if (outstanding_.compare_exchange_strong(expected, 0))
+                {
+                    exception_ = HPX_MOVE(e);
+                    finish();
+                    return;
+                }
+            }
+            arrive();
+        }
+
+        void arrive()
+        {
+            if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                finish();
+            }
+        }
+
+        lco_type lco_;
+        wrapping_type* wrapper_ = nullptr;
+
+        // the result and the parcel write handler are outstanding
+        std::atomic<int> outstanding_{2};
+
+        hpx::optional<value_type> result_;
+        std::exception_ptr exception_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Result>
+    struct action_sender_signatures
+    {
+        using type = hpx::execution::experimental::completion_signatures<
+            hpx::execution::experimental::set_value_t(Result),
+            hpx::execution::experimental::set_error_t(std::exception_ptr)>;
+    };
+
+    template <>
+    struct action_sender_signatures<void>
+    {
+        using type = hpx::execution::experimental::completion_signatures<
+            hpx::execution::experimental::set_value_t(),
+            hpx::execution::experimental::set_error_t(std::exception_ptr)>;
+    };
+
+    template <typename Result>
+    using action_sender_signatures_t =
+        typename action_sender_signatures<Result>::type;
+
+    // the bulk action sender sends the results of all invocations
+    template <typename Result>
+    struct bulk_action_result
+    {
+        using type = std::vector<Result>;
+    };
+
+    template <>
+    struct bulk_action_result<void>
+    {
+        using type = void;
+    };
+
+    template <typename Result>
+    using bulk_action_result_t = typename bulk_action_result<Result>::type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Action, typename... Ts>
+    struct action_sender
+    {
+        using action_type = typename hpx::traits::extract_action<Action>::type;
+        using result_type = typename action_type::local_result_type;
+
+        hpx::id_type id;
+        hpx::tuple<Ts...> args;
+
+        template <typename Receiver>
+        struct operation_state final : remote_invocation<Action>
+        {
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+            hpx::id_type id;
+            hpx::tuple<Ts...> args;
+
+            template <typename Receiver_, typename Args>
+            operation_state(
+                Receiver_&& receiver, hpx::id_type const& id, Args&& args)
+              : receiver(HPX_FORWARD(Receiver_, receiver))
+              , id(id)
+              , args(HPX_FORWARD(Args, args))
+            {
+            }
+
+            friend void tag_invoke(
+                hpx::execution::experimental::start_t,
+                operation_state& os) noexcept
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        hpx::invoke_fused(
+                            [&](auto&&... vs) {
+                                os.invoke(os.id, HPX_MOVE(vs)...);
+                            },
+                            os.args);
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                    });
+            }
+
+        private:
+            void finish() override
+            {
+                if (this->has_exception())
+                {
+                    hpx::execution::experimental::set_error(
+                        HPX_MOVE(receiver), HPX_MOVE(this->get_exception()));
+                }
+                else if constexpr (std::is_void_v<result_type>)
+                {
+                    hpx::execution::experimental::set_value(HPX_MOVE(receiver));
+                }
+                else
+                {
+                    hpx::execution::experimental::set_value(
+                        HPX_MOVE(receiver), HPX_MOVE(this->get_result()));
+                }
+            }
+        };
+
+        template <typename Receiver>
+        friend operation_state<Receiver> tag_invoke(
+            hpx::execution::experimental::connect_t, action_sender&& s,
+            Receiver&& receiver)
+        {
+            return {HPX_FORWARD(Receiver, receiver), s.id, HPX_MOVE(s.args)};
+        }
+
+        template <typename Receiver>
+        friend operation_state<Receiver> tag_invoke(
+            hpx::execution::experimental::connect_t, action_sender& s,
+            Receiver&& receiver)
+        {
+            return {HPX_FORWARD(Receiver, receiver), s.id, s.args};
+        }
+    };
+
+    template <typename Action, typename... Ts, typename Env>
+    auto tag_invoke(hpx::execution::experimental::get_completion_signatures_t,
+        action_sender<Action, Ts...> const&, Env) noexcept
+        -> action_sender_signatures_t<
+            typename action_sender<Action, Ts...>::result_type>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Action, typename... Ts>
+    struct bulk_action_sender
+    {
+        using action_type = typename hpx::traits::extract_action<Action>::type;
+        using result_type = typename action_type::local_result_type;
+
+        std::vector<hpx::id_type> ids;
+        hpx::tuple<Ts...> args;
+
+        template <typename Receiver>
+        struct operation_state
+        {
+            struct target_invocation final : remote_invocation<Action>
+            {
+                operation_state* op = nullptr;
+
+            private:
+                void finish() override
+                {
+                    op->arrive();
+                }
+            };
+
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+            std::vector<hpx::id_type> ids;
+            hpx::tuple<Ts...> args;
+            std::unique_ptr<target_invocation[]> invocations;
+            std::atomic<std::size_t> outstanding{0};
+
+            template <typename Receiver_, typename Ids, typename Args>
+            operation_state(Receiver_&& receiver, Ids&& ids, Args&& args)
+              : receiver(HPX_FORWARD(Receiver_, receiver))
+              , ids(HPX_FORWARD(Ids, ids))
+              , args(HPX_FORWARD(Args, args))
+            {
+            }
+
+            operation_state(operation_state&&) = delete;
+            operation_state& operator=(operation_state&&) = delete;
+            operation_state(operation_state const&) = delete;
+            operation_state& operator=(operation_state const&) = delete;
+
+            friend void tag_invoke(
+                hpx::execution::experimental::start_t,
+                operation_state& os) noexcept
+            {
+                std::size_t const size = os.ids.size();
+                if (size == 0)
+                {
+                    os.outstanding.store(1, std::memory_order_relaxed);
+                    os.arrive();
+                    return;
+                }
+
+                std::size_t started = 0;
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        os.invocations.reset(new target_invocation[size]);
+
+                        // the last invocation finishing completes the
+                        // receiver, keep one reference until all have been
+                        // started
+                        os.outstanding.store(
+                            size + 1, std::memory_order_relaxed);
+                        for (/**/; started != size; ++started)
+                        {
+                            os.invocations[started].op = &os;
+                            hpx::invoke_fused(
+                                [&](auto const&... vs) {
+                                    os.invocations[started].invoke(
+                                        os.ids[started], vs...);
+                                },
+                                os.args);
+                        }
+                        os.arrive();
+                    },
+                    [&](std::exception_ptr ep) {
+                        if (started == 0)
+                        {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(os.receiver), HPX_MOVE(ep));
+                            return;
+                        }
+
+                        // report the error once the invocations which have
+                        // already been started have finished
+                        os.exception = HPX_MOVE(ep);
+                        std::size_t const count = size - started + 1;
+                        if (os.outstanding.fetch_sub(
+                                count, std::memory_order_acq_rel) == count)
+                        {
+                            os.complete();
+                        }
+                    });
+            }
+
+        private:
+            void arrive()
+            {
+                if (outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    complete();
+                }
+            }
+
+            void complete()
+            {
+                std::size_t const size = ids.size();
+                if (!exception)
+                {
+                    // report the first exception in target order
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        if (invocations[i].has_exception())
+                        {
+                            exception =
+                                HPX_MOVE(invocations[i].get_exception());
+                            break;
+                        }
+                    }
+                }
+
+                if (exception)
+                {
+                    hpx::execution::experimental::set_error(
+                        HPX_MOVE(receiver), HPX_MOVE(exception));
+                }
+                else if constexpr (std::is_void_v<result_type>)
+                {
+                    hpx::execution::experimental::set_value(HPX_MOVE(receiver));
+                }
+                else
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() {
+                            std::vector<result_type> results;
+                            results.reserve(size);
+                            for (std::size_t i = 0; i != size; ++i)
+                            {
+                                results.push_back(
+                                    HPX_MOVE(invocations[i].get_result()));
+                            }
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(receiver), HPX_MOVE(results));
+                        },
+                        [&](std::exception_ptr ep) {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(receiver), HPX_MOVE(ep));
+                        });
+                }
+            }
+
+            std::exception_ptr exception;
+        };
+
+        template <typename Receiver>
+        friend operation_state<Receiver> tag_invoke(
+            hpx::execution::experimental::connect_t, bulk_action_sender&& s,
+            Receiver&& receiver)
+        {
+            return {HPX_FORWARD(Receiver, receiver), HPX_MOVE(s.ids),
+                HPX_MOVE(s.args)};
+        }
+
+        template <typename Receiver>
+        friend operation_state<Receiver> tag_invoke(
+            hpx::execution::experimental::connect_t, bulk_action_sender& s,
+            Receiver&& receiver)
+        {
+            return {HPX_FORWARD(Receiver, receiver), s.ids, s.args};
+        }
+    };
+
+    template <typename Action, typename... Ts, typename Env>
+    auto tag_invoke(hpx::execution::experimental::get_completion_signatures_t,
+        bulk_action_sender<Action, Ts...> const&, Env) noexcept
+        -> action_sender_signatures_t<bulk_action_result_t<
+            typename bulk_action_sender<Action, Ts...>::result_type>>;
+}    // namespace hpx::distributed::experimental::detail
+
+namespace hpx::distributed::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Returns a sender invoking the action on the given target once it is
+    /// started. The sender sends the result of the action (or nothing if the
+    /// action returns void), an exception thrown by the action is sent as an
+    /// error.
+    ///
+    /// Unlike hpx::async, no future or shared state is created: the response
+    /// of the (remote) invocation is sent to an LCO embedded in the operation
+    /// state and the receiver is completed directly from the thread decoding
+    /// the response parcel (or the thread executing the action if the target
+    /// is local). The target and the arguments are stored in the sender, the
+    /// arguments are moved into the parcel when the sender is started.
+    ///
+    /// \note The receiver may be completed on a thread handling parcels,
+    ///       continuations performing substantial work should be transferred
+    ///       to a scheduler using continues_on.
+    template <typename Action, typename... Ts>
+    detail::action_sender<Action, std::decay_t<Ts>...> async_action(
+        hpx::id_type const& id, Ts&&... vs)
+    {
+        return {id, hpx::make_tuple(HPX_FORWARD(Ts, vs)...)};
+    }
+
+    template <typename Component, typename Signature, typename Derived,
+        typename... Ts>
+    detail::action_sender<Derived, std::decay_t<Ts>...> async_action(
+        hpx::actions::basic_action<Component, Signature, Derived> /*act*/,
+        hpx::id_type const& id, Ts&&... vs)
+    {
+        return {id, hpx::make_tuple(HPX_FORWARD(Ts, vs)...)};
+    }
+
+    /// Returns a sender invoking the action with the same arguments on all
+    /// given targets (e.g. all localities) once it is started. The sender
+    /// sends a std::vector holding the results in the order of the targets
+    /// (or nothing if the action returns void) once all invocations have
+    /// finished. If any of the invocations failed, the exception of the
+    /// first failed invocation (in the order of the targets) is sent as an
+    /// error.
+    template <typename Action, typename... Ts>
+    detail::bulk_action_sender<Action, std::decay_t<Ts>...> bulk_async_action(
+        std::vector<hpx::id_type> ids, Ts&&... vs)
+    {
+        return {HPX_MOVE(ids), hpx::make_tuple(HPX_FORWARD(Ts, vs)...)};
+    }
+
+    template <typename Component, typename Signature, typename Derived,
+        typename... Ts>
+    detail::bulk_action_sender<Derived, std::decay_t<Ts>...> bulk_async_action(
+        hpx::actions::basic_action<Component, Signature, Derived> /*act*/,
+        std::vector<hpx::id_type> ids, Ts&&... vs)
+    {
+        return {HPX_MOVE(ids), hpx::make_tuple(HPX_FORWARD(Ts, vs)...)};
+    }
+}    // namespace hpx::distributed::experimental
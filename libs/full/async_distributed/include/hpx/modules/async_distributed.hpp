@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <hpx/async_distributed/action_sender.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_distributed/async_callback.hpp>
 #include <hpx/async_distributed/async_continue.hpp>
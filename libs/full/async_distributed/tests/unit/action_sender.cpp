@@ -0,0 +1,246 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/async_distributed/action_sender.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace dex = hpx::distributed::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int32_t increment(std::int32_t i)
+{
+    return i + 1;
+}
+HPX_PLAIN_ACTION(increment)
+
+std::atomic<int> void_calls(0);
+
+void do_nothing()
+{
+    ++void_calls;
+}
+HPX_PLAIN_ACTION(do_nothing)
+
+std::int32_t throw_error(std::int32_t i)
+{
+    if (i != 0)
+    {
+        throw std::runtime_error("throw_error");
+    }
+    return i;
+}
+HPX_PLAIN_ACTION(throw_error)
+
+std::uint32_t get_locality_id()
+{
+    return hpx::get_locality_id();
+}
+HPX_PLAIN_ACTION(get_locality_id)
+
+///////////////////////////////////////////////////////////////////////////////
+struct decrement_server
+  : hpx::components::managed_component_base<decrement_server>
+{
+    std::int32_t call(std::int32_t i) const
+    {
+        return i - 1;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(decrement_server, call)
+};
+
+typedef hpx::components::managed_component<decrement_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, decrement_server)
+
+typedef decrement_server::call_action call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_action_sender(hpx::id_type const& target)
+{
+    {
+        auto result =
+            tt::sync_wait(dex::async_action<increment_action>(target, 42));
+        HPX_TEST_EQ(hpx::get<0>(*result), 43);
+    }
+
+    {
+        increment_action inc;
+        auto s = dex::async_action(inc, target, 42);
+
+        // the sender can be started more than once
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(s)), 43);
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(s)), 43);
+    }
+
+    {
+        // composing remote invocations doesn't require futures
+        auto s = dex::async_action<increment_action>(target, 40) |
+            ex::then([](std::int32_t i) { return i + 1; }) |
+            ex::let_value([&](std::int32_t i) {
+                return dex::async_action<increment_action>(target, i);
+            });
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(HPX_MOVE(s))), 43);
+    }
+
+    {
+        int const calls = void_calls.load();
+        tt::sync_wait(dex::async_action<do_nothing_action>(target));
+        if (target == hpx::find_here())
+        {
+            HPX_TEST_EQ(void_calls.load(), calls + 1);
+        }
+    }
+
+    {
+        hpx::id_type dec =
+            hpx::components::new_<decrement_server>(target).get();
+
+        auto result =
+            tt::sync_wait(dex::async_action<call_action>(HPX_MOVE(dec), 42));
+        HPX_TEST_EQ(hpx::get<0>(*result), 41);
+    }
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            tt::sync_wait(dex::async_action<throw_error_action>(target, 1));
+            HPX_TEST(false);
+        }
+        catch (std::exception const& e)
+        {
+            caught_exception = true;
+            HPX_TEST(std::string(e.what()).find("throw_error") !=
+                std::string::npos);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    {
+        // errors can be handled in the pipeline
+        auto s = dex::async_action<throw_error_action>(target, 1) |
+            ex::let_error([](std::exception_ptr) { return ex::just(-1); });
+        HPX_TEST_EQ(hpx::get<0>(*tt::sync_wait(HPX_MOVE(s))), -1);
+    }
+
+    {
+        // many concurrent invocations
+        std::vector<decltype(dex::async_action<increment_action>(
+            target, std::int32_t()))>
+            senders;
+        for (std::int32_t i = 0; i != 100; ++i)
+        {
+            senders.push_back(dex::async_action<increment_action>(target, i));
+        }
+
+        auto result = tt::sync_wait(ex::when_all_vector(HPX_MOVE(senders)));
+        std::vector<std::int32_t> const& values = hpx::get<0>(*result);
+        HPX_TEST_EQ(values.size(), std::size_t(100));
+        for (std::int32_t i = 0; i != 100; ++i)
+        {
+            HPX_TEST_EQ(values[i], i + 1);
+        }
+    }
+}
+
+void test_bulk_action_sender(std::vector<hpx::id_type> const& localities)
+{
+    {
+        auto result = tt::sync_wait(
+            dex::bulk_async_action<get_locality_id_action>(localities));
+        std::vector<std::uint32_t> const& ids = hpx::get<0>(*result);
+
+        HPX_TEST_EQ(ids.size(), localities.size());
+        for (std::size_t i = 0; i != localities.size(); ++i)
+        {
+            HPX_TEST_EQ(ids[i], hpx::naming::get_locality_id_from_id(
+                                    localities[i]));
+        }
+    }
+
+    {
+        increment_action inc;
+        auto s = dex::bulk_async_action(inc, localities, 1) |
+            ex::then([](std::vector<std::int32_t> values) {
+                std::int32_t sum = 0;
+                for (std::int32_t v : values)
+                {
+                    sum += v;
+                }
+                return sum;
+            });
+
+        auto result = tt::sync_wait(HPX_MOVE(s));
+        HPX_TEST_EQ(hpx::get<0>(*result),
+            static_cast<std::int32_t>(2 * localities.size()));
+    }
+
+    {
+        tt::sync_wait(dex::bulk_async_action<do_nothing_action>(localities));
+    }
+
+    {
+        auto result = tt::sync_wait(dex::bulk_async_action<increment_action>(
+            std::vector<hpx::id_type>(), 1));
+        HPX_TEST(hpx::get<0>(*result).empty());
+    }
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            tt::sync_wait(
+                dex::bulk_async_action<throw_error_action>(localities, 1));
+            HPX_TEST(false);
+        }
+        catch (std::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    for (hpx::id_type const& id : localities)
+    {
+        test_action_sender(id);
+    }
+    test_bulk_action_sender(localities);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
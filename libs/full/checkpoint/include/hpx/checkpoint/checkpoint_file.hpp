@@ -0,0 +1,521 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines functions writing checkpoints directly to files and
+/// restoring them from memory mapped files. In contrast to save_checkpoint,
+/// the serialized data is never held in memory as a whole. Each object is
+/// serialized by its own task and streamed to its own region of the file in
+/// chunks. Incremental checkpoints store only the objects which were
+/// modified and refer to an earlier checkpoint file for all other objects.
+
+/// \file hpx/checkpoint/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/preprocess_container.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Options controlling how checkpoint files are written
+    struct checkpoint_file_options
+    {
+        /// The size of the chunks the serialized data of each object is
+        /// written in. While one chunk is being written, the serialization
+        /// continues into a second one.
+        std::size_t chunk_size = 4 * 1024 * 1024;
+
+        /// Flush the file to the storage device before it is made visible
+        /// under its final name.
+        bool sync = false;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // An object passed to an incremental checkpoint together with the
+        // information whether it has been modified
+        template <typename T>
+        struct checkpoint_tracked_object
+        {
+            T const& t;
+            bool dirty;
+        };
+
+        template <typename T>
+        T const& checkpoint_object(T const& t) noexcept
+        {
+            return t;
+        }
+
+        template <typename T>
+        T const& checkpoint_object(
+            checkpoint_tracked_object<T> const& t) noexcept
+        {
+            return t.t;
+        }
+
+        template <typename T>
+        constexpr bool checkpoint_object_dirty(T const&) noexcept
+        {
+            return true;
+        }
+
+        template <typename T>
+        constexpr bool checkpoint_object_dirty(
+            checkpoint_tracked_object<T> const& t) noexcept
+        {
+            return t.dirty;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The file a checkpoint is being written to. The file is created
+        // under a temporary name and is renamed once it was committed.
+        class HPX_EXPORT checkpoint_file_writer
+        {
+        public:
+            // marks objects stored in the base checkpoint
+            static constexpr std::uint64_t in_base = ~std::uint64_t(0);
+
+            checkpoint_file_writer(std::string filename, std::string base,
+                std::vector<std::uint64_t> const& sizes,
+                checkpoint_file_options const& options);
+            ~checkpoint_file_writer();
+
+            checkpoint_file_writer(checkpoint_file_writer const&) = delete;
+            checkpoint_file_writer& operator=(
+                checkpoint_file_writer const&) = delete;
+
+            std::uint64_t offset(std::size_t index) const noexcept
+            {
+                return offsets_[index];
+            }
+
+            std::uint64_t size(std::size_t index) const noexcept
+            {
+                return sizes_[index];
+            }
+
+            std::size_t chunk_size() const noexcept
+            {
+                return options_.chunk_size;
+            }
+
+            // write the given data at the given position of the file
+            void write(
+                void const* data, std::size_t size, std::uint64_t offset) const;
+
+            // make the file visible under its final name
+            void commit();
+
+        private:
+            std::string filename_;
+            std::string tmp_filename_;
+            checkpoint_file_options options_;
+            std::vector<std::uint64_t> offsets_;
+            std::vector<std::uint64_t> sizes_;
+            int fd_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialization container streaming the data of one object to its
+        // region of the checkpoint file. Full chunks are written
+        // asynchronously while the serialization continues.
+        class HPX_EXPORT checkpoint_file_stream
+        {
+        public:
+            checkpoint_file_stream(
+                checkpoint_file_writer const& file, std::size_t index);
+            ~checkpoint_file_stream();
+
+            checkpoint_file_stream(checkpoint_file_stream const&) = delete;
+            checkpoint_file_stream& operator=(
+                checkpoint_file_stream const&) = delete;
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void resize(std::size_t count)
+            {
+                size_ += count;
+            }
+
+            void write(void const* address, std::size_t count,
+                std::size_t current);
+
+            // write the remaining data and wait for all writes to finish
+            void close();
+
+        private:
+            void submit();
+            void wait();
+
+            checkpoint_file_writer const& file_;
+            std::uint64_t offset_;
+            std::uint64_t expected_size_;
+            std::size_t size_;
+            std::uint64_t written_;
+            std::vector<char> buffers_[2];
+            std::size_t current_buffer_;
+            std::size_t fill_;
+            hpx::future<void> pending_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialization container referring to the data of one object
+        // inside a memory mapped checkpoint file
+        struct checkpoint_region
+        {
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            char const& operator[](std::size_t i) const noexcept
+            {
+                return data_[i];
+            }
+
+            char const* data_;
+            std::size_t size_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Arrays are stored such that they can be referred to in place when
+        // the checkpoint is restored from the mapped file
+        inline constexpr hpx::serialization::archive_flags
+            checkpoint_file_archive_flags =
+                hpx::serialization::archive_flags::enable_zero_copy_receive;
+
+        template <typename T>
+        std::uint64_t checkpoint_object_size(T const& t)
+        {
+            hpx::serialization::detail::preprocess_container data;
+            {
+                hpx::serialization::output_archive ar(
+                    data, checkpoint_file_archive_flags);
+                ar.get_extra_data<checkpointing_tag>();
+                hpx::serialization::detail::serialize_one(ar, t);
+            }
+            return static_cast<std::uint64_t>(data.size());
+        }
+
+        template <typename T>
+        void save_checkpoint_object(
+            checkpoint_file_writer const& file, std::size_t index, T const& t)
+        {
+            checkpoint_file_stream stream(file, index);
+            {
+                hpx::serialization::output_archive ar(
+                    stream, checkpoint_file_archive_flags);
+                ar.get_extra_data<checkpointing_tag>();
+                hpx::serialization::detail::serialize_one(ar, t);
+            }
+            stream.close();
+        }
+
+        template <std::size_t... Is, typename... Ts>
+        void save_checkpoint_file_impl(std::index_sequence<Is...>,
+            std::string filename, std::string base,
+            checkpoint_file_options const& options, Ts const&... ts)
+        {
+            // determine the size of the modified objects concurrently
+            std::vector<hpx::future<std::uint64_t>> size_futures;
+            size_futures.reserve(sizeof...(Ts));
+            (size_futures.push_back(checkpoint_object_dirty(ts) ?
+                     hpx::async([&t = checkpoint_object(ts)]() {
+                         return checkpoint_object_size(t);
+                     }) :
+                     hpx::make_ready_future(checkpoint_file_writer::in_base)),
+                ...);
+
+            hpx::wait_all(size_futures);
+
+            std::vector<std::uint64_t> sizes;
+            sizes.reserve(sizeof...(Ts));
+            for (auto& f : size_futures)
+            {
+                sizes.push_back(f.get());
+            }
+
+            checkpoint_file_writer file(
+                HPX_MOVE(filename), HPX_MOVE(base), sizes, options);
+
+            // serialize and write the modified objects concurrently
+            std::vector<hpx::future<void>> futures;
+            futures.reserve(sizeof...(Ts));
+            (
+                [&](std::size_t index, auto const& t) {
+                    if (checkpoint_object_dirty(t))
+                    {
+                        futures.push_back(
+                            hpx::async([&file, index,
+                                           &obj = checkpoint_object(t)]() {
+                                save_checkpoint_object(file, index, obj);
+                            }));
+                    }
+                }(Is, ts),
+                ...);
+
+            hpx::wait_all(futures);
+            for (auto& f : futures)
+            {
+                f.get();    // rethrow exceptions
+            }
+
+            file.commit();
+        }
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Mark an object passed to save_checkpoint_file as modified (or not)
+    ///
+    /// \param t            The object to store.
+    /// \param dirty        Whether the object was modified since the
+    ///                     checkpoint the new checkpoint is based on.
+    ///
+    /// Objects which are not dirty are not written to incremental
+    /// checkpoints, the checkpoint refers to the base checkpoint instead.
+    template <typename T>
+    detail::checkpoint_tracked_object<T> mark_dirty(
+        T const& t, bool dirty = true) noexcept
+    {
+        return detail::checkpoint_tracked_object<T>{t, dirty};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// save_checkpoint_file
+    ///
+    /// \param options      Options controlling how the file is written.
+    /// \param filename     The name of the checkpoint file to create.
+    /// \param ts           The objects to store.
+    ///
+    /// Save_checkpoint_file serializes the given objects directly into the
+    /// given file. Each object is serialized by a separate task and its data
+    /// is streamed to disk in chunks, the data is never held in memory as a
+    /// whole. The file is created under a temporary name and replaces any
+    /// existing file of the given name only once all data was written.
+    ///
+    /// The objects are referenced, not copied. They must not be modified
+    /// (or destroyed) before the returned future has become ready.
+    ///
+    /// \returns A future which becomes ready once the checkpoint was written.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file(checkpoint_file_options options,
+        std::string filename, Ts const&... ts)
+    {
+        return hpx::async(
+            [options = HPX_MOVE(options), filename = HPX_MOVE(filename)](
+                Ts const&... ts) mutable {
+                detail::save_checkpoint_file_impl(
+                    std::index_sequence_for<Ts...>(), HPX_MOVE(filename),
+                    std::string(), options, detail::checkpoint_object(ts)...);
+            },
+            std::cref(ts)...);
+    }
+
+    /// \copydoc save_checkpoint_file
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file(
+        std::string filename, Ts const&... ts)
+    {
+        return save_checkpoint_file(
+            checkpoint_file_options(), HPX_MOVE(filename), ts...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// save_checkpoint_file_delta
+    ///
+    /// \param options      Options controlling how the file is written.
+    /// \param filename     The name of the checkpoint file to create.
+    /// \param base         The name of the checkpoint file the new
+    ///                     checkpoint is based on. It has to store the same
+    ///                     number of objects.
+    /// \param ts           The objects to store. Objects wrapped using
+    ///                     mark_dirty(t, false) are not written, the new
+    ///                     checkpoint refers to the base checkpoint instead.
+    ///
+    /// Save_checkpoint_file_delta creates an incremental checkpoint storing
+    /// only the modified objects. The base checkpoint (and any checkpoint
+    /// it is based on) has to be kept for the new checkpoint to be
+    /// restorable.
+    ///
+    /// \returns A future which becomes ready once the checkpoint was written.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file_delta(
+        checkpoint_file_options options, std::string filename,
+        std::string base, Ts const&... ts)
+    {
+        return hpx::async(
+            [options = HPX_MOVE(options), filename = HPX_MOVE(filename),
+                base = HPX_MOVE(base)](Ts const&... ts) mutable {
+                detail::save_checkpoint_file_impl(
+                    std::index_sequence_for<Ts...>(), HPX_MOVE(filename),
+                    HPX_MOVE(base), options, ts...);
+            },
+            std::cref(ts)...);
+    }
+
+    /// \copydoc save_checkpoint_file_delta
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_file_delta(
+        std::string filename, std::string base, Ts const&... ts)
+    {
+        return save_checkpoint_file_delta(checkpoint_file_options(),
+            HPX_MOVE(filename), HPX_MOVE(base), ts...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A checkpoint file mapped into memory
+    ///
+    /// The objects stored in the checkpoint are de-serialized on request
+    /// directly from the mapped file. Arrays stored in place (e.g.
+    /// hpx::serialization::buffer_view) refer to the mapped file, which
+    /// stays mapped as long as such objects exist. Checkpoint files an
+    /// incremental checkpoint is based on are mapped once one of the objects
+    /// stored in them is restored.
+    class HPX_EXPORT mapped_checkpoint
+    {
+    public:
+        explicit mapped_checkpoint(std::string filename);
+        ~mapped_checkpoint();
+
+        mapped_checkpoint(mapped_checkpoint&&) noexcept;
+        mapped_checkpoint& operator=(mapped_checkpoint&&) noexcept;
+
+        /// Return the number of objects stored in the checkpoint
+        std::size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+
+        /// Return the name of the checkpoint file
+        std::string const& filename() const noexcept
+        {
+            return filename_;
+        }
+
+        /// Return the name of the checkpoint file this checkpoint is based
+        /// on (empty if this is not an incremental checkpoint)
+        std::string const& base_filename() const noexcept
+        {
+            return base_filename_;
+        }
+
+        /// Restore the object stored at the given position
+        template <typename T>
+        void restore_object(std::size_t index, T& t) const
+        {
+            auto [region, owner] = get_region(index);
+
+            hpx::serialization::input_archive ar(region, region.size());
+            ar.set_buffer_owner(HPX_MOVE(owner));
+            hpx::serialization::detail::serialize_one(ar, t);
+        }
+
+        /// Restore all objects, the objects have to be passed in the same
+        /// order as they were passed to save_checkpoint_file.
+        template <typename... Ts>
+        void restore(Ts&... ts) const
+        {
+            if (sizeof...(Ts) != size())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::util::mapped_checkpoint::restore",
+                    "the number of objects to restore ({}) does not match "
+                    "the number of objects stored in the checkpoint {} ({})",
+                    sizeof...(Ts), filename_, size());
+            }
+
+            std::size_t index = 0;
+            (restore_object(index++, ts), ...);
+        }
+
+    private:
+        struct entry
+        {
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        std::pair<detail::checkpoint_region, std::shared_ptr<void const>>
+        get_region(std::size_t index) const;
+
+        std::string filename_;
+        std::string base_filename_;
+        std::shared_ptr<void const> mapping_;
+        char const* data_;
+        std::size_t size_;
+        std::vector<entry> entries_;
+
+        mutable std::mutex mtx_;
+        mutable std::unique_ptr<mapped_checkpoint> base_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// restore_checkpoint_file
+    ///
+    /// \param filename     The name of the checkpoint file to restore.
+    /// \param ts           The objects to restore, they have to be passed in
+    ///                     the same order as they were passed to
+    ///                     save_checkpoint_file.
+    ///
+    /// Restore_checkpoint_file maps the given checkpoint file into memory
+    /// and restores the given objects from it.
+    template <typename... Ts>
+    void restore_checkpoint_file(std::string filename, Ts&... ts)
+    {
+        mapped_checkpoint(HPX_MOVE(filename)).restore(ts...);
+    }
+}    // namespace hpx::util
+
+/// \cond NOINTERNAL
+namespace hpx::traits {
+
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_file_stream>
+      : default_serialization_access_data<util::detail::checkpoint_file_stream>
+    {
+        static std::size_t size(
+            util::detail::checkpoint_file_stream const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static void resize(
+            util::detail::checkpoint_file_stream& cont, std::size_t count)
+        {
+            cont.resize(count);
+        }
+
+        static void write(util::detail::checkpoint_file_stream& cont,
+            std::size_t count, std::size_t current, void const* address)
+        {
+            cont.write(address, count, current);
+        }
+    };
+}    // namespace hpx::traits
+/// \endcond
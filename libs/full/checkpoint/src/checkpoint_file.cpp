@@ -0,0 +1,572 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#if !defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    namespace {
+
+        // Layout of a checkpoint file: the header is followed by one entry
+        // per object, the name of the base checkpoint (if any), and the data
+        // of the objects stored in this file (each aligned to 64 bytes)
+        constexpr char file_magic[8] = {'H', 'P', 'X', 'C', 'K', 'P', 'T', 0};
+        constexpr std::uint32_t file_version = 1;
+        constexpr std::uint64_t file_alignment = 64;
+
+        struct file_header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t reserved;
+            std::uint64_t num_objects;
+            std::uint64_t base_name_size;
+            std::uint64_t file_size;
+        };
+
+        struct file_entry
+        {
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        constexpr std::uint64_t align_offset(std::uint64_t offset) noexcept
+        {
+            return (offset + file_alignment - 1) & ~(file_alignment - 1);
+        }
+
+        [[noreturn]] void throw_filesystem_error(char const* function,
+            char const* operation, std::string const& filename)
+        {
+            int const error = errno;
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error, function,
+                "{} failed for checkpoint file {}: {}", operation, filename,
+                std::strerror(error));
+        }
+
+        [[noreturn]] void throw_invalid_file(
+            std::string const& filename, char const* reason)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "hpx::util::mapped_checkpoint::mapped_checkpoint",
+                "{} is not a valid checkpoint file: {}", filename, reason);
+        }
+    }    // namespace
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        checkpoint_file_writer::checkpoint_file_writer(std::string filename,
+            std::string base, std::vector<std::uint64_t> const& sizes,
+            checkpoint_file_options const& options)
+          : filename_(HPX_MOVE(filename))
+          , tmp_filename_(filename_ + ".tmp")
+          , options_(options)
+          , offsets_(sizes.size(), in_base)
+          , sizes_(sizes)
+          , fd_(-1)
+        {
+#if defined(HPX_WINDOWS)
+            HPX_THROW_EXCEPTION(hpx::error::not_implemented,
+                "hpx::util::save_checkpoint_file",
+                "checkpoint files are not supported on this platform");
+#else
+            if (options_.chunk_size == 0)
+            {
+                options_.chunk_size = checkpoint_file_options().chunk_size;
+            }
+
+            bool const stores_all = std::none_of(sizes_.begin(), sizes_.end(),
+                [](std::uint64_t size) { return size == in_base; });
+
+            if (base.empty() && !stores_all)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::util::save_checkpoint_file_delta",
+                    "unmodified objects require a base checkpoint for {}",
+                    filename_);
+            }
+            if (!base.empty())
+            {
+                if (base == filename_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "hpx::util::save_checkpoint_file_delta",
+                        "a checkpoint can't be based on itself ({})",
+                        filename_);
+                }
+
+                mapped_checkpoint const base_checkpoint(base);
+                if (base_checkpoint.size() != sizes_.size())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "hpx::util::save_checkpoint_file_delta",
+                        "the base checkpoint {} stores {} objects, expected "
+                        "{}",
+                        base, base_checkpoint.size(), sizes_.size());
+                }
+            }
+
+            // determine the layout of the file
+            std::uint64_t const table_size =
+                sizeof(file_header) + sizes_.size() * sizeof(file_entry);
+            std::uint64_t offset = align_offset(table_size + base.size());
+
+            std::vector<file_entry> entries(sizes_.size());
+            for (std::size_t i = 0; i != sizes_.size(); ++i)
+            {
+                if (sizes_[i] == in_base)
+                {
+                    entries[i] = file_entry{in_base, 0};
+                    continue;
+                }
+
+                offsets_[i] = offset;
+                entries[i] = file_entry{offset, sizes_[i]};
+                offset = align_offset(offset + sizes_[i]);
+            }
+
+            file_header header{};
+            std::memcpy(header.magic, file_magic, sizeof(file_magic));
+            header.version = file_version;
+            header.num_objects = sizes_.size();
+            header.base_name_size = base.size();
+            header.file_size = offset;
+
+            fd_ = ::open(tmp_filename_.c_str(),
+                O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd_ == -1)
+            {
+                throw_filesystem_error("hpx::util::save_checkpoint_file",
+                    "open", tmp_filename_);
+            }
+
+            try
+            {
+                if (::ftruncate(fd_, static_cast<off_t>(offset)) != 0)
+                {
+                    throw_filesystem_error("hpx::util::save_checkpoint_file",
+                        "ftruncate", tmp_filename_);
+                }
+
+                write(&header, sizeof(header), 0);
+                if (!entries.empty())
+                {
+                    write(entries.data(), entries.size() * sizeof(file_entry),
+                        sizeof(file_header));
+                }
+                if (!base.empty())
+                {
+                    write(base.data(), base.size(), table_size);
+                }
+            }
+            catch (...)
+            {
+                ::close(fd_);
+                ::unlink(tmp_filename_.c_str());
+                throw;
+            }
+#endif
+        }
+
+        checkpoint_file_writer::~checkpoint_file_writer()
+        {
+#if !defined(HPX_WINDOWS)
+            // the checkpoint was not committed, remove the incomplete file
+            if (fd_ != -1)
+            {
+                ::close(fd_);
+                ::unlink(tmp_filename_.c_str());
+            }
+#endif
+        }
+
+        void checkpoint_file_writer::write([[maybe_unused]] void const* data,
+            [[maybe_unused]] std::size_t size,
+            [[maybe_unused]] std::uint64_t offset) const
+        {
+#if !defined(HPX_WINDOWS)
+            HPX_ASSERT(fd_ != -1);
+
+            char const* p = static_cast<char const*>(data);
+            while (size != 0)
+            {
+                ssize_t const written =
+                    ::pwrite(fd_, p, size, static_cast<off_t>(offset));
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+
+                    throw_filesystem_error("hpx::util::save_checkpoint_file",
+                        "pwrite", tmp_filename_);
+                }
+
+                p += written;
+                size -= static_cast<std::size_t>(written);
+                offset += static_cast<std::uint64_t>(written);
+            }
+#endif
+        }
+
+        void checkpoint_file_writer::commit()
+        {
+#if !defined(HPX_WINDOWS)
+            HPX_ASSERT(fd_ != -1);
+
+            if (options_.sync && ::fsync(fd_) != 0)
+            {
+                throw_filesystem_error("hpx::util::save_checkpoint_file",
+                    "fsync", tmp_filename_);
+            }
+
+            int const fd = fd_;
+            fd_ = -1;
+            if (::close(fd) != 0)
+            {
+                int const error = errno;
+                ::unlink(tmp_filename_.c_str());
+                errno = error;
+                throw_filesystem_error(
+                    "hpx::util::save_checkpoint_file", "close", tmp_filename_);
+            }
+
+            if (std::rename(tmp_filename_.c_str(), filename_.c_str()) != 0)
+            {
+                int const error = errno;
+                ::unlink(tmp_filename_.c_str());
+                errno = error;
+                throw_filesystem_error(
+                    "hpx::util::save_checkpoint_file", "rename", filename_);
+            }
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        checkpoint_file_stream::checkpoint_file_stream(
+            checkpoint_file_writer const& file, std::size_t index)
+          : file_(file)
+          , offset_(file.offset(index))
+          , expected_size_(file.size(index))
+          , size_(0)
+          , written_(0)
+          , current_buffer_(0)
+          , fill_(0)
+        {
+            HPX_ASSERT(offset_ != checkpoint_file_writer::in_base);
+        }
+
+        checkpoint_file_stream::~checkpoint_file_stream()
+        {
+            // the buffers have to outlive the pending write
+            if (pending_.valid())
+            {
+                pending_.wait();
+            }
+        }
+
+        void checkpoint_file_stream::write(
+            void const* address, std::size_t count, std::size_t current)
+        {
+            HPX_ASSERT(current == written_ + fill_);
+
+            if (current + count > expected_size_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                    "hpx::util::save_checkpoint_file",
+                    "the serialized data exceeds the precomputed size, was "
+                    "the object modified while being checkpointed?");
+            }
+
+            char const* p = static_cast<char const*>(address);
+            while (count != 0)
+            {
+                std::vector<char>& buffer = buffers_[current_buffer_];
+                if (buffer.empty())
+                {
+                    buffer.resize(static_cast<std::size_t>((std::min)(
+                        static_cast<std::uint64_t>(file_.chunk_size()),
+                        expected_size_)));
+                }
+
+                std::size_t const n = (std::min)(count, buffer.size() - fill_);
+                std::memcpy(buffer.data() + fill_, p, n);
+                fill_ += n;
+                p += n;
+                count -= n;
+
+                if (fill_ == buffer.size())
+                {
+                    submit();
+                }
+            }
+        }
+
+        void checkpoint_file_stream::close()
+        {
+            if (fill_ != 0)
+            {
+                submit();
+            }
+            wait();
+
+            if (written_ != expected_size_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                    "hpx::util::save_checkpoint_file",
+                    "the serialized data does not match the precomputed "
+                    "size, was the object modified while being "
+                    "checkpointed?");
+            }
+        }
+
+        // Write the current buffer (asynchronously, if possible) and continue
+        // with the other one
+        void checkpoint_file_stream::submit()
+        {
+            // the other buffer may still be being written
+            wait();
+
+            char const* data = buffers_[current_buffer_].data();
+            std::size_t const size = fill_;
+            std::uint64_t const offset = offset_ + written_;
+
+            if (threads::get_self_ptr() != nullptr)
+            {
+                // don't block the worker thread while the data is written
+                pending_ = hpx::threads::run_as_os_thread(
+                    [&file = file_, data, size, offset]() {
+                        file.write(data, size, offset);
+                    });
+            }
+            else
+            {
+                file_.write(data, size, offset);
+            }
+
+            written_ += size;
+            fill_ = 0;
+            current_buffer_ ^= 1;
+        }
+
+        void checkpoint_file_stream::wait()
+        {
+            if (pending_.valid())
+            {
+                hpx::future<void> f = HPX_MOVE(pending_);
+                f.get();    // rethrow exceptions
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_checkpoint::mapped_checkpoint(std::string filename)
+      : filename_(HPX_MOVE(filename))
+      , data_(nullptr)
+      , size_(0)
+    {
+#if defined(HPX_WINDOWS)
+        HPX_THROW_EXCEPTION(hpx::error::not_implemented,
+            "hpx::util::mapped_checkpoint::mapped_checkpoint",
+            "checkpoint files are not supported on this platform");
+#else
+        int const fd = ::open(filename_.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+        {
+            throw_filesystem_error(
+                "hpx::util::mapped_checkpoint::mapped_checkpoint", "open",
+                filename_);
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            int const error = errno;
+            ::close(fd);
+            errno = error;
+            throw_filesystem_error(
+                "hpx::util::mapped_checkpoint::mapped_checkpoint", "fstat",
+                filename_);
+        }
+
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ < sizeof(file_header))
+        {
+            ::close(fd);
+            throw_invalid_file(filename_, "the file is too short");
+        }
+
+        void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        int const error = errno;
+        ::close(fd);    // the mapping keeps the file open
+
+        if (p == MAP_FAILED)
+        {
+            errno = error;
+            throw_filesystem_error(
+                "hpx::util::mapped_checkpoint::mapped_checkpoint", "mmap",
+                filename_);
+        }
+
+        // objects referring to the mapped data keep the mapping alive
+        std::size_t const size = size_;
+        mapping_ = std::shared_ptr<void const>(
+            p, [size](void const* p) { ::munmap(const_cast<void*>(p), size); });
+        data_ = static_cast<char const*>(p);
+
+        file_header header;
+        std::memcpy(&header, data_, sizeof(header));
+
+        if (std::memcmp(header.magic, file_magic, sizeof(file_magic)) != 0)
+        {
+            throw_invalid_file(filename_, "bad magic number");
+        }
+        if (header.version != file_version)
+        {
+            throw_invalid_file(filename_, "unsupported version");
+        }
+        if (header.file_size != size_)
+        {
+            throw_invalid_file(filename_, "the file is truncated");
+        }
+
+        std::uint64_t const table_size = sizeof(file_header) +
+            header.num_objects * sizeof(file_entry);
+        if (header.num_objects > size_ / sizeof(file_entry) ||
+            table_size + header.base_name_size > size_)
+        {
+            throw_invalid_file(filename_, "corrupted object table");
+        }
+
+        entries_.resize(header.num_objects);
+        if (!entries_.empty())
+        {
+            std::memcpy(entries_.data(), data_ + sizeof(file_header),
+                entries_.size() * sizeof(file_entry));
+        }
+        base_filename_.assign(
+            data_ + table_size, data_ + table_size + header.base_name_size);
+
+        for (entry const& e : entries_)
+        {
+            if (e.offset == detail::checkpoint_file_writer::in_base)
+            {
+                if (base_filename_.empty())
+                {
+                    throw_invalid_file(filename_,
+                        "object refers to a missing base checkpoint");
+                }
+            }
+            else if (e.offset > size_ || e.size > size_ - e.offset)
+            {
+                throw_invalid_file(filename_, "corrupted object table");
+            }
+        }
+#endif
+    }
+
+    mapped_checkpoint::~mapped_checkpoint() = default;
+
+    mapped_checkpoint::mapped_checkpoint(mapped_checkpoint&& rhs) noexcept
+      : filename_(HPX_MOVE(rhs.filename_))
+      , base_filename_(HPX_MOVE(rhs.base_filename_))
+      , mapping_(HPX_MOVE(rhs.mapping_))
+      , data_(rhs.data_)
+      , size_(rhs.size_)
+      , entries_(HPX_MOVE(rhs.entries_))
+      , base_(HPX_MOVE(rhs.base_))
+    {
+        rhs.data_ = nullptr;
+        rhs.size_ = 0;
+    }
+
+    mapped_checkpoint& mapped_checkpoint::operator=(
+        mapped_checkpoint&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            filename_ = HPX_MOVE(rhs.filename_);
+            base_filename_ = HPX_MOVE(rhs.base_filename_);
+            mapping_ = HPX_MOVE(rhs.mapping_);
+            data_ = rhs.data_;
+            size_ = rhs.size_;
+            entries_ = HPX_MOVE(rhs.entries_);
+            base_ = HPX_MOVE(rhs.base_);
+
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    std::pair<detail::checkpoint_region, std::shared_ptr<void const>>
+    mapped_checkpoint::get_region(std::size_t index) const
+    {
+        if (index >= entries_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::util::mapped_checkpoint::restore_object",
+                "object index {} is out of range, the checkpoint {} stores {} "
+                "objects",
+                index, filename_, entries_.size());
+        }
+
+        entry const& e = entries_[index];
+        if (e.offset != detail::checkpoint_file_writer::in_base)
+        {
+            return {detail::checkpoint_region{data_ + e.offset,
+                        static_cast<std::size_t>(e.size)},
+                mapping_};
+        }
+
+        // the object is stored in the base checkpoint, map it on first use
+        mapped_checkpoint const* base = nullptr;
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            if (!base_)
+            {
+                auto checkpoint =
+                    std::make_unique<mapped_checkpoint>(base_filename_);
+                if (checkpoint->size() != entries_.size())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                        "hpx::util::mapped_checkpoint::restore_object",
+                        "the base checkpoint {} of {} stores {} objects, "
+                        "expected {}",
+                        base_filename_, filename_, checkpoint->size(),
+                        entries_.size());
+                }
+                base_ = HPX_MOVE(checkpoint);
+            }
+            base = base_.get();
+        }
+        return base->get_region(index);
+    }
+}    // namespace hpx::util
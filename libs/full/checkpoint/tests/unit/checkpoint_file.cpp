@@ -0,0 +1,146 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint_file,
+// save_checkpoint_file_delta and restore_checkpoint_file.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/buffer_view.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_file_options;
+using hpx::util::mapped_checkpoint;
+using hpx::util::mark_dirty;
+using hpx::util::restore_checkpoint_file;
+using hpx::util::save_checkpoint_file;
+using hpx::util::save_checkpoint_file_delta;
+
+char const* const full_file = "checkpoint_file_test_full.ckpt";
+char const* const delta_file = "checkpoint_file_test_delta.ckpt";
+
+// Main
+int main()
+{
+    std::vector<double> vec(100000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<double>(i) * 0.5;
+    }
+    std::string str = "I am a string of characters";
+    int integer = 10;
+
+    // Test 1
+    //  write all objects to a file and restore them
+    {
+        //[file_test_1
+        // use small chunks to exercise the streaming of large objects
+        checkpoint_file_options options;
+        options.chunk_size = 4096;
+
+        hpx::future<void> f =
+            save_checkpoint_file(options, full_file, vec, str, integer);
+        f.get();
+
+        std::vector<double> vec2;
+        std::string str2;
+        int integer2 = 0;
+        restore_checkpoint_file(full_file, vec2, str2, integer2);
+        //]
+
+        HPX_TEST(vec == vec2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST_EQ(integer, integer2);
+    }
+
+    // Test 2
+    //  write only the modified objects, the others are referred to the file
+    //  of the previous checkpoint
+    {
+        str = "I am a modified string";
+        integer = 42;
+
+        //[file_test_2
+        save_checkpoint_file_delta(
+            delta_file, full_file, mark_dirty(vec, false), str, integer)
+            .get();
+
+        mapped_checkpoint cp(delta_file);
+        HPX_TEST_EQ(cp.size(), std::size_t(3));
+        HPX_TEST_EQ(cp.base_filename(), std::string(full_file));
+
+        // objects are deserialized only when they are requested
+        std::string str2;
+        cp.restore_object(1, str2);
+        //]
+        HPX_TEST_EQ(str, str2);
+
+        std::vector<double> vec2;
+        int integer2 = 0;
+        cp.restore(vec2, str2, integer2);
+        HPX_TEST(vec == vec2);
+        HPX_TEST_EQ(integer, integer2);
+    }
+
+    // Test 3
+    //  buffer views refer to the mapped file instead of copying the data
+    {
+        hpx::serialization::buffer_view<double> view(vec.data(), vec.size());
+        save_checkpoint_file(delta_file, view).get();
+
+        hpx::serialization::buffer_view<double> view2;
+        {
+            mapped_checkpoint cp(delta_file);
+            cp.restore_object(0, view2);
+        }
+
+        // the mapping is kept alive by the view
+        HPX_TEST_EQ(view2.size(), vec.size());
+        HPX_TEST(std::equal(view2.begin(), view2.end(), vec.begin()));
+    }
+
+    // Test 4
+    //  errors are reported
+    {
+        bool caught_exception = false;
+        try
+        {
+            std::string str2;
+            restore_checkpoint_file(full_file, str2);
+        }
+        catch (hpx::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+
+        caught_exception = false;
+        try
+        {
+            mapped_checkpoint cp("checkpoint_file_test_missing.ckpt");
+        }
+        catch (hpx::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    std::remove(full_file);
+    std::remove(delta_file);
+
+    return hpx::util::report_errors();
+}
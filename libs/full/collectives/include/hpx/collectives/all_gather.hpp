@@ -105,6 +105,41 @@ namespace hpx { namespace collectives {
     all_gather(communicator comm, T&& result,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+    /// AllGather a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites operating on
+    /// the given channel communicator. The values are exchanged using
+    /// point-to-point communication between the participating sites only,
+    /// without any central (root) site being involved.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_gather operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_gather operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for exchanging the values
+    ///                     (default: selected based on the number of sites).
+    ///                     Supported are \a collective_algorithm::flat,
+    ///                     \a collective_algorithm::binomial_tree,
+    ///                     \a collective_algorithm::recursive_doubling (for
+    ///                     power-of-two numbers of sites only), and
+    ///                     \a collective_algorithm::ring.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values send by all participating sites. It will become
+    ///             ready once the all_gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>>
+    all_gather(channel_communicator comm, T&& result,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -117,7 +152,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -221,6 +258,37 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_gather plain values using point-to-point communication
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<arg_type>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::all_gather",
+                    "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              generation, algorithm]() mutable
+                          -> std::vector<arg_type> {
+            collective_algorithm const selected =
+                detail::select_all_gather_algorithm(
+                    algorithm, comm.get_info().first);
+
+            return detail::all_gather(
+                comm, HPX_MOVE(local_result), generation, selected);
+        });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
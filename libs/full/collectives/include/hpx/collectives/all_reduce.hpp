@@ -110,6 +110,44 @@ namespace hpx { namespace collectives {
     all_reduce(communicator comm,
         T&& result, F&& op, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites operating on
+    /// the given channel communicator. The values are combined using
+    /// point-to-point communication between the participating sites only,
+    /// without any central (root) site being involved. Depending on the
+    /// selected algorithm this requires O(log(num_sites)) communication
+    /// steps per site.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites. The operation has to
+    ///                     be associative and commutative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the all_reduce operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for combining the values
+    ///                     (default: selected based on the number of sites).
+    ///                     Supported are \a collective_algorithm::flat,
+    ///                     \a collective_algorithm::binomial_tree, and
+    ///                     \a collective_algorithm::recursive_doubling.
+    ///
+    /// \returns    This function returns a future holding the result of the
+    ///             reduction. It will become ready once the all_reduce
+    ///             operation has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>>
+    all_reduce(channel_communicator comm,
+        T&& result, F&& op, generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -123,7 +161,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -240,6 +280,35 @@ namespace hpx { namespace collectives {
                               generation, root_site),
             HPX_FORWARD(T, local_result), HPX_FORWARD(F, op), this_site);
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // all_reduce plain values using point-to-point communication
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(channel_communicator comm,
+        T&& local_result, F&& op, generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::all_reduce",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_FORWARD(T, local_result),
+                op = HPX_FORWARD(F, op), generation,
+                algorithm]() mutable -> arg_type {
+                collective_algorithm const selected =
+                    detail::select_all_reduce_algorithm(
+                        algorithm, comm.get_info().first);
+
+                return detail::all_reduce(
+                    comm, HPX_MOVE(local_result), op, generation, selected);
+            });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
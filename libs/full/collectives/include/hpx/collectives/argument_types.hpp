@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 
 #include <cstddef>
+#include <cstdint>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace collectives {
@@ -145,4 +146,44 @@ namespace hpx { namespace collectives {
 
         std::size_t tag_;
     };
+
+    /// The algorithms available for the collective operations that are
+    /// implemented on top of a \a channel_communicator.
+    enum class collective_algorithm : std::uint8_t
+    {
+        /// pick an algorithm based on the number of sites
+        automatic = 0,
+        /// all sites directly communicate with the root site
+        flat = 1,
+        /// communicate along a binomial tree rooted at the root site
+        binomial_tree = 2,
+        /// pairwise exchange in log2(num_sites) rounds
+        recursive_doubling = 3,
+        /// pass data around a ring of all sites in num_sites-1 steps
+        ring = 4
+    };
+
+    struct algorithm_arg
+    {
+        explicit constexpr algorithm_arg(
+            collective_algorithm algorithm =
+                collective_algorithm::automatic) noexcept
+          : algorithm_(algorithm)
+        {
+        }
+
+        constexpr algorithm_arg& operator=(
+            collective_algorithm algorithm) noexcept
+        {
+            algorithm_ = algorithm;
+            return *this;
+        }
+
+        constexpr operator collective_algorithm() const noexcept
+        {
+            return algorithm_;
+        }
+
+        collective_algorithm algorithm_;
+    };
 }}    // namespace hpx::collectives
@@ -185,6 +185,73 @@ namespace hpx { namespace collectives {
     hpx::future<T> broadcast_from(communicator comm,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+    /// Broadcast a value to different call sites
+    ///
+    /// This function sends a value to all call sites operating on the given
+    /// channel communicator. The calling site acts as the root of the
+    /// broadcast operation. The value is distributed using point-to-point
+    /// communication between the participating sites.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for distributing the value
+    ///                     (default: selected based on the number of sites).
+    ///                     Supported are \a collective_algorithm::flat and
+    ///                     \a collective_algorithm::binomial_tree.
+    ///
+    /// \note       The generation and algorithm values from corresponding
+    ///             \a broadcast_to and \a broadcast_from have to match.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become
+    ///             ready once the broadcast operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
+
+    /// Receive a value that was broadcast to different call sites
+    ///
+    /// This function receives a value that was sent from the given root site
+    /// to all call sites operating on the given channel communicator.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  root_site   The site that invoked the corresponding
+    ///                     \a broadcast_to. This value is optional and
+    ///                     defaults to '0' (zero).
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the broadcast operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the broadcast operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for distributing the value
+    ///                     (default: selected based on the number of sites).
+    ///
+    /// \note       The generation and algorithm values from corresponding
+    ///             \a broadcast_to and \a broadcast_from have to match.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent to all participating sites. It will become
+    ///             ready once the broadcast operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -199,7 +266,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -382,6 +451,58 @@ namespace hpx { namespace collectives {
                                      this_site, generation, root_site),
             this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // broadcast plain values using point-to-point communication
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_to",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async(
+            [comm = HPX_MOVE(comm), local_result = HPX_FORWARD(T, local_result),
+                generation, algorithm]() mutable -> arg_type {
+                auto [num_sites, this_site] = comm.get_info();
+                collective_algorithm const selected =
+                    detail::select_broadcast_algorithm(algorithm, num_sites);
+
+                return detail::broadcast(comm, HPX_MOVE(local_result),
+                    this_site, generation, selected);
+            });
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<T>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::broadcast_from",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm), root_site, generation,
+                              algorithm]() -> T {
+            collective_algorithm const selected =
+                detail::select_broadcast_algorithm(
+                    algorithm, comm.get_info().first);
+
+            return detail::broadcast(
+                comm, T(), root_site, generation, selected);
+        });
+    }
 }}    // namespace hpx::collectives
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +160,10 @@ namespace hpx { namespace collectives {
 
         HPX_EXPORT void free();
 
+        // return the number of sites and the sequence number of this site
+        HPX_EXPORT std::pair<std::size_t, std::size_t> get_info() const
+            noexcept;
+
     private:
         std::shared_ptr<detail::channel_communicator> comm_;
     };
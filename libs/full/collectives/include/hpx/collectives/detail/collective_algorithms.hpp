@@ -0,0 +1,592 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This file implements the point-to-point based algorithms (binomial trees,
+// recursive doubling, rings) used by the collective operations that are
+// invoked on a channel_communicator. All functions in here are blocking and
+// are expected to be run on an HPX thread.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace collectives { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Communicators with at most this number of sites use the flat
+    // algorithms by default.
+    inline constexpr std::size_t flat_algorithm_threshold = 4;
+
+    // Maximal number of communication steps a single collective operation
+    // may use, used to derive unique channel tags. The ring algorithms use
+    // one step per site.
+    inline constexpr std::size_t max_steps_per_operation = 65536;
+
+    ///////////////////////////////////////////////////////////////////////////
+    constexpr bool is_power_of_two(std::size_t n) noexcept
+    {
+        return n != 0 && (n & (n - 1)) == 0;
+    }
+
+    constexpr std::size_t largest_power_of_two(std::size_t n) noexcept
+    {
+        std::size_t p = 1;
+        while (p <= n / 2)
+        {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    // All communication steps of one collective operation use different
+    // tags, consecutive generations use disjoint ranges of tags.
+    constexpr std::size_t make_tag(
+        std::size_t generation, std::size_t step) noexcept
+    {
+        HPX_ASSERT(step < max_steps_per_operation);
+        return (generation == std::size_t(-1) ? 0 : generation) *
+            max_steps_per_operation +
+            step;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Resolve collective_algorithm::automatic for the various operations. All
+    // sites have to select the same algorithm, the selection is therefore
+    // based on the number of sites only (the payload may differ between
+    // sites).
+    inline collective_algorithm select_all_reduce_algorithm(
+        collective_algorithm algorithm, std::size_t num_sites) noexcept
+    {
+        if (algorithm != collective_algorithm::automatic)
+        {
+            return algorithm;
+        }
+
+        // recursive doubling minimizes the number of rounds, large payloads
+        // on non-power-of-two sizes may benefit from explicitly selecting the
+        // binomial tree (reduce followed by a broadcast) instead
+        return collective_algorithm::recursive_doubling;
+    }
+
+    inline collective_algorithm select_broadcast_algorithm(
+        collective_algorithm algorithm, std::size_t num_sites) noexcept
+    {
+        if (algorithm != collective_algorithm::automatic)
+        {
+            return algorithm;
+        }
+        return num_sites <= flat_algorithm_threshold ?
+            collective_algorithm::flat :
+            collective_algorithm::binomial_tree;
+    }
+
+    inline collective_algorithm select_gather_algorithm(
+        collective_algorithm algorithm, std::size_t num_sites) noexcept
+    {
+        if (algorithm != collective_algorithm::automatic)
+        {
+            return algorithm;
+        }
+        return num_sites <= flat_algorithm_threshold ?
+            collective_algorithm::flat :
+            collective_algorithm::binomial_tree;
+    }
+
+    inline collective_algorithm select_all_gather_algorithm(
+        collective_algorithm algorithm, std::size_t num_sites) noexcept
+    {
+        if (algorithm != collective_algorithm::automatic)
+        {
+            return algorithm;
+        }
+        return is_power_of_two(num_sites) ?
+            collective_algorithm::recursive_doubling :
+            collective_algorithm::ring;
+    }
+
+    [[noreturn]] inline void throw_unsupported_algorithm(
+        char const* operation, collective_algorithm algorithm)
+    {
+        HPX_THROW_EXCEPTION(hpx::error::bad_parameter, operation,
+            "the requested collective algorithm ({}) is not supported by "
+            "this operation",
+            static_cast<int>(algorithm));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Binomial tree broadcast, the value is valid on the root site only
+    template <typename T>
+    T broadcast_binomial_tree(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t root_site, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const relative = (this_site + num_sites - root_site) %
+            num_sites;
+        std::size_t const tag = make_tag(generation, 0);
+
+        // receive the value from our parent
+        std::size_t mask = 1;
+        while (mask < num_sites)
+        {
+            if (relative & mask)
+            {
+                std::size_t const parent =
+                    (relative - mask + root_site) % num_sites;
+                value =
+                    get<T>(comm, that_site_arg(parent), tag_arg(tag)).get();
+                break;
+            }
+            mask <<= 1;
+        }
+
+        // forward the value to our children
+        std::vector<hpx::future<void>> sends;
+        mask >>= 1;
+        while (mask > 0)
+        {
+            if (relative + mask < num_sites)
+            {
+                std::size_t const child =
+                    (relative + mask + root_site) % num_sites;
+                sends.push_back(
+                    set(comm, that_site_arg(child), value, tag_arg(tag)));
+            }
+            mask >>= 1;
+        }
+
+        hpx::wait_all(sends);
+        return value;
+    }
+
+    template <typename T>
+    T broadcast_flat(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t root_site, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const tag = make_tag(generation, 0);
+
+        if (this_site != root_site)
+        {
+            return get<T>(comm, that_site_arg(root_site), tag_arg(tag)).get();
+        }
+
+        std::vector<hpx::future<void>> sends;
+        sends.reserve(num_sites - 1);
+        for (std::size_t site = 0; site != num_sites; ++site)
+        {
+            if (site != root_site)
+            {
+                sends.push_back(
+                    set(comm, that_site_arg(site), value, tag_arg(tag)));
+            }
+        }
+
+        hpx::wait_all(sends);
+        return value;
+    }
+
+    template <typename T>
+    T broadcast(hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t root_site, std::size_t generation,
+        collective_algorithm algorithm)
+    {
+        switch (algorithm)
+        {
+        case collective_algorithm::flat:
+            return broadcast_flat(comm, HPX_MOVE(value), root_site, generation);
+
+        case collective_algorithm::binomial_tree:
+            return broadcast_binomial_tree(
+                comm, HPX_MOVE(value), root_site, generation);
+
+        default:
+            throw_unsupported_algorithm(
+                "hpx::collectives::detail::broadcast", algorithm);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Binomial tree reduction, the result is valid on the root site only.
+    // Values are combined in the order of the site numbers relative to the
+    // root site.
+    template <typename T, typename F>
+    T reduce_binomial_tree(
+        hpx::collectives::channel_communicator const& comm, T value, F& op,
+        std::size_t root_site, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const relative = (this_site + num_sites - root_site) %
+            num_sites;
+        std::size_t const tag = make_tag(generation, 1);
+
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1)
+        {
+            if (relative & mask)
+            {
+                // hand our partial result to the parent, we're done
+                std::size_t const parent =
+                    (relative - mask + root_site) % num_sites;
+                set(comm, that_site_arg(parent), HPX_MOVE(value), tag_arg(tag))
+                    .get();
+                return T();
+            }
+
+            if (relative + mask < num_sites)
+            {
+                std::size_t const child =
+                    (relative + mask + root_site) % num_sites;
+                value = HPX_INVOKE(op, HPX_MOVE(value),
+                    get<T>(comm, that_site_arg(child), tag_arg(tag)).get());
+            }
+        }
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recursive doubling all-reduce. For non-power-of-two numbers of sites
+    // the excess sites fold their values into a partner site first and
+    // receive the final result from it at the end.
+    template <typename T, typename F>
+    T all_reduce_recursive_doubling(
+        hpx::collectives::channel_communicator const& comm, T value, F& op,
+        std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const pof2 = largest_power_of_two(num_sites);
+        std::size_t const excess = num_sites - pof2;
+
+        std::size_t step = 0;
+        if (this_site >= pof2)
+        {
+            // excess site: contribute value and wait for the result
+            std::size_t const partner = this_site - pof2;
+            set(comm, that_site_arg(partner), HPX_MOVE(value),
+                tag_arg(make_tag(generation, step)))
+                .get();
+            return get<T>(comm, that_site_arg(partner),
+                tag_arg(make_tag(generation, step + 1)))
+                .get();
+        }
+
+        if (this_site < excess)
+        {
+            value = HPX_INVOKE(op, HPX_MOVE(value),
+                get<T>(comm, that_site_arg(this_site + pof2),
+                    tag_arg(make_tag(generation, step)))
+                    .get());
+        }
+
+        // pairwise exchanges, make sure all sites combine the values in the
+        // same order to get bitwise identical results
+        step = 2;
+        for (std::size_t mask = 1; mask < pof2; mask <<= 1, ++step)
+        {
+            std::size_t const partner = this_site ^ mask;
+            std::size_t const tag = make_tag(generation, step);
+
+            hpx::future<void> sent =
+                set(comm, that_site_arg(partner), value, tag_arg(tag));
+            T other = get<T>(comm, that_site_arg(partner), tag_arg(tag)).get();
+            sent.get();
+
+            if (partner < this_site)
+            {
+                value = HPX_INVOKE(op, HPX_MOVE(other), HPX_MOVE(value));
+            }
+            else
+            {
+                value = HPX_INVOKE(op, HPX_MOVE(value), HPX_MOVE(other));
+            }
+        }
+
+        if (this_site < excess)
+        {
+            set(comm, that_site_arg(this_site + pof2), value,
+                tag_arg(make_tag(generation, 1)))
+                .get();
+        }
+        return value;
+    }
+
+    template <typename T, typename F>
+    T all_reduce(
+        hpx::collectives::channel_communicator const& comm, T value, F& op,
+        std::size_t generation, collective_algorithm algorithm)
+    {
+        switch (algorithm)
+        {
+        case collective_algorithm::recursive_doubling:
+            return all_reduce_recursive_doubling(
+                comm, HPX_MOVE(value), op, generation);
+
+        case collective_algorithm::binomial_tree:
+        {
+            T result =
+                reduce_binomial_tree(comm, HPX_MOVE(value), op, 0, generation);
+            return broadcast_binomial_tree(
+                comm, HPX_MOVE(result), 0, generation);
+        }
+
+        case collective_algorithm::flat:
+        {
+            T result =
+                reduce_binomial_tree(comm, HPX_MOVE(value), op, 0, generation);
+            return broadcast_flat(comm, HPX_MOVE(result), 0, generation);
+        }
+
+        default:
+            throw_unsupported_algorithm(
+                "hpx::collectives::detail::all_reduce", algorithm);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Gather the values of all sites on the root site, the returned vector
+    // is ordered by site number (and empty on all sites but the root).
+    template <typename T>
+    std::vector<T> gather_flat(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t root_site, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const tag = make_tag(generation, 0);
+
+        if (this_site != root_site)
+        {
+            set(comm, that_site_arg(root_site), HPX_MOVE(value), tag_arg(tag))
+                .get();
+            return std::vector<T>();
+        }
+
+        std::vector<hpx::future<T>> values;
+        values.reserve(num_sites);
+        for (std::size_t site = 0; site != num_sites; ++site)
+        {
+            if (site == root_site)
+            {
+                values.push_back(hpx::make_ready_future(HPX_MOVE(value)));
+            }
+            else
+            {
+                values.push_back(
+                    get<T>(comm, that_site_arg(site), tag_arg(tag)));
+            }
+        }
+
+        std::vector<T> result;
+        result.reserve(num_sites);
+        for (auto&& f : values)
+        {
+            result.push_back(f.get());
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> gather_binomial_tree(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t root_site, std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const relative = (this_site + num_sites - root_site) %
+            num_sites;
+        std::size_t const tag = make_tag(generation, 0);
+
+        // the data collected from our sub-tree, ordered by relative site
+        std::vector<T> data;
+        data.push_back(HPX_MOVE(value));
+
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1)
+        {
+            if (relative & mask)
+            {
+                std::size_t const parent =
+                    (relative - mask + root_site) % num_sites;
+                set(comm, that_site_arg(parent), HPX_MOVE(data), tag_arg(tag))
+                    .get();
+                return std::vector<T>();
+            }
+
+            if (relative + mask < num_sites)
+            {
+                std::size_t const child =
+                    (relative + mask + root_site) % num_sites;
+                std::vector<T> received =
+                    get<std::vector<T>>(comm, that_site_arg(child),
+                        tag_arg(tag))
+                        .get();
+                for (auto&& v : received)
+                {
+                    data.push_back(HPX_MOVE(v));
+                }
+            }
+        }
+
+        // rotate the data into site order
+        HPX_ASSERT(data.size() == num_sites);
+        std::vector<T> result(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            result[(i + root_site) % num_sites] = HPX_MOVE(data[i]);
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> gather(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t root_site, std::size_t generation,
+        collective_algorithm algorithm)
+    {
+        switch (algorithm)
+        {
+        case collective_algorithm::flat:
+            return gather_flat(comm, HPX_MOVE(value), root_site, generation);
+
+        case collective_algorithm::binomial_tree:
+            return gather_binomial_tree(
+                comm, HPX_MOVE(value), root_site, generation);
+
+        default:
+            throw_unsupported_algorithm(
+                "hpx::collectives::detail::gather", algorithm);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recursive doubling all-gather, requires a power-of-two number of sites
+    template <typename T>
+    std::vector<T> all_gather_recursive_doubling(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        if (!is_power_of_two(num_sites))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::detail::all_gather_recursive_doubling",
+                "the recursive doubling all_gather algorithm requires the "
+                "number of sites to be a power of two ({})",
+                num_sites);
+        }
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        // after round k each site holds the 2^(k+1) values of its aligned
+        // block of sites
+        std::size_t step = 0;
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1, ++step)
+        {
+            std::size_t const partner = this_site ^ mask;
+            std::size_t const tag = make_tag(generation, step);
+
+            std::size_t const my_block = this_site & ~(mask - 1);
+            std::size_t const partner_block = partner & ~(mask - 1);
+
+            std::vector<T> block(result.begin() + my_block,
+                result.begin() + my_block + mask);
+            hpx::future<void> sent = set(
+                comm, that_site_arg(partner), HPX_MOVE(block), tag_arg(tag));
+
+            std::vector<T> received =
+                get<std::vector<T>>(comm, that_site_arg(partner), tag_arg(tag))
+                    .get();
+            HPX_ASSERT(received.size() == mask);
+            for (std::size_t i = 0; i != mask; ++i)
+            {
+                result[partner_block + i] = HPX_MOVE(received[i]);
+            }
+            sent.get();
+        }
+        return result;
+    }
+
+    // Ring all-gather, every site forwards the value it received in the
+    // previous step to its right neighbor
+    template <typename T>
+    std::vector<T> all_gather_ring(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t generation)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        for (std::size_t step = 0; step + 1 < num_sites; ++step)
+        {
+            std::size_t const send_index =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const recv_index =
+                (this_site + num_sites - step - 1) % num_sites;
+            std::size_t const tag = make_tag(generation, step);
+
+            // explicitly copy the value to protect against vector<bool>
+            hpx::future<void> sent = set(comm, that_site_arg(right),
+                T(result[send_index]), tag_arg(tag));
+            result[recv_index] =
+                get<T>(comm, that_site_arg(left), tag_arg(tag)).get();
+            sent.get();
+        }
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> all_gather(
+        hpx::collectives::channel_communicator const& comm, T value,
+        std::size_t generation, collective_algorithm algorithm)
+    {
+        switch (algorithm)
+        {
+        case collective_algorithm::recursive_doubling:
+            return all_gather_recursive_doubling(
+                comm, HPX_MOVE(value), generation);
+
+        case collective_algorithm::ring:
+            return all_gather_ring(comm, HPX_MOVE(value), generation);
+
+        case collective_algorithm::binomial_tree:
+        {
+            std::vector<T> result =
+                gather_binomial_tree(comm, HPX_MOVE(value), 0, generation);
+            return broadcast_binomial_tree(
+                comm, HPX_MOVE(result), 0, generation);
+        }
+
+        case collective_algorithm::flat:
+        {
+            std::vector<T> result =
+                gather_flat(comm, HPX_MOVE(value), 0, generation);
+            return broadcast_flat(comm, HPX_MOVE(result), 0, generation);
+        }
+
+        default:
+            throw_unsupported_algorithm(
+                "hpx::collectives::detail::all_gather", algorithm);
+        }
+    }
+}}}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -204,6 +204,70 @@ namespace hpx { namespace collectives {
     gather_there(communicator comm, T&& result,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+    /// Gather a set of values from different call sites
+    ///
+    /// This function receives a set of values from all call sites operating on
+    /// the given channel communicator. The calling site acts as the root of
+    /// the gather operation. The values are collected using point-to-point
+    /// communication between the participating sites.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to the central gather point
+    ///                     from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the gather operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the gather operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for collecting the values
+    ///                     (default: selected based on the number of sites).
+    ///                     Supported are \a collective_algorithm::flat and
+    ///                     \a collective_algorithm::binomial_tree.
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values send by all participating sites. It will become
+    ///             ready once the gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<decay_t<T>>> gather_here(
+        channel_communicator comm, T&& result,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
+
+    /// Gather a given value at the given call site
+    ///
+    /// This function transmits the value given by \a result to a central
+    /// gather site (where the corresponding \a gather_here is executed)
+    /// using point-to-point communication between the participating sites.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to the central gather point
+    ///                     from this call site.
+    /// \param  root_site   The site that invoked the corresponding
+    ///                     \a gather_here. This value is optional and
+    ///                     defaults to '0' (zero).
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the gather operation performed on the
+    ///                     given communicator. This is optional and needs to be
+    ///                     supplied only if the gather operation on the
+    ///                     given communicator has to be performed more than
+    ///                     once. The generation number (if given) must be a
+    ///                     positive number greater than zero.
+    /// \param  algorithm   The algorithm to use for collecting the values
+    ///                     (default: selected based on the number of sites).
+    ///
+    /// \returns    This function returns a future which will become
+    ///             ready once the gather operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<void> gather_there(channel_communicator comm, T&& result,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg());
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -217,7 +281,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -395,6 +461,62 @@ namespace hpx { namespace collectives {
                                 this_site, generation, root_site),
             HPX_FORWARD(T, local_result), this_site);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // gather plain values using point-to-point communication
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<arg_type>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::gather_here",
+                    "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              generation, algorithm]() mutable
+                          -> std::vector<arg_type> {
+            auto [num_sites, this_site] = comm.get_info();
+            collective_algorithm const selected =
+                detail::select_gather_algorithm(algorithm, num_sites);
+
+            return detail::gather(comm, HPX_MOVE(local_result), this_site,
+                generation, selected);
+        });
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(channel_communicator comm,
+        T&& local_result, root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        algorithm_arg algorithm = algorithm_arg())
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<void>(HPX_GET_EXCEPTION(
+                hpx::error::bad_parameter, "hpx::collectives::gather_there",
+                "the generation number shouldn't be zero"));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              root_site, generation, algorithm]() mutable {
+            collective_algorithm const selected =
+                detail::select_gather_algorithm(
+                    algorithm, comm.get_info().first);
+
+            detail::gather(comm, HPX_MOVE(local_result), root_site, generation,
+                selected);
+        });
+    }
 }}    // namespace hpx::collectives
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,13 @@ namespace hpx { namespace collectives {
         comm_.reset();
     }
 
+    std::pair<std::size_t, std::size_t> channel_communicator::get_info()
+        const noexcept
+    {
+        HPX_ASSERT(comm_);
+        return comm_->get_info();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<channel_communicator> create_channel_communicator(
         char const* basename, num_sites_arg num_sites, this_site_arg this_site)
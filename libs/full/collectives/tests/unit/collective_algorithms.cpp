@@ -0,0 +1,239 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the point-to-point based algorithms of the collective
+// operations invoked on a channel_communicator. All sites are simulated
+// by HPX threads running on the current locality.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* collective_algorithms_basename =
+    "/test/collective_algorithms/";
+
+std::size_t const site_counts[] = {1, 2, 3, 5, 8, 13, 32};
+constexpr std::size_t num_generations = 3;
+
+std::vector<channel_communicator> create_communicators(std::size_t num_sites)
+{
+    static std::size_t count = 0;
+    std::string const basename =
+        collective_algorithms_basename + std::to_string(++count) + "/";
+
+    std::vector<hpx::future<channel_communicator>> comms;
+    comms.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        comms.push_back(create_channel_communicator(
+            basename.c_str(), num_sites_arg(num_sites), this_site_arg(i)));
+    }
+    return hpx::unwrap(comms);
+}
+
+// run the given function concurrently for all sites
+template <typename F>
+void run_on_all_sites(std::vector<channel_communicator> const& comms, F&& f)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(comms.size());
+    for (std::size_t i = 0; i != comms.size(); ++i)
+    {
+        tasks.push_back(hpx::async(f, i, comms[i]));
+    }
+    hpx::wait_all(tasks);
+
+    for (auto&& t : tasks)
+    {
+        HPX_TEST(!t.has_exception());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_reduce(collective_algorithm algorithm)
+{
+    for (std::size_t num_sites : site_counts)
+    {
+        auto comms = create_communicators(num_sites);
+        run_on_all_sites(
+            comms, [&](std::size_t site, channel_communicator comm) {
+                for (std::size_t gen = 1; gen <= num_generations; ++gen)
+                {
+                    std::size_t result = all_reduce(comm, site + gen,
+                        std::plus<std::size_t>{}, generation_arg(gen),
+                        algorithm_arg(algorithm))
+                                             .get();
+
+                    HPX_TEST_EQ(result,
+                        num_sites * (num_sites - 1) / 2 + num_sites * gen);
+                }
+            });
+    }
+}
+
+void test_all_reduce_bool()
+{
+    for (std::size_t num_sites : site_counts)
+    {
+        auto comms = create_communicators(num_sites);
+        run_on_all_sites(
+            comms, [&](std::size_t site, channel_communicator comm) {
+                bool result = all_reduce(comm, site % 2 == 0,
+                    std::logical_and<>{}, generation_arg(1))
+                                  .get();
+                HPX_TEST_EQ(result, num_sites == 1);
+            });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_broadcast(collective_algorithm algorithm)
+{
+    for (std::size_t num_sites : site_counts)
+    {
+        auto comms = create_communicators(num_sites);
+        run_on_all_sites(
+            comms, [&](std::size_t site, channel_communicator comm) {
+                for (std::size_t gen = 1; gen <= num_generations; ++gen)
+                {
+                    // rotate the root site with each generation
+                    std::size_t const root = gen % num_sites;
+                    std::string const expected =
+                        "value " + std::to_string(gen);
+
+                    std::string result;
+                    if (site == root)
+                    {
+                        result = broadcast_to(comm, expected,
+                            generation_arg(gen), algorithm_arg(algorithm))
+                                     .get();
+                    }
+                    else
+                    {
+                        result = broadcast_from<std::string>(comm,
+                            root_site_arg(root), generation_arg(gen),
+                            algorithm_arg(algorithm))
+                                     .get();
+                    }
+                    HPX_TEST_EQ(result, expected);
+                }
+            });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_gather(collective_algorithm algorithm)
+{
+    for (std::size_t num_sites : site_counts)
+    {
+        auto comms = create_communicators(num_sites);
+        run_on_all_sites(
+            comms, [&](std::size_t site, channel_communicator comm) {
+                for (std::size_t gen = 1; gen <= num_generations; ++gen)
+                {
+                    std::size_t const root = gen % num_sites;
+                    if (site == root)
+                    {
+                        std::vector<std::size_t> result = gather_here(comm,
+                            site + gen, generation_arg(gen),
+                            algorithm_arg(algorithm))
+                                                              .get();
+
+                        HPX_TEST_EQ(result.size(), num_sites);
+                        for (std::size_t i = 0; i != result.size(); ++i)
+                        {
+                            HPX_TEST_EQ(result[i], i + gen);
+                        }
+                    }
+                    else
+                    {
+                        gather_there(comm, site + gen, root_site_arg(root),
+                            generation_arg(gen), algorithm_arg(algorithm))
+                            .get();
+                    }
+                }
+            });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_gather(collective_algorithm algorithm)
+{
+    for (std::size_t num_sites : site_counts)
+    {
+        if (algorithm == collective_algorithm::recursive_doubling &&
+            (num_sites & (num_sites - 1)) != 0)
+        {
+            continue;    // requires power-of-two number of sites
+        }
+
+        auto comms = create_communicators(num_sites);
+        run_on_all_sites(
+            comms, [&](std::size_t site, channel_communicator comm) {
+                for (std::size_t gen = 1; gen <= num_generations; ++gen)
+                {
+                    std::vector<std::size_t> result = all_gather(comm,
+                        site * gen, generation_arg(gen),
+                        algorithm_arg(algorithm))
+                                                          .get();
+
+                    HPX_TEST_EQ(result.size(), num_sites);
+                    for (std::size_t i = 0; i != result.size(); ++i)
+                    {
+                        HPX_TEST_EQ(result[i], i * gen);
+                    }
+                }
+            });
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (auto algorithm : {collective_algorithm::automatic,
+             collective_algorithm::flat, collective_algorithm::binomial_tree,
+             collective_algorithm::recursive_doubling})
+    {
+        test_all_reduce(algorithm);
+    }
+    test_all_reduce_bool();
+
+    for (auto algorithm : {collective_algorithm::automatic,
+             collective_algorithm::flat, collective_algorithm::binomial_tree})
+    {
+        test_broadcast(algorithm);
+        test_gather(algorithm);
+    }
+
+    for (auto algorithm : {collective_algorithm::automatic,
+             collective_algorithm::flat, collective_algorithm::binomial_tree,
+             collective_algorithm::recursive_doubling,
+             collective_algorithm::ring})
+    {
+        test_all_gather(algorithm);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
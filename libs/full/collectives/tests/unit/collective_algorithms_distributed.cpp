@@ -0,0 +1,189 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the point-to-point based algorithms of the collective
+// operations invoked on a channel_communicator spanning all localities. The
+// sites supply payloads of different sizes, all of them have to select the
+// same algorithm nevertheless.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* collective_algorithms_basename =
+    "/test/collective_algorithms_distributed/";
+
+// the number of sites run on each locality, this results in both power of two
+// and non-power of two numbers of sites
+std::size_t const sites_per_locality[] = {1, 3, 4};
+constexpr std::size_t num_generations = 3;
+
+// every other site supplies a payload which is larger than 16kB
+std::vector<std::uint64_t> make_payload(std::size_t site, std::size_t gen)
+{
+    std::size_t const size = site % 2 == 0 ? 4096 + site : site + 1;
+    return std::vector<std::uint64_t>(size, site + gen);
+}
+
+std::uint64_t payload_sum(std::vector<std::uint64_t> const& v)
+{
+    std::uint64_t sum = 0;
+    for (std::uint64_t value : v)
+    {
+        sum += value;
+    }
+    return sum;
+}
+
+// run the given function concurrently for all sites on this locality
+template <typename F>
+void run_on_local_sites(std::size_t num_local_sites, F&& f)
+{
+    static std::size_t count = 0;
+    std::string const basename =
+        collective_algorithms_basename + std::to_string(++count) + "/";
+
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    std::size_t const here = hpx::get_locality_id();
+    std::size_t const num_sites = num_localities * num_local_sites;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_local_sites);
+    for (std::size_t i = 0; i != num_local_sites; ++i)
+    {
+        std::size_t const site = here * num_local_sites + i;
+        tasks.push_back(hpx::async([&, site]() {
+            channel_communicator comm =
+                create_channel_communicator(hpx::launch::sync,
+                    basename.c_str(), num_sites_arg(num_sites),
+                    this_site_arg(site));
+            f(site, num_sites, comm);
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    for (auto&& t : tasks)
+    {
+        HPX_TEST(!t.has_exception());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct concatenate
+{
+    std::vector<std::uint64_t> operator()(std::vector<std::uint64_t> lhs,
+        std::vector<std::uint64_t> const& rhs) const
+    {
+        lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+        return lhs;
+    }
+};
+
+void test_all_reduce(std::size_t num_local_sites)
+{
+    run_on_local_sites(num_local_sites,
+        [](std::size_t site, std::size_t num_sites, channel_communicator comm) {
+            for (std::size_t gen = 1; gen <= num_generations; ++gen)
+            {
+                std::vector<std::uint64_t> result =
+                    all_reduce(comm, make_payload(site, gen), concatenate{},
+                        generation_arg(gen))
+                        .get();
+
+                std::size_t expected_size = 0;
+                std::uint64_t expected_sum = 0;
+                for (std::size_t i = 0; i != num_sites; ++i)
+                {
+                    auto const payload = make_payload(i, gen);
+                    expected_size += payload.size();
+                    expected_sum += payload_sum(payload);
+                }
+                HPX_TEST_EQ(result.size(), expected_size);
+                HPX_TEST_EQ(payload_sum(result), expected_sum);
+            }
+        });
+}
+
+void test_gather(std::size_t num_local_sites)
+{
+    run_on_local_sites(num_local_sites,
+        [](std::size_t site, std::size_t num_sites, channel_communicator comm) {
+            for (std::size_t gen = 1; gen <= num_generations; ++gen)
+            {
+                std::size_t const root = gen % num_sites;
+                if (site == root)
+                {
+                    std::vector<std::vector<std::uint64_t>> result =
+                        gather_here(
+                            comm, make_payload(site, gen), generation_arg(gen))
+                            .get();
+
+                    HPX_TEST_EQ(result.size(), num_sites);
+                    for (std::size_t i = 0; i != result.size(); ++i)
+                    {
+                        HPX_TEST(result[i] == make_payload(i, gen));
+                    }
+                }
+                else
+                {
+                    gather_there(comm, make_payload(site, gen),
+                        root_site_arg(root), generation_arg(gen))
+                        .get();
+                }
+            }
+        });
+}
+
+void test_all_gather(std::size_t num_local_sites)
+{
+    run_on_local_sites(num_local_sites,
+        [](std::size_t site, std::size_t num_sites, channel_communicator comm) {
+            for (std::size_t gen = 1; gen <= num_generations; ++gen)
+            {
+                std::vector<std::vector<std::uint64_t>> result = all_gather(
+                    comm, make_payload(site, gen), generation_arg(gen))
+                                                                     .get();
+
+                HPX_TEST_EQ(result.size(), num_sites);
+                for (std::size_t i = 0; i != result.size(); ++i)
+                {
+                    HPX_TEST(result[i] == make_payload(i, gen));
+                }
+            }
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (std::size_t num_local_sites : sites_per_locality)
+    {
+        test_all_reduce(num_local_sites);
+        test_gather(num_local_sites);
+        test_all_gather(num_local_sites);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
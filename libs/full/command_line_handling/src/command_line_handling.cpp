@@ -791,6 +791,7 @@ namespace hpx::util {
         }
 
         enable_logging_settings(vm, ini_config);
+        enable_tracing_settings(vm, ini_config);
 
         if (rtcfg_.mode_ != hpx::runtime_mode::local)
         {
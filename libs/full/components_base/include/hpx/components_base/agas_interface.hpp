@@ -283,8 +283,7 @@ namespace hpx { namespace agas {
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_NETWORKING)
     HPX_EXPORT void route(parcelset::parcel&& p,
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&
-            f,
+        parcelset::parcel_write_handler_type&& f,
         threads::thread_priority local_priority =
             threads::thread_priority::default_);
 #endif
@@ -236,7 +236,7 @@ namespace hpx { namespace agas { namespace detail {
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_NETWORKING)
     extern HPX_EXPORT void (*route)(parcelset::parcel&& p,
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&,
+        parcelset::parcel_write_handler_type&&,
         threads::thread_priority local_priority);
 #endif
 
@@ -397,8 +397,7 @@ namespace hpx { namespace agas {
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_NETWORKING)
     void route(parcelset::parcel&& p,
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&
-            f,
+        parcelset::parcel_write_handler_type&& f,
         threads::thread_priority local_priority)
     {
         return detail::route(HPX_MOVE(p), HPX_MOVE(f), local_priority);
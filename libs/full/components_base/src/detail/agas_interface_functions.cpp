@@ -230,7 +230,7 @@ namespace hpx { namespace agas { namespace detail {
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_NETWORKING)
     void (*route)(parcelset::parcel&& p,
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&,
+        parcelset::parcel_write_handler_type&&,
         threads::thread_priority local_priority) = nullptr;
 #endif
 
@@ -12,6 +12,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling/command_line_handling.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#include <hpx/coroutines/detail/stack_arena.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -50,6 +51,7 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -339,10 +341,28 @@ namespace hpx {
         void activate_global_options(
             util::command_line_handling& cmdline, int argc, char** argv)
         {
+            threads::set_stackless_leaf_tasks(
+                cmdline.rtcfg_.use_stackless_leaf_tasks());
+
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+            if (cmdline.rtcfg_.use_stack_arena())
+            {
+                namespace posix = threads::coroutines::detail::posix;
+
+                posix::stack_arena.region_size = static_cast<std::size_t>(
+                    cmdline.rtcfg_.get_stack_arena_region_size());
+                posix::stack_arena.huge_pages =
+                    static_cast<posix::stack_arena_huge_pages>(
+                        cmdline.rtcfg_.get_stack_arena_huge_pages());
+                posix::stack_arena.prefault =
+                    cmdline.rtcfg_.use_stack_arena_prefault();
+                posix::stack_arena.enabled = true;
+            }
+#endif
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
@@ -383,6 +403,17 @@ namespace hpx {
             HPX_UNUSED(argv);
         }
 
+        // reset the global options which were set for the runtime that has
+        // been destroyed
+        void deactivate_global_options() noexcept
+        {
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+            // all stacks allocated from the arena have been released at this
+            // point, the next runtime may be configured differently
+            threads::coroutines::detail::posix::stack_arena.enabled = false;
+#endif
+        }
+
         ///////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
         void handle_list_and_print_options(hpx::runtime& rt,
@@ -655,8 +686,12 @@ namespace hpx {
         {
             if (blocking)
             {
-                return run(*rt, cfg.hpx_main_f_, cfg.vm_, cfg.rtcfg_.mode_,
-                    HPX_MOVE(startup), HPX_MOVE(shutdown));
+                int const result = run(*rt, cfg.hpx_main_f_, cfg.vm_,
+                    cfg.rtcfg_.mode_, HPX_MOVE(startup), HPX_MOVE(shutdown));
+
+                rt.reset();
+                deactivate_global_options();
+                return result;
             }
 
             // non-blocking version
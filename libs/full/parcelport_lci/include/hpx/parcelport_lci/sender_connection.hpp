@@ -40,8 +40,7 @@ namespace hpx::parcelset::policies::lci {
     private:
         using sender_type = sender;
 
-        using write_handler_type =
-            hpx::function<void(std::error_code const&, parcel const&)>;
+        using write_handler_type = parcelset::parcel_write_handler_type;
 
         using data_type = std::vector<char>;
 
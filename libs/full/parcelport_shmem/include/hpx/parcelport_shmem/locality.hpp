@@ -0,0 +1,75 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A shared memory locality is identified by the name of the host it runs
+    // on and by the name of its mailbox
+    class locality
+    {
+    public:
+        locality() = default;
+
+        locality(std::string const& host, std::string const& mailbox)
+          : host_(host)
+          , mailbox_(mailbox)
+        {
+        }
+
+        std::string const& host() const noexcept
+        {
+            return host_;
+        }
+
+        std::string const& mailbox() const noexcept
+        {
+            return mailbox_;
+        }
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !mailbox_.empty();
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.mailbox_ == rhs.mailbox_ && lhs.host_ == rhs.host_;
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.host_ < rhs.host_ ||
+                (lhs.host_ == rhs.host_ && lhs.mailbox_ < rhs.mailbox_);
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string host_;
+        std::string mailbox_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,129 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/receiver_connection.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    template <typename Parcelport>
+    struct receiver
+    {
+        using connection_type = receiver_connection;
+        using connection_ptr = std::unique_ptr<connection_type>;
+        using connection_list = std::vector<connection_ptr>;
+
+        explicit receiver(Parcelport& pp) noexcept
+          : pp_(pp)
+          , mailbox_(nullptr)
+        {
+        }
+
+        void run(mailbox& mb) noexcept
+        {
+            mailbox_ = &mb;
+        }
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            std::vector<std::shared_ptr<received_message>> messages;
+            bool has_work = false;
+
+            {
+                std::unique_lock l(connections_mtx_, std::try_to_lock);
+                if (!l.owns_lock() || mailbox_ == nullptr)
+                {
+                    return false;
+                }
+
+                // We first try to accept new connections
+                mailbox_->accept(
+                    [this](std::uint32_t slot, std::string const& name) {
+                        accept(slot, name);
+                    });
+
+                // Read from all channels, release the ones which were closed
+                // by their senders
+                for (auto it = connections_.begin(); it != connections_.end();)
+                {
+                    std::shared_ptr<received_message> msg =
+                        (*it)->receive(has_work);
+                    if (msg)
+                    {
+                        messages.push_back(HPX_MOVE(msg));
+                    }
+
+                    if ((*it)->finished())
+                    {
+                        mailbox_->release((*it)->slot());
+                        it = connections_.erase(it);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+
+            for (auto& msg : messages)
+            {
+                decode_received_message(pp_, HPX_MOVE(msg), num_thread);
+            }
+            return has_work;
+        }
+
+        // Stop receiving data, all senders are notified
+        void shutdown()
+        {
+            std::unique_lock l(connections_mtx_);
+            for (connection_ptr& connection : connections_)
+            {
+                connection->shutdown();
+                mailbox_->release(connection->slot());
+            }
+            connections_.clear();
+        }
+
+    private:
+        void accept(std::uint32_t slot, std::string const& name)
+        {
+            error_code ec(throwmode::lightweight);
+            connection_ptr connection = connection_type::open(slot, name, ec);
+            if (!connection)
+            {
+                // the sender has gone away already
+                mailbox_->release(slot);
+                return;
+            }
+            connections_.push_back(HPX_MOVE(connection));
+        }
+
+        Parcelport& pp_;
+        mailbox* mailbox_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,330 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A received message, the zero-copy chunks either own their data or refer
+    // to the chunk segment sent along with the message
+    struct received_message
+    {
+        using data_type = std::vector<char>;
+        using chunk_type = serialization::serialize_buffer<char>;
+        using buffer_type = parcel_buffer<data_type, chunk_type>;
+
+        buffer_type buffer_;
+        shared_memory_segment segment_;
+    };
+
+    template <typename Parcelport>
+    void decode_received_message(Parcelport& pp,
+        std::shared_ptr<received_message> msg, std::size_t num_thread = -1)
+    {
+        std::vector<serialization::serialization_chunk> chunks(
+            decode_chunks(msg->buffer_));
+
+        // the de-serialized objects may refer to the received data in place
+        // (including the mapped chunk segment), the message is kept alive for
+        // as long as this is the case
+        std::shared_ptr<void const> owner;
+        if (pp.allow_zero_copy_receive())
+        {
+            owner = msg;
+        }
+
+        decode_message_with_owner(
+            pp, msg->buffer_, 0, chunks, num_thread, HPX_MOVE(owner));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The receiving end of a channel
+    class receiver_connection
+    {
+    private:
+        enum connection_state
+        {
+            initialized,
+            rcvd_header,
+            rcvd_transmission_chunks,
+            rcvd_data
+        };
+
+        using buffer_type = received_message::buffer_type;
+        using chunk_type = received_message::chunk_type;
+
+    public:
+        receiver_connection(std::uint32_t slot, channel&& ch) noexcept
+          : state_(initialized)
+          , slot_(slot)
+          , channel_(HPX_MOVE(ch))
+          , offset_(0)
+          , chunks_idx_(0)
+        {
+        }
+
+        // Open the channel registered in the given slot
+        static std::unique_ptr<receiver_connection> open(std::uint32_t slot,
+            std::string const& name, error_code& ec = throws)
+        {
+            channel ch;
+            ch.open(name, ec);
+            if (ec)
+            {
+                return nullptr;
+            }
+
+            // nobody else needs to find the channel anymore
+            ch.unlink();
+
+            auto connection =
+                std::make_unique<receiver_connection>(slot, HPX_MOVE(ch));
+
+            connection->sender_mailbox_.open(
+                connection->channel_.sender_mailbox(), ec);
+            if (ec)
+            {
+                return nullptr;
+            }
+            return connection;
+        }
+
+        std::uint32_t slot() const noexcept
+        {
+            return slot_;
+        }
+
+        // The sender has closed the channel and all data was received
+        bool finished() const noexcept
+        {
+            return state_ == initialized && offset_ == 0 &&
+                channel_.closed() && !channel_.readable();
+        }
+
+        // Stop receiving data, the sender fails all subsequent writes
+        void shutdown() noexcept
+        {
+            channel_.shutdown();
+            sender_mailbox_.notify();
+        }
+
+        // Read all available data, returns the message if it was completely
+        // received. The flag progress is set if any data was read.
+        std::shared_ptr<received_message> receive(bool& progress)
+        {
+            std::shared_ptr<received_message> result;
+
+            bool read_data = false;
+            while (!result && receive_step(read_data, result))
+            {
+            }
+
+            // wake the sender if it is waiting for space in the channel
+            if (read_data && channel_.reset_sender_waiting())
+            {
+                sender_mailbox_.notify();
+            }
+
+            progress = progress || read_data;
+            return result;
+        }
+
+    private:
+        // Perform the next step of receiving a message, returns false if more
+        // data is needed to continue
+        bool receive_step(
+            bool& read_data, std::shared_ptr<received_message>& result)
+        {
+            switch (state_)
+            {
+            case initialized:
+                if (!read(&header_, sizeof(header_), read_data))
+                {
+                    return false;
+                }
+                receive_header();
+                return true;
+
+            case rcvd_header:
+            {
+                auto& transmission_chunks = msg_->buffer_.transmission_chunks_;
+                if (!read(transmission_chunks.data(),
+                        transmission_chunks.size() *
+                            sizeof(buffer_type::transmission_chunk_type),
+                        read_data))
+                {
+                    return false;
+                }
+                state_ = rcvd_transmission_chunks;
+                return true;
+            }
+
+            case rcvd_transmission_chunks:
+            {
+                auto& data = msg_->buffer_.data_;
+                if (!read(data.data(), data.size(), read_data))
+                {
+                    return false;
+                }
+                state_ = rcvd_data;
+                return true;
+            }
+
+            case rcvd_data:
+                if (!receive_chunks(read_data))
+                {
+                    return false;
+                }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                {
+                    parcelset::data_point& data = msg_->buffer_.data_point_;
+                    data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+                }
+#endif
+                result = HPX_MOVE(msg_);
+                state_ = initialized;
+                return true;
+
+            default:
+                HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        void receive_header()
+        {
+            msg_ = std::make_shared<received_message>();
+
+            buffer_type& buffer = msg_->buffer_;
+            buffer.data_.resize(static_cast<std::size_t>(header_.size));
+            buffer.size_ = header_.size;
+            buffer.data_size_ = header_.data_size;
+            buffer.num_chunks_ = buffer_type::count_chunks_type(
+                header_.num_zero_copy_chunks, header_.num_non_zero_copy_chunks);
+
+            if (header_.num_zero_copy_chunks != 0)
+            {
+                buffer.transmission_chunks_.resize(
+                    std::size_t(header_.num_zero_copy_chunks) +
+                    header_.num_non_zero_copy_chunks);
+                buffer.chunks_.reserve(header_.num_zero_copy_chunks);
+            }
+            chunks_idx_ = 0;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.bytes_ = static_cast<std::size_t>(header_.size);
+#endif
+            state_ = rcvd_header;
+        }
+
+        bool receive_chunks(bool& read_data)
+        {
+            buffer_type& buffer = msg_->buffer_;
+            std::size_t const num_chunks = header_.num_zero_copy_chunks;
+
+            if (header_.segment_size != 0)
+            {
+                // the chunks were placed into a separate segment, refer to
+                // them in place
+                header_.segment_name[max_name_length - 1] = '\0';
+                msg_->segment_ =
+                    shared_memory_segment::open(header_.segment_name);
+                msg_->segment_.unlink();
+
+                HPX_ASSERT(msg_->segment_.size() >= header_.segment_size);
+
+                char* data = static_cast<char*>(msg_->segment_.data());
+                for (std::size_t i = 0; i != num_chunks; ++i)
+                {
+                    std::size_t const size = static_cast<std::size_t>(
+                        buffer.transmission_chunks_[i].second);
+                    buffer.chunks_.emplace_back(
+                        data, size, chunk_type::reference);
+                    data += align_chunk(size);
+                }
+                return true;
+            }
+
+            while (chunks_idx_ != num_chunks)
+            {
+                if (buffer.chunks_.size() == chunks_idx_)
+                {
+                    buffer.chunks_.emplace_back(static_cast<std::size_t>(
+                        buffer.transmission_chunks_[chunks_idx_].second));
+                }
+
+                chunk_type& c = buffer.chunks_[chunks_idx_];
+                if (!read(c.data(), c.size(), read_data))
+                {
+                    return false;
+                }
+                ++chunks_idx_;
+            }
+            return true;
+        }
+
+        // Read the remaining part of the given piece of data, returns true if
+        // it was completely read
+        bool read(void* data, std::size_t size, bool& read_data) noexcept
+        {
+            std::size_t const n = channel_.read(
+                static_cast<char*>(data) + offset_, size - offset_);
+            if (n != 0)
+            {
+                read_data = true;
+            }
+
+            offset_ += n;
+            if (offset_ != size)
+            {
+                return false;
+            }
+
+            offset_ = 0;
+            return true;
+        }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+        connection_state state_;
+        std::uint32_t slot_;
+
+        channel channel_;
+        mailbox sender_mailbox_;
+
+        message_header header_;
+        std::shared_ptr<received_message> msg_;
+
+        std::size_t offset_;
+        std::size_t chunks_idx_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
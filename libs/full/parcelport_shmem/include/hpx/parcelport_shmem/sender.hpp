@@ -0,0 +1,134 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        sender(std::string const& mailbox_name, std::size_t ring_size,
+            std::size_t chunk_segment_threshold)
+          : mailbox_name_(mailbox_name)
+          , ring_size_(ring_size)
+          , chunk_segment_threshold_(chunk_segment_threshold)
+          , next_segment_(0)
+        {
+        }
+
+        connection_ptr create_connection(parcelset::locality const& l,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            auto connection = std::make_shared<connection_type>(
+                this, l, chunk_segment_threshold_, pp);
+
+            connection->connect(next_segment_name(), ring_size_, mailbox_name_,
+                ec);
+            if (ec)
+            {
+                return connection_ptr();
+            }
+            return connection;
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        // The names of all segments created by this locality are derived
+        // from the name of its mailbox
+        std::string next_segment_name()
+        {
+            return mailbox_name_ + "." +
+                std::to_string(
+                    next_segment_.fetch_add(1, std::memory_order_relaxed));
+        }
+
+        // Returns true if the message was completely sent
+        bool send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            std::error_code ec;
+            if (connection->send(ec))
+            {
+                connection->done(ec);
+
+                error_code postprocess_ec(throwmode::lightweight);
+                hpx::move_only_function<void(error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(
+                    postprocess_ec, connection->destination(), connection);
+                return true;
+            }
+
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(HPX_MOVE(connection));
+            return false;
+        }
+
+        bool background_work()
+        {
+            // progress all connections which are currently waiting for space
+            // in their channel
+            connection_list connections;
+            {
+                std::unique_lock l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    std::swap(connections, connections_);
+                }
+            }
+
+            // connections which are still waiting are woken up by the
+            // receiver once it has consumed some data
+            bool has_work = false;
+            for (connection_ptr& connection : connections)
+            {
+                has_work = send_messages(HPX_MOVE(connection)) || has_work;
+            }
+            return has_work;
+        }
+
+    private:
+        std::string mailbox_name_;
+        std::size_t ring_size_;
+        std::size_t chunk_segment_threshold_;
+        std::atomic<std::size_t> next_segment_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,342 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+    std::string next_segment_name(sender*);
+
+    struct sender_connection
+      : parcelset::parcelport_connection<sender_connection, std::vector<char>>
+    {
+    private:
+        using sender_type = sender;
+
+        using data_type = std::vector<char>;
+
+        using base_type =
+            parcelset::parcelport_connection<sender_connection, data_type>;
+
+        // a contiguous piece of the message which still has to be written
+        struct piece
+        {
+            void const* data;
+            std::size_t size;
+        };
+
+    public:
+        sender_connection(sender_type* s, parcelset::locality const& there,
+            std::size_t chunk_segment_threshold,
+            parcelset::parcelport* pp) noexcept
+          : sender_(s)
+          , piece_idx_(0)
+          , piece_offset_(0)
+          , chunk_segment_threshold_(chunk_segment_threshold)
+          , pp_(pp)
+          , there_(there)
+        {
+        }
+
+        ~sender_connection()
+        {
+            if (channel_)
+            {
+                // let the receiver know that no more data will arrive
+                channel_.close();
+                if (peer_mailbox_)
+                {
+                    peer_mailbox_.notify();
+                }
+            }
+        }
+
+        // Create the channel and register it with the mailbox of the
+        // destination
+        void connect(std::string const& channel_name, std::size_t ring_size,
+            std::string const& sender_mailbox, error_code& ec = throws)
+        {
+            std::string const& peer_mailbox =
+                there_.get<locality>().mailbox();
+
+            peer_mailbox_.open(peer_mailbox, ec);
+            if (ec)
+            {
+                return;
+            }
+
+            channel_.create(channel_name, ring_size, sender_mailbox, ec);
+            if (ec)
+            {
+                return;
+            }
+
+            if (!peer_mailbox_.connect(channel_name))
+            {
+                channel_.unlink();
+                channel_ = channel();
+
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "shmem::sender_connection::connect",
+                    "all channels of the mailbox {} are in use", peer_mailbox);
+                return;
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) const noexcept
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                hpx::chrono::high_resolution_clock::now();
+#endif
+            handler_ = HPX_FORWARD(Handler, handler);
+
+            prepare_message();
+
+            std::error_code ec;
+            if (!send(ec))
+            {
+                postprocess_handler_ =
+                    HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+                return;
+            }
+
+            done(ec);
+
+            error_code postprocess_ec;
+            parcel_postprocess(postprocess_ec, there_, shared_from_this());
+        }
+
+        // Write as much of the message as fits into the channel, returns true
+        // if the message was completely written (or has failed, in which case
+        // ec is set)
+        bool send(std::error_code& ec)
+        {
+            if (channel_.is_shut_down())
+            {
+                ec = std::error_code(ECONNRESET, std::system_category());
+                return true;
+            }
+
+            bool progress = false;
+            bool waiting = false;
+            while (piece_idx_ != pieces_.size())
+            {
+                piece const& p = pieces_[piece_idx_];
+
+                std::size_t const written = channel_.write(
+                    static_cast<char const*>(p.data) + piece_offset_,
+                    p.size - piece_offset_);
+                if (written != 0)
+                {
+                    progress = true;
+                }
+
+                piece_offset_ += written;
+                if (piece_offset_ != p.size)
+                {
+                    // the channel is full, the receiver notifies us once it
+                    // has read some of the data (retry once after announcing
+                    // this to not miss data read in the meantime)
+                    if (!waiting)
+                    {
+                        channel_.set_sender_waiting();
+                        waiting = true;
+                        continue;
+                    }
+
+                    if (progress)
+                    {
+                        peer_mailbox_.notify();
+                    }
+                    return false;
+                }
+
+                ++piece_idx_;
+                piece_offset_ = 0;
+            }
+
+            peer_mailbox_.notify();
+            return true;
+        }
+
+        // Invoke the write handler once the message has been sent
+        void done(std::error_code const& ec)
+        {
+            handler_(ec);
+            handler_.reset();
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                hpx::chrono::high_resolution_clock::now() -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            buffer_.clear();
+            pieces_.clear();
+        }
+
+    private:
+        friend struct sender;
+
+        void prepare_message()
+        {
+            pieces_.clear();
+            piece_idx_ = 0;
+            piece_offset_ = 0;
+
+            std::memset(&header_, 0, sizeof(header_));
+            header_.size = buffer_.size_;
+            header_.data_size = buffer_.data_size_;
+            header_.num_zero_copy_chunks = buffer_.num_chunks_.first;
+            header_.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+
+            pieces_.push_back(piece{&header_, sizeof(header_)});
+
+            auto const& transmission_chunks = buffer_.transmission_chunks_;
+            if (header_.num_zero_copy_chunks != 0)
+            {
+                HPX_ASSERT(transmission_chunks.size() ==
+                    std::size_t(header_.num_zero_copy_chunks) +
+                        header_.num_non_zero_copy_chunks);
+
+                pieces_.push_back(piece{transmission_chunks.data(),
+                    transmission_chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type)});
+            }
+
+            pieces_.push_back(
+                piece{buffer_.data_.data(), buffer_.data_.size()});
+
+            std::size_t segment_size = 0;
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    segment_size += align_chunk(c.size_);
+                }
+            }
+
+            // large chunks are placed into a separate segment which is mapped
+            // by the receiver, this avoids streaming them through the channel
+            if (segment_size != 0 &&
+                segment_size >= chunk_segment_threshold_ &&
+                write_chunk_segment(segment_size))
+            {
+                return;
+            }
+
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    pieces_.push_back(piece{c.data_.cpos_, c.size_});
+                }
+            }
+        }
+
+        // Copy all zero-copy chunks into a new segment, returns false if the
+        // segment could not be created (the chunks are written to the channel
+        // in this case)
+        bool write_chunk_segment(std::size_t segment_size)
+        {
+            error_code ec(throwmode::lightweight);
+            shared_memory_segment segment = shared_memory_segment::create(
+                next_segment_name(sender_), segment_size, ec);
+            if (ec)
+            {
+                return false;
+            }
+
+            char* data = static_cast<char*>(segment.data());
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    std::memcpy(data, c.data_.cpos_, c.size_);
+                    data += align_chunk(c.size_);
+                }
+            }
+
+            // the segment stays alive after unmapping it, it is removed by
+            // the receiver
+            header_.segment_size = segment_size;
+            std::memcpy(header_.segment_name, segment.name().c_str(),
+                segment.name().size() + 1);
+            return true;
+        }
+
+        sender_type* sender_;
+
+        hpx::move_only_function<void(std::error_code const&)> handler_;
+        hpx::move_only_function<void(error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender_connection>)>
+            postprocess_handler_;
+
+        channel channel_;
+        mailbox peer_mailbox_;
+
+        message_header header_;
+        std::vector<piece> pieces_;
+        std::size_t piece_idx_;
+        std::size_t piece_offset_;
+
+        std::size_t chunk_segment_threshold_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
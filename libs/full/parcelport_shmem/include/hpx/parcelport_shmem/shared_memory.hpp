@@ -0,0 +1,262 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // maximal length of the names of the shared memory segments (including
+    // the terminating zero)
+    inline constexpr std::size_t max_name_length = 64;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A POSIX shared memory segment mapped into this process. The mapping is
+    // released on destruction, the segment itself is removed by unlink() (or
+    // when the last process mapping it has exited after it was unlinked).
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment() = default;
+
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment(shared_memory_segment&& rhs) noexcept;
+        shared_memory_segment& operator=(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(shared_memory_segment&& rhs) noexcept;
+
+        ~shared_memory_segment();
+
+        // Create (and map) a new segment of the given size
+        static shared_memory_segment create(
+            std::string const& name, std::size_t size, error_code& ec = throws);
+
+        // Map an existing segment
+        static shared_memory_segment open(
+            std::string const& name, error_code& ec = throws);
+
+        // Remove the name of the segment, existing mappings stay valid
+        void unlink() noexcept;
+
+        void* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        void reset() noexcept;
+
+        std::string name_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    // Return whether a shared memory segment with the given name exists and
+    // is accessible
+    HPX_EXPORT bool shared_memory_segment_exists(std::string const& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every locality owns a mailbox, other localities connect to it by
+    // registering a channel in one of its slots. The mailbox also holds the
+    // doorbell the receiving locality waits on while it is idle.
+    class HPX_EXPORT mailbox
+    {
+    public:
+        struct header;
+
+        mailbox() = default;
+
+        // Create the mailbox of this locality
+        void create(std::string const& name, std::uint32_t num_slots);
+
+        // Open the mailbox of another locality
+        void open(std::string const& name, error_code& ec = throws);
+
+        void unlink() noexcept
+        {
+            segment_.unlink();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        // Register the channel with the given name, returns false if all
+        // slots are taken
+        bool connect(std::string const& channel_name) noexcept;
+
+        // Find all newly registered channels, f is invoked with the slot
+        // number and the name of each of them
+        template <typename F>
+        void accept(F&& f);
+
+        // Free the given slot after the channel using it was closed
+        void release(std::uint32_t slot) noexcept;
+
+        // Wake up the locality owning the mailbox, if needed
+        void notify() noexcept;
+
+        // Prepare waiting for notifications, returns the current doorbell
+        // value which has to be passed to wait(). Any work which was
+        // triggered before calling this function has to be checked for
+        // afterwards.
+        std::uint32_t prepare_wait() noexcept;
+
+        // Wait for a notification (or until the timeout expires)
+        void wait(std::uint32_t doorbell,
+            std::chrono::microseconds timeout) noexcept;
+
+        // Cancel waiting for notifications
+        void cancel_wait() noexcept;
+
+    private:
+        bool has_new_channels() noexcept;
+        char const* slot_name(std::uint32_t slot) const noexcept;
+        bool accept_slot(std::uint32_t slot) noexcept;
+
+        std::uint32_t num_slots() const noexcept;
+
+        shared_memory_segment segment_;
+        header* header_ = nullptr;
+        std::uint32_t seen_channels_ = 0;
+    };
+
+    template <typename F>
+    void mailbox::accept(F&& f)
+    {
+        if (!has_new_channels())
+        {
+            return;
+        }
+
+        std::uint32_t const slots = num_slots();
+        for (std::uint32_t i = 0; i != slots; ++i)
+        {
+            if (accept_slot(i))
+            {
+                f(i, std::string(slot_name(i)));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A channel is a single-producer, single-consumer byte stream in a shared
+    // memory segment which is created by the sending locality.
+    class HPX_EXPORT channel
+    {
+    public:
+        struct header;
+
+        channel() = default;
+
+        // Create a new channel with the given capacity, the name of the
+        // sender's mailbox is stored in the channel
+        void create(std::string const& name, std::size_t capacity,
+            std::string const& sender_mailbox, error_code& ec = throws);
+
+        // Open a channel created by another locality
+        void open(std::string const& name, error_code& ec = throws);
+
+        void unlink() noexcept
+        {
+            segment_.unlink();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        std::string const& name() const noexcept
+        {
+            return segment_.name();
+        }
+
+        // Name of the mailbox of the sending locality
+        std::string sender_mailbox() const;
+
+        // Write (up to) the given number of bytes, returns the number of
+        // bytes written (sender only)
+        std::size_t write(void const* data, std::size_t size) noexcept;
+
+        // Read (up to) the given number of bytes, returns the number of bytes
+        // read (receiver only)
+        std::size_t read(void* data, std::size_t size) noexcept;
+
+        // Return whether data is available for reading
+        bool readable() const noexcept;
+
+        // The sender closes the channel once it is done with it
+        void close() noexcept;
+        bool closed() const noexcept;
+
+        // The receiver shuts the channel down if it stops receiving data
+        void shutdown() noexcept;
+        bool is_shut_down() const noexcept;
+
+        // The sender sets this flag if it is waiting for space to become
+        // available, the receiver resets it and notifies the sender
+        void set_sender_waiting() noexcept;
+        bool reset_sender_waiting() noexcept;
+
+    private:
+        shared_memory_segment segment_;
+        header* header_ = nullptr;
+        char* data_ = nullptr;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Header of every message written to a channel
+    struct message_header
+    {
+        std::uint64_t size;
+        std::uint64_t data_size;
+
+        // pair of (zero-copy, non-zero-copy) chunks
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+
+        // the zero-copy chunks are stored in a separate segment if the
+        // segment size is not zero, otherwise they follow the data
+        std::uint64_t segment_size;
+        char segment_name[max_name_length];
+    };
+
+    // Chunks stored in a separate segment are aligned to this
+    inline constexpr std::size_t chunk_alignment = 64;
+
+    constexpr std::size_t align_chunk(std::size_t size) noexcept
+    {
+        return (size + chunk_alignment - 1) & ~(chunk_alignment - 1);
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
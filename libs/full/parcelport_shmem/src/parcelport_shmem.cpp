@@ -0,0 +1,379 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        std::string next_segment_name(sender* s)
+        {
+            return s->next_segment_name();
+        }
+
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            // time the I/O thread sleeps at most while waiting for
+            // notifications
+            static constexpr std::chrono::microseconds wait_timeout =
+                std::chrono::milliseconds(100);
+
+            static std::string host_name()
+            {
+                char name[256] = {};
+                if (::gethostname(name, sizeof(name) - 1) != 0)
+                {
+                    return std::string();
+                }
+                return std::string(name);
+            }
+
+            // The name of the mailbox has to be unique on this host, all
+            // other segments created by this locality derive their names from
+            // it
+            static std::string mailbox_name()
+            {
+                std::random_device rd;
+                std::ostringstream strm;
+                strm << "/hpx.shmem." << ::getpid() << "." << std::hex
+                     << rd();
+                return strm.str();
+            }
+
+            static parcelset::locality local_endpoint()
+            {
+                return parcelset::locality(
+                    locality(host_name(), mailbox_name()));
+            }
+
+            template <typename T>
+            static T get_config_entry(
+                util::runtime_configuration const& ini, char const* key,
+                T dflt)
+            {
+                return hpx::util::get_entry_as<T>(ini, key, dflt);
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, local_endpoint(), notifier)
+              , stopped_(false)
+              , max_channels_(get_config_entry<std::uint32_t>(
+                    ini, "hpx.parcel.shmem.max_channels", 256))
+              , sender_(here_mailbox(),
+                    get_config_entry<std::size_t>(
+                        ini, "hpx.parcel.shmem.ring_size", 1048576),
+                    get_config_entry<std::size_t>(ini,
+                        "hpx.parcel.shmem.chunk_segment_threshold", 65536))
+              , receiver_(*this)
+              , background_threads_(get_config_entry<std::size_t>(
+                    ini, "hpx.parcel.shmem.background_threads", -1))
+            {
+            }
+
+            ~parcelport()
+            {
+                if (mailbox_)
+                {
+                    mailbox_.unlink();
+                }
+            }
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                mailbox_.create(here_mailbox(), max_channels_);
+                receiver_.run(mailbox_);
+
+                // the I/O thread progresses the channels while all worker
+                // threads are busy, it sleeps while there is nothing to do
+                io_service_pool_.get_io_service(0).post(
+                    hpx::bind(&parcelport::io_service_work, this));
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode_all))
+                {
+                    if (threads::get_self_ptr())
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                }
+
+                stopped_ = true;
+                if (mailbox_)
+                {
+                    // wake up the I/O thread
+                    mailbox_.notify();
+
+                    receiver_.shutdown();
+                    mailbox_.unlink();
+                }
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return here().get<locality>().host();
+            }
+
+            // Shared memory can be used only if the destination runs on the
+            // same host and its mailbox is accessible
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override
+            {
+                if (!use_alternative_parcelport)
+                {
+                    return false;
+                }
+
+                locality const& dest = l.get<locality>();
+                if (dest.host() != here().get<locality>().host())
+                {
+                    return false;
+                }
+
+                std::unique_lock lk(reachable_mtx_);
+                auto it = reachable_.find(dest.mailbox());
+                if (it == reachable_.end())
+                {
+                    it = reachable_
+                             .emplace(dest.mailbox(),
+                                 shared_memory_segment_exists(dest.mailbox()))
+                             .first;
+                }
+                return it->second;
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_ || num_thread >= background_threads_)
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode_send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode_receive)
+                {
+                    has_work =
+                        receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::string const& here_mailbox() const noexcept
+            {
+                return here().get<locality>().mailbox();
+            }
+
+            void io_service_work()
+            {
+                std::size_t k = 0;
+                while (!stopped_)
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work() || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                        continue;
+                    }
+
+                    if (++k < 64)
+                    {
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                            "io_service_work");
+                        continue;
+                    }
+
+                    // announce that we are going to sleep, everything
+                    // arriving afterwards rings the doorbell
+                    std::uint32_t const doorbell = mailbox_.prepare_wait();
+                    if (stopped_ || receiver_.background_work() ||
+                        sender_.background_work())
+                    {
+                        mailbox_.cancel_wait();
+                        k = 0;
+                        continue;
+                    }
+
+                    mailbox_.wait(doorbell, wait_timeout);
+                }
+            }
+
+            std::atomic<bool> stopped_;
+
+            std::uint32_t max_channels_;
+            mailbox mailbox_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            hpx::spinlock reachable_mtx_;
+            std::map<std::string, bool> reachable_;
+
+            std::size_t background_threads_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 200
+    //
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static constexpr char const* priority() noexcept
+        {
+            return "200";
+        }
+
+        static constexpr void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */) noexcept
+        {
+        }
+
+        // by default no additional initialization using the resource
+        // partitioner is required
+        static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+        static constexpr void destroy() noexcept {}
+
+        static constexpr char const* call() noexcept
+        {
+            return
+                // size of the ring buffer of each channel
+                "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:1048576}\n"
+
+                // maximal number of channels other localities can open
+                "max_channels = ${HPX_PARCEL_SHMEM_MAX_CHANNELS:256}\n"
+
+                // zero-copy chunks of at least this (total) size are passed
+                // in a separate shared memory segment
+                "chunk_segment_threshold = "
+                "${HPX_PARCEL_SHMEM_CHUNK_SEGMENT_THRESHOLD:65536}\n"
+
+                // number of cores that do background work, default: all
+                "background_threads = "
+                "${HPX_PARCEL_SHMEM_BACKGROUND_THREADS:-1}\n";
+        }
+    };
+}    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
@@ -0,0 +1,579 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // magic numbers identifying the segment types
+        constexpr std::uint64_t mailbox_magic = 0x78626c69616d7868;
+        constexpr std::uint64_t channel_magic = 0x6c656e6e61686378;
+
+        constexpr std::size_t align_offset(std::size_t size) noexcept
+        {
+            return (size + 63) & ~std::size_t(63);
+        }
+
+        std::uint32_t* futex_word(std::atomic<std::uint32_t>& a) noexcept
+        {
+            static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                    sizeof(std::uint32_t),
+                "std::atomic<std::uint32_t> can't be used as a futex");
+            return reinterpret_cast<std::uint32_t*>(&a);
+        }
+
+        // the futexes are shared between processes, i.e. the operations are
+        // not marked as private
+        void futex_wait(std::atomic<std::uint32_t>& a, std::uint32_t expected,
+            std::chrono::microseconds timeout) noexcept
+        {
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+            ts.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+            ::syscall(SYS_futex, futex_word(a), FUTEX_WAIT, expected, &ts,
+                nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>& a) noexcept
+        {
+            ::syscall(SYS_futex, futex_word(a), FUTEX_WAKE, INT_MAX, nullptr,
+                nullptr, 0);
+        }
+
+        void copy_name(char* target, std::string const& name) noexcept
+        {
+            std::size_t const size =
+                (std::min)(name.size(), max_name_length - 1);
+            std::memcpy(target, name.data(), size);
+            target[size] = '\0';
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    shared_memory_segment::shared_memory_segment(
+        shared_memory_segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(rhs.data_)
+      , size_(rhs.size_)
+    {
+        rhs.data_ = nullptr;
+        rhs.size_ = 0;
+    }
+
+    shared_memory_segment& shared_memory_segment::operator=(
+        shared_memory_segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = rhs.data_;
+            size_ = rhs.size_;
+
+            rhs.data_ = nullptr;
+            rhs.size_ = 0;
+        }
+        return *this;
+    }
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        reset();
+    }
+
+    void shared_memory_segment::reset() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    shared_memory_segment shared_memory_segment::create(
+        std::string const& name, std::size_t size, error_code& ec)
+    {
+        HPX_ASSERT(name.size() < max_name_length);
+
+        shared_memory_segment segment;
+
+        int const fd = ::shm_open(
+            name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "could not create shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return segment;
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            int const error = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "could not resize shared memory segment {}: {}", name,
+                std::strerror(error));
+            return segment;
+        }
+
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const error = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(error));
+            return segment;
+        }
+
+        segment.name_ = name;
+        segment.data_ = data;
+        segment.size_ = size;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment;
+    }
+
+    shared_memory_segment shared_memory_segment::open(
+        std::string const& name, error_code& ec)
+    {
+        shared_memory_segment segment;
+
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "could not open shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return segment;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "could not determine the size of shared memory segment {}",
+                name);
+            return segment;
+        }
+
+        std::size_t const size = static_cast<std::size_t>(st.st_size);
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const error = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(error));
+            return segment;
+        }
+
+        segment.name_ = name;
+        segment.data_ = data;
+        segment.size_ = size;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment;
+    }
+
+    void shared_memory_segment::unlink() noexcept
+    {
+        if (!name_.empty())
+        {
+            ::shm_unlink(name_.c_str());
+        }
+    }
+
+    bool shared_memory_segment_exists(std::string const& name)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            return false;
+        }
+        ::close(fd);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        enum slot_state : std::uint32_t
+        {
+            slot_free = 0,
+            slot_claimed = 1,
+            slot_ready = 2,
+            slot_attached = 3
+        };
+
+        struct mailbox_slot
+        {
+            std::atomic<std::uint32_t> state;
+            char name[max_name_length];
+        };
+    }    // namespace
+
+    struct mailbox::header
+    {
+        std::uint64_t magic;
+        std::uint32_t num_slots;
+
+        alignas(64) std::atomic<std::uint32_t> doorbell;
+        std::atomic<std::uint32_t> sleeping;
+
+        alignas(64) std::atomic<std::uint32_t> new_channels;
+
+        mailbox_slot* slots() noexcept
+        {
+            return reinterpret_cast<mailbox_slot*>(
+                reinterpret_cast<char*>(this) + align_offset(sizeof(header)));
+        }
+    };
+
+    void mailbox::create(std::string const& name, std::uint32_t num_slots)
+    {
+        segment_ = shared_memory_segment::create(name,
+            align_offset(sizeof(header)) + num_slots * sizeof(mailbox_slot));
+
+        header_ = new (segment_.data()) header;
+        header_->num_slots = num_slots;
+        header_->doorbell.store(0, std::memory_order_relaxed);
+        header_->sleeping.store(0, std::memory_order_relaxed);
+        header_->new_channels.store(0, std::memory_order_relaxed);
+
+        mailbox_slot* slots = header_->slots();
+        for (std::uint32_t i = 0; i != num_slots; ++i)
+        {
+            new (&slots[i].state) std::atomic<std::uint32_t>(slot_free);
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        header_->magic = mailbox_magic;
+    }
+
+    void mailbox::open(std::string const& name, error_code& ec)
+    {
+        segment_ = shared_memory_segment::open(name, ec);
+        if (!segment_)
+        {
+            return;
+        }
+
+        auto* h = static_cast<header*>(segment_.data());
+        if (segment_.size() < sizeof(header) || h->magic != mailbox_magic ||
+            segment_.size() <
+                align_offset(sizeof(header)) +
+                    h->num_slots * sizeof(mailbox_slot))
+        {
+            segment_ = shared_memory_segment();
+            HPX_THROWS_IF(ec, hpx::error::network_error, "shmem::mailbox::open",
+                "shared memory segment {} is not a valid mailbox", name);
+            return;
+        }
+        header_ = h;
+    }
+
+    std::uint32_t mailbox::num_slots() const noexcept
+    {
+        return header_->num_slots;
+    }
+
+    char const* mailbox::slot_name(std::uint32_t slot) const noexcept
+    {
+        return header_->slots()[slot].name;
+    }
+
+    bool mailbox::connect(std::string const& channel_name) noexcept
+    {
+        HPX_ASSERT(header_ != nullptr);
+
+        mailbox_slot* slots = header_->slots();
+        for (std::uint32_t i = 0; i != header_->num_slots; ++i)
+        {
+            std::uint32_t expected = slot_free;
+            if (slots[i].state.load(std::memory_order_relaxed) == slot_free &&
+                slots[i].state.compare_exchange_strong(
+                    expected, slot_claimed, std::memory_order_acquire))
+            {
+                copy_name(slots[i].name, channel_name);
+                slots[i].state.store(slot_ready, std::memory_order_release);
+
+                header_->new_channels.fetch_add(1, std::memory_order_release);
+                notify();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool mailbox::has_new_channels() noexcept
+    {
+        std::uint32_t const new_channels =
+            header_->new_channels.load(std::memory_order_acquire);
+        if (new_channels == seen_channels_)
+        {
+            return false;
+        }
+        seen_channels_ = new_channels;
+        return true;
+    }
+
+    bool mailbox::accept_slot(std::uint32_t slot) noexcept
+    {
+        std::atomic<std::uint32_t>& state = header_->slots()[slot].state;
+
+        std::uint32_t expected = slot_ready;
+        return state.load(std::memory_order_relaxed) == slot_ready &&
+            state.compare_exchange_strong(
+                expected, slot_attached, std::memory_order_acquire);
+    }
+
+    void mailbox::release(std::uint32_t slot) noexcept
+    {
+        HPX_ASSERT(slot < header_->num_slots);
+        header_->slots()[slot].state.store(
+            slot_free, std::memory_order_release);
+    }
+
+    void mailbox::notify() noexcept
+    {
+        header_->doorbell.fetch_add(1, std::memory_order_seq_cst);
+        if (header_->sleeping.load(std::memory_order_seq_cst) != 0)
+        {
+            futex_wake(header_->doorbell);
+        }
+    }
+
+    std::uint32_t mailbox::prepare_wait() noexcept
+    {
+        header_->sleeping.store(1, std::memory_order_seq_cst);
+        return header_->doorbell.load(std::memory_order_seq_cst);
+    }
+
+    void mailbox::wait(
+        std::uint32_t doorbell, std::chrono::microseconds timeout) noexcept
+    {
+        futex_wait(header_->doorbell, doorbell, timeout);
+        header_->sleeping.store(0, std::memory_order_relaxed);
+    }
+
+    void mailbox::cancel_wait() noexcept
+    {
+        header_->sleeping.store(0, std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct channel::header
+    {
+        std::uint64_t magic;
+        std::uint64_t capacity;
+        char sender_mailbox[max_name_length];
+
+        // total number of bytes written and read
+        alignas(64) std::atomic<std::uint64_t> head;
+        alignas(64) std::atomic<std::uint64_t> tail;
+
+        alignas(64) std::atomic<std::uint32_t> closed;
+        std::atomic<std::uint32_t> shut_down;
+        std::atomic<std::uint32_t> sender_waiting;
+    };
+
+    void channel::create(std::string const& name, std::size_t capacity,
+        std::string const& sender_mailbox, error_code& ec)
+    {
+        segment_ = shared_memory_segment::create(
+            name, align_offset(sizeof(header)) + capacity, ec);
+        if (!segment_)
+        {
+            return;
+        }
+
+        header_ = new (segment_.data()) header;
+        header_->capacity = capacity;
+        copy_name(header_->sender_mailbox, sender_mailbox);
+        header_->head.store(0, std::memory_order_relaxed);
+        header_->tail.store(0, std::memory_order_relaxed);
+        header_->closed.store(0, std::memory_order_relaxed);
+        header_->shut_down.store(0, std::memory_order_relaxed);
+        header_->sender_waiting.store(0, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_release);
+        header_->magic = channel_magic;
+
+        data_ =
+            static_cast<char*>(segment_.data()) + align_offset(sizeof(header));
+    }
+
+    void channel::open(std::string const& name, error_code& ec)
+    {
+        segment_ = shared_memory_segment::open(name, ec);
+        if (!segment_)
+        {
+            return;
+        }
+
+        auto* h = static_cast<header*>(segment_.data());
+        if (segment_.size() < sizeof(header) || h->magic != channel_magic ||
+            segment_.size() < align_offset(sizeof(header)) + h->capacity)
+        {
+            segment_ = shared_memory_segment();
+            HPX_THROWS_IF(ec, hpx::error::network_error, "shmem::channel::open",
+                "shared memory segment {} is not a valid channel", name);
+            return;
+        }
+
+        header_ = h;
+        data_ =
+            static_cast<char*>(segment_.data()) + align_offset(sizeof(header));
+    }
+
+    std::string channel::sender_mailbox() const
+    {
+        return std::string(header_->sender_mailbox);
+    }
+
+    std::size_t channel::write(void const* data, std::size_t size) noexcept
+    {
+        std::uint64_t const capacity = header_->capacity;
+        std::uint64_t const head =
+            header_->head.load(std::memory_order_relaxed);
+        std::uint64_t const tail =
+            header_->tail.load(std::memory_order_acquire);
+
+        std::size_t const n = static_cast<std::size_t>(
+            (std::min)(std::uint64_t(size), capacity - (head - tail)));
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        std::size_t const pos = static_cast<std::size_t>(head % capacity);
+        std::size_t const first = (std::min)(n, std::size_t(capacity - pos));
+
+        std::memcpy(data_ + pos, data, first);
+        std::memcpy(data_, static_cast<char const*>(data) + first, n - first);
+
+        header_->head.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    std::size_t channel::read(void* data, std::size_t size) noexcept
+    {
+        std::uint64_t const capacity = header_->capacity;
+        std::uint64_t const tail =
+            header_->tail.load(std::memory_order_relaxed);
+        std::uint64_t const head =
+            header_->head.load(std::memory_order_acquire);
+
+        std::size_t const n = static_cast<std::size_t>(
+            (std::min)(std::uint64_t(size), head - tail));
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        std::size_t const pos = static_cast<std::size_t>(tail % capacity);
+        std::size_t const first = (std::min)(n, std::size_t(capacity - pos));
+
+        std::memcpy(data, data_ + pos, first);
+        std::memcpy(static_cast<char*>(data) + first, data_, n - first);
+
+        header_->tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    bool channel::readable() const noexcept
+    {
+        return header_->head.load(std::memory_order_acquire) !=
+            header_->tail.load(std::memory_order_relaxed);
+    }
+
+    void channel::close() noexcept
+    {
+        header_->closed.store(1, std::memory_order_release);
+    }
+
+    bool channel::closed() const noexcept
+    {
+        return header_->closed.load(std::memory_order_acquire) != 0;
+    }
+
+    void channel::shutdown() noexcept
+    {
+        header_->shut_down.store(1, std::memory_order_release);
+    }
+
+    bool channel::is_shut_down() const noexcept
+    {
+        return header_->shut_down.load(std::memory_order_acquire) != 0;
+    }
+
+    void channel::set_sender_waiting() noexcept
+    {
+        header_->sender_waiting.store(1, std::memory_order_seq_cst);
+    }
+
+    bool channel::reset_sender_waiting() noexcept
+    {
+        return header_->sender_waiting.load(std::memory_order_seq_cst) != 0 &&
+            header_->sender_waiting.exchange(0, std::memory_order_seq_cst) !=
+            0;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
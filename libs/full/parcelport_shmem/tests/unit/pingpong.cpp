@@ -0,0 +1,117 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Sends messages back and forth between two localities. The message sizes
+// cover data copied through the channels, zero-copy chunks passed in separate
+// shared memory segments, and messages larger than the ring buffer of a
+// channel.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const message_sizes[] = {
+    1, 100, 4096, 70000, 1048576 + 17, 3 * 1048576};
+constexpr std::size_t num_iterations = 10;
+
+std::vector<char> make_message(std::size_t size, std::size_t seed)
+{
+    std::vector<char> message(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        message[i] = static_cast<char>((i * 31 + seed) % 251);
+    }
+    return message;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> pong(std::vector<char> message)
+{
+    return message;
+}
+HPX_PLAIN_ACTION(pong, pong_action)
+
+// send the message to the other locality which sends it back until the count
+// is exhausted, return the total number of bytes received
+std::uint64_t ping(hpx::id_type const& to, std::vector<char> const& message,
+    std::size_t count);
+HPX_PLAIN_ACTION(ping, ping_action)
+
+std::uint64_t ping(hpx::id_type const& to, std::vector<char> const& message,
+    std::size_t count)
+{
+    HPX_TEST(message == make_message(message.size(), count % 2));
+    if (count == 0)
+    {
+        return message.size();
+    }
+
+    std::uint64_t const received =
+        ping_action()(to, hpx::find_here(),
+            make_message(message.size(), (count - 1) % 2), count - 1);
+    return received + message.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_pong(hpx::id_type const& there)
+{
+    for (std::size_t size : message_sizes)
+    {
+        std::vector<hpx::future<std::vector<char>>> replies;
+        replies.reserve(num_iterations);
+        for (std::size_t i = 0; i != num_iterations; ++i)
+        {
+            replies.push_back(
+                hpx::async(pong_action(), there, make_message(size, i)));
+        }
+
+        for (std::size_t i = 0; i != num_iterations; ++i)
+        {
+            HPX_TEST(replies[i].get() == make_message(size, i));
+        }
+    }
+}
+
+void test_ping(hpx::id_type const& there)
+{
+    for (std::size_t size : message_sizes)
+    {
+        std::uint64_t const received = ping_action()(there, hpx::find_here(),
+            make_message(size, num_iterations % 2), num_iterations);
+        HPX_TEST_EQ(received, (num_iterations + 1) * size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+
+    for (hpx::id_type const& there : localities)
+    {
+        test_pong(there);
+        test_ping(there);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
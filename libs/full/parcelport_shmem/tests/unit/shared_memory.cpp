@@ -0,0 +1,306 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exercises the shared memory channels and mailboxes used by the shared memory
+// parcelport within a single process.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::channel;
+using hpx::parcelset::policies::shmem::mailbox;
+
+///////////////////////////////////////////////////////////////////////////////
+std::string make_name(char const* name)
+{
+    return "/hpx_shmem_test." + std::to_string(::getpid()) + "." + name;
+}
+
+std::vector<char> make_data(std::size_t size, std::size_t seed)
+{
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<char>((i * 31 + seed) % 251);
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// pieces of odd sizes wrap around the end of the ring buffer at all possible
+// positions
+void test_wraparound()
+{
+    std::size_t const capacity = 64;
+
+    channel sender;
+    sender.create(make_name("wraparound"), capacity, make_name("mailbox"));
+    HPX_TEST(sender);
+
+    channel receiver;
+    receiver.open(sender.name());
+    HPX_TEST(receiver);
+    HPX_TEST_EQ(receiver.sender_mailbox(), make_name("mailbox"));
+
+    std::vector<char> const data = make_data(capacity * 100, 1);
+    std::vector<char> received(data.size());
+
+    std::size_t written = 0;
+    std::size_t read = 0;
+    for (std::size_t i = 0; read != data.size(); ++i)
+    {
+        std::size_t const write_size =
+            (std::min)(std::size_t(7 + i % 13), data.size() - written);
+        written += sender.write(data.data() + written, write_size);
+
+        std::size_t const read_size = 5 + i % 11;
+        read += receiver.read(
+            received.data() + read, (std::min)(read_size, written - read));
+    }
+    HPX_TEST(received == data);
+
+    // a full ring accepts no more data, an empty one yields none
+    HPX_TEST(!receiver.readable());
+    HPX_TEST_EQ(sender.write(data.data(), capacity + 1), capacity);
+    HPX_TEST_EQ(sender.write(data.data(), 1), std::size_t(0));
+    HPX_TEST(receiver.readable());
+
+    std::vector<char> buffer(capacity + 1);
+    HPX_TEST_EQ(receiver.read(buffer.data(), buffer.size()), capacity);
+    HPX_TEST(std::equal(
+        buffer.begin(), buffer.begin() + capacity, data.begin()));
+    HPX_TEST_EQ(receiver.read(buffer.data(), buffer.size()), std::size_t(0));
+    HPX_TEST(!receiver.readable());
+
+    sender.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a message larger than the ring buffer is streamed through it by concurrent
+// writes and reads
+void test_large_message()
+{
+    std::size_t const capacity = 4096;
+
+    channel sender;
+    sender.create(make_name("large"), capacity, make_name("mailbox"));
+
+    channel receiver;
+    receiver.open(sender.name());
+
+    std::vector<char> const data = make_data(capacity * 257 + 13, 2);
+    std::vector<char> received(data.size());
+
+    std::thread writer([&]() {
+        std::size_t written = 0;
+        while (written != data.size())
+        {
+            std::size_t const n = sender.write(data.data() + written,
+                (std::min)(capacity / 3, data.size() - written));
+            if (n == 0)
+            {
+                std::this_thread::yield();
+            }
+            written += n;
+        }
+        sender.close();
+    });
+
+    std::size_t read = 0;
+    while (read != data.size())
+    {
+        std::size_t const n = receiver.read(
+            received.data() + read, (std::min)(std::size_t(1000),
+                                        data.size() - read));
+        if (n == 0)
+        {
+            std::this_thread::yield();
+        }
+        read += n;
+    }
+    writer.join();
+
+    HPX_TEST(received == data);
+    HPX_TEST(receiver.closed());
+    HPX_TEST(!receiver.readable());
+
+    sender.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_flags()
+{
+    channel sender;
+    sender.create(make_name("flags"), 64, make_name("mailbox"));
+
+    channel receiver;
+    receiver.open(sender.name());
+
+    HPX_TEST(!receiver.closed());
+    HPX_TEST(!sender.is_shut_down());
+    HPX_TEST(!receiver.reset_sender_waiting());
+
+    sender.set_sender_waiting();
+    HPX_TEST(receiver.reset_sender_waiting());
+    HPX_TEST(!receiver.reset_sender_waiting());
+
+    receiver.shutdown();
+    HPX_TEST(sender.is_shut_down());
+
+    sender.close();
+    HPX_TEST(receiver.closed());
+
+    sender.unlink();
+
+    // the name of the channel is gone, opening it fails
+    channel unlinked;
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    unlinked.open(sender.name(), ec);
+    HPX_TEST(ec);
+    HPX_TEST(!unlinked);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_connect()
+{
+    mailbox receiver;
+    receiver.create(make_name("connect"), 2);
+
+    mailbox sender;
+    sender.open(make_name("connect"));
+    HPX_TEST(sender);
+
+    HPX_TEST(sender.connect("first"));
+    HPX_TEST(sender.connect("second"));
+    HPX_TEST(!sender.connect("third"));
+
+    std::vector<std::string> names(2);
+    std::size_t accepted = 0;
+    receiver.accept([&](std::uint32_t slot, std::string const& name) {
+        HPX_TEST_LT(slot, std::uint32_t(2));
+        names[slot] = name;
+        ++accepted;
+    });
+    HPX_TEST_EQ(accepted, std::size_t(2));
+    HPX_TEST_EQ(names[0], std::string("first"));
+    HPX_TEST_EQ(names[1], std::string("second"));
+
+    // channels are reported only once
+    receiver.accept([&](std::uint32_t, std::string const&) { ++accepted; });
+    HPX_TEST_EQ(accepted, std::size_t(2));
+
+    // a released slot can be reused
+    receiver.release(0);
+    HPX_TEST(sender.connect("third"));
+    receiver.accept([&](std::uint32_t slot, std::string const& name) {
+        HPX_TEST_EQ(slot, std::uint32_t(0));
+        HPX_TEST_EQ(name, std::string("third"));
+        ++accepted;
+    });
+    HPX_TEST_EQ(accepted, std::size_t(3));
+
+    receiver.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the owner of a mailbox sleeps on its doorbell until another process rings it
+void test_doorbell()
+{
+    using namespace std::chrono_literals;
+
+    mailbox receiver;
+    receiver.create(make_name("doorbell"), 1);
+
+    mailbox sender;
+    sender.open(make_name("doorbell"));
+
+    // nobody rings, the wait times out
+    {
+        std::uint32_t const doorbell = receiver.prepare_wait();
+        auto const start = std::chrono::steady_clock::now();
+        receiver.wait(doorbell, 10ms);
+        HPX_TEST(std::chrono::steady_clock::now() - start >= 5ms);
+    }
+
+    // the doorbell rang after preparing to wait, the wait returns immediately
+    {
+        std::uint32_t const doorbell = receiver.prepare_wait();
+        sender.notify();
+        auto const start = std::chrono::steady_clock::now();
+        receiver.wait(doorbell, 60s);
+        HPX_TEST(std::chrono::steady_clock::now() - start < 30s);
+    }
+
+    // the sleeping receiver is woken up by the futex
+    for (int i = 0; i != 10; ++i)
+    {
+        std::atomic<bool> waiting(false);
+        std::atomic<bool> woken(false);
+
+        std::thread waiter([&]() {
+            std::uint32_t const doorbell = receiver.prepare_wait();
+            waiting = true;
+            receiver.wait(doorbell, 60s);
+            woken = true;
+        });
+
+        while (!waiting)
+        {
+            std::this_thread::yield();
+        }
+        std::this_thread::sleep_for(1ms);
+
+        auto const start = std::chrono::steady_clock::now();
+        sender.notify();
+        waiter.join();
+
+        HPX_TEST(woken);
+        HPX_TEST(std::chrono::steady_clock::now() - start < 30s);
+    }
+
+    // a channel being connected rings the doorbell as well
+    {
+        std::uint32_t const doorbell = receiver.prepare_wait();
+        HPX_TEST(sender.connect("channel"));
+        auto const start = std::chrono::steady_clock::now();
+        receiver.wait(doorbell, 60s);
+        HPX_TEST(std::chrono::steady_clock::now() - start < 30s);
+    }
+
+    receiver.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_wraparound();
+    test_large_message();
+    test_flags();
+    test_connect();
+    test_doorbell();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
@@ -13,6 +13,7 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/parcelport_tcp/io_uring_context.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
 #include <hpx/parcelset/parcelport_impl.hpp>
@@ -111,6 +112,10 @@ namespace hpx::parcelset {
             void handle_read_completion(std::error_code const& e,
                 std::shared_ptr<receiver> receiver_conn);
 
+            // Return the io_uring context associated with the given
+            // io_context, if any
+            io_uring_context* get_io_uring(asio::io_context& io_service) const;
+
             /// Acceptor used to listen for incoming connections.
             asio::ip::tcp::acceptor* acceptor_;
 
@@ -125,6 +130,14 @@ namespace hpx::parcelset {
             using write_connections_set = std::set<std::weak_ptr<sender>>;
             write_connections_set write_connections_;
 #endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            // one io_uring instance per io_context, empty if io_uring is
+            // disabled or not supported
+            bool use_io_uring_;
+            io_uring_parameters io_uring_params_;
+            std::vector<std::unique_ptr<io_uring_context>> io_urings_;
+#endif
         };
     }    // namespace policies::tcp
 }    // namespace hpx::parcelset
@@ -0,0 +1,208 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/modules/functional.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/tcp.hpp>
+#include <asio/read.hpp>
+#include <asio/write.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <asio/posix/stream_descriptor.hpp>
+
+#include <mutex>
+#endif
+
+namespace hpx::parcelset::policies::tcp {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_parameters
+    {
+        // number of submission queue entries
+        std::uint32_t queue_depth = 256;
+
+        // number and size of the buffers registered with the kernel, small
+        // transfers are staged through those, which avoids mapping the user
+        // memory for every operation
+        std::size_t num_registered_buffers = 64;
+        std::size_t registered_buffer_size = 4096;
+
+        // messages of at least this size are sent using zero-copy sends
+        // (IORING_OP_SENDMSG_ZC), zero disables zero-copy sends
+        std::size_t zero_copy_threshold = 65536;
+    };
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+    ///////////////////////////////////////////////////////////////////////////
+    // The io_uring context submits socket reads and writes to an io_uring
+    // instance. Completions are reaped by the thread running the associated
+    // io_context (the ring signals an eventfd which is watched by the
+    // io_context), all handlers are invoked on that thread. Operations issued
+    // while completions are being handled are submitted together, using a
+    // single system call.
+    class HPX_EXPORT io_uring_context
+    {
+    public:
+        using handler_type =
+            hpx::move_only_function<void(std::error_code const&, std::size_t)>;
+
+        struct operation;
+
+        // Create a new io_uring context, returns an empty pointer if io_uring
+        // is not supported by the kernel (or is not permitted)
+        static std::unique_ptr<io_uring_context> create(
+            asio::io_context& io_service, io_uring_parameters const& params);
+
+        io_uring_context(io_uring_context const&) = delete;
+        io_uring_context(io_uring_context&&) = delete;
+        io_uring_context& operator=(io_uring_context const&) = delete;
+        io_uring_context& operator=(io_uring_context&&) = delete;
+
+        ~io_uring_context();
+
+        asio::io_context& get_io_service() noexcept
+        {
+            return io_service_;
+        }
+
+        // Write all of the given buffers to the socket, the buffers have to
+        // stay alive until the handler is invoked
+        void async_write(int fd, std::vector<asio::const_buffer> const& buffers,
+            handler_type handler);
+
+        // Read until all of the given buffers are filled
+        void async_read(int fd,
+            std::vector<asio::mutable_buffer> const& buffers,
+            handler_type handler);
+
+        // Stop reaping completions, all pending operations have to have
+        // completed (i.e. the corresponding sockets have been shut down)
+        void stop();
+
+        bool has_registered_buffers() const noexcept
+        {
+            return registered_buffers_ != nullptr;
+        }
+
+        bool has_zero_copy_send() const noexcept
+        {
+            return zero_copy_threshold_ != 0;
+        }
+
+    private:
+        io_uring_context(
+            asio::io_context& io_service, io_uring_parameters const& params);
+
+        bool init(io_uring_parameters const& params);
+
+        void start(std::unique_ptr<operation> op);
+        void submit(operation* op);
+        void flush();
+
+        void wait_for_completions();
+        void reap_completions();
+        bool handle_completion(operation* op, int res, std::uint32_t flags);
+
+        void release_slot(operation* op);
+
+        asio::io_context& io_service_;
+        asio::posix::stream_descriptor event_;
+
+        int ring_fd_ = -1;
+        int event_fd_ = -1;
+
+        // mapped submission and completion queues
+        void* sq_ring_ = nullptr;
+        std::size_t sq_ring_size_ = 0;
+        void* cq_ring_ = nullptr;
+        std::size_t cq_ring_size_ = 0;
+        void* sqes_ = nullptr;
+        std::size_t sqes_size_ = 0;
+
+        std::uint32_t* sq_head_ = nullptr;
+        std::uint32_t* sq_tail_ = nullptr;
+        std::uint32_t sq_mask_ = 0;
+        std::uint32_t sq_entries_ = 0;
+        std::uint32_t* sq_array_ = nullptr;
+
+        std::uint32_t* cq_head_ = nullptr;
+        std::uint32_t* cq_tail_ = nullptr;
+        std::uint32_t cq_mask_ = 0;
+        void* cqes_ = nullptr;
+
+        // protects the submission queue and the free buffer slots
+        std::mutex mtx_;
+        std::uint32_t to_submit_ = 0;
+
+        // buffers registered with the kernel
+        char* registered_buffers_ = nullptr;
+        std::size_t registered_buffer_size_ = 0;
+        std::size_t num_registered_buffers_ = 0;
+        std::vector<std::uint32_t> free_slots_;
+
+        // list of all outstanding operations
+        operation* head_ = nullptr;
+
+        std::size_t zero_copy_threshold_ = 0;
+        bool stopped_ = false;
+    };
+#else
+    class io_uring_context;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Write all buffers to the socket, using the given io_uring context if
+    // available
+    template <typename Handler>
+    void async_write(asio::ip::tcp::socket& socket,
+        [[maybe_unused]] io_uring_context* uring,
+        std::vector<asio::const_buffer> const& buffers, Handler&& handler)
+    {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (uring != nullptr)
+        {
+            uring->async_write(socket.native_handle(), buffers,
+                HPX_FORWARD(Handler, handler));
+            return;
+        }
+#endif
+        asio::async_write(socket, buffers, HPX_FORWARD(Handler, handler));
+    }
+
+    // Fill all buffers from the socket, using the given io_uring context if
+    // available
+    template <typename Handler>
+    void async_read(asio::ip::tcp::socket& socket,
+        [[maybe_unused]] io_uring_context* uring,
+        std::vector<asio::mutable_buffer> const& buffers, Handler&& handler)
+    {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (uring != nullptr)
+        {
+            uring->async_read(socket.native_handle(), buffers,
+                HPX_FORWARD(Handler, handler));
+            return;
+        }
+#endif
+        asio::async_read(socket, buffers, HPX_FORWARD(Handler, handler));
+    }
+}    // namespace hpx::parcelset::policies::tcp
+
+#endif
@@ -20,6 +20,7 @@
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/timing.hpp>
 
+#include <hpx/parcelport_tcp/io_uring_context.hpp>
 #include <hpx/parcelset/decode_parcels.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
@@ -56,8 +57,9 @@ namespace hpx::parcelset::policies::tcp {
     {
     public:
         receiver(asio::io_context& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport, io_uring_context* uring = nullptr)
           : socket_(io_service)
+          , uring_(uring)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
           , parcelport_(parcelport)
@@ -120,7 +122,7 @@ namespace hpx::parcelset::policies::tcp {
                 void (receiver::*f)(std::error_code const&, std::size_t,
                     Handler) = &receiver::handle_read_header<Handler>;
 
-                asio::async_read(socket_, buffers,
+                tcp::async_read(socket_, uring_, buffers,
                     hpx::bind(f, shared_from_this(),
                         placeholders::_1,    // error
                         placeholders::_2,    // bytes_transferred
@@ -242,7 +244,7 @@ namespace hpx::parcelset::policies::tcp {
                         quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    asio::async_read(socket_, buffers,
+                    tcp::async_read(socket_, uring_, buffers,
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -303,7 +305,7 @@ namespace hpx::parcelset::policies::tcp {
                         quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    asio::async_read(socket_, buffers,
+                    tcp::async_read(socket_, uring_, buffers,
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -351,8 +353,9 @@ namespace hpx::parcelset::policies::tcp {
                         return;
                     }
 
-                    asio::async_write(socket_,
-                        asio::buffer(&ack_, sizeof(ack_)),
+                    tcp::async_write(socket_, uring_,
+                        std::vector<asio::const_buffer>{
+                            asio::buffer(&ack_, sizeof(ack_))},
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -378,6 +381,7 @@ namespace hpx::parcelset::policies::tcp {
 
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
+        io_uring_context* uring_;
 
         std::uint64_t max_inbound_size_;
 
@@ -19,6 +19,7 @@
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 
+#include <hpx/parcelport_tcp/io_uring_context.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
@@ -56,9 +57,13 @@ namespace hpx::parcelset::policies::tcp {
 
     public:
         // Construct a sending parcelport_connection with the given io_context.
+        // If an io_uring context is given, it is used for the socket's reads
+        // and writes instead of asio.
         sender(asio::io_context& io_service,
-            parcelset::locality const& locality_id, parcelset::parcelport* pp)
+            parcelset::locality const& locality_id, parcelset::parcelport* pp,
+            io_uring_context* uring = nullptr)
           : socket_(io_service)
+          , uring_(uring)
           , ack_(0)
           , there_(locality_id)
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
@@ -185,7 +190,7 @@ namespace hpx::parcelset::policies::tcp {
             void (sender::*f)(std::error_code const&, std::size_t) =
                 &sender::handle_write;
 
-            asio::async_write(socket_, buffers,
+            tcp::async_write(socket_, uring_, buffers,
                 hpx::bind(
                     f, shared_from_this(), placeholders::_1, placeholders::_2));
         }
@@ -251,7 +256,9 @@ namespace hpx::parcelset::policies::tcp {
             void (sender::*f)(std::error_code const&) =
                 &sender::handle_read_ack;
 
-            asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
+            tcp::async_read(socket_, uring_,
+                std::vector<asio::mutable_buffer>{
+                    asio::buffer(&ack_, sizeof(ack_))},
                 hpx::bind(f, shared_from_this(), placeholders::_1));
         }
 
@@ -274,6 +281,7 @@ namespace hpx::parcelset::policies::tcp {
 
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
+        io_uring_context* uring_;
 
         bool ack_;
 
@@ -19,6 +19,7 @@
 #include <hpx/modules/util.hpp>
 
 #include <hpx/parcelport_tcp/connection_handler.hpp>
+#include <hpx/parcelport_tcp/io_uring_context.hpp>
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/receiver.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
@@ -64,6 +65,11 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+      , use_io_uring_(
+            hpx::util::get_entry_as<int>(ini, "hpx.parcel.tcp.io_uring", 1) !=
+            0)
+#endif
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -73,6 +79,24 @@ namespace hpx::parcelset::policies::tcp {
                 "locality type: {}",
                 here_.type());
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_params_.queue_depth = hpx::util::get_entry_as<std::uint32_t>(
+            ini, "hpx.parcel.tcp.io_uring_queue_depth",
+            io_uring_params_.queue_depth);
+        io_uring_params_.num_registered_buffers =
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.tcp.io_uring_registered_buffers",
+                io_uring_params_.num_registered_buffers);
+        io_uring_params_.registered_buffer_size =
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.tcp.io_uring_registered_buffer_size",
+                io_uring_params_.registered_buffer_size);
+        io_uring_params_.zero_copy_threshold =
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.tcp.io_uring_zero_copy_threshold",
+                io_uring_params_.zero_copy_threshold);
+#endif
     }
 
     connection_handler::~connection_handler()
@@ -82,6 +106,26 @@ namespace hpx::parcelset::policies::tcp {
 
     bool connection_handler::do_run()
     {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // create one io_uring instance per io_context, fall back to asio if
+        // io_uring is not available
+        if (use_io_uring_ && io_urings_.empty())
+        {
+            for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+            {
+                auto uring = io_uring_context::create(
+                    io_service_pool_.get_io_service(static_cast<int>(i)),
+                    io_uring_params_);
+                if (!uring)
+                {
+                    io_urings_.clear();
+                    break;
+                }
+                io_urings_.push_back(HPX_MOVE(uring));
+            }
+        }
+#endif
+
         using asio::ip::tcp;
         asio::io_context& io_service = io_service_pool_.get_io_service();
         if (nullptr == acceptor_)
@@ -97,8 +141,9 @@ namespace hpx::parcelset::policies::tcp {
         {
             try
             {
-                std::shared_ptr<receiver> receiver_conn(new receiver(
-                    io_service, get_max_inbound_message_size(), *this));
+                std::shared_ptr<receiver> receiver_conn(
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, get_io_uring(io_service)));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -158,7 +203,7 @@ namespace hpx::parcelset::policies::tcp {
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
         std::shared_ptr<sender> sender_connection(
-            new sender(io_service, l, this));
+            new sender(io_service, l, this, get_io_uring(io_service)));
 
         // Connect to the target locality, retry if needed
         std::error_code error = asio::error::try_again;
@@ -252,6 +297,21 @@ namespace hpx::parcelset::policies::tcp {
         return sender_connection;
     }
 
+    io_uring_context* connection_handler::get_io_uring(
+        [[maybe_unused]] asio::io_context& io_service) const
+    {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        for (auto const& uring : io_urings_)
+        {
+            if (&uring->get_io_service() == &io_service)
+            {
+                return uring.get();
+            }
+        }
+#endif
+        return nullptr;
+    }
+
     parcelset::locality connection_handler::agas_locality(
         util::runtime_configuration const& ini) const
     {
@@ -287,8 +347,9 @@ namespace hpx::parcelset::policies::tcp {
             std::shared_ptr<receiver> c(receiver_conn);
 
             asio::io_context& io_service = io_service_pool_.get_io_service();
-            receiver_conn.reset(new receiver(
-                io_service, get_max_inbound_message_size(), *this));
+            receiver_conn.reset(new receiver(io_service,
+                get_max_inbound_message_size(), *this,
+                get_io_uring(io_service)));
             acceptor_->async_accept(receiver_conn->socket(),
                 hpx::bind(&connection_handler::handle_accept, this,
                     placeholders::_1, receiver_conn));
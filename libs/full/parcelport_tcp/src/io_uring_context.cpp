@@ -0,0 +1,800 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/assert.hpp>
+
+#include <hpx/parcelport_tcp/io_uring_context.hpp>
+
+#include <asio/error.hpp>
+#include <asio/post.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// zero-copy sends using sendmsg were added in Linux 6.1
+#if defined(IORING_CQE_F_NOTIF) && defined(IORING_SEND_ZC_REPORT_USAGE)
+#define HPX_PARCELPORT_TCP_IO_URING_SENDMSG_ZC
+#endif
+
+namespace hpx::parcelset::policies::tcp {
+
+    namespace {
+
+        int io_uring_setup(std::uint32_t entries, io_uring_params* p) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, std::uint32_t to_submit,
+            std::uint32_t min_complete, std::uint32_t flags) noexcept
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(int fd, unsigned int opcode, void const* arg,
+            unsigned int nr_args) noexcept
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        template <typename T>
+        T* ring_ptr(void* ring, std::uint32_t offset) noexcept
+        {
+            return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+        }
+
+        std::uint32_t load_acquire(std::uint32_t const* p) noexcept
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        void store_release(std::uint32_t* p, std::uint32_t value) noexcept
+        {
+            __atomic_store_n(p, value, __ATOMIC_RELEASE);
+        }
+
+        std::error_code make_error(int res)
+        {
+            if (res == -ECANCELED)
+            {
+                return asio::error::make_error_code(
+                    asio::error::operation_aborted);
+            }
+            return std::error_code(-res, std::system_category());
+        }
+
+        // the context currently reaping completions on this thread
+        thread_local io_uring_context* reaping_context = nullptr;
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_context::operation
+    {
+        enum class kind
+        {
+            read,
+            write
+        };
+
+        operation(kind k, int fd, handler_type&& handler)
+          : kind_(k)
+          , fd_(fd)
+          , handler_(HPX_MOVE(handler))
+        {
+            std::memset(&msg_, 0, sizeof(msg_));
+        }
+
+        kind kind_;
+        int fd_;
+
+        // the (remaining) user buffers
+        std::vector<iovec> iov_;
+        std::size_t first_ = 0;
+
+        std::size_t size_ = 0;
+        std::size_t transferred_ = 0;
+
+        msghdr msg_;
+        handler_type handler_;
+        std::error_code ec_;
+
+        // index of the registered buffer used for staging the data, if any
+        std::int32_t slot_ = -1;
+
+        bool zero_copy_ = false;
+        bool completed_ = false;
+        std::uint32_t pending_notifications_ = 0;
+
+        // list of all outstanding operations
+        operation* prev_ = nullptr;
+        operation* next_ = nullptr;
+
+        // account for the given number of transferred bytes
+        void advance(std::size_t bytes) noexcept
+        {
+            transferred_ += bytes;
+            if (slot_ != -1)
+            {
+                return;
+            }
+
+            while (bytes != 0 && first_ != iov_.size())
+            {
+                iovec& v = iov_[first_];
+                std::size_t const n = (std::min)(bytes, v.iov_len);
+                v.iov_base = static_cast<char*>(v.iov_base) + n;
+                v.iov_len -= n;
+                bytes -= n;
+                if (v.iov_len == 0)
+                {
+                    ++first_;
+                }
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<io_uring_context> io_uring_context::create(
+        asio::io_context& io_service, io_uring_parameters const& params)
+    {
+        std::unique_ptr<io_uring_context> ctx(
+            new io_uring_context(io_service, params));
+        if (!ctx->init(params))
+        {
+            return {};
+        }
+
+        ctx->wait_for_completions();
+        return ctx;
+    }
+
+    io_uring_context::io_uring_context(
+        asio::io_context& io_service, io_uring_parameters const& params)
+      : io_service_(io_service)
+      , event_(io_service)
+      , zero_copy_threshold_(params.zero_copy_threshold)
+    {
+    }
+
+    bool io_uring_context::init(io_uring_parameters const& params)
+    {
+        std::uint32_t const depth = (std::max)(params.queue_depth, 8u);
+
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        p.flags = IORING_SETUP_CQSIZE;
+        p.cq_entries = 4 * depth;
+
+        ring_fd_ = io_uring_setup(depth, &p);
+        if (ring_fd_ < 0)
+        {
+            ring_fd_ = -1;
+            return false;
+        }
+
+        // map the submission and completion queues
+        sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(std::uint32_t);
+        cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+
+        bool const single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap)
+        {
+            sq_ring_size_ = cq_ring_size_ =
+                (std::max)(sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED)
+        {
+            sq_ring_ = nullptr;
+            return false;
+        }
+
+        if (single_mmap)
+        {
+            cq_ring_ = sq_ring_;
+        }
+        else
+        {
+            cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+            if (cq_ring_ == MAP_FAILED)
+            {
+                cq_ring_ = nullptr;
+                return false;
+            }
+        }
+
+        sqes_size_ = p.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES);
+        if (sqes_ == MAP_FAILED)
+        {
+            sqes_ = nullptr;
+            return false;
+        }
+
+        sq_head_ = ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.head);
+        sq_tail_ = ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.tail);
+        sq_mask_ = *ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.ring_mask);
+        sq_entries_ = p.sq_entries;
+        sq_array_ = ring_ptr<std::uint32_t>(sq_ring_, p.sq_off.array);
+
+        cq_head_ = ring_ptr<std::uint32_t>(cq_ring_, p.cq_off.head);
+        cq_tail_ = ring_ptr<std::uint32_t>(cq_ring_, p.cq_off.tail);
+        cq_mask_ = *ring_ptr<std::uint32_t>(cq_ring_, p.cq_off.ring_mask);
+        cqes_ = ring_ptr<void>(cq_ring_, p.cq_off.cqes);
+
+        // completions are signaled through an eventfd watched by the
+        // io_context
+        event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (event_fd_ < 0)
+        {
+            event_fd_ = -1;
+            return false;
+        }
+
+        if (io_uring_register(
+                ring_fd_, IORING_REGISTER_EVENTFD, &event_fd_, 1) != 0)
+        {
+            ::close(event_fd_);
+            event_fd_ = -1;
+            return false;
+        }
+
+        std::error_code ec;
+        event_.assign(event_fd_, ec);
+        if (ec)
+        {
+            ::close(event_fd_);
+            event_fd_ = -1;
+            return false;
+        }
+
+        // register the staging buffers, this is optional
+        std::size_t const num_buffers = params.num_registered_buffers;
+        std::size_t const buffer_size = params.registered_buffer_size;
+        if (num_buffers != 0 && buffer_size != 0)
+        {
+            void* buffers = ::mmap(nullptr, num_buffers * buffer_size,
+                PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (buffers != MAP_FAILED)
+            {
+                iovec v = {buffers, num_buffers * buffer_size};
+                if (io_uring_register(
+                        ring_fd_, IORING_REGISTER_BUFFERS, &v, 1) == 0)
+                {
+                    registered_buffers_ = static_cast<char*>(buffers);
+                    registered_buffer_size_ = buffer_size;
+                    num_registered_buffers_ = num_buffers;
+
+                    free_slots_.reserve(num_buffers);
+                    for (std::size_t i = num_buffers; i != 0; --i)
+                    {
+                        free_slots_.push_back(
+                            static_cast<std::uint32_t>(i - 1));
+                    }
+                }
+                else
+                {
+                    ::munmap(buffers, num_buffers * buffer_size);
+                }
+            }
+        }
+
+        // zero-copy sends are used only if supported by the kernel
+#if defined(HPX_PARCELPORT_TCP_IO_URING_SENDMSG_ZC)
+        if (zero_copy_threshold_ != 0)
+        {
+            std::size_t const probe_size = sizeof(io_uring_probe) +
+                (IORING_OP_LAST + 1) * sizeof(io_uring_probe_op);
+            std::vector<std::uint64_t> storage(probe_size / 8 + 1, 0);
+            auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+
+            if (io_uring_register(ring_fd_, IORING_REGISTER_PROBE, probe,
+                    IORING_OP_LAST + 1) != 0 ||
+                probe->last_op < IORING_OP_SENDMSG_ZC ||
+                !(probe->ops[IORING_OP_SENDMSG_ZC].flags &
+                    IO_URING_OP_SUPPORTED))
+            {
+                zero_copy_threshold_ = 0;
+            }
+        }
+#else
+        zero_copy_threshold_ = 0;
+#endif
+        return true;
+    }
+
+    io_uring_context::~io_uring_context()
+    {
+        stop();
+
+        // cancel all outstanding operations and wait for them to complete,
+        // the kernel may still refer to their buffers otherwise
+        if (ring_fd_ != -1 && sqes_ != nullptr)
+        {
+            reaping_context = this;
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                if (head_ != nullptr)
+                {
+#if defined(IORING_ASYNC_CANCEL_ANY)
+                    std::uint32_t const tail = *sq_tail_;
+                    if (tail - load_acquire(sq_head_) != sq_entries_)
+                    {
+                        std::uint32_t const idx = tail & sq_mask_;
+                        io_uring_sqe* sqe =
+                            static_cast<io_uring_sqe*>(sqes_) + idx;
+                        std::memset(sqe, 0, sizeof(*sqe));
+                        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+                        sqe->fd = -1;
+                        sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+                        sqe->user_data = 0;
+                        sq_array_[idx] = idx;
+                        store_release(sq_tail_, tail + 1);
+                        ++to_submit_;
+                    }
+#endif
+                }
+            }
+
+            // the operations complete only if the kernel supports cancelling
+            // them or if their sockets have been shut down, don't wait for
+            // them indefinitely
+            auto const deadline = std::chrono::steady_clock::now() +
+                std::chrono::milliseconds(100);
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    flush();
+                }
+                reap_completions();
+
+                if (head_ == nullptr ||
+                    std::chrono::steady_clock::now() >= deadline)
+                {
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            reaping_context = nullptr;
+        }
+
+        // closing the ring makes the kernel cancel all operations which are
+        // still outstanding
+        if (head_ != nullptr && ring_fd_ != -1)
+        {
+            ::close(ring_fd_);
+            ring_fd_ = -1;
+        }
+
+        // operations which did not complete are dropped, their handlers are
+        // not invoked
+        while (head_ != nullptr)
+        {
+            operation* op = head_;
+            head_ = op->next_;
+            delete op;
+        }
+
+        std::error_code ec;
+        event_.close(ec);    // closes event_fd_, if assigned
+
+        if (registered_buffers_ != nullptr)
+        {
+            ::munmap(registered_buffers_,
+                num_registered_buffers_ * registered_buffer_size_);
+        }
+        if (sqes_ != nullptr)
+        {
+            ::munmap(sqes_, sqes_size_);
+        }
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+        {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_ != nullptr)
+        {
+            ::munmap(sq_ring_, sq_ring_size_);
+        }
+        if (ring_fd_ != -1)
+        {
+            ::close(ring_fd_);
+        }
+    }
+
+    void io_uring_context::stop()
+    {
+        stopped_ = true;
+
+        std::error_code ec;
+        event_.cancel(ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_context::async_write(int fd,
+        std::vector<asio::const_buffer> const& buffers, handler_type handler)
+    {
+        auto op = std::make_unique<operation>(
+            operation::kind::write, fd, HPX_MOVE(handler));
+
+        op->iov_.reserve(buffers.size());
+        for (asio::const_buffer const& b : buffers)
+        {
+            if (b.size() != 0)
+            {
+                op->iov_.push_back(
+                    iovec{const_cast<void*>(b.data()), b.size()});
+                op->size_ += b.size();
+            }
+        }
+
+        start(HPX_MOVE(op));
+    }
+
+    void io_uring_context::async_read(int fd,
+        std::vector<asio::mutable_buffer> const& buffers, handler_type handler)
+    {
+        auto op = std::make_unique<operation>(
+            operation::kind::read, fd, HPX_MOVE(handler));
+
+        op->iov_.reserve(buffers.size());
+        for (asio::mutable_buffer const& b : buffers)
+        {
+            if (b.size() != 0)
+            {
+                op->iov_.push_back(iovec{b.data(), b.size()});
+                op->size_ += b.size();
+            }
+        }
+
+        start(HPX_MOVE(op));
+    }
+
+    void io_uring_context::start(std::unique_ptr<operation> op)
+    {
+        if (op->size_ == 0)
+        {
+            // nothing to do, complete asynchronously as asio would
+            asio::post(io_service_,
+                [handler = HPX_MOVE(op->handler_)]() mutable {
+                    handler(std::error_code(), 0);
+                });
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+
+            // small transfers are staged through a registered buffer
+            if (op->size_ <= registered_buffer_size_ && !free_slots_.empty())
+            {
+                op->slot_ = static_cast<std::int32_t>(free_slots_.back());
+                free_slots_.pop_back();
+            }
+
+            op->next_ = head_;
+            if (head_ != nullptr)
+            {
+                head_->prev_ = op.get();
+            }
+            head_ = op.get();
+        }
+
+        if (op->slot_ != -1 && op->kind_ == operation::kind::write)
+        {
+            char* data = registered_buffers_ +
+                static_cast<std::size_t>(op->slot_) * registered_buffer_size_;
+            for (iovec const& v : op->iov_)
+            {
+                std::memcpy(data, v.iov_base, v.iov_len);
+                data += v.iov_len;
+            }
+        }
+        else if (op->kind_ == operation::kind::write &&
+            zero_copy_threshold_ != 0 && op->size_ >= zero_copy_threshold_)
+        {
+            op->zero_copy_ = true;
+        }
+
+        submit(op.release());
+    }
+
+    void io_uring_context::submit(operation* op)
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+
+        std::uint32_t tail = *sq_tail_;
+        while (tail - load_acquire(sq_head_) == sq_entries_)
+        {
+            // the submission queue is full, hand its content to the kernel
+            flush();
+            if (tail - load_acquire(sq_head_) == sq_entries_)
+            {
+                l.unlock();
+                std::this_thread::yield();
+                l.lock();
+            }
+            tail = *sq_tail_;
+        }
+
+        std::uint32_t const idx = tail & sq_mask_;
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes_) + idx;
+        std::memset(sqe, 0, sizeof(*sqe));
+
+        sqe->fd = op->fd_;
+        sqe->user_data = reinterpret_cast<std::uint64_t>(op);
+
+        if (op->slot_ != -1)
+        {
+            char* data = registered_buffers_ +
+                static_cast<std::size_t>(op->slot_) * registered_buffer_size_;
+
+            sqe->opcode = op->kind_ == operation::kind::write ?
+                IORING_OP_WRITE_FIXED :
+                IORING_OP_READ_FIXED;
+            sqe->addr = reinterpret_cast<std::uint64_t>(
+                data + op->transferred_);
+            sqe->len = static_cast<std::uint32_t>(
+                op->size_ - op->transferred_);
+            sqe->buf_index = 0;
+        }
+        else
+        {
+            op->msg_.msg_iov = op->iov_.data() + op->first_;
+            op->msg_.msg_iovlen = op->iov_.size() - op->first_;
+
+            sqe->addr = reinterpret_cast<std::uint64_t>(&op->msg_);
+            sqe->len = 1;
+
+            if (op->kind_ == operation::kind::write)
+            {
+                sqe->msg_flags = MSG_NOSIGNAL;
+#if defined(HPX_PARCELPORT_TCP_IO_URING_SENDMSG_ZC)
+                sqe->opcode = op->zero_copy_ ? IORING_OP_SENDMSG_ZC :
+                                               IORING_OP_SENDMSG;
+#else
+                sqe->opcode = IORING_OP_SENDMSG;
+#endif
+            }
+            else
+            {
+                sqe->opcode = IORING_OP_RECVMSG;
+                sqe->msg_flags = MSG_WAITALL;
+            }
+        }
+
+        sq_array_[idx] = idx;
+        store_release(sq_tail_, tail + 1);
+        ++to_submit_;
+
+        // operations issued while handling completions are submitted together
+        // after all completions have been handled
+        if (reaping_context != this)
+        {
+            flush();
+        }
+    }
+
+    // the lock has to be held
+    void io_uring_context::flush()
+    {
+        while (to_submit_ != 0)
+        {
+            int const submitted = io_uring_enter(ring_fd_, to_submit_, 0, 0);
+            if (submitted < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+
+                // EAGAIN/EBUSY: the kernel is out of resources or the
+                // completion queue is full, retry later
+                break;
+            }
+            to_submit_ -= (std::min)(
+                to_submit_, static_cast<std::uint32_t>(submitted));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_context::wait_for_completions()
+    {
+        event_.async_wait(asio::posix::stream_descriptor::wait_read,
+            [this](auto const& ec) {
+                if (ec || stopped_)
+                {
+                    return;
+                }
+
+                std::uint64_t value = 0;
+                [[maybe_unused]] auto const r =
+                    ::read(event_fd_, &value, sizeof(value));
+
+                reaping_context = this;
+                reap_completions();
+                reaping_context = nullptr;
+
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    flush();
+                }
+
+                wait_for_completions();
+            });
+    }
+
+    void io_uring_context::reap_completions()
+    {
+        std::vector<operation*> completed;
+
+        std::uint32_t head = *cq_head_;
+        while (true)
+        {
+            std::uint32_t const tail = load_acquire(cq_tail_);
+            if (head == tail)
+            {
+                break;
+            }
+
+            for (/**/; head != tail; ++head)
+            {
+                io_uring_cqe const& cqe =
+                    static_cast<io_uring_cqe const*>(cqes_)[head & cq_mask_];
+
+                auto* op = reinterpret_cast<operation*>(cqe.user_data);
+                if (op != nullptr && handle_completion(op, cqe.res, cqe.flags))
+                {
+                    completed.push_back(op);
+                }
+            }
+            store_release(cq_head_, head);
+        }
+
+        if (completed.empty())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            for (operation* op : completed)
+            {
+                release_slot(op);
+
+                if (op->prev_ != nullptr)
+                    op->prev_->next_ = op->next_;
+                else
+                    head_ = op->next_;
+                if (op->next_ != nullptr)
+                    op->next_->prev_ = op->prev_;
+            }
+        }
+
+        for (operation* op : completed)
+        {
+            std::unique_ptr<operation> p(op);
+            if (!stopped_)
+            {
+                p->handler_(p->ec_, p->transferred_);
+            }
+        }
+    }
+
+    // returns whether the operation has completed
+    bool io_uring_context::handle_completion(
+        operation* op, int res, std::uint32_t flags)
+    {
+#if defined(HPX_PARCELPORT_TCP_IO_URING_SENDMSG_ZC)
+        if (flags & IORING_CQE_F_NOTIF)
+        {
+            // the kernel has released the buffers of a zero-copy send
+            HPX_ASSERT(op->pending_notifications_ != 0);
+            --op->pending_notifications_;
+            return op->completed_ && op->pending_notifications_ == 0;
+        }
+
+        if (flags & IORING_CQE_F_MORE)
+        {
+            // a notification will follow
+            ++op->pending_notifications_;
+        }
+#else
+        (void) flags;
+#endif
+
+        if (res < 0)
+        {
+            if (res == -EINTR || res == -EAGAIN)
+            {
+                submit(op);
+                return false;
+            }
+
+            if (op->zero_copy_ && (res == -EINVAL || res == -EOPNOTSUPP))
+            {
+                // zero-copy sends are not supported for this socket
+                zero_copy_threshold_ = 0;
+                op->zero_copy_ = false;
+                submit(op);
+                return false;
+            }
+
+            op->ec_ = make_error(res);
+        }
+        else if (res == 0)
+        {
+            op->ec_ = op->kind_ == operation::kind::read ?
+                asio::error::make_error_code(asio::error::eof) :
+                std::error_code(EPIPE, std::system_category());
+        }
+        else
+        {
+            op->advance(static_cast<std::size_t>(res));
+            if (op->transferred_ < op->size_)
+            {
+                // short transfer, continue with the remaining data
+                submit(op);
+                return false;
+            }
+
+            if (op->slot_ != -1 && op->kind_ == operation::kind::read)
+            {
+                char const* data = registered_buffers_ +
+                    static_cast<std::size_t>(op->slot_) *
+                        registered_buffer_size_;
+                for (iovec const& v : op->iov_)
+                {
+                    std::memcpy(v.iov_base, data, v.iov_len);
+                    data += v.iov_len;
+                }
+            }
+        }
+
+        op->completed_ = true;
+        return op->pending_notifications_ == 0;
+    }
+
+    // the lock has to be held
+    void io_uring_context::release_slot(operation* op)
+    {
+        if (op->slot_ != -1)
+        {
+            free_slots_.push_back(static_cast<std::uint32_t>(op->slot_));
+            op->slot_ = -1;
+        }
+    }
+}    // namespace hpx::parcelset::policies::tcp
+
+#endif
@@ -43,7 +43,19 @@ namespace hpx::traits {
 
         static constexpr char const* call() noexcept
         {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            return "io_uring = ${HPX_PARCEL_TCP_IO_URING:1}\n"
+                   "io_uring_queue_depth = "
+                   "${HPX_PARCEL_TCP_IO_URING_QUEUE_DEPTH:256}\n"
+                   "io_uring_registered_buffers = "
+                   "${HPX_PARCEL_TCP_IO_URING_REGISTERED_BUFFERS:64}\n"
+                   "io_uring_registered_buffer_size = "
+                   "${HPX_PARCEL_TCP_IO_URING_REGISTERED_BUFFER_SIZE:4096}\n"
+                   "io_uring_zero_copy_threshold = "
+                   "${HPX_PARCEL_TCP_IO_URING_ZERO_COPY_THRESHOLD:65536}\n";
+#else
             return "";
+#endif
         }
     };
 }    // namespace hpx::traits
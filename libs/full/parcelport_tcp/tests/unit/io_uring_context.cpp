@@ -0,0 +1,176 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Transfers data through the io_uring based reads and writes over a loopback
+// connection.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/parcelport_tcp/io_uring_context.hpp>
+
+#include <asio/buffer.hpp>
+#include <asio/io_context.hpp>
+#include <asio/ip/address_v4.hpp>
+#include <asio/ip/tcp.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <system_error>
+#include <vector>
+
+using hpx::parcelset::policies::tcp::io_uring_context;
+using hpx::parcelset::policies::tcp::io_uring_parameters;
+
+///////////////////////////////////////////////////////////////////////////////
+struct connection
+{
+    explicit connection(asio::io_context& io)
+      : acceptor(io,
+            asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0))
+      , client(io)
+      , server(io)
+    {
+        client.connect(acceptor.local_endpoint());
+        acceptor.accept(server);
+    }
+
+    asio::ip::tcp::acceptor acceptor;
+    asio::ip::tcp::socket client;
+    asio::ip::tcp::socket server;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_transfer(asio::io_context& io, io_uring_context& ctx)
+{
+    connection c(io);
+
+    // the sizes cover data copied through the registered buffers, data larger
+    // than a registered buffer, and data sent using zero-copy sends
+    for (std::size_t size : {std::size_t(3), std::size_t(100),
+             std::size_t(4000), std::size_t(70000), std::size_t(5 << 20)})
+    {
+        std::vector<char> header(8), data(size);
+        std::iota(header.begin(), header.end(), char(7));
+        std::iota(data.begin(), data.end(), char(1));
+
+        std::vector<char> received_header(header.size());
+        std::vector<char> received_data(size);
+
+        std::size_t const expected = header.size() + size;
+        int done = 0;
+
+        std::vector<asio::const_buffer> const write_buffers = {
+            asio::buffer(header), asio::buffer(data)};
+        ctx.async_write(c.client.native_handle(), write_buffers,
+            [&](std::error_code const& ec, std::size_t transferred) {
+                HPX_TEST(!ec);
+                HPX_TEST_EQ(transferred, expected);
+                ++done;
+            });
+
+        std::vector<asio::mutable_buffer> const read_buffers = {
+            asio::buffer(received_header), asio::buffer(received_data)};
+        ctx.async_read(c.server.native_handle(), read_buffers,
+            [&](std::error_code const& ec, std::size_t transferred) {
+                HPX_TEST(!ec);
+                HPX_TEST_EQ(transferred, expected);
+                ++done;
+            });
+
+        while (done != 2)
+        {
+            io.run_one();
+        }
+
+        HPX_TEST(received_header == header);
+        HPX_TEST(received_data == data);
+    }
+}
+
+void test_eof(asio::io_context& io, io_uring_context& ctx)
+{
+    connection c(io);
+
+    std::vector<char> data(10);
+    std::vector<asio::mutable_buffer> const read_buffers = {
+        asio::buffer(data)};
+
+    bool done = false;
+    ctx.async_read(c.server.native_handle(), read_buffers,
+        [&](std::error_code const& ec, std::size_t) {
+            HPX_TEST(ec == asio::error::make_error_code(asio::error::eof));
+            done = true;
+        });
+
+    c.client.shutdown(asio::ip::tcp::socket::shutdown_both);
+    while (!done)
+    {
+        io.run_one();
+    }
+}
+
+// destroying the context does not wait indefinitely for reads which never
+// complete, their handlers are not invoked
+void test_outstanding_read(asio::io_context& io)
+{
+    auto ctx = io_uring_context::create(io, io_uring_parameters());
+    HPX_TEST(ctx);
+
+    connection c(io);
+
+    std::vector<char> data(10);
+    std::vector<asio::mutable_buffer> const read_buffers = {
+        asio::buffer(data)};
+
+    bool invoked = false;
+    ctx->async_read(c.server.native_handle(), read_buffers,
+        [&](std::error_code const&, std::size_t) { invoked = true; });
+
+    auto const start = std::chrono::steady_clock::now();
+    ctx.reset();
+    HPX_TEST(std::chrono::steady_clock::now() - start <
+        std::chrono::seconds(10));
+
+    io.poll();
+    HPX_TEST(!invoked);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    asio::io_context io;
+
+    io_uring_parameters params;
+    params.zero_copy_threshold = 65536;
+
+    auto ctx = io_uring_context::create(io, params);
+    if (!ctx)
+    {
+        // the kernel does not support io_uring
+        std::cout << "io_uring is not available, skipping test\n";
+        return hpx::util::report_errors();
+    }
+
+    test_transfer(io, *ctx);
+    test_eof(io, *ctx);
+
+    ctx.reset();
+    test_outstanding_read(io);
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
@@ -32,6 +32,7 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -120,11 +121,13 @@ namespace hpx::parcelset {
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    // The buffer owner (if given) is kept alive by all de-serialized objects
+    // which refer to the buffer data in place.
     template <typename Parcelport, typename Buffer>
-    void decode_message_with_chunks(Parcelport& pp, Buffer buffer,
+    void decode_message_with_owner(Parcelport& pp, Buffer& buffer,
         std::size_t parcel_count,
         std::vector<serialization::serialization_chunk>& chunks,
-        std::size_t num_thread = -1)
+        std::size_t num_thread, std::shared_ptr<void const> owner)
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
             static_cast<std::uint64_t>(buffer.data_size_));
@@ -145,6 +148,7 @@ namespace hpx::parcelset {
                     // De-serialize the parcel data
                     serialization::input_archive archive(
                         buffer.data_, inbound_data_size, &chunks);
+                    archive.set_buffer_owner(HPX_MOVE(owner));
 
                     if (parcel_count == 0)
                     {
@@ -317,6 +321,16 @@ namespace hpx::parcelset {
         }
     }
 
+    template <typename Parcelport, typename Buffer>
+    void decode_message_with_chunks(Parcelport& pp, Buffer buffer,
+        std::size_t parcel_count,
+        std::vector<serialization::serialization_chunk>& chunks,
+        std::size_t num_thread = -1)
+    {
+        decode_message_with_owner(
+            pp, buffer, parcel_count, chunks, num_thread, nullptr);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message(Parcelport& pp, Buffer buffer, std::size_t parcel_count,
@@ -324,8 +338,21 @@ namespace hpx::parcelset {
     {
         std::vector<serialization::serialization_chunk> chunks(
             decode_chunks(buffer));
-        decode_message_with_chunks(
-            pp, HPX_MOVE(buffer), parcel_count, chunks, num_thread);
+
+        if (pp.allow_zero_copy_receive())
+        {
+            // the received data may be referred to in place, the buffer is
+            // kept alive for as long as this is the case (moving the buffer
+            // does not invalidate the chunks)
+            auto owner = std::make_shared<Buffer>(HPX_MOVE(buffer));
+            decode_message_with_owner(
+                pp, *owner, parcel_count, chunks, num_thread, owner);
+        }
+        else
+        {
+            decode_message_with_chunks(
+                pp, HPX_MOVE(buffer), parcel_count, chunks, num_thread);
+        }
     }
 
     template <typename Parcelport, typename Buffer>
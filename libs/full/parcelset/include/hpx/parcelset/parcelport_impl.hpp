@@ -175,6 +175,12 @@ namespace hpx::parcelset {
                 archive_flags_ = archive_flags_ |
                     int(serialization::archive_flags::disable_data_chunking);
             }
+
+            if (this->allow_zero_copy_receive())
+            {
+                archive_flags_ = archive_flags_ |
+                    int(serialization::archive_flags::enable_zero_copy_receive);
+            }
         }
 
         ~parcelport_impl() override
@@ -473,6 +473,17 @@ namespace hpx::parcelset::detail {
                 action_->get_parent_thread_id().get()));
 #endif
 
+        if (threads::tracing::is_enabled())
+        {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            std::uint64_t const parcel_id = data_.parcel_id_.get_lsb();
+#else
+            std::uint64_t const parcel_id = 0;
+#endif
+            threads::tracing::parcel_received(parcel_id, size_,
+                naming::get_locality_id_from_gid(data_.source_id_));
+        }
+
         return false;
     }
 
@@ -532,6 +532,17 @@ namespace hpx::parcelset {
             util::external_timer::send(
                 p.parcel_id().get_lsb(), p.size(), p.destination_locality_id());
 #endif
+
+            if (threads::tracing::is_enabled())
+            {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                std::uint64_t const parcel_id = p.parcel_id().get_lsb();
+#else
+                std::uint64_t const parcel_id = 0;
+#endif
+                threads::tracing::parcel_sent(
+                    parcel_id, p.size(), p.destination_locality_id());
+            }
         }
     }    // namespace detail
 
@@ -1330,6 +1341,8 @@ namespace hpx::parcelset {
         ini_defs.emplace_back(
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
             "$[hpx.parcel.array_optimization]}");
+        ini_defs.emplace_back(
+            "zero_copy_receive = ${HPX_PARCEL_ZERO_COPY_RECEIVE:0}");
         ini_defs.emplace_back(
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}");
 #if defined(HPX_HAVE_PARCEL_COALESCING)
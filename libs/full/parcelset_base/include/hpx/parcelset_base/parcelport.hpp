@@ -312,6 +312,10 @@ namespace hpx::parcelset {
         /// Return whether it is allowed to apply zero copy optimizations
         bool allow_zero_copy_optimizations() const noexcept;
 
+        /// Return whether received arrays may be referred to in place,
+        /// inside the received message buffers
+        bool allow_zero_copy_receive() const noexcept;
+
         bool async_serialization() const noexcept;
 
         // callback while bootstrap the parcel layer
@@ -354,6 +358,7 @@ namespace hpx::parcelset {
         /// serialization is allowed to use array optimization
         bool allow_array_optimizations_;
         bool allow_zero_copy_optimizations_;
+        bool allow_zero_copy_receive_;
 
         /// async serialization of parcels
         bool async_serialization_;
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/modules/functional.hpp>
 
+#include <cstddef>
 #include <system_error>
 
 namespace hpx::parcelset {
@@ -24,8 +25,13 @@ namespace hpx::parcelset {
     ///       parcel layer whenever a parcel has been sent by the underlying
     ///       networking library and if no explicit parcel handler function was
     ///       specified for the parcel.
+    ///
+    /// \note Write handlers usually bind a member function of the parcelport
+    ///       together with a couple of shared pointers, the embedded storage
+    ///       is large enough to hold those without allocating.
     using parcel_write_handler_type =
-        hpx::function<void(std::error_code const&, parcelset::parcel const&)>;
+        hpx::function<void(std::error_code const&, parcelset::parcel const&),
+            false, 6 * sizeof(void*)>;
 
     ////////////////////////////////////////////////////////////////////////
     /// Type of background work to perform
@@ -26,8 +26,7 @@ namespace hpx::parcelset::policies {
             flush_mode_buffer_full = 2
         };
 
-        using write_handler_type = hpx::function<void(
-            std::error_code const&, parcelset::parcel const&)>;
+        using write_handler_type = parcelset::parcel_write_handler_type;
 
         virtual ~message_handler() = default;
 
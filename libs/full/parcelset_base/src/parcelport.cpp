@@ -41,6 +41,7 @@ namespace hpx::parcelset {
       , max_outbound_message_size_(ini.get_max_outbound_message_size())
       , allow_array_optimizations_(true)
       , allow_zero_copy_optimizations_(true)
+      , allow_zero_copy_receive_(false)
       , async_serialization_(false)
       , priority_(hpx::util::get_entry_as<int>(
             ini, "hpx.parcel." + type + ".priority", 0))
@@ -63,6 +64,12 @@ namespace hpx::parcelset {
             {
                 allow_zero_copy_optimizations_ = false;
             }
+
+            if (hpx::util::get_entry_as<int>(
+                    ini, key + ".zero_copy_receive", 0) != 0)
+            {
+                allow_zero_copy_receive_ = true;
+            }
         }
 
         if (hpx::util::get_entry_as<int>(
@@ -362,6 +369,11 @@ namespace hpx::parcelset {
         return allow_zero_copy_optimizations_;
     }
 
+    bool parcelport::allow_zero_copy_receive() const noexcept
+    {
+        return allow_zero_copy_receive_;
+    }
+
     bool parcelport::async_serialization() const noexcept
     {
         return async_serialization_;
@@ -390,6 +402,17 @@ namespace hpx::parcelset {
         util::external_timer::send(
             p.parcel_id().get_lsb(), p.size(), p.destination_locality_id());
 #endif
+
+        if (threads::tracing::is_enabled())
+        {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            std::uint64_t const parcel_id = p.parcel_id().get_lsb();
+#else
+            std::uint64_t const parcel_id = 0;
+#endif
+            threads::tracing::parcel_sent(
+                parcel_id, p.size(), p.destination_locality_id());
+        }
     }
 
 }    // namespace hpx::parcelset
@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_arena.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -20,10 +21,16 @@
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/threading_base/stackless_leaf_tasks.hpp>
+#include <hpx/threading_base/thread_sampling.hpp>
+#include <hpx/util/regex_from_pattern.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <regex>
+#include <string>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::performance_counters::detail {
@@ -323,6 +330,31 @@ namespace hpx::performance_counters::detail {
                                     get_stack_unbind_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
 #endif
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+            // /threads{locality#%d/total}/count/stack-arena-reuses
+            {"count/stack-arena-reuses",
+                &threads::coroutines::detail::posix::
+                    get_stack_arena_reuse_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-arena-allocations
+            {"count/stack-arena-allocations",
+                &threads::coroutines::detail::posix::
+                    get_stack_arena_allocation_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-arena-regions
+            {"count/stack-arena-regions",
+                &threads::coroutines::detail::posix::
+                    get_stack_arena_region_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-arena-prefaults
+            {"count/stack-arena-prefaults",
+                &threads::coroutines::detail::posix::
+                    get_stack_arena_prefault_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+#endif
+            // /threads{locality#%d/total}/count/stackless-blocking
+            {"count/stackless-blocking", &threads::get_stackless_blocking_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
 
@@ -342,6 +374,127 @@ namespace hpx::performance_counters::detail {
         return naming::invalid_gid;
     }
 #endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // sampling profiler counter creation function
+    // /threads{locality#%d/total}/count/samples@<description>
+    naming::gid_type sampling_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "sampling_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        if (paths.instancename_ != "total" || paths.instanceindex_ != -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "sampling_counter_creator", "invalid counter instance name: {}",
+                paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        // an empty parameter refers to the samples of all descriptions
+        using detail::create_raw_counter;
+        hpx::function<std::int64_t(bool)> f = hpx::bind_front(
+            &threads::sampling::get_sample_count, paths.parameters_);
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+
+    // enumerate the descriptions samples were taken for
+    bool sampling_counter_discoverer(counter_info const& info,
+        discover_counter_func const& f, discover_counters_mode mode,
+        error_code& ec)
+    {
+        counter_path_elements p;
+        counter_status status =
+            get_counter_path_elements(info.fullname_, p, ec);
+        if (!status_is_valid(status))
+        {
+            return false;
+        }
+
+        if (p.parentinstancename_.empty())
+        {
+            p.parentinstancename_ = "locality#*";
+            p.parentinstanceindex_ = -1;
+        }
+
+        if (p.instancename_.empty())
+        {
+            p.instancename_ = "total";
+            p.instanceindex_ = -1;
+        }
+
+        std::vector<std::string> descriptions;
+        if (p.parameters_.find_first_of("*?[]") != std::string::npos)
+        {
+            std::string str_rx(util::regex_from_pattern(p.parameters_, ec));
+            if (ec)
+            {
+                return false;
+            }
+
+            std::regex rx(str_rx);
+            for (auto const& e : threads::sampling::get_histogram())
+            {
+                if (std::regex_match(e.first, rx))
+                {
+                    descriptions.push_back(e.first);
+                }
+            }
+        }
+        else
+        {
+            descriptions.push_back(p.parameters_);
+            if (p.parameters_.empty() &&
+                mode == discover_counters_mode::full)
+            {
+                for (auto const& e : threads::sampling::get_histogram())
+                {
+                    descriptions.push_back(e.first);
+                }
+            }
+        }
+
+        for (std::string const& description : descriptions)
+        {
+            counter_path_elements cp = p;
+            cp.parameters_ = description;
+
+            std::string fullname;
+            get_counter_name(cp, fullname, ec);
+            if (ec)
+            {
+                return false;
+            }
+
+            counter_info cinfo = info;
+            cinfo.fullname_ = HPX_MOVE(fullname);
+            if (!f(cinfo, ec) || ec)
+            {
+                return false;
+            }
+        }
+
+        if (&ec != &throws)
+        {
+            ec = make_success_code();
+        }
+        return true;
+    }
 }    // namespace hpx::performance_counters::detail
 
 namespace hpx::performance_counters {
@@ -610,6 +763,38 @@ namespace hpx::performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
 #endif
+#if defined(HPX_COROUTINES_HAVE_STACK_ARENA)
+            {"/threads/count/stack-arena-reuses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks reused from the "
+                "stack arena free lists for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-arena-allocations",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stacks carved from "
+                "stack arena regions for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-arena-regions",
+                counter_type::monotonically_increasing,
+                "returns the total number of memory regions mapped by the "
+                "stack arena for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-arena-prefaults",
+                counter_type::monotonically_increasing,
+                "returns the total number of pages faulted in up front while "
+                "mapping stack arena regions for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+#endif
+            {"/threads/count/stackless-blocking",
+                counter_type::monotonically_increasing,
+                "returns the total number of stackless HPX-threads which have "
+                "blocked their worker thread for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
@@ -695,7 +880,15 @@ namespace hpx::performance_counters {
                 hpx::bind_front(
                     &detail::locality_pool_thread_no_total_counter_creator, &tm,
                     &threads::thread_pool_base::get_busy_loop_count),
-                &locality_pool_thread_no_total_counter_discoverer, ""}
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // samples taken by the sampling profiler
+            {"/threads/count/samples", counter_type::monotonically_increasing,
+                "returns the number of samples taken by the sampling profiler "
+                "while an HPX-thread with the given description (or any "
+                "HPX-thread if no description is given) was running on the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, &detail::sampling_counter_creator,
+                &detail::sampling_counter_discoverer, ""}
         };
 
         install_counter_types(
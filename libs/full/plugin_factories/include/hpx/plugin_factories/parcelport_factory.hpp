@@ -111,6 +111,10 @@ namespace hpx::plugins {
                 name_uc +
                 "_ZERO_COPY_OPTIMIZATION:"
                 "$[hpx.parcel.zero_copy_optimization]}");
+            fillini.emplace_back("zero_copy_receive = ${HPX_PARCEL_" +
+                name_uc +
+                "_ZERO_COPY_RECEIVE:"
+                "$[hpx.parcel.zero_copy_receive]}");
             fillini.emplace_back(
                 "zero_copy_serialization_threshold = ${HPX_PARCEL_" + name_uc +
                 "_ZERO_COPY_SERIALIZATION_THRESHOLD:"
@@ -648,6 +648,11 @@ namespace hpx {
             io_pool_.clear();
         }
 #endif
+
+        // all worker threads have exited, write the task trace and the
+        // samples
+        deinit_tracing();
+        deinit_sampling();
     }
 
     int runtime_distributed::finalize(double shutdown_timeout)
@@ -106,6 +106,65 @@ void handle_values_tests_distributed_access(hpx::partitioned_vector<T>& v)
     compare_vectors(values2, result2);
 }
 
+template <typename T>
+void handle_values_tests_random_access(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    // positions alternating between the first and the last partitions
+    std::vector<std::size_t> positions;
+    for (std::size_t i = 0; i != v.size() / 2; ++i)
+    {
+        positions.push_back(v.size() - i - 1);
+        positions.push_back(i);
+    }
+
+    std::vector<T> values(positions.size());
+    fill_vector(values, T(1), T(1));
+
+    v.set_values(hpx::launch::sync, positions, values);
+    compare_vectors(values, v.get_values(hpx::launch::sync, positions));
+
+    for (std::size_t i = 0; i != positions.size(); ++i)
+    {
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, positions[i]), values[i]);
+    }
+}
+
+template <typename T>
+void handle_values_tests_cached(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    std::vector<std::size_t> positions(v.size());
+    fill_vector(positions, std::size_t(0), std::size_t(1));
+
+    HPX_TEST(!v.is_cache_enabled());
+    v.enable_cache();
+    HPX_TEST(v.is_cache_enabled());
+
+    std::vector<T> values(v.size(), T(42));
+    compare_vectors(values, v.get_values(hpx::launch::sync, positions));
+
+    // writes through the vector invalidate the cached partition
+    v.set_value(hpx::launch::sync, 0, T(43));
+    v.set_value(hpx::launch::sync, v.size() - 1, T(44));
+    HPX_TEST_EQ(v.get_value(hpx::launch::sync, 0), T(43));
+    HPX_TEST_EQ(v.get_value(0).get(), T(43));
+    HPX_TEST_EQ(v.get_value(hpx::launch::sync, v.size() - 1), T(44));
+
+    // modifications bypassing the vector require explicit invalidation
+    fill_vector(v, T(45));
+    v.invalidate_cache();
+
+    values.assign(v.size(), T(45));
+    compare_vectors(values, v.get_values(positions).get());
+
+    v.disable_cache();
+    HPX_TEST(!v.is_cache_enabled());
+    compare_vectors(values, v.get_values(hpx::launch::sync, positions));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename DistPolicy>
@@ -121,6 +180,16 @@ void handle_values_tests_with_policy(
         hpx::partitioned_vector<T> v(size, policy);
         handle_values_tests_distributed_access(v);
     }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_random_access(v);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_cached(v);
+    }
 }
 
 template <typename T>
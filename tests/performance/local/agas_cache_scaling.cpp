@@ -0,0 +1,225 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of the AGAS object cache when being
+// accessed concurrently from a growing number of worker threads. It compares
+// an lru_cache protected by a single spinlock (the way the addressing service
+// used to protect all of its cache entries) with the sharded
+// concurrent_lru_cache.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/cache/concurrent_lru_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using statistics_type = hpx::util::cache::statistics::local_full_statistics;
+
+struct locked_cache
+{
+    using cache_type = hpx::util::cache::lru_cache<hpx::naming::gid_type,
+        hpx::agas::gva, statistics_type>;
+
+    explicit locked_cache(std::size_t cache_size)
+      : cache_(cache_size)
+    {
+    }
+
+    bool get_entry(hpx::naming::gid_type const& key, hpx::agas::gva& value)
+    {
+        hpx::naming::gid_type realkey;
+
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        return cache_.get_entry(key, realkey, value);
+    }
+
+    void update(hpx::naming::gid_type const& key, hpx::agas::gva const& value)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx_);
+        cache_.update(key, value);
+    }
+
+    hpx::spinlock mtx_;
+    cache_type cache_;
+};
+
+struct concurrent_cache
+{
+    using cache_type =
+        hpx::util::cache::concurrent_lru_cache<hpx::naming::gid_type,
+            hpx::agas::gva, statistics_type>;
+
+    explicit concurrent_cache(std::size_t cache_size)
+      : cache_(cache_size)
+    {
+    }
+
+    bool get_entry(hpx::naming::gid_type const& key, hpx::agas::gva& value)
+    {
+        return cache_.get_entry(key, value);
+    }
+
+    void update(hpx::naming::gid_type const& key, hpx::agas::gva const& value)
+    {
+        cache_.update(key, value);
+    }
+
+    cache_type cache_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct benchmark_params
+{
+    std::size_t cache_size;
+    std::size_t num_operations;
+    std::size_t update_percentage;
+};
+
+// Every thread performs a mix of lookups and updates on randomly selected
+// keys, similar to what resolve_cached does. Returns the elapsed time.
+template <typename Cache>
+double run_benchmark(Cache& cache,
+    std::vector<hpx::naming::gid_type> const& keys, std::size_t num_threads,
+    benchmark_params const& params)
+{
+    hpx::agas::gva const value(hpx::get_locality(),
+        hpx::components::component_invalid, 1, std::uint64_t(0), 0);
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> workers;
+    workers.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        workers.push_back(hpx::async([&, i]() {
+            std::uint64_t state = i + 1;
+            for (std::size_t j = 0; j != params.num_operations; ++j)
+            {
+                // xorshift random number generator
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                hpx::naming::gid_type const& key = keys[state % keys.size()];
+
+                hpx::agas::gva g;
+                if ((state >> 32) % 100 < params.update_percentage ||
+                    !cache.get_entry(key, g))
+                {
+                    cache.update(key, value);
+                }
+            }
+        }));
+    }
+    hpx::wait_all(workers);
+
+    return t.elapsed();
+}
+
+template <typename Cache>
+void benchmark_cache(char const* name,
+    std::vector<hpx::naming::gid_type> const& keys,
+    benchmark_params const& params)
+{
+    hpx::agas::gva const value(hpx::get_locality(),
+        hpx::components::component_invalid, 1, std::uint64_t(0), 0);
+
+    std::size_t const max_threads = hpx::get_num_worker_threads();
+    for (std::size_t num_threads = 1; num_threads <= max_threads;
+         num_threads *= 2)
+    {
+        Cache cache(params.cache_size);
+        for (auto const& key : keys)
+        {
+            cache.update(key, value);
+        }
+
+        double const elapsed = run_benchmark(cache, keys, num_threads, params);
+        double const total_operations =
+            static_cast<double>(num_threads * params.num_operations);
+
+        std::cout << name << "," << num_threads << ","
+                  << total_operations / elapsed / 1e6 << std::endl;
+
+        if (num_threads * 2 > max_threads)
+        {
+            hpx::util::print_cdash_timing(
+                (std::string("AGASCacheScaling_") + name).c_str(), elapsed);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    benchmark_params params;
+    params.cache_size = vm["cache_size"].as<std::size_t>();
+    params.num_operations = vm["num_operations"].as<std::size_t>();
+    params.update_percentage = vm["update_percentage"].as<std::size_t>();
+
+    std::size_t const num_entries = vm["num_entries"].as<std::size_t>();
+
+    // the keys refer to consecutive objects
+    hpx::naming::gid_type const first_key =
+        hpx::detail::get_next_id(num_entries);
+
+    std::vector<hpx::naming::gid_type> keys;
+    keys.reserve(num_entries);
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        keys.push_back(first_key + i);
+    }
+
+    std::cout << "cache,threads,throughput (Mops/s)" << std::endl;
+
+    benchmark_cache<locked_cache>("locked_lru_cache", keys, params);
+    benchmark_cache<concurrent_cache>("concurrent_lru_cache", keys, params);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("cache_size",
+         value<std::size_t>()->default_value(HPX_AGAS_LOCAL_CACHE_SIZE),
+         "maximal number of entries held by the cache")
+        ("num_entries,n",
+         value<std::size_t>()->default_value(4096),
+         "number of distinct keys accessed by the benchmark")
+        ("num_operations",
+         value<std::size_t>()->default_value(100000),
+         "number of cache operations performed by each thread")
+        ("update_percentage",
+         value<std::size_t>()->default_value(5),
+         "percentage of operations updating an existing entry");
+    // clang-format on
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
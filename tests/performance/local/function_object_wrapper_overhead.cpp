@@ -8,14 +8,18 @@
 // make inspect happy: hpxinspect:nodeprecatedinclude hpxinspect:nodeprecatedname
 
 #include <hpx/functional/function.hpp>
+#include <hpx/functional/move_only_function.hpp>
 #include <hpx/hpx.hpp>
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/modules/program_options.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <utility>
 
 #include "worker_timed.hpp"
 
@@ -55,6 +59,41 @@ void run(F const& f, std::uint64_t local_iterations)
     std::cout << " walltime/iteration: " << ((elapsed / i) * 1e9) << " ns\n";
 }
 
+// mimics the callables typically created for continuations: a shared
+// pointer to some state plus a couple of indices
+struct continuation_like
+{
+    void operator()() const
+    {
+        *p += i + j;
+    }
+
+    std::shared_ptr<std::uint64_t> p;
+    std::size_t i;
+    std::size_t j;
+};
+
+// measures the cost of creating, moving, invoking and destroying a function
+// object wrapping a continuation-like callable
+template <typename Function>
+void run_construct(std::uint64_t local_iterations)
+{
+    auto p = std::make_shared<std::uint64_t>(0);
+
+    std::uint64_t i = 0;
+    hpx::chrono::high_resolution_timer t;
+
+    for (; i < local_iterations; ++i)
+    {
+        Function f = continuation_like{p, i, 1};
+        Function g = std::move(f);
+        g();
+    }
+
+    double elapsed = t.elapsed();
+    std::cout << " walltime/iteration: " << ((elapsed / i) * 1e9) << " ns\n";
+}
+
 int app_main(variables_map& vm)
 {
     {
@@ -78,6 +117,24 @@ int app_main(variables_map& vm)
         run(f, iterations);
     }
 
+    // construction overhead depending on the size of the embedded storage
+    {
+        std::cout << "hpx::move_only_function (default storage, "
+                  << hpx::util::detail::function_storage_size << " bytes)";
+        run_construct<hpx::move_only_function<void()>>(iterations);
+    }
+    {
+        constexpr std::size_t storage_size = 6 * sizeof(void*);
+        std::cout << "hpx::move_only_function (" << storage_size
+                  << " bytes storage)";
+        run_construct<hpx::move_only_function<void(), false, storage_size>>(
+            iterations);
+    }
+    {
+        std::cout << "std::function (construction)";
+        run_construct<std::function<void()>>(iterations);
+    }
+
     return 0;
 }
 
@@ -198,6 +198,31 @@ void measure_function_futures_wait_all(
     print_stats("async", "WaitAll", exec_name(exec), count, duration, csv);
 }
 
+// Time attaching chains of continuations to promises and running them
+void measure_function_futures_continuation_chain(std::uint64_t count, bool csv)
+{
+    constexpr std::uint64_t chain_length = 100;
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; i += chain_length)
+    {
+        hpx::promise<double> p;
+        future<double> f = p.get_future();
+        for (std::uint64_t j = i; j < count && j < i + chain_length; ++j)
+        {
+            f = f.then(hpx::launch::sync,
+                [](future<double>&& f) { return f.get() + null_function(); });
+        }
+        p.set_value(0.0);
+        f.get();
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then", "Chain", "sync", count, duration, csv);
+}
+
 template <typename Executor>
 void measure_function_futures_limiting_executor(
     std::uint64_t count, bool csv, Executor exec)
@@ -526,6 +551,7 @@ int hpx_main(variables_map& vm)
 #endif
                 measure_function_futures_wait_each(count, csv, par);
                 measure_function_futures_wait_all(count, csv, par);
+                measure_function_futures_continuation_chain(count, csv);
                 measure_function_futures_sliding_semaphore(count, csv, par);
                 measure_function_futures_for_loop(count, csv, par);
                 measure_function_futures_for_loop(count, csv, sched_exec_tps);
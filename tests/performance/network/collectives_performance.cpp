@@ -0,0 +1,301 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the root-site based collective operations with the
+// point-to-point algorithms available for channel communicators (flat,
+// binomial tree, recursive doubling, ring). Every locality simulates
+// --sites-per-locality sites, which allows to exercise larger site counts on
+// a small number of localities.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/collectives.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+using payload_type = std::vector<double>;
+
+struct elementwise_plus
+{
+    payload_type operator()(payload_type lhs, payload_type const& rhs) const
+    {
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    }
+};
+
+struct benchmark_params
+{
+    std::size_t iterations;
+    std::size_t payload_size;
+    std::size_t sites_per_locality;
+    std::size_t num_sites;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// run the given operation concurrently for all local sites, returns the
+// elapsed time per iteration
+template <typename F>
+double run_local_sites(benchmark_params const& params, F&& f)
+{
+    std::size_t const first_site =
+        hpx::get_locality_id() * params.sites_per_locality;
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(params.sites_per_locality);
+    for (std::size_t i = 0; i != params.sites_per_locality; ++i)
+    {
+        sites.push_back(hpx::async(f, first_site + i));
+    }
+    hpx::wait_all(sites);
+
+    return t.elapsed() / static_cast<double>(params.iterations);
+}
+
+void print_result(char const* operation, char const* algorithm,
+    benchmark_params const& params, double elapsed)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        hpx::cout << operation << "," << algorithm << "," << params.num_sites
+                  << "," << params.payload_size * sizeof(double) << ","
+                  << elapsed * 1e6 << "\n"
+                  << std::flush;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// baseline: all operations funnel through a single root site
+void benchmark_root_communicator(benchmark_params const& params)
+{
+    static std::size_t count = 0;
+    std::string const basename =
+        "/benchmark/collectives/root/" + std::to_string(++count);
+
+    double elapsed = run_local_sites(params, [&](std::size_t site) {
+        communicator comm = create_communicator(basename.c_str(),
+            num_sites_arg(params.num_sites), this_site_arg(site));
+
+        payload_type value(params.payload_size, 1.0);
+        for (std::size_t i = 0; i != params.iterations; ++i)
+        {
+            all_reduce(comm, value, elementwise_plus{}, this_site_arg(site),
+                generation_arg(i + 1))
+                .get();
+        }
+    });
+    print_result("all_reduce", "root", params, elapsed);
+
+    elapsed = run_local_sites(params, [&](std::size_t site) {
+        std::string const name = basename + "/broadcast";
+        communicator comm = create_communicator(name.c_str(),
+            num_sites_arg(params.num_sites), this_site_arg(site));
+
+        for (std::size_t i = 0; i != params.iterations; ++i)
+        {
+            if (site == 0)
+            {
+                broadcast_to(comm, payload_type(params.payload_size, 1.0),
+                    this_site_arg(site), generation_arg(i + 1))
+                    .get();
+            }
+            else
+            {
+                broadcast_from<payload_type>(
+                    comm, this_site_arg(site), generation_arg(i + 1))
+                    .get();
+            }
+        }
+    });
+    print_result("broadcast", "root", params, elapsed);
+
+    elapsed = run_local_sites(params, [&](std::size_t site) {
+        std::string const name = basename + "/all_gather";
+        communicator comm = create_communicator(name.c_str(),
+            num_sites_arg(params.num_sites), this_site_arg(site));
+
+        payload_type value(params.payload_size, 1.0);
+        for (std::size_t i = 0; i != params.iterations; ++i)
+        {
+            all_gather(comm, value, this_site_arg(site), generation_arg(i + 1))
+                .get();
+        }
+    });
+    print_result("all_gather", "root", params, elapsed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool is_power_of_two(std::size_t n)
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+void benchmark_channel_communicator(benchmark_params const& params,
+    collective_algorithm algorithm, char const* algorithm_name)
+{
+    static std::size_t count = 0;
+    std::string const basename =
+        "/benchmark/collectives/channel/" + std::to_string(++count);
+
+    // create all communicators up front to exclude the setup from the timings
+    std::size_t const first_site =
+        hpx::get_locality_id() * params.sites_per_locality;
+
+    std::vector<hpx::future<channel_communicator>> comm_futures;
+    comm_futures.reserve(params.sites_per_locality);
+    for (std::size_t i = 0; i != params.sites_per_locality; ++i)
+    {
+        comm_futures.push_back(create_channel_communicator(basename.c_str(),
+            num_sites_arg(params.num_sites), this_site_arg(first_site + i)));
+    }
+    std::vector<channel_communicator> comms = hpx::unwrap(comm_futures);
+
+    auto local_comm = [&](std::size_t site) -> channel_communicator& {
+        return comms[site - first_site];
+    };
+
+    // the generation is used to separate the different operations on the
+    // same communicator
+    std::size_t generation = 0;
+
+    if (algorithm != collective_algorithm::ring)
+    {
+        double elapsed = run_local_sites(params, [&](std::size_t site) {
+            payload_type value(params.payload_size, 1.0);
+            for (std::size_t i = 0; i != params.iterations; ++i)
+            {
+                all_reduce(local_comm(site), value, elementwise_plus{},
+                    generation_arg(generation + i + 1),
+                    algorithm_arg(algorithm))
+                    .get();
+            }
+        });
+        generation += params.iterations;
+        print_result("all_reduce", algorithm_name, params, elapsed);
+    }
+
+    if (algorithm == collective_algorithm::flat ||
+        algorithm == collective_algorithm::binomial_tree)
+    {
+        double elapsed = run_local_sites(params, [&](std::size_t site) {
+            for (std::size_t i = 0; i != params.iterations; ++i)
+            {
+                if (site == 0)
+                {
+                    broadcast_to(local_comm(site),
+                        payload_type(params.payload_size, 1.0),
+                        generation_arg(generation + i + 1),
+                        algorithm_arg(algorithm))
+                        .get();
+                }
+                else
+                {
+                    broadcast_from<payload_type>(local_comm(site),
+                        root_site_arg(0), generation_arg(generation + i + 1),
+                        algorithm_arg(algorithm))
+                        .get();
+                }
+            }
+        });
+        generation += params.iterations;
+        print_result("broadcast", algorithm_name, params, elapsed);
+    }
+
+    if (algorithm != collective_algorithm::recursive_doubling ||
+        is_power_of_two(params.num_sites))
+    {
+        double elapsed = run_local_sites(params, [&](std::size_t site) {
+            payload_type value(params.payload_size, 1.0);
+            for (std::size_t i = 0; i != params.iterations; ++i)
+            {
+                all_gather(local_comm(site), value,
+                    generation_arg(generation + i + 1),
+                    algorithm_arg(algorithm))
+                    .get();
+            }
+        });
+        generation += params.iterations;
+        print_result("all_gather", algorithm_name, params, elapsed);
+    }
+
+    // make sure no site releases its communicator while others still use it
+    hpx::distributed::barrier::synchronize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    benchmark_params params;
+    params.iterations = vm["iterations"].as<std::size_t>();
+    params.payload_size = vm["payload-size"].as<std::size_t>();
+    params.sites_per_locality = vm["sites-per-locality"].as<std::size_t>();
+    params.num_sites =
+        hpx::get_num_localities(hpx::launch::sync) * params.sites_per_locality;
+
+    if (hpx::get_locality_id() == 0)
+    {
+        hpx::cout << "operation,algorithm,sites,payload (bytes),"
+                     "time per operation (us)\n"
+                  << std::flush;
+    }
+
+    benchmark_root_communicator(params);
+    hpx::distributed::barrier::synchronize();
+
+    benchmark_channel_communicator(params, collective_algorithm::flat, "flat");
+    benchmark_channel_communicator(
+        params, collective_algorithm::binomial_tree, "binomial_tree");
+    benchmark_channel_communicator(
+        params, collective_algorithm::recursive_doubling, "recursive_doubling");
+    benchmark_channel_communicator(params, collective_algorithm::ring, "ring");
+    benchmark_channel_communicator(
+        params, collective_algorithm::automatic, "automatic");
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(100),
+         "number of times to repeat each collective operation")
+        ("payload-size",
+         hpx::program_options::value<std::size_t>()->default_value(1),
+         "number of doubles contributed by each site")
+        ("sites-per-locality",
+         hpx::program_options::value<std::size_t>()->default_value(1),
+         "number of sites simulated on each locality");
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif